@@ -25,6 +25,9 @@ class LLBC_Socket;
 class LLBC_Session;
 class LLBC_IService;
 class LLBC_PollerMgr;
+class LLBC_PollerStat;
+struct LLBC_SendLanePolicy;
+struct LLBC_RecvLimitPolicy;
 
 __LLBC_NS_END
 
@@ -81,6 +84,48 @@ public:
      */
     void SetPollerMgr(LLBC_PollerMgr *mgr);
 
+    /**
+     * Set poller NUMA node, poller buffers will prefer to allocate on this node.
+     * @param[in] node - the NUMA node, -1 means not specific.
+     */
+    void SetNUMANode(int node);
+
+    /**
+     * Set poller busy poll mode, must call before start.
+     * In busy poll mode, poller threads wait events with zero timeout, and fallback to
+     * blocking wait after idle idleUSecs micro-seconds, any event will switch back to busy polling.
+     * @param[in] idleUSecs - the busy poll idle time, in micro-seconds, <= 0 means disable busy poll.
+     */
+    void SetBusyPoll(int idleUSecs);
+
+    /**
+     * Set poller send cork mode, must call before start.
+     * In send cork mode, sessions send data corked until service frame end(flush sends event)
+     * or flush now packet sent, see LLBC_IService::SetSendCork().
+     * @param[in] cork - send cork flag.
+     */
+    void SetSendCork(bool cork);
+
+    /**
+     * Set poller created sessions' send lanes policy, must call before start, see LLBC_IService::SetSendLanePolicy().
+     * @param[in] policy - the send lanes policy, owned by service, NULL means disable send lanes.
+     */
+    void SetSendLanePolicy(const LLBC_SendLanePolicy *policy);
+
+    /**
+     * Set poller created sessions' receive rate limit policy, must call before start, see LLBC_IService::SetRecvLimitPolicy().
+     * @param[in] policy - the receive limit policy, owned by service, NULL means not limit.
+     */
+    void SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy);
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    /**
+     * Set poller statistic collector.
+     * @param[in] stat - the poller stat, owned by poller manager.
+     */
+    void SetStat(LLBC_PollerStat *stat);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 public:
     /**
      * Startup poller to work.
@@ -98,23 +143,87 @@ public:
      */
     virtual void Cleanup();
 
+#if LLBC_CFG_COMM_ENABLE_UDP
+public:
+    /**
+     * Send datagram, only support in datagram supported poller.
+     * Note: No matter method call success or not, method will steal <block> the parameter.
+     * @param[in] session - the datagram session.
+     * @param[in] block   - the datagram block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SendDatagram(LLBC_Session *session, LLBC_MessageBlock *block);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
 protected:
     /**
      * Handle queued events.
+     * @param[in] waitTime - the first event wait time, in milli-seconds.
+     * @return bool - return true if handled any event, otherwise return false.
      */
-    virtual void HandleQueuedEvents(int waitTime);
+    virtual bool HandleQueuedEvents(int waitTime);
     virtual void HandleEv_AddSock(LLBC_PollerEvent &ev);
     virtual void HandleEv_AsyncConn(LLBC_PollerEvent &ev);
     virtual void HandleEv_Send(LLBC_PollerEvent &ev);
     virtual void HandleEv_Close(LLBC_PollerEvent &ev);
     virtual void HandleEv_Monitor(LLBC_PollerEvent &ev);
     virtual void HandleEv_TakeOverSession(LLBC_PollerEvent &ev);
+    virtual void HandleEv_FlushSends(LLBC_PollerEvent &ev);
+
+    /**
+     * Flush session corked send data, after flushed, session maybe closed(send failed).
+     * @param[in] session - the corked session.
+     */
+    virtual void FlushCorkedSession(LLBC_Session *session);
+
+    /**
+     * Pause session receive, call by session when receive rate limited(Delay action), poller
+     * stop reading session socket until session delayed packets released.
+     * Poller not support pause reading(eg: SelectPoller) keep reading, exceed delayed packets will be dropped.
+     * @param[in] session - the session.
+     */
+    virtual void PauseSessionRecv(LLBC_Session *session);
+
+    /**
+     * Resume session receive, call after session delayed packets all released, after resumed, session maybe closed.
+     * @param[in] session - the session.
+     */
+    virtual void ResumeSessionRecv(LLBC_Session *session);
+
+    /**
+     * Release receive paused sessions' delayed packets, and resume sessions receive if delayed packets all released.
+     */
+    void HandleRecvPausedSessions();
+
+    /**
+     * Get poller wait timeout, in busy poll mode, return 0 until poller idle busy poll idle time.
+     * @param[in] blockingTimeout - the blocking wait timeout, in milli-seconds.
+     * @return int - the wait timeout, in milli-seconds.
+     */
+    int GetWaitTimeout(int blockingTimeout) const;
+
+    /**
+     * Mark poller busy(got events), in busy poll mode, will keep poller busy polling.
+     */
+    void MarkBusy();
+
+    /**
+     * Busy poll wait no events, relax CPU if waited with zero timeout.
+     * @param[in] waitTimeout - the wait timeout, in milli-seconds.
+     */
+    static void BusyPollRelax(int waitTimeout);
 
     /**
      * Create new session from socket.
      */
     LLBC_Session *CreateSession(LLBC_Socket *socket, int sessionId = 0);
 
+    /**
+     * Allocate session Id which hash to self poller.
+     * @return int - the new session Id.
+     */
+    int AllocSelfSessionId();
+
 protected:
     /**
      * Add session to poller.
@@ -149,6 +258,7 @@ private:
      * Access method list:
      *      AddSession(LLBC_Session *)
      *      RemoveSession(LLBC_Session *)
+     *      PauseSessionRecv(LLBC_Session *)
      */
     friend class LLBC_Session;
 
@@ -160,6 +270,17 @@ protected:
     int _brotherCount;
     LLBC_IService *_svc;
     LLBC_PollerMgr *_pollerMgr;
+    int _numaNode;
+    int _busyPollIdleUSecs;
+    volatile sint64 _busyPollActiveTime;
+    bool _sendCork;
+    std::vector<int> _corkedSessions;
+    const LLBC_SendLanePolicy *_sendLanePolicy;
+    const LLBC_RecvLimitPolicy *_recvLimitPolicy;
+    std::vector<int> _recvPausedSessions;
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_PollerStat *_stat;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
     
     typedef std::map<LLBC_SocketHandle, LLBC_Session *> _Sockets;
     _Sockets _sockets;
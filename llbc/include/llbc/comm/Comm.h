@@ -19,8 +19,11 @@
 #include "llbc/comm/ICoder.h"
 #include "llbc/comm/IFacade.h"
 #include "llbc/comm/PollerType.h"
+#include "llbc/comm/SendLane.h"
+#include "llbc/comm/RecvLimit.h"
 #include "llbc/comm/BasePoller.h"
 #include "llbc/comm/IService.h"
+#include "llbc/comm/ServiceStat.h"
 #include "llbc/comm/ServiceMgr.h"
 #include "llbc/comm/PacketHeaderParts.h"
 #include "llbc/comm/LibPacketHeaderDescFactory.h"
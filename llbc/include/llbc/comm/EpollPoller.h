@@ -54,6 +54,18 @@ public:
      */
     virtual void Cleanup();
 
+#if LLBC_CFG_COMM_ENABLE_UDP
+public:
+    /**
+     * Send datagram, datagrams will queued and batch send(sendmmsg) when queued events drained.
+     * Note: No matter method call success or not, method will steal <block> the parameter.
+     * @param[in] session - the datagram session.
+     * @param[in] block   - the datagram block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SendDatagram(LLBC_Session *session, LLBC_MessageBlock *block);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
 protected:
     /**
      * Queued event handlers.
@@ -65,6 +77,11 @@ protected:
     virtual void HandleEv_Monitor(LLBC_PollerEvent &ev);
     virtual void HandleEv_TakeOverSession(LLBC_PollerEvent &ev);
 
+    /**
+     * Resume session receive, edge triggered readable event not notify again, read remain data directly.
+     */
+    virtual void ResumeSessionRecv(LLBC_Session *session);
+
     /**
      * Add session to poller.
      */
@@ -94,18 +111,109 @@ private:
     /**
      * Handle connecting sockets.
      */
-    bool HandleConnecting(LLBC_SocketHandle handle, int events);
+    void HandleConnecting(LLBC_SocketHandle handle, int events);
+
+    /**
+     * Bind socket handle's fd slot, all previous bound readiness events of this handle will become stale.
+     * @param[in] handle     - the socket handle.
+     * @param[in] session    - the session, NULL if is connecting socket.
+     * @param[in] connecting - connecting socket flag.
+     * @return uint64 - the epoll event data, (slot tag << 32) | handle.
+     */
+    uint64 BindFdSlot(LLBC_SocketHandle handle, LLBC_Session *session, bool connecting);
+
+    /**
+     * Unbind socket handle's fd slot, all queued readiness events of this handle will be discarded.
+     * @param[in] handle - the socket handle.
+     */
+    void UnbindFdSlot(LLBC_SocketHandle handle);
 
     /**
      * Accept new session.
      */
     void Accept(LLBC_Session *session);
 
+#if LLBC_CFG_COMM_ENABLE_UDP
+private:
+    /**
+     * Batch receive(recvmmsg) datagrams.
+     */
+    void RecvDatagrams(LLBC_Session *session);
+
+    /**
+     * Get or create the listen datagram socket's peer pseudo-session.
+     */
+    LLBC_Session *AcceptDatagramPeer(LLBC_Session *listenSession, const sockaddr_in &addr);
+
+    /**
+     * Batch send(sendmmsg) all queued datagrams.
+     */
+    void FlushDatagrams();
+
+    /**
+     * Discard specified socket's all queued datagrams.
+     */
+    void DiscardDatagrams(LLBC_SocketHandle handle);
+
+    /**
+     * Remove datagram session, if is listen session, all peer pseudo-sessions will be closed.
+     */
+    void RemoveDatagramSession(LLBC_Session *session);
+
+    /**
+     * Close all idle timeout datagram peer pseudo-sessions.
+     */
+    void CheckDatagramPeersTimeout();
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
 private:
     LLBC_Handle _epoll;
     LLBC_PollerMonitor *_monitor;
 
     LLBC_EpollEvent _events[LLBC_CFG_COMM_MAX_EVENT_COUNT];
+
+    // The socket handle indexed fd slots, readiness events carry (slot tag << 32) | handle,
+    // queued event is stale if tag mismatch(socket removed or handle reused after epoll_wait).
+    struct _FdSlot
+    {
+        uint32 tag; // (generation << 1) | connecting flag, 0 if slot not in use.
+        LLBC_Session *session;
+    };
+
+    std::vector<_FdSlot> _fdSlots;
+    uint32 _fdGeneration;
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    struct _DgramPeer
+    {
+        LLBC_Session *session;
+        sint64 lastActiveTime;
+    };
+
+    // Listen datagram socket handle -> (peer ip << 16 | peer port) -> peer pseudo-session.
+    typedef std::map<uint64, _DgramPeer> _DgramPeers;
+    typedef std::map<LLBC_SocketHandle, _DgramPeers> _DgramListens;
+    _DgramListens _dgramListens;
+    sint64 _dgramLastCheckTime;
+
+    struct _DgramSend
+    {
+        LLBC_SocketHandle handle;
+        bool hasPeer;
+        sockaddr_in peer;
+        LLBC_MessageBlock *block;
+    };
+
+    int _dgramSendCount;
+    _DgramSend _dgramSends[LLBC_CFG_COMM_UDP_BATCH_SIZE];
+    struct mmsghdr _dgramSendMsgs[LLBC_CFG_COMM_UDP_BATCH_SIZE];
+    struct iovec _dgramSendIovs[LLBC_CFG_COMM_UDP_BATCH_SIZE];
+
+    char *_dgramRecvBuf;
+    sockaddr_in _dgramRecvAddrs[LLBC_CFG_COMM_UDP_BATCH_SIZE];
+    struct mmsghdr _dgramRecvMsgs[LLBC_CFG_COMM_UDP_BATCH_SIZE];
+    struct iovec _dgramRecvIovs[LLBC_CFG_COMM_UDP_BATCH_SIZE];
+#endif // LLBC_CFG_COMM_ENABLE_UDP
 };
 
 __LLBC_NS_END
@@ -13,6 +13,10 @@
 #include "llbc/core/Core.h"
 #include "llbc/objbase/ObjBase.h"
 
+#include "llbc/comm/SendLane.h"
+#include "llbc/comm/RecvLimit.h"
+#include "llbc/comm/ServiceStat.h"
+
 __LLBC_NS_BEGIN
 
 /**
@@ -121,6 +125,119 @@ public:
      */
     virtual int SetDriveMode(DriveMode mode) = 0;
 
+    /**
+     * Get the service poller model.
+     * @return const LLBC_String & - the poller model, default is LLBC_CFG_COMM_POLLER_MODEL.
+     */
+    virtual const LLBC_String &GetPollerModel() const = 0;
+
+    /**
+     * Set the service poller model, must call before service start and before any session created,
+     * use to run/benchmark different pollers side by side in one process.
+     * @param[in] model - the poller model(case insensitive), eg: "SelectPoller", "PollPoller", "EpollPoller".
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetPollerModel(const LLBC_String &model) = 0;
+
+    /**
+     * Set the service threads placement, must call before service start.
+     * Service logic thread, pollers and pollers' monitor threads keep on specific NUMA node,
+     * pollers' buffers allocate on this node too.
+     * @param[in] numaNode       - the NUMA node, -1 means not limit node.
+     * @param[in] svcCPU         - the service logic thread bind CPU index, -1 means float in node's CPUs,
+     *                             ignored if service is external drive.
+     * @param[in] firstPollerCPU - poller N bind to CPU index(firstPollerCPU + N), wrap around in node's CPUs,
+     *                             -1 means pollers float in node's CPUs.
+     * CPU index is the index of node's CPUs if numaNode specified, otherwise is the CPU number.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetThreadPlacement(int numaNode, int svcCPU = -1, int firstPollerCPU = -1) = 0;
+
+    /**
+     * Set the service busy poll low-latency mode, must call before service start.
+     * In busy poll mode, service logic thread spin wait next frame(any event arrived will begin next frame
+     * immediately), pollers wait events with zero timeout and sockets set SO_BUSY_POLL option(Linux platform).
+     * Busy polling threads fallback to blocking wait after idle idleUSecs micro-seconds, and switch back to
+     * busy polling when event arrived.
+     * Busy poll trades CPU for latency, recommend to bind threads to dedicated CPUs, see SetThreadPlacement().
+     * Note: SelectPoller/IocpPoller not support busy poll, service logic thread busy poll need self-drive mode.
+     * @param[in] enabled   - enable busy poll or not.
+     * @param[in] idleUSecs - the busy poll idle time, in micro-seconds, must greater than 0.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetBusyPoll(bool enabled, int idleUSecs = LLBC_CFG_COMM_DFT_BUSY_POLL_IDLE_USECS) = 0;
+
+    /**
+     * Check service busy poll mode enabled or not.
+     * @return bool - return true if busy poll enabled, otherwise return false.
+     */
+    virtual bool IsBusyPoll() const = 0;
+
+    /**
+     * Set the service send cork mode, must call before service start.
+     * In send cork mode, sessions' sends in one service frame are appended to socket and flushed
+     * once at frame end by gathered write(less send() calls and tcp segments), flush now packet(see
+     * LLBC_Packet::SetFlushNow()) or session corked data reach LLBC_CFG_COMM_SEND_CORK_MAX_SIZE will
+     * flush session immediately.
+     * Note: SelectPoller/IocpPoller not support send cork.
+     * @param[in] cork - send cork flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendCork(bool cork) = 0;
+
+    /**
+     * Check service send cork mode enabled or not.
+     * @return bool - return true if send cork enabled, otherwise return false.
+     */
+    virtual bool IsSendCork() const = 0;
+
+    /**
+     * Set the service send lanes policy, must call before service start.
+     * After set, each session queue sending packets in per priority lanes(see LLBC_SendPriority), lanes
+     * data moved to socket send queue by policy(strict or weighted) when socket send queue drained, so
+     * high priority packets not blocked behind bulk low priority packets, work best with send cork mode
+     * (frame's sends interleaved at frame end flush).
+     * Packet send priority specified by LLBC_Packet::SetSendPriority(), or opcode send priority table
+     * (see SetOpcodeSendPriority()), default is Normal.
+     * Note: IocpPoller not support send lanes.
+     * @param[in] policy - the send lanes policy, service will copy it, NULL means disable send lanes.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendLanePolicy(const LLBC_SendLanePolicy *policy) = 0;
+
+    /**
+     * Get the service send lanes policy.
+     * @return const LLBC_SendLanePolicy * - the send lanes policy, if send lanes disabled, return NULL.
+     */
+    virtual const LLBC_SendLanePolicy *GetSendLanePolicy() const = 0;
+
+    /**
+     * Set opcode send priority, must call before service start, only available when send lanes enabled.
+     * @param[in] opcode   - the opcode.
+     * @param[in] priority - the send priority, see LLBC_SendPriority.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetOpcodeSendPriority(int opcode, int priority) = 0;
+
+    /**
+     * Set the service receive rate limit policy, must call before service start.
+     * After set, each session received packets must take tokens from session token bucket and opcode token
+     * bucket(if opcode limited) in poller thread before queued to service, breached packets will be dropped,
+     * delayed(session socket reading paused until tokens refilled) or session disconnected by policy action.
+     * Limited/Dropped packets counted in service stat, see LLBC_SessionStat.
+     * Note: SelectPoller/IocpPoller not support pause reading, Delay action only delay packets, datagram sessions
+     *       Delay action fallback to Drop.
+     * @param[in] policy - the receive limit policy, service will copy it, NULL means not limit.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy) = 0;
+
+    /**
+     * Get the service receive rate limit policy.
+     * @return const LLBC_RecvLimitPolicy * - the receive limit policy, if not limit, return NULL.
+     */
+    virtual const LLBC_RecvLimitPolicy *GetRecvLimitPolicy() const = 0;
+
 public:
     /**
      * Suppress coder not found warning in protocol-stack.
@@ -195,6 +312,68 @@ public:
      */
     virtual int AsyncConn(const char *ip, uint16 port, double timeout = -1) = 0;
 
+    /**
+     * Establishes a local(in-process) session to another service.
+     * Local session packets handed over to peer service by pointer via lock-free queue, no socket,
+     * no packet framing/compress, peer service handle packets with the same handler/facade semantics.
+     * Both services receive OnSessionCreate/OnSessionDestroy as normal sessions, when any side
+     * removes session or stops, both sides receive OnSessionDestroy.
+     * @param[in] peer - the peer service, must be started and same type with this service.
+     * @return int - the new local session Id(in this service), if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectLocal(LLBC_IService *peer) = 0;
+
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    /**
+     * Create a unix domain stream socket session and listening.
+     * Unix domain socket sessions bypass TCP stack, use for same host IPC(eg: sidecar processes).
+     * Session local/peer address is AF_UNIX family with zero ip and port.
+     * @param[in] path - the unix socket path, if start with '@', means linux abstract namespace,
+     *                   otherwise stale socket file will be removed before bind.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ListenUnix(const char *path) = 0;
+
+    /**
+     * Establishes a unix domain stream socket connection to a specified path.
+     * @param[in] path - the unix socket path, if start with '@', means linux abstract namespace.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectUnix(const char *path) = 0;
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    /**
+     * Create a udp datagram listen session, only support epoll poller.
+     * Every remote peer will map to a pseudo-session(OnSessionCreate called when first datagram arrival),
+     * pseudo-session destroyed when listen session destroyed or idle timeout(LLBC_CFG_COMM_UDP_SESSION_IDLE_TIMEOUT),
+     * when peers count reached LLBC_CFG_COMM_UDP_MAX_PEERS_PER_LISTENER, new peers' datagrams will be discarded.
+     * One packet per datagram, packet large than LLBC_CFG_COMM_UDP_MAX_DATAGRAM_SIZE will be discarded,
+     * datagrams delivery is unreliable and unordered.
+     * @param[in] ip   - the ip address.
+     * @param[in] port - the port number.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ListenUdp(const char *ip, uint16 port) = 0;
+
+    /**
+     * Create a connected udp datagram session to peer address, only support epoll poller.
+     * @param[in] ip   - the ip address.
+     * @param[in] port - the port number.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectUdp(const char *ip, uint16 port) = 0;
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+    /**
+     * Adopt a connected stream socket handle as a session, eg: the inherited socketpair end.
+     * Adopted session has the same lifecycle with connected session(OnSessionCreate/OnSessionDestroy).
+     * @param[in] handle - the connected AF_INET/AF_UNIX stream socket handle,
+     *                     if adopt success, handle owned by service, otherwise still owned by caller.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int AdoptSocket(LLBC_SocketHandle handle) = 0;
+
     /**
      * Check given sessionId is validate or not.
      * @param[in] sessionId - the given session Id.
@@ -443,6 +622,21 @@ public:
     int SubscribeStatus(int opcode ,int status, ObjType *obj, void (ObjType::*method)(LLBC_Packet &));
 #endif // LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
 
+#if LLBC_CFG_COMM_ENABLE_CORO
+    /**
+     * Subscribe message to specified coroutine delegate, every packet handled in a new coroutine,
+     * handler can await reply/timer/future(see AwaitReply/CoroSleep/AwaitFuture) without blocking service.
+     * Note: Same opcode can't subscribe normal handler and coroutine handler at the same time.
+     */
+    virtual int SubscribeCoro(int opcode, LLBC_IDelegate1<LLBC_Packet &> *deleg) = 0;
+
+    /**
+     * Subscribe message to specified coroutine handler method.
+     */
+    template <typename ObjType>
+    int SubscribeCoro(int opcode, ObjType *obj, void (ObjType::*method)(LLBC_Packet &));
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
     /**
      * Set protocol filter to service's specified protocol layer.
      * @param[in] filter  - the protocol filter.
@@ -505,6 +699,93 @@ public:
     template <typename ObjType>
     int Post(ObjType *obj, void (ObjType::*method)(This *));
 
+    /**
+     * Get the service executor, executor's tasks will run in service thread.
+     * Eg: Use as thread pool future continuation executor, let continuation run in service thread:
+     *      future.Then(obj, &Obj::OnJobDone, svc->GetExecutor());
+     * @return LLBC_IExecutor * - the service executor.
+     */
+    virtual LLBC_IExecutor *GetExecutor() = 0;
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+public:
+    /**
+     * Await reply packet in coroutine handler, the packet matched by sessionId + opcode, if more than
+     * one coroutines await same sessionId + opcode, the reply packets dispatch in FIFO order.
+     * Note: must be called in coroutine handler(see SubscribeCoro).
+     * @param[in] sessionId - the reply packet sessionId.
+     * @param[in] opcode    - the reply packet opcode.
+     * @param[in] timeout   - the timeout, in milli-seconds, default never timeout.
+     * @return LLBC_Packet * - the reply packet, valid until coroutine handler return, return NULL if
+     *                         failed(timeout: LLBC_ERROR_TIMEOUT, session destroyed: LLBC_ERROR_NOT_FOUND,
+     *                         service stopping: LLBC_ERROR_END).
+     */
+    virtual LLBC_Packet *AwaitReply(int sessionId, int opcode, int timeout = LLBC_INFINITE) = 0;
+
+    /**
+     * Suspend coroutine handler specific milli-seconds, service continue process other packets.
+     * Note: must be called in coroutine handler(see SubscribeCoro).
+     * @param[in] milliSeconds - the sleep milli-seconds.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int CoroSleep(int milliSeconds) = 0;
+
+    /**
+     * Await thread pool future done in coroutine handler.
+     * Note: must be called in coroutine handler(see SubscribeCoro).
+     * @param[in] future  - the future.
+     * @param[in] timeout - the timeout, in milli-seconds, default never timeout.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int AwaitFuture(const LLBC_Future &future, int timeout = LLBC_INFINITE) = 0;
+
+    /**
+     * Get alive(running or suspended) coroutine handlers count.
+     * @return int - the coroutine handlers count.
+     */
+    virtual int GetCoroCount() const = 0;
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+public:
+    /**
+     * Get service traffic statistic snapshot, thread safe.
+     * Note: The stats collect from per-poller counters and service handler stats, the stats
+     *       of last started pollers still available after service stopped.
+     * @param[out] stat         - the service stat.
+     * @param[in]  withSessions - include alive sessions stat or not, default is false.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int GetStat(LLBC_ServiceStat &stat, bool withSessions = false) = 0;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+public:
+    /**
+     * Get/Set service slow frame threshold, when one frame cost greater than threshold,
+     * the frame top offenders(opcode handlers, timers) will be reported to root logger.
+     * @param[in] threshold - the threshold, in milli-seconds, 0 means use 2 times of frame interval,
+     *                        less than 0 means disable slow frame report.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int GetSlowFrameThreshold() const = 0;
+    virtual int SetSlowFrameThreshold(int threshold) = 0;
+
+    /**
+     * Get service frame profile(per-phase/per-opcode/per-timer cost histograms), thread safe.
+     * @param[out] profile    - the frame profile.
+     * @param[in]  lastWindow - get last completed rolling window or not, default get current window.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int GetFrameProfile(LLBC_FrameProfile &profile, bool lastWindow = false) = 0;
+
+    /**
+     * Get last slow frame report, thread safe.
+     * @return LLBC_String - the last slow frame report, if no slow frame, return empty string.
+     */
+    virtual LLBC_String GetLastSlowFrameReport() = 0;
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 public:
     /**
      * One time service call routine, if service drive mode is ExternalDrive, you must manual call this method.
@@ -121,6 +121,22 @@ inline int LLBC_IService::Subscribe(int opcode, ObjType *obj, void (ObjType::*me
     return LLBC_OK;
 }
 
+#if LLBC_CFG_COMM_ENABLE_CORO
+template <typename ObjType>
+inline int LLBC_IService::SubscribeCoro(int opcode, ObjType *obj, void (ObjType::*method)(LLBC_Packet &))
+{
+    LLBC_IDelegate1<LLBC_Packet &> *deleg = 
+        new LLBC_Delegate1<ObjType, LLBC_Packet &>(obj, method);
+    if (this->SubscribeCoro(opcode, deleg) != LLBC_OK)
+    {
+        delete deleg;
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
 template <typename ObjType>
 inline int LLBC_IService::PreSubscribe(int opcode, ObjType *obj, void *(ObjType::*method)(LLBC_Packet &))
 {
@@ -0,0 +1,181 @@
+/**
+ * @file    IoUringPoller.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_COMM_IO_URING_POLLER_H__
+#define __LLBC_COMM_IO_URING_POLLER_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+#include "llbc/comm/BasePoller.h"
+
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The io_uring poller class encapsulation.
+ *        Listen sockets use multishot accept, stream sockets use multishot recv with provided buffer ring,
+ *        sends are batch submitted after queued events drained.
+ *        Completions and queued events handled in one thread, queued events push will wakeup poller by wakeup pipe.
+ */
+class LLBC_HIDDEN LLBC_IoUringPoller : public LLBC_BasePoller
+{
+public:
+    LLBC_IoUringPoller();
+    virtual ~LLBC_IoUringPoller();
+
+public:
+    /**
+     * Startup poller.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Start();
+
+    /**
+     * Task startup method.
+     */
+    virtual void Svc();
+
+    /**
+     * Task cleanup method.
+     */
+    virtual void Cleanup();
+
+    /**
+     * Push message block to poller, if poller waiting completions, will wakeup it.
+     * @param[in] block - the message block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Push(LLBC_MessageBlock *block);
+
+protected:
+    /**
+     * Queued event handlers.
+     */
+    virtual void HandleEv_AddSock(LLBC_PollerEvent &ev);
+    virtual void HandleEv_AsyncConn(LLBC_PollerEvent &ev);
+    virtual void HandleEv_Send(LLBC_PollerEvent &ev);
+    virtual void HandleEv_Close(LLBC_PollerEvent &ev);
+    virtual void HandleEv_Monitor(LLBC_PollerEvent &ev);
+    virtual void HandleEv_TakeOverSession(LLBC_PollerEvent &ev);
+
+    /**
+     * Flush session corked send data.
+     */
+    virtual void FlushCorkedSession(LLBC_Session *session);
+
+    /**
+     * Pause/Resume session receive, cancel/rearm multishot recv.
+     */
+    virtual void PauseSessionRecv(LLBC_Session *session);
+    virtual void ResumeSessionRecv(LLBC_Session *session);
+
+    /**
+     * Add session to poller.
+     */
+    virtual void AddSession(LLBC_Session *session);
+
+    /**
+     * Remove session from poller.
+     */
+    virtual void RemoveSession(LLBC_Session *session);
+
+private:
+    /**
+     * The socket handle indexed fd slot, requests carry (kind << 60) | (generation << 32) | handle user data,
+     * completion is stale if generation mismatch(socket removed or handle reused after request submitted).
+     */
+    struct _FdSlot
+    {
+        uint32 gen;                 // 0 if slot not in use.
+        LLBC_Session *session;      // NULL if is connecting socket.
+        bool recvArmed;             // Multishot accept/recv armed or not.
+        bool sendQueued;            // In pending sends or not.
+        LLBC_MessageBlock *sending; // The in-flight send block, owned by poller.
+        bool sendSubmitted;         // The send block's send request submitted(completion pending) or not.
+    };
+
+    /**
+     * Create/Destroy the provided recv buffer ring.
+     */
+    int CreateBufRing();
+    void DestroyBufRing();
+
+    /**
+     * Give back provided recv buffer to buffer ring.
+     */
+    void RecycleBuf(uint16 bufId);
+
+    /**
+     * Get submission queue entry, if submission queue full, submit first.
+     */
+    LLBC_IoUringSqe *GetSqe();
+
+    /**
+     * Submit requests.
+     */
+    void ArmWakeup();
+    void ArmAccept(LLBC_SocketHandle handle);
+    void ArmRecv(LLBC_SocketHandle handle);
+    void SubmitSend(LLBC_SocketHandle handle);
+
+    /**
+     * Cancel request, if submission queue full, cancel deferred to next loop.
+     */
+    void CancelRequest(uint64 userData);
+    void FlushCancels();
+
+    /**
+     * Queue session send, all queued sends will batch submit after queued events drained.
+     */
+    void QueueSend(LLBC_SocketHandle handle);
+    void FlushSends();
+
+    /**
+     * Handle all completions.
+     * @return bool - return true if handled any completion, otherwise return false.
+     */
+    bool HandleCompletions();
+    void HandleAccept(uint64 userData, int res, uint32 flags);
+    void HandleRecv(uint64 userData, int res, uint32 flags);
+    void HandleSend(uint64 userData, int res);
+    void HandleConnecting(LLBC_SocketHandle handle, int res);
+
+    /**
+     * Bind/Unbind/Get socket handle's fd slot.
+     */
+    void BindFdSlot(LLBC_SocketHandle handle, LLBC_Session *session);
+    void UnbindFdSlot(LLBC_SocketHandle handle);
+    _FdSlot *GetFdSlot(LLBC_SocketHandle handle, uint32 gen);
+
+private:
+    LLBC_IoUring _ring;
+
+    LLBC_Handle _wakeupPipe[2];
+    volatile sint32 _wakeupSignaled;
+
+    struct io_uring_buf_ring *_bufRing;
+    char *_recvBufs;
+    uint16 _bufRingTail;
+
+    std::vector<_FdSlot> _fdSlots;
+    uint32 _fdGeneration;
+    uint64 _sqFullTimes;
+
+    std::vector<LLBC_SocketHandle> _pendingSends;
+    std::vector<uint64> _pendingCancels; // The deferred cancel requests(submission queue full when cancel).
+    std::map<uint64, LLBC_MessageBlock *> _orphanSends; // The removed sessions' in-flight send blocks.
+};
+
+__LLBC_NS_END
+
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+
+#endif // !__LLBC_COMM_IO_URING_POLLER_H__
@@ -29,6 +29,8 @@ __LLBC_NS_BEGIN
  */
 class LLBC_EXPORT LLBC_Packet
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_Packet);
+
 public:
     LLBC_Packet();
     ~LLBC_Packet();
@@ -186,6 +188,32 @@ public:
      */
     void SetPeerAddr(const LLBC_SockAddr_IN &addr);
 
+    /**
+     * Check packet is flush now packet or not(local send option, not transfer to peer).
+     * @return bool - return true if is flush now packet, otherwise return false.
+     */
+    bool IsFlushNow() const;
+
+    /**
+     * Set packet flush now flag, in send cork mode, flush now packet send immediately(with the
+     * session's corked data), see LLBC_IService::SetSendCork().
+     * @param[in] flushNow - flush now flag.
+     */
+    void SetFlushNow(bool flushNow);
+
+    /**
+     * Get packet send priority(local send option, not transfer to peer).
+     * @return int - the send priority, see LLBC_SendPriority, -1 means not specified.
+     */
+    int GetSendPriority() const;
+
+    /**
+     * Set packet send priority, only available when service send lanes enabled, not specified packet
+     * will use service opcode send priority, see LLBC_IService::SetSendLanePolicy().
+     * @param[in] priority - the send priority, see LLBC_SendPriority.
+     */
+    void SetSendPriority(int priority);
+
     /**
      * Set packet header.
      * @param[in] svcId     - service Id.
@@ -490,6 +518,8 @@ private:
     int _sessionId;
     LLBC_SockAddr_IN _localAddr;
     LLBC_SockAddr_IN _peerAddr;
+    bool _flushNow;
+    int _sendPriority;
 
     LLBC_ICoder *_encoder;
     LLBC_ICoder *_decoder;
@@ -127,6 +127,26 @@ inline void LLBC_Packet::SetPeerAddr(const LLBC_SockAddr_IN &addr)
     _peerAddr = addr;
 }
 
+inline bool LLBC_Packet::IsFlushNow() const
+{
+    return _flushNow;
+}
+
+inline void LLBC_Packet::SetFlushNow(bool flushNow)
+{
+    _flushNow = flushNow;
+}
+
+inline int LLBC_Packet::GetSendPriority() const
+{
+    return _sendPriority;
+}
+
+inline void LLBC_Packet::SetSendPriority(int priority)
+{
+    _sendPriority = priority;
+}
+
 template <typename _Ty>
 inline int LLBC_Packet::Read(std::vector<_Ty> &val)
 {
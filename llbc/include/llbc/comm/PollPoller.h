@@ -0,0 +1,137 @@
+/**
+ * @file    PollPoller.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_COMM_POLL_POLLER_H__
+#define __LLBC_COMM_POLL_POLLER_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+#include "llbc/comm/BasePoller.h"
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The Poll poller class encapsulation.
+ *        Use persistent compact pollfd array(swap-remove), no FD_SETSIZE limit.
+ *        Poll and queued events handled in one thread, queued events push will wakeup poll by wakeup pipe.
+ */
+class LLBC_HIDDEN LLBC_PollPoller : public LLBC_BasePoller
+{
+public:
+    LLBC_PollPoller();
+    virtual ~LLBC_PollPoller();
+
+public:
+    /**
+     * Startup poller.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Start();
+
+    /**
+     * Task startup method.
+     */
+    virtual void Svc();
+
+    /**
+     * Task cleanup method.
+     */
+    virtual void Cleanup();
+
+    /**
+     * Push message block to poller, if poller waiting in poll(), will wakeup it.
+     * @param[in] block - the message block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Push(LLBC_MessageBlock *block);
+
+protected:
+    /**
+     * Queued event handlers.
+     */
+    virtual void HandleEv_AddSock(LLBC_PollerEvent &ev);
+    virtual void HandleEv_AsyncConn(LLBC_PollerEvent &ev);
+    virtual void HandleEv_Send(LLBC_PollerEvent &ev);
+    virtual void HandleEv_Close(LLBC_PollerEvent &ev);
+    virtual void HandleEv_Monitor(LLBC_PollerEvent &ev);
+    virtual void HandleEv_TakeOverSession(LLBC_PollerEvent &ev);
+
+    /**
+     * Flush session corked send data.
+     */
+    virtual void FlushCorkedSession(LLBC_Session *session);
+
+    /**
+     * Pause/Resume session receive, remove/add POLLIN event.
+     */
+    virtual void PauseSessionRecv(LLBC_Session *session);
+    virtual void ResumeSessionRecv(LLBC_Session *session);
+
+    /**
+     * Add session to poller.
+     */
+    virtual void AddSession(LLBC_Session *session);
+
+    /**
+     * Remove session from poller.
+     */
+    virtual void RemoveSession(LLBC_Session *session);
+
+private:
+    /**
+     * Poll and handle all ready file descriptors.
+     * @param[in] timeout - the poll timeout, in milliseconds.
+     */
+    void Poll(int timeout);
+
+    /**
+     * Add/Remove file descriptor to/from pollfd array.
+     */
+    void AddFd(LLBC_SocketHandle handle, short events, LLBC_Session *session);
+    void RemoveFd(LLBC_SocketHandle handle);
+
+    /**
+     * Get file descriptor index in pollfd array, if not found, return -1.
+     */
+    int GetFdIndex(LLBC_SocketHandle handle) const;
+
+    /**
+     * Update session writable event, only wait writable when session has remain data.
+     */
+    void UpdateWriteEvent(LLBC_Session *session);
+
+    /**
+     * Handle connecting sockets.
+     */
+    bool HandleConnecting(LLBC_SocketHandle handle, short revents);
+
+    /**
+     * Accept new session.
+     */
+    void Accept(LLBC_Session *session);
+
+private:
+    LLBC_Handle _wakeupPipe[2];
+    volatile sint32 _wakeupSignaled;
+
+    std::vector<LLBC_PollFd> _fds;             // The compact pollfd array, [0] is wakeup pipe read end.
+    std::vector<LLBC_Session *> _fdSessions;   // The pollfd array index -> session, NULL if not session fd.
+    std::vector<int> _fdIndexes;               // The fd -> pollfd array index, -1 if not in array.
+
+    std::vector<LLBC_PollFd> _readyFds;
+};
+
+__LLBC_NS_END
+
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+#endif // !__LLBC_COMM_POLL_POLLER_H__
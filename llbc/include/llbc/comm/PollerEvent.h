@@ -46,6 +46,8 @@ struct LLBC_HIDDEN LLBC_PollerEvent
         // Take over session request, once poller found it can't process the new session,
         // poller will create this event and post to appropriate brother.
         TakeOverSession,
+        // Flush corked sessions send data, generate by Service layer at end of frame.
+        FlushSends,
 
         // Sentinel.
         End
@@ -110,6 +112,11 @@ public:
      */
     static LLBC_MessageBlock *BuildTakeOverSessionEv(LLBC_Session *session);
 
+    /**
+     * Build flush sends event.
+     */
+    static LLBC_MessageBlock *BuildFlushSendsEv();
+
     /**
      * Build take over socket event(only available in WIN32 platform).
      */
@@ -22,6 +22,10 @@ class LLBC_Packet;
 class LLBC_Socket;
 class LLBC_IService;
 class LLBC_BasePoller;
+class LLBC_PollerStat;
+class LLBC_ServiceStat;
+struct LLBC_SendLanePolicy;
+struct LLBC_RecvLimitPolicy;
 
 __LLBC_NS_END
 
@@ -43,6 +47,44 @@ public:
      */
     void SetPollerType(int type);
 
+    /**
+     * Get poller type.
+     * @return int - the poller type.
+     */
+    int GetPollerType() const;
+
+    /**
+     * Set pollers threads placement, must call before start.
+     * @param[in] numaNode - the NUMA node pollers run on and allocate buffers on, -1 means not specific.
+     * @param[in] cpuNos   - the candidate CPUs, empty means not bind.
+     * @param[in] firstCPU - poller N bind to cpuNos[(firstCPU + N) % cpuNos.size()], -1 means float in cpuNos.
+     */
+    void SetThreadPlacement(int numaNode, const std::vector<int> &cpuNos, int firstCPU);
+
+    /**
+     * Set pollers busy poll mode, must call before start.
+     * @param[in] idleUSecs - the busy poll idle time, in micro-seconds, <= 0 means disable busy poll.
+     */
+    void SetBusyPoll(int idleUSecs);
+
+    /**
+     * Set pollers send cork mode, must call before start, Select/Iocp pollers not support.
+     * @param[in] cork - send cork flag.
+     */
+    void SetSendCork(bool cork);
+
+    /**
+     * Set pollers send lanes policy, must call before start, Iocp poller not support.
+     * @param[in] policy - the send lanes policy, owned by service, NULL means disable send lanes.
+     */
+    void SetSendLanePolicy(const LLBC_SendLanePolicy *policy);
+
+    /**
+     * Set pollers receive rate limit policy, must call before start.
+     * @param[in] policy - the receive limit policy, owned by service, NULL means not limit.
+     */
+    void SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy);
+
     /**
      * Set service.
      * @param[in] svc - the service.
@@ -91,6 +133,49 @@ public:
      */
     int AsyncConn(const char *ip, uint16 port);
 
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    /**
+     * Listen in specified unix domain socket path(call by service).
+     * @param[in] path - the unix socket path, if start with '@', means linux abstract namespace.
+     * @return int - the new session Id, if return 0, means listen failed.
+     */
+    int ListenUnix(const char *path);
+
+    /**
+     * Connect to unix domain socket path(call by service).
+     * @param[in] path - the unix socket path, if start with '@', means linux abstract namespace.
+     * @return int - the new session Id, if return 0, means connect failed.
+     */
+    int ConnectUnix(const char *path);
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    /**
+     * Listen udp datagrams in specified local address(call by service), only support epoll poller.
+     * Every remote peer will create a pseudo-session when first datagram arrival.
+     * @param[in] ip   - the ip address.
+     * @param[in] port - the port number.
+     * @return int - the new session Id, if return 0, means listen failed.
+     */
+    int ListenUdp(const char *ip, uint16 port);
+
+    /**
+     * Create connected udp session to peer address(call by service), only support epoll poller.
+     * @param[in] ip   - the ip address.
+     * @param[in] port - the port number.
+     * @return int - the new session Id, if return 0, means connect failed.
+     */
+    int ConnectUdp(const char *ip, uint16 port);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+    /**
+     * Adopt a connected stream socket handle(eg: inherited socketpair end), call by service.
+     * After adopt success, socket handle owned by poller manager.
+     * @param[in] handle - the connected socket handle, AF_INET or AF_UNIX stream socket.
+     * @return int - the new session Id, if return 0, means adopt failed(handle not closed).
+     */
+    int AdoptSocket(LLBC_SocketHandle handle);
+
     /**
      * Send packet.
      * @param[in] packet - the packet.
@@ -105,13 +190,42 @@ public:
      */
     void Close(int sessionId, const char *reason = NULL);
 
+    /**
+     * Flush all pollers corked sessions send data(send cork mode).
+     */
+    void FlushSends();
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+public:
+    /**
+     * Collect all pollers statistic infos(call by service).
+     * @param[in] withSessions - collect alive sessions stat or not.
+     * @param[out] stat        - the service stat.
+     */
+    void CollectStat(bool withSessions, LLBC_ServiceStat &stat);
+
+    /**
+     * Collect all pollers total sent & received bytes(call by service).
+     * @param[out] sentBytes   - the total sent bytes.
+     * @param[out] recvedBytes - the total received bytes.
+     */
+    void CollectTraffic(uint64 &sentBytes, uint64 &recvedBytes);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 private:
     /**
-     * Allocate new session Id, call by self or Poller.
+     * Allocate new session Id, call by self, Poller or Service(local session).
      * @return int - the new session Id.
      */
     int AllocSessionId();
 
+    /**
+     * Add socket to poller, if pollers not start, add to pending add-socks container.
+     * @param[in] sock - the socket.
+     * @return int - the new session Id.
+     */
+    int AddSock(LLBC_Socket *sock);
+
     /**
      * Push specific message to poller, call by Poller.
      * @param[in] id    - the poller Id.
@@ -137,14 +251,27 @@ private:
      * Friend classes.
      */
     friend class LLBC_BasePoller;
+    friend class LLBC_Service;
 
 private:
     int _type;
     LLBC_IService *_svc;
 
+    int _numaNode;
+    std::vector<int> _placementCPUs;
+    int _firstPollerCPU;
+    int _busyPollIdleUSecs;
+    bool _sendCork;
+    const LLBC_SendLanePolicy *_sendLanePolicy;
+    const LLBC_RecvLimitPolicy *_recvLimitPolicy;
+
     int _pollerCount;
     LLBC_BasePoller **_pollers;
     LLBC_SpinLock _pollerLock;
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    int _pollerStatCount;
+    LLBC_PollerStat *_pollerStats;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 
     int _maxSessionId;
 
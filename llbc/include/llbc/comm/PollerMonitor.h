@@ -46,6 +46,11 @@ public:
      */
     void Stop();
 
+    /**
+     * Set monitor thread CPU affinity, must call before start.
+     */
+    using LLBC_BaseTask::SetCPUAffinity;
+
 public:
     /**
      * Task entry method.
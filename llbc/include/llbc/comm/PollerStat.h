@@ -0,0 +1,143 @@
+/**
+ * @file    PollerStat.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The poller traffic statistic collector.
+ *        Only written by owner poller thread, counters are plain counters updated without lock(stored
+ *        atomically, readers never see torn value), the lock only protect sessions/opcodes add & remove,
+ *        readers copy counters under the lock, so counters update(per-packet hot path) never lock.
+ */
+#ifndef __LLBC_COMM_POLLER_STAT_H__
+#define __LLBC_COMM_POLLER_STAT_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+
+#include "llbc/comm/ServiceStat.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The poller traffic statistic collector class encapsulation.
+ */
+class LLBC_HIDDEN LLBC_PollerStat
+{
+public:
+    LLBC_PollerStat();
+    ~LLBC_PollerStat();
+
+public:
+    /**
+     * Add session stat, call when session add to poller.
+     * @param[in] sessionId - the session Id.
+     * @return LLBC_SessionStat * - the session stat, it's valid until RemoveSession() called.
+     */
+    LLBC_SessionStat *AddSession(int sessionId);
+
+    /**
+     * Remove session stat, call when session remove from poller.
+     * @param[in] sessionId - the session Id.
+     */
+    void RemoveSession(int sessionId);
+
+public:
+    /**
+     * Data block will send(append to socket send queue).
+     * @param[in] stat - the session stat.
+     * @param[in] len  - the data length.
+     */
+    void OnWillSend(LLBC_SessionStat *stat, size_t len);
+
+    /**
+     * Data sent.
+     * @param[in] stat - the session stat.
+     * @param[in] len  - the sent data length.
+     */
+    void OnSent(LLBC_SessionStat *stat, size_t len);
+
+    /**
+     * Not sent data dropped(send lanes stale data).
+     * @param[in] stat    - the session stat.
+     * @param[in] packets - the dropped packets count.
+     * @param[in] len     - the dropped data length.
+     */
+    void OnSendDropped(LLBC_SessionStat *stat, int packets, size_t len);
+
+    /**
+     * Received packet rate limited.
+     * @param[in] stat    - the session stat.
+     * @param[in] dropped - the packet dropped or not.
+     */
+    void OnRecvLimited(LLBC_SessionStat *stat, bool dropped);
+
+    /**
+     * Data received.
+     * @param[in] stat - the session stat.
+     * @param[in] len  - the received data length.
+     */
+    void OnRecved(LLBC_SessionStat *stat, size_t len);
+
+    /**
+     * Socket system call done.
+     * @param[in] stat      - the session stat.
+     * @param[in] sendCalls - the send() call times.
+     * @param[in] recvCalls - the recv() call times.
+     */
+    void OnSysCalls(LLBC_SessionStat *stat, int sendCalls, int recvCalls);
+
+    /**
+     * Packet sent(encoded and append to send queue).
+     * @param[in] stat   - the session stat.
+     * @param[in] opcode - the packet opcode.
+     * @param[in] len    - the packet encoded length.
+     */
+    void OnPacketSent(LLBC_SessionStat *stat, int opcode, size_t len);
+
+    /**
+     * Packets received(decoded from stream).
+     * @param[in] stat    - the session stat.
+     * @param[in] opcode  - the packet opcode.
+     * @param[in] len     - the packet length.
+     */
+    void OnPacketRecved(LLBC_SessionStat *stat, int opcode, size_t len);
+
+public:
+    /**
+     * Merge this poller stat into service stat snapshot.
+     * @param[in] withSessions - merge alive sessions stat or not.
+     * @param[out] stat        - the service stat.
+     */
+    void MergeTo(bool withSessions, LLBC_ServiceStat &stat);
+
+    /**
+     * Get total sent & received bytes.
+     * @param[out] sentBytes   - the total sent bytes.
+     * @param[out] recvedBytes - the total received bytes.
+     */
+    void GetTraffic(uint64 &sentBytes, uint64 &recvedBytes);
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_PollerStat);
+
+private:
+    /**
+     * Get opcode stat, if not exist, create it.
+     */
+    LLBC_OpcodeStat &GetOpcodeStat(int opcode);
+
+private:
+    LLBC_AdaptiveLock _lock; // Protect session/opcode stats add & remove.
+
+    LLBC_SessionStat _total;
+
+    typedef std::map<int, LLBC_SessionStat> _SessionStats;
+    _SessionStats _sessionStats;
+
+    typedef std::map<int, LLBC_OpcodeStat> _OpcodeStats;
+    _OpcodeStats _opcodeStats;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_POLLER_STAT_H__
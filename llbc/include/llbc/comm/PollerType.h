@@ -31,6 +31,12 @@ public:
 #elif LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
         EpollPoller,    // Epoll poller availables on LINUX & ANDROID platforms.
 #endif // LLBC_TARGET_PLATFORM_WIN32
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+        PollPoller,     // Poll poller availables on all Non-WIN32 platforms.
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+        IoUringPoller,  // io_uring poller availables on LINUX platform.
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
 
         End
     };
@@ -0,0 +1,114 @@
+/**
+ * @file    RecvLimit.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_COMM_RECV_LIMIT_H__
+#define __LLBC_COMM_RECV_LIMIT_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The receive rate limit breach action enumeration.
+ */
+class LLBC_EXPORT LLBC_RecvLimitAction
+{
+public:
+    enum
+    {
+        Begin,
+
+        Drop = Begin,   // Drop the breached packet.
+        Delay,          // Delay the breached packet until tokens refilled, and pause reading the session socket.
+        Disconnect,     // Close the session.
+
+        End
+    };
+
+public:
+    /**
+     * Check given receive limit action is validate or not.
+     * @param[in] action - the receive limit action, see above enumeration.
+     * @return bool - return true if validate, otherwise return false.
+     */
+    static bool IsValid(int action);
+
+    /**
+     * Get receive limit action string representation.
+     * @param[in] action - the receive limit action, see above enumeration.
+     * @return const LLBC_String & - the receive limit action string representation.
+     */
+    static const LLBC_String &Action2Str(int action);
+};
+
+/**
+ * \brief The session receive rate limit policy, shared by all sessions of service(immutable after service started).
+ *        Each session has one packets token bucket and one token bucket per limited opcode, received packet
+ *        must take one token from session bucket and its opcode bucket(if limited) before queued to service.
+ */
+struct LLBC_EXPORT LLBC_RecvLimitPolicy
+{
+    /**
+     * \brief The token bucket rate.
+     */
+    struct Rate
+    {
+        int rate;  // Packets per second, 0 means not limit.
+        int burst; // Bucket capacity(max burst packets), 0 means same as rate.
+
+        Rate(int rate = 0, int burst = 0);
+    };
+
+    int action;                         // The breach action, see LLBC_RecvLimitAction.
+    Rate sessionRate;                   // The session packets rate.
+    std::map<int, Rate> opcodeRates;    // The per opcode packets rates.
+
+    LLBC_RecvLimitPolicy();
+};
+
+/**
+ * \brief The session receive rate limiter, created by poller if service receive limit policy set.
+ */
+class LLBC_HIDDEN LLBC_RecvLimiter
+{
+public:
+    /**
+     * Construct limiter.
+     * @param[in] policy   - the receive limit policy.
+     * @param[in] canDelay - the session can pause reading or not, if not, Delay action will fallback to Drop.
+     */
+    LLBC_RecvLimiter(const LLBC_RecvLimitPolicy &policy, bool canDelay);
+    ~LLBC_RecvLimiter();
+
+public:
+    /**
+     * Get the breach action.
+     * @return int - the breach action, see LLBC_RecvLimitAction.
+     */
+    int GetAction() const;
+
+    /**
+     * Try take tokens for received packet.
+     * @param[in] opcode - the packet opcode.
+     * @return bool - return true if allowed, otherwise return false(rate limited).
+     */
+    bool Allow(int opcode);
+
+private:
+    int _action;
+
+    LLBC_TokenBucketSampler _sessionBucket;
+    typedef std::map<int, LLBC_TokenBucketSampler *> _OpcodeBuckets;
+    _OpcodeBuckets _opcodeBuckets;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_RECV_LIMIT_H__
@@ -0,0 +1,68 @@
+/**
+ * @file    SendLane.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_COMM_SEND_LANE_H__
+#define __LLBC_COMM_SEND_LANE_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The packet send priority enumeration, each priority mapped to one session send lane.
+ */
+class LLBC_EXPORT LLBC_SendPriority
+{
+public:
+    enum
+    {
+        Begin,
+
+        High = Begin,   // Latency critical packets, eg: combat/move sync.
+        Normal,         // Default priority.
+        Low,            // Bulk/Stale-tolerant packets, eg: chat/ranking/bulk state sync.
+
+        End
+    };
+
+public:
+    /**
+     * Check given send priority is validate or not.
+     * @param[in] priority - the send priority, see above enumeration.
+     * @return bool - return true if validate, otherwise return false.
+     */
+    static bool IsValid(int priority);
+
+    /**
+     * Get send priority string representation.
+     * @param[in] priority - the send priority, see above enumeration.
+     * @return const LLBC_String & - the send priority string representation.
+     */
+    static const LLBC_String &Priority2Str(int priority);
+};
+
+/**
+ * \brief The session send lanes schedule policy, shared by all sessions of service(immutable after service started).
+ *        Strict mode always drain higher priority lane first, weighted mode drain lanes by deficit round robin,
+ *        each round lane can send weight * LLBC_CFG_COMM_SEND_LANE_QUANTUM bytes.
+ */
+struct LLBC_EXPORT LLBC_SendLanePolicy
+{
+    bool weighted;                            // Weighted or strict priority schedule.
+    int weights[LLBC_SendPriority::End];      // The lane weights, only available in weighted mode.
+    int lowStaleTimeout;                      // Low lane stale timeout(in milli-seconds), when socket congested,
+                                              // low lane packets queued longer than it will be dropped, 0 means never drop.
+
+    LLBC_SendLanePolicy();
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_SEND_LANE_H__
@@ -16,6 +16,8 @@
 #include "llbc/comm/IService.h"
 #include "llbc/comm/ServiceEvent.h"
 #include "llbc/comm/PollerMgr.h"
+#include "llbc/comm/ServiceExecutor.h"
+#include "llbc/comm/ServiceCoroScheduler.h"
 #if !LLBC_CFG_COMM_USE_FULL_STACK
 #include "llbc/comm/protocol/ProtocolStack.h"
 #endif
@@ -81,6 +83,89 @@ public:
      */
     virtual int SetDriveMode(DriveMode mode);
 
+    /**
+     * Get the service poller model.
+     * @return const LLBC_String & - the poller model.
+     */
+    virtual const LLBC_String &GetPollerModel() const;
+
+    /**
+     * Set the service poller model, must call before service start and before any session created.
+     * @param[in] model - the poller model(case insensitive).
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetPollerModel(const LLBC_String &model);
+
+    /**
+     * Set the service threads placement, must call before service start.
+     * @param[in] numaNode       - the NUMA node, -1 means not limit node.
+     * @param[in] svcCPU         - the service logic thread bind CPU index, -1 means float in node's CPUs.
+     * @param[in] firstPollerCPU - poller N bind to CPU index(firstPollerCPU + N), -1 means float in node's CPUs.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetThreadPlacement(int numaNode, int svcCPU = -1, int firstPollerCPU = -1);
+
+    /**
+     * Set the service busy poll low-latency mode, must call before service start.
+     * @param[in] enabled   - enable busy poll or not.
+     * @param[in] idleUSecs - the busy poll idle time, in micro-seconds, must greater than 0.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetBusyPoll(bool enabled, int idleUSecs = LLBC_CFG_COMM_DFT_BUSY_POLL_IDLE_USECS);
+
+    /**
+     * Check service busy poll mode enabled or not.
+     * @return bool - return true if busy poll enabled, otherwise return false.
+     */
+    virtual bool IsBusyPoll() const;
+
+    /**
+     * Set the service send cork mode, must call before service start.
+     * @param[in] cork - send cork flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendCork(bool cork);
+
+    /**
+     * Check service send cork mode enabled or not.
+     * @return bool - return true if send cork enabled, otherwise return false.
+     */
+    virtual bool IsSendCork() const;
+
+    /**
+     * Set the service send lanes policy, must call before service start.
+     * @param[in] policy - the send lanes policy, service will copy it, NULL means disable send lanes.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendLanePolicy(const LLBC_SendLanePolicy *policy);
+
+    /**
+     * Get the service send lanes policy.
+     * @return const LLBC_SendLanePolicy * - the send lanes policy, if send lanes disabled, return NULL.
+     */
+    virtual const LLBC_SendLanePolicy *GetSendLanePolicy() const;
+
+    /**
+     * Set opcode send priority, must call before service start, only available when send lanes enabled.
+     * @param[in] opcode   - the opcode.
+     * @param[in] priority - the send priority, see LLBC_SendPriority.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetOpcodeSendPriority(int opcode, int priority);
+
+    /**
+     * Set the service receive rate limit policy, must call before service start.
+     * @param[in] policy - the receive limit policy, service will copy it, NULL means not limit.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy);
+
+    /**
+     * Get the service receive rate limit policy.
+     * @return const LLBC_RecvLimitPolicy * - the receive limit policy, if not limit, return NULL.
+     */
+    virtual const LLBC_RecvLimitPolicy *GetRecvLimitPolicy() const;
+
 public:
     /**
      * Suppress coder not found warning in protocol-stack.
@@ -164,6 +249,54 @@ public:
      */
     virtual int AsyncConn(const char *ip, uint16 port, double timeout = -1);
 
+    /**
+     * Establishes a local(in-process) session to another service.
+     * @param[in] peer - the peer service.
+     * @return int - the new local session Id, if return 0, means failed.
+     */
+    virtual int ConnectLocal(LLBC_IService *peer);
+
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    /**
+     * Create a unix domain stream socket session and listening.
+     * @param[in] path - the unix socket path.
+     * @return int - the new session Id, if return 0, means failed.
+     */
+    virtual int ListenUnix(const char *path);
+
+    /**
+     * Establishes a unix domain stream socket connection to a specified path.
+     * @param[in] path - the unix socket path.
+     * @return int - the new session Id, if return 0, means failed.
+     */
+    virtual int ConnectUnix(const char *path);
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    /**
+     * Create a udp datagram listen session.
+     * @param[in] ip   - the ip address.
+     * @param[in] port - the port number.
+     * @return int - the new session Id, if return 0, means failed.
+     */
+    virtual int ListenUdp(const char *ip, uint16 port);
+
+    /**
+     * Create a connected udp datagram session to peer address.
+     * @param[in] ip   - the ip address.
+     * @param[in] port - the port number.
+     * @return int - the new session Id, if return 0, means failed.
+     */
+    virtual int ConnectUdp(const char *ip, uint16 port);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+    /**
+     * Adopt a connected stream socket handle as a session.
+     * @param[in] handle - the connected socket handle.
+     * @return int - the new session Id, if return 0, means failed.
+     */
+    virtual int AdoptSocket(LLBC_SocketHandle handle);
+
     /**
      * Check given sessionId is lgeal or not.
      * @param[in] sessionId - the given session Id.
@@ -328,6 +461,13 @@ public:
     virtual int UnifyPreSubscribe(LLBC_IDelegateEx<LLBC_Packet &> *deleg);
 #endif // LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
 
+#if LLBC_CFG_COMM_ENABLE_CORO
+    /**
+     * Subscribe message to specified coroutine delegate.
+     */
+    virtual int SubscribeCoro(int opcode, LLBC_IDelegate1<LLBC_Packet &> *deleg);
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
 #if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
     /**
      * Subscribe message status to specified delegate, if subscribed, service will not call default opcode handler.
@@ -383,6 +523,82 @@ public:
      */
     virtual int Post(LLBC_IDelegate1<Base *> *deleg);
 
+    /**
+     * Get the service executor, executor's tasks will run in service thread.
+     * @return LLBC_IExecutor * - the service executor.
+     */
+    virtual LLBC_IExecutor *GetExecutor();
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+public:
+    /**
+     * Await reply packet in coroutine handler.
+     * @param[in] sessionId - the reply packet sessionId.
+     * @param[in] opcode    - the reply packet opcode.
+     * @param[in] timeout   - the timeout, in milli-seconds.
+     * @return LLBC_Packet * - the reply packet, return NULL if failed.
+     */
+    virtual LLBC_Packet *AwaitReply(int sessionId, int opcode, int timeout = LLBC_INFINITE);
+
+    /**
+     * Suspend coroutine handler specific milli-seconds.
+     * @param[in] milliSeconds - the sleep milli-seconds.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int CoroSleep(int milliSeconds);
+
+    /**
+     * Await thread pool future done in coroutine handler.
+     * @param[in] future  - the future.
+     * @param[in] timeout - the timeout, in milli-seconds.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int AwaitFuture(const LLBC_Future &future, int timeout = LLBC_INFINITE);
+
+    /**
+     * Get alive coroutine handlers count.
+     * @return int - the coroutine handlers count.
+     */
+    virtual int GetCoroCount() const;
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+public:
+    /**
+     * Get service traffic statistic snapshot, thread safe.
+     * @param[out] stat         - the service stat.
+     * @param[in]  withSessions - include alive sessions stat or not, default is false.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int GetStat(LLBC_ServiceStat &stat, bool withSessions = false);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+public:
+    /**
+     * Get/Set service slow frame threshold.
+     * @param[in] threshold - the threshold, in milli-seconds, 0 means use 2 times of frame interval,
+     *                        less than 0 means disable slow frame report.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int GetSlowFrameThreshold() const;
+    virtual int SetSlowFrameThreshold(int threshold);
+
+    /**
+     * Get service frame profile, thread safe.
+     * @param[out] profile    - the frame profile.
+     * @param[in]  lastWindow - get last completed rolling window or not.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int GetFrameProfile(LLBC_FrameProfile &profile, bool lastWindow = false);
+
+    /**
+     * Get last slow frame report, thread safe.
+     * @return LLBC_String - the last slow frame report.
+     */
+    virtual LLBC_String GetLastSlowFrameReport();
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 public:
     /**
      * One time service call routine, if service drive mode is ExternalDrive, you must manual call this method.
@@ -428,6 +644,19 @@ private:
      * Queued event operation methods.
      */
     void HandleQueuedEvents();
+    bool HasQueuedEvents() const;
+
+    /**
+     * Get current frame arena, only available when called in service drive thread, otherwise return NULL.
+     * Frame arena allocated events are handled in next frame at the latest, arena reset after that frame.
+     */
+    LLBC_PoolArena *GetFrameArena();
+
+    /**
+     * Busy poll mode wait next frame, spin until frame end or any event arrived,
+     * if service idle busy poll idle time, fallback to sleep.
+     */
+    void BusyWaitNextFrame();
     void HandleEv_SessionCreate(LLBC_ServiceEvent &ev);
     void HandleEv_SessionDestroy(LLBC_ServiceEvent &ev);
     void HandleEv_AsyncConnResult(LLBC_ServiceEvent &ev);
@@ -437,6 +666,17 @@ private:
     void HandleEv_UnsubscribeEv(LLBC_ServiceEvent &ev);
     void HandleEv_FireEv(LLBC_ServiceEvent &ev);
 
+    /**
+     * Local session operation methods.
+     */
+    struct _LocalLink;
+    void AddLocalSession(int sessionId, _LocalLink *link);
+    _LocalLink *RetainLocalLink(int sessionId);
+    int SendLocal(_LocalLink *link, LLBC_Packet *packet);
+    void CloseLocalLink(_LocalLink *link, const char *reason);
+    void CloseLocalSessions();
+    void HandleLocalEvents();
+
     /**
      * Facade operation methods.
      */
@@ -466,6 +706,20 @@ private:
      */
     void ProcessIdle();
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    /**
+     * Traffic samplers update method, feed samplers once per second.
+     */
+    void UpdateSamplers();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    /**
+     * Apply slow frame threshold to frame profiler, call when threshold or fps changed.
+     */
+    void ApplySlowFrameThreshold();
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 private:
     /**
      * Internal helper methods.
@@ -509,6 +763,18 @@ private:
     int _fps;
     int _frameInterval;
     sint64 _begHeartbeatTime;
+    sint64 _begHeartbeatMonoTime; // Monotonic clock, in micro-seconds, busy poll mode only.
+
+    int _busyPollIdleUSecs;
+    sint64 _busyPollActiveTime;
+
+    bool _sendCork;
+    volatile sint32 _corkedSends; // Set by sender threads, exchanged by service thread, use atomic operations.
+
+    LLBC_SendLanePolicy *_sendLanePolicy;
+    std::map<int, int> _opcodeSendPriorities;
+
+    LLBC_RecvLimitPolicy *_recvLimitPolicy;
 
     volatile bool _sinkIntoLoop;
     volatile bool _afterStop;
@@ -517,7 +783,16 @@ private:
     LLBC_PollerMgr _pollerMgr;
     
     LLBC_SessionIdSet _connectedSessionIds;
-    LLBC_SpinLock _connectedSessionIdsLock;
+    LLBC_AdaptiveLock _connectedSessionIdsLock;
+
+    typedef std::map<int, _LocalLink *> _LocalSessions;
+    _LocalSessions _localSessions;
+    volatile sint32 _localSessionCount;
+    LLBC_MpscQueue<LLBC_ServiceEvent *> _localEvents;
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+    int _curFrameArena;
+    LLBC_PoolArena _frameArenas[2];
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
 
 #if !LLBC_CFG_COMM_USE_FULL_STACK
     LLBC_ProtocolStack _stack;
@@ -531,6 +806,9 @@ private:
     _Handlers _handlers;
     typedef std::map<int, LLBC_IDelegateEx<LLBC_Packet &> *> _PreHandlers;
     _PreHandlers _preHandlers;
+#if LLBC_CFG_COMM_ENABLE_CORO
+    _Handlers _coroHandlers;
+#endif // LLBC_CFG_COMM_ENABLE_CORO
 #if LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
     LLBC_IDelegateEx<LLBC_Packet &> *_unifyPreHandler;
 #endif // LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
@@ -553,6 +831,7 @@ private:
     bool _handlingBeforeFrameTasks;
     bool _handledBeforeFrameTasks;
     bool _handlingAfterFrameTasks;
+    LLBC_AdaptiveLock _frameTasksLock;
 
 private:
 #if LLBC_CFG_OBJBASE_ENABLED
@@ -565,6 +844,31 @@ private:
 private:
     LLBC_EventManager _evManager;
 
+private:
+    LLBC_ServiceExecutor _executor;
+#if LLBC_CFG_COMM_ENABLE_CORO
+    LLBC_ServiceCoroScheduler _coroScheduler;
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+private:
+    LLBC_AdaptiveLock _statLock;
+    typedef std::map<int, LLBC_OpcodeStat> _OpcodeStats;
+    _OpcodeStats _handleStats;
+
+    time_t _lastSamplingTime;
+    uint64 _lastSentBytes;
+    uint64 _lastRecvedBytes;
+    LLBC_IntervalSampler _sentSampler;
+    LLBC_IntervalSampler _recvedSampler;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+private:
+    int _slowFrameThreshold;
+    LLBC_FrameProfiler *_profiler;
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 private:
     LLBC_ServiceMgr &_svcMgr;
 
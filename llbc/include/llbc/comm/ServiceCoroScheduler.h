@@ -0,0 +1,173 @@
+/**
+ * @file    ServiceCoroScheduler.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The service coroutine scheduler, run coroutine packet handlers in service thread.
+ *        Coroutine handler can await reply packet/timer/thread pool future, awaiting coroutine
+ *        not block service thread, woken coroutines resumed in service frame.
+ */
+#ifndef __LLBC_COMM_SERVICE_CORO_SCHEDULER_H__
+#define __LLBC_COMM_SERVICE_CORO_SCHEDULER_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+
+__LLBC_NS_BEGIN
+
+/**
+ * Pre-declare some classes.
+ */
+class LLBC_Packet;
+class LLBC_IService;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The service coroutine scheduler class encapsulation.
+ *        All methods must be called in service thread.
+ */
+class LLBC_HIDDEN LLBC_ServiceCoroScheduler
+{
+public:
+    LLBC_ServiceCoroScheduler();
+    ~LLBC_ServiceCoroScheduler();
+
+public:
+    /**
+     * Set the service.
+     * @param[in] svc - the service.
+     */
+    void SetService(LLBC_IService *svc);
+
+    /**
+     * Get alive(running or suspended) coroutines count.
+     * @return int - the alive coroutines count.
+     */
+    int GetCoroCount() const;
+
+public:
+    /**
+     * Spawn coroutine to handle packet, coroutine run immediately until finished or first await.
+     * @param[in] handler - the packet handler, scheduler not take over it.
+     * @param[in] packet  - the packet, scheduler take over it(include failed).
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Spawn(LLBC_IDelegate1<LLBC_Packet &> *handler, LLBC_Packet *packet);
+
+    /**
+     * Dispatch packet to the coroutine which awaiting this packet(match sessionId + opcode, FIFO).
+     * @param[in] packet - the packet, if dispatched, scheduler take over it.
+     * @return bool - return true if packet dispatched, otherwise return false.
+     */
+    bool DispatchReply(LLBC_Packet *packet);
+
+    /**
+     * Session destroy handler, all reply awaiting coroutines of this session will be woken
+     * with LLBC_ERROR_NOT_FOUND error.
+     * @param[in] sessionId - the destroyed session Id.
+     */
+    void OnSessionDestroy(int sessionId);
+
+    /**
+     * Resume all woken coroutines, call in every service frame.
+     */
+    void Update();
+
+    /**
+     * Cancel all coroutines, all awaiting coroutines woken with LLBC_ERROR_END error and
+     * run to finish, call when service stopping.
+     */
+    void CancelAll();
+
+public:
+    /**
+     * Await reply packet, must be called in coroutine handler.
+     * @param[in] sessionId - the reply packet sessionId.
+     * @param[in] opcode    - the reply packet opcode.
+     * @param[in] timeout   - the timeout, in milli-seconds, LLBC_INFINITE means never timeout.
+     * @return LLBC_Packet * - the reply packet, owned by scheduler, release when coroutine finished,
+     *                         return NULL if failed(timeout: LLBC_ERROR_TIMEOUT, session destroyed:
+     *                         LLBC_ERROR_NOT_FOUND, service stopping: LLBC_ERROR_END).
+     */
+    LLBC_Packet *AwaitReply(int sessionId, int opcode, int timeout);
+
+    /**
+     * Suspend current coroutine specific milli-seconds, must be called in coroutine handler.
+     * @param[in] milliSeconds - the sleep milli-seconds.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Sleep(int milliSeconds);
+
+    /**
+     * Await thread pool future done, must be called in coroutine handler.
+     * @param[in] future  - the future.
+     * @param[in] timeout - the timeout, in milli-seconds, LLBC_INFINITE means never timeout.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int AwaitFuture(const LLBC_Future &future, int timeout);
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_ServiceCoroScheduler);
+
+private:
+    struct _CoroCtx;
+    class _WaitTimer;
+    class _FutureWaker;
+
+    /**
+     * Get current coroutine context.
+     * @return _CoroCtx * - the current coroutine context, if failed, return NULL.
+     */
+    _CoroCtx *GetCurrentCtx();
+
+    /**
+     * Suspend current coroutine until woken.
+     * @param[in] ctx         - the current coroutine context.
+     * @param[in] waitId      - the wait Id.
+     * @param[in] timeout     - the timeout, LLBC_INFINITE means never timeout.
+     * @param[in] timerResult - the timer wake result.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Wait(_CoroCtx *ctx, uint32 waitId, int timeout, int timerResult);
+
+    /**
+     * Wake awaiting coroutine.
+     * @param[in] coroId - the coroutine Id.
+     * @param[in] waitId - the wait Id, use to ignore staled wakeup.
+     * @param[in] result - the wait result.
+     * @param[in] reply  - the reply packet, if woken, coroutine take over it.
+     * @return bool - return true if woken, otherwise return false.
+     */
+    bool Wake(sint64 coroId, uint32 waitId, int result, LLBC_Packet *reply);
+
+    /**
+     * Resume coroutine, if coroutine finished, destroy it.
+     * @param[in] ctx - the coroutine context.
+     */
+    void Resume(_CoroCtx *ctx);
+
+private:
+    LLBC_IService *_svc;
+    bool _cancelling;
+    uint32 _maxWaitId;
+
+    typedef std::map<sint64, _CoroCtx *> _Ctxs;
+    _Ctxs _ctxs;
+    std::vector<_CoroCtx *> _ready;
+
+    typedef std::pair<sint64, uint32> _Waiter;
+    typedef std::pair<int, int> _ReplyKey;
+    typedef std::map<_ReplyKey, std::deque<_Waiter> > _ReplyWaiters;
+    _ReplyWaiters _replyWaiters;
+};
+
+__LLBC_NS_END
+
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+#endif // !__LLBC_COMM_SERVICE_CORO_SCHEDULER_H__
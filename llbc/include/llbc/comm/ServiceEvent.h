@@ -66,6 +66,8 @@ struct LLBC_HIDDEN LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_SessionCreate : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_SessionCreate);
+
     bool isListen;
     int sessionId;
     LLBC_SockAddr_IN local;
@@ -81,6 +83,8 @@ struct LLBC_HIDDEN LLBC_SvcEv_SessionCreate : public LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_SessionDestroy : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_SessionDestroy);
+
     bool isListen;
     int sessionId;
     LLBC_SockAddr_IN local;
@@ -98,6 +102,8 @@ struct LLBC_HIDDEN LLBC_SvcEv_SessionDestroy : public LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_AsyncConn : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_AsyncConn);
+
     bool connected;
     LLBC_String reason;
     LLBC_SockAddr_IN peer;
@@ -111,6 +117,8 @@ struct LLBC_HIDDEN LLBC_SvcEv_AsyncConn : public LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_DataArrival : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_DataArrival);
+
     LLBC_Packet *packet;
 
     LLBC_SvcEv_DataArrival();
@@ -122,6 +130,8 @@ struct LLBC_HIDDEN LLBC_SvcEv_DataArrival : public LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_ProtoReport : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_ProtoReport);
+
     int sessionId;
     int opcode;
 
@@ -138,6 +148,8 @@ struct LLBC_HIDDEN LLBC_SvcEv_ProtoReport : public LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_SubscribeEv : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_SubscribeEv);
+
     int id;
     LLBC_String stub;
     LLBC_IDelegate1<LLBC_Event *> *deleg;
@@ -151,6 +163,8 @@ struct LLBC_HIDDEN LLBC_SvcEv_SubscribeEv : public LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_UnsubscribeEv : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_UnsubscribeEv);
+
     int id;
     LLBC_String stub;
 
@@ -163,6 +177,8 @@ struct LLBC_HIDDEN LLBC_SvcEv_UnsubscribeEv : public LLBC_ServiceEvent
  */
 struct LLBC_HIDDEN LLBC_SvcEv_FireEv : public LLBC_ServiceEvent
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_SvcEv_FireEv);
+
     LLBC_Event *ev;
 
     LLBC_SvcEv_FireEv();
@@ -209,10 +225,13 @@ public:
 
     /**
      * Build subscribe-event event.
+     * Note: If arena specified, event & message block allocate from arena(LLBC_CFG_COM_USE_POOL_ALLOCATOR enabled),
+     *       must handled before arena reset, same as BuildUnsubscribeEvEv()/BuildFireEvEv().
      */
     static LLBC_MessageBlock *BuildSubscribeEvEv(int id,
                                                  const LLBC_String &stub,
-                                                 LLBC_IDelegate1<LLBC_Event *> *deleg);
+                                                 LLBC_IDelegate1<LLBC_Event *> *deleg,
+                                                 LLBC_PoolArena *arena = NULL);
 
     /**
      * Build proto-report event.
@@ -226,12 +245,14 @@ public:
     /**
      * Build unsubscribe-event event.
      */
-    static LLBC_MessageBlock *BuildUnsubscribeEvEv(int id, const LLBC_String &stub);
+    static LLBC_MessageBlock *BuildUnsubscribeEvEv(int id,
+                                                   const LLBC_String &stub,
+                                                   LLBC_PoolArena *arena = NULL);
 
     /**
      * Build fire-event event.
      */
-    static LLBC_MessageBlock *BuildFireEvEv(LLBC_Event *ev);
+    static LLBC_MessageBlock *BuildFireEvEv(LLBC_Event *ev, LLBC_PoolArena *arena = NULL);
 
 public:
     /**
@@ -0,0 +1,58 @@
+/**
+ * @file    ServiceExecutor.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The service executor, post task to service thread to execute.
+ */
+#ifndef __LLBC_COMM_SERVICE_EXECUTOR_H__
+#define __LLBC_COMM_SERVICE_EXECUTOR_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * Pre-declare some classes.
+ */
+class LLBC_IService;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The service executor class encapsulation.
+ *        Execute() post the task to service, task will run in service thread's next frame.
+ */
+class LLBC_HIDDEN LLBC_ServiceExecutor : public LLBC_IExecutor
+{
+public:
+    LLBC_ServiceExecutor();
+    virtual ~LLBC_ServiceExecutor();
+
+public:
+    /**
+     * Set the service.
+     * @param[in] svc - the service.
+     */
+    void SetService(LLBC_IService *svc);
+
+    /**
+     * Execute task in service thread.
+     * @param[in] task - the task delegate, executor take over it.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Execute(LLBC_IDelegate0 *task);
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_ServiceExecutor);
+
+private:
+    LLBC_IService *_svc;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_SERVICE_EXECUTOR_H__
@@ -0,0 +1,104 @@
+/**
+ * @file    ServiceStat.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The service traffic statistic infos(only available when LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT enabled).
+ */
+#ifndef __LLBC_COMM_SERVICE_STAT_H__
+#define __LLBC_COMM_SERVICE_STAT_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The session traffic statistic info.
+ */
+struct LLBC_EXPORT LLBC_SessionStat
+{
+    int sessionId;
+
+    uint64 sentBytes;         // Sent bytes.
+    uint64 sentPackets;       // Sent packets.
+    uint64 sendCalls;         // send() system call times.
+    uint64 sendDroppedPackets; // Dropped stale packets(send lanes low priority lane).
+
+    uint64 recvedBytes;       // Received bytes.
+    uint64 recvedPackets;     // Received packets.
+    uint64 recvCalls;         // recv() system call times.
+    uint64 recvLimitedPackets; // Receive rate limited packets(include dropped/delayed packets).
+    uint64 recvDroppedPackets; // Receive rate limit dropped packets.
+
+    sint64 pendingSendBytes;  // Not yet sent bytes(the send queue depth).
+
+    LLBC_SessionStat();
+
+    /**
+     * Merge other session stat into this stat(sessionId not merge).
+     * @param[in] other - other session stat.
+     */
+    void Merge(const LLBC_SessionStat &other);
+};
+
+/**
+ * \brief The opcode traffic & handle cost statistic info.
+ */
+struct LLBC_EXPORT LLBC_OpcodeStat
+{
+    int opcode;
+
+    uint64 sentBytes;         // Sent bytes(encoded).
+    uint64 sentPackets;       // Sent packets.
+    uint64 recvedBytes;       // Received bytes(decoded from stream).
+    uint64 recvedPackets;     // Received packets.
+
+    LLBC_CostStat handleCost; // Handler cost stat.
+
+    LLBC_OpcodeStat();
+
+    /**
+     * Merge other opcode stat into this stat(opcode not merge).
+     * @param[in] other - other opcode stat.
+     */
+    void Merge(const LLBC_OpcodeStat &other);
+};
+
+/**
+ * \brief The service traffic statistic snapshot.
+ */
+class LLBC_EXPORT LLBC_ServiceStat
+{
+public:
+    LLBC_ServiceStat();
+
+public:
+    /**
+     * Reset the snapshot.
+     */
+    void Reset();
+
+public:
+    int svcId;                // The service Id.
+
+    LLBC_SessionStat total;   // All sessions(include closed sessions) total stat.
+    size_t sessionCount;      // The alive sessions count.
+
+    sint64 sentBytesPerSec;   // Last seconds sent bytes speed.
+    sint64 recvedBytesPerSec; // Last seconds received bytes speed.
+
+    ulong svcQueuedEvents;    // Service queued events count.
+    ulong pollerQueuedEvents; // All pollers queued events count.
+
+    typedef std::map<int, LLBC_OpcodeStat> OpcodeStats;
+    OpcodeStats opcodeStats;  // Opcode stats.
+
+    typedef std::vector<LLBC_SessionStat> SessionStats;
+    SessionStats sessionStats; // Alive session stats.
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_SERVICE_STAT_H__
@@ -13,6 +13,8 @@
 #include "llbc/core/Core.h"
 #include "llbc/objbase/ObjBase.h"
 
+#include "llbc/comm/SendLane.h"
+
 __LLBC_NS_BEGIN
 
 /**
@@ -22,7 +24,11 @@ class LLBC_Packet;
 class LLBC_Socket;
 class LLBC_IService;
 class LLBC_BasePoller;
+class LLBC_PollerStat;
 class LLBC_ProtocolStack;
+class LLBC_RecvLimiter;
+struct LLBC_SessionStat;
+struct LLBC_RecvLimitPolicy;
 
 __LLBC_NS_END
 
@@ -159,6 +165,58 @@ public:
      */
     void SetPoller(LLBC_BasePoller *poller);
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    /**
+     * Set the statistic collector.
+     * @param[in] pollerStat - the owner poller stat.
+     * @param[in] stat       - the session stat, allocated by poller stat.
+     */
+    void SetStat(LLBC_PollerStat *pollerStat, LLBC_SessionStat *stat);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    /**
+     * Check session send corked or not.
+     * @return bool - return true if send corked, otherwise return false.
+     */
+    bool IsSendCorked() const;
+
+    /**
+     * Set session send corked or not, corked session send only append data to socket,
+     * poller will flush corked data, see LLBC_BasePoller::FlushCorkedSession().
+     * @param[in] corked - send corked flag.
+     */
+    void SetSendCorked(bool corked);
+
+    /**
+     * Get the corked(appended but not flushed) send data size.
+     * @return size_t - the corked send data size.
+     */
+    size_t GetCorkedSize() const;
+
+    /**
+     * Reset corked send data size, call by poller when flush session.
+     */
+    void ResetCorkedSize();
+
+    /**
+     * Set the receive rate limit policy, after set, received packets must take tokens before
+     * push to service, see LLBC_IService::SetRecvLimitPolicy().
+     * @param[in] policy - the receive limit policy, NULL means not limit.
+     */
+    void SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy);
+
+    /**
+     * Check session receive paused or not(receive rate limit Delay action).
+     * @return bool - return true if receive paused, otherwise return false.
+     */
+    bool IsRecvPaused() const;
+
+    /**
+     * Push delayed packets to service as tokens allowed, call by poller.
+     * @return bool - return true if all delayed packets pushed(session receive resumed), otherwise return false.
+     */
+    bool ReleaseDelayedPackets();
+
 public:
     /**
      * @Send packet.
@@ -171,10 +229,11 @@ public:
      * Send message block.
      * Note: 
      *       No matter method call success or not, method will steal <block> the parameter.
-     * @param[in] block - the message block.
+     * @param[in] block    - the message block.
+     * @param[in] priority - the send priority, only available when socket send lanes enabled.
      * @return int - return 0 if success, otherwise return -1.
      */
-    int Send(LLBC_MessageBlock *block);
+    int Send(LLBC_MessageBlock *block, int priority = LLBC_SendPriority::Normal);
 
 public:
     /**
@@ -215,6 +274,13 @@ public:
      */
     void OnSent(size_t len);
 
+    /**
+     * Send dropped event handler method, call by socket, when socket dropped stale send lanes data, will call this method.
+     * @param[in] packets - the dropped packets count.
+     * @param[in] len     - the dropped data length, in bytes.
+     */
+    void OnSendDropped(int packets, size_t len);
+
     /**
      * Received event handler method, call by socket, when data received, will call this metho.
      * @param[in] block - the data block.
@@ -222,6 +288,30 @@ public:
      */
     bool OnRecved(LLBC_MessageBlock *block);
 
+#if LLBC_CFG_COMM_ENABLE_UDP
+    /**
+     * Datagram received event handler method, call by poller, one block hold one complete datagram.
+     * @param[in] block - the datagram block.
+     * @return bool - return true if success, otherwise return false(if failed, this method maybe perform OnClose() op).
+     */
+    bool OnDatagramRecved(LLBC_MessageBlock *block);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+    /**
+     * Socket system call event handler method, call by socket, use to statistic send()/recv() call times.
+     * @param[in] sendCalls - the send() call times.
+     * @param[in] recvCalls - the recv() call times.
+     */
+    void OnSysCalls(int sendCalls, int recvCalls);
+
+private:
+    /**
+     * Limit received packet, allowed packet push to service, otherwise perform breach action.
+     * @param[in] packet - the received packet.
+     * @return bool - return true if success, return false if session closed(Disconnect action).
+     */
+    bool LimitRecv(LLBC_Packet *packet);
+
 private:
     int _id;
     LLBC_Socket *_socket;
@@ -233,6 +323,18 @@ private:
     LLBC_ProtocolStack *_protoStack;
 
     int _pollerType;
+
+    bool _sendCorked;
+    size_t _corkedSize;
+
+    LLBC_RecvLimiter *_recvLimiter;
+    std::deque<LLBC_Packet *> _delayedPackets;
+    bool _recvPaused;
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_PollerStat *_pollerStat;
+    LLBC_SessionStat *_stat;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 };
 
 __LLBC_NS_END
@@ -13,6 +13,8 @@
 #include "llbc/core/Core.h"
 #include "llbc/objbase/ObjBase.h"
 
+#include "llbc/comm/SendLane.h"
+
 __LLBC_NS_BEGIN
 
 /**
@@ -54,6 +56,20 @@ public:
      */
     int GetPollerType() const;
 
+    /**
+     * Set the send lanes policy, after set, async sent data queued in per priority lanes, and moved
+     * to send queue by policy when send queue empty(Iocp poller not support).
+     * @param[in] policy - the send lanes policy, shared by sockets, NULL means disable send lanes.
+     */
+    void SetSendLanePolicy(const LLBC_SendLanePolicy *policy);
+
+    /**
+     * Set socket send congested or not, congested socket will drop stale low priority lane data.
+     * Note: Readiness based pollers auto update congested flag in OnSend().
+     * @param[in] congested - the congested flag.
+     */
+    void SetSendCongested(bool congested);
+
     /**
      * Set the poller type.
      * @param[in] type - the poller type.
@@ -67,6 +83,48 @@ public:
      */
     LLBC_SocketHandle Handle();
 
+    /**
+     * Determine this socket is unix domain socket or not.
+     * @return bool - return true if is unix domain socket, otherwise return false.
+     */
+    bool IsUnixSocket() const;
+
+    /**
+     * Mark this socket is unix domain socket or not, unix domain socket has no ip/port address,
+     * local/peer address always set to AF_UNIX family with zero ip and port.
+     * @param[in] unixSocket - the unix domain socket flag.
+     */
+    void SetUnixSocket(bool unixSocket);
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    /**
+     * Determine this socket is datagram(udp) socket or not.
+     * @return bool - return true if is datagram socket, otherwise return false.
+     */
+    bool IsDatagram() const;
+
+    /**
+     * Mark this socket is datagram(udp) socket or not.
+     * @param[in] datagram - the datagram socket flag.
+     */
+    void SetDatagram(bool datagram);
+
+    /**
+     * Determine this socket is datagram peer socket or not.
+     * Datagram peer socket is the pseudo-session socket of listen datagram socket's remote peer,
+     * it share listen socket handle(not owned), only hold the peer address.
+     * @return bool - return true if is datagram peer socket, otherwise return false.
+     */
+    bool IsDatagramPeer() const;
+
+    /**
+     * Create datagram peer socket, only available in listen datagram socket.
+     * @param[in] peer - the remote peer address.
+     * @return LLBC_Socket * - the datagram peer socket.
+     */
+    LLBC_Socket *CreateDatagramPeer(const LLBC_SockAddr_IN &peer);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
     /**
      * Shutdown socket input.
      * @return int - return 0 if success, otherwise return -1.
@@ -179,6 +237,7 @@ public:
 
     /**
      * places the socket a state where it is listening for an incoming connection.
+     * If is datagram socket, only mark socket as listen socket, peer datagrams will dispatch to pseudo-sessions.
      * @param[in] backlog - maximum length of the queue of pending connections.
      * @return int - return 0 if success, otherwise return -1.
      */
@@ -212,6 +271,22 @@ public:
      */
     int Connect(const LLBC_SockAddr_IN &addr);
 
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    /**
+     * Bind current unix domain socket to specific path.
+     * @param[in] path - the unix socket path, if start with '@', means linux abstract namespace.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int BindTo(const char *path);
+
+    /**
+     * Establishes a connection to specified unix socket path.
+     * @param[in] path - the unix socket path, if start with '@', means linux abstract namespace.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Connect(const char *path);
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
 #if LLBC_TARGET_PLATFORM_WIN32
     /**
      * WIN32 specific socket method, connect to peer(asynchronous).
@@ -253,17 +328,25 @@ public:
      * Asynchronous send data, data will append the socket's send queue.
      * Note: 
      *       No matter method call success or not, method will steal <block> the parameter.
-     * @param[in] block - data block.
+     * @param[in] block    - data block.
+     * @param[in] priority - the send priority, only available when send lanes enabled.
      * @return int - return 0 if success, otherwise return -1.
      */
-    int AsyncSend(LLBC_MessageBlock *block);
+    int AsyncSend(LLBC_MessageBlock *block, int priority = LLBC_SendPriority::Normal);
 
     /**
-     * Check the socket exist no send data or not.
+     * Check the socket exist no send data(include send lanes queued data) or not.
      * @return bool - return true it means exist data not send.
      */
     bool IsExistNoSendData() const;
 
+    /**
+     * Merge and detach all not send data, use by completion based pollers(eg: io_uring poller).
+     * If send lanes enabled, only detach one schedule round data.
+     * @return LLBC_MessageBlock * - the merged not send data block, if not exist not send data, return NULL.
+     */
+    LLBC_MessageBlock *DetachNoSendData();
+
     /**
      * Receive data from a connected socket.
      * @param[in] buf - buffer for the incoming data.
@@ -402,6 +485,31 @@ private:
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
 private:
+    /**
+     * Get first not send block, if send queue empty, schedule send lanes data to send queue first.
+     */
+    LLBC_MessageBlock *FirstSendBlock();
+
+    /**
+     * Move one round send lanes data to send queue by send lanes policy.
+     */
+    void ScheduleSendLanes();
+
+    /**
+     * Drop low priority lane stale data.
+     */
+    void DropStaleSendLaneData();
+
+private:
+    /**
+     * The send lane entry.
+     */
+    struct _SendLaneEntry
+    {
+        LLBC_MessageBlock *block;
+        sint64 enqueueTime; // Coarse monotonic clock, in milli-seconds, 0 if not need stale check.
+    };
+    typedef std::deque<_SendLaneEntry> _SendLane;
 
 private:
     LLBC_SocketHandle _handle;
@@ -410,11 +518,21 @@ private:
     int _pollerType;
 
     bool _listenSocket;
+    bool _unixSocket;
+#if LLBC_CFG_COMM_ENABLE_UDP
+    bool _datagram;
+    bool _datagramPeer;
+#endif // LLBC_CFG_COMM_ENABLE_UDP
     LLBC_SockAddr_IN _peerAddr;
     LLBC_SockAddr_IN _localAddr;
 
     LLBC_MessageBuffer _willSend;
 
+    const LLBC_SendLanePolicy *_lanePolicy;
+    _SendLane *_lanes;
+    size_t _laneDeficits[LLBC_SendPriority::End];
+    bool _sendCongested;
+
 #if LLBC_TARGET_PLATFORM_WIN32
     bool _nonBlocking;
     LLBC_OverlappedGroup _olGroup;
@@ -91,6 +91,12 @@ public:
      */
     virtual int AddCoder(int opcode, LLBC_ICoderFactory *coder) = 0;
 
+    /**
+     * Discard the incomplete(partial received) data, used by message boundary preserved transports(eg: udp),
+     * one datagram's unconsumed remain data must not be spliced with the next datagram.
+     */
+    virtual void DiscardIncompleteData();
+
 public:
     /**
      * Set protocol filter to protocol.
@@ -81,6 +81,11 @@ public:
      */
     virtual int AddCoder(int opcode, LLBC_ICoderFactory *coder);
 
+    /**
+     * Discard the partial received packet header and payload.
+     */
+    virtual void DiscardIncompleteData();
+
 private:
     LLBC_PacketHeaderAssembler _headerAssembler;
 
@@ -161,6 +161,11 @@ public:
      */
     int Recv(LLBC_MessageBlock *block, std::vector<LLBC_Packet *> &packets, bool &removeSession);
 
+    /**
+     * Discard the Pack-Layer protocol incomplete data, call after one datagram received.
+     */
+    void DiscardIncompleteData();
+
 private:
     /**
      * Declare friend class: LLBC_IProtocol.
@@ -18,6 +18,7 @@
 // #include "llbc/common/ThirdHeader.h"
 #include "llbc/common/Macro.h"
 #include "llbc/common/BasicDataType.h"
+#include "llbc/common/PoolAllocator.h"
 #include "llbc/common/Define.h"
 #include "llbc/common/Template.h"
 #include "llbc/common/Endian.h"
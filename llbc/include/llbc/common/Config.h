@@ -22,6 +22,28 @@
 #else
  #define LLBC_CFG_OS_DFT_BACKLOG_SIZE                       (SOMAXCONN)
 #endif
+// Determine enable the io_uring raw system call wrappers or not(Linux platform only), see core/os/OS_IoUring.h.
+// The core(file bulk io) and comm(io_uring poller) io_uring supports all depend on this option.
+#if LLBC_TARGET_PLATFORM_LINUX
+ #define LLBC_CFG_OS_ENABLE_IO_URING                        1
+#else // Non-Linux platform
+ #define LLBC_CFG_OS_ENABLE_IO_URING                        0
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+/**
+ * \brief Common about config options define.
+ */
+// Determine LLBC_Malloc/LLBC_Calloc/LLBC_Realloc/LLBC_Free macros use pool allocator or not.
+// If enabled, small blocks allocate from thread cached size-class pools, see common/PoolAllocator.h.
+// If enabled, the classes declared with LLBC_POOL_ALLOCATED_CLASS()(eg: LLBC_Packet, LLBC_MessageBlock, service events)
+// allocate from pool allocator too, LLBC_New/LLBC_Delete of these classes use pool allocator.
+// Note: If enabled, the memory free by LLBC_Free(including the buffers attached to LLBC_Stream/LLBC_MessageBlock
+//       and give up ownership) should be allocated by LLBC_Malloc/LLBC_Calloc/LLBC_Realloc, and vice versa.
+//       The blocks without pool header magic(user/third-party buffers) are passed to free()/realloc(), but
+//       the check is heuristic, so default disabled.
+#define LLBC_CFG_COM_USE_POOL_ALLOCATOR                     0
+// The pool arena chunk size, in bytes, see LLBC_PoolArena.
+#define LLBC_CFG_COM_POOL_ARENA_CHUNK_SIZE                  65536
 
 /**
  * \brief Core/File about config options define.
@@ -29,6 +51,16 @@
 // Define the LLBC_File class CopyFile method copy buffer size, in bytes, default is 16MB.
 // Only used in Non-WIN32 systems.
 #define LLBC_CFG_CORE_FILE_COPY_BUF_SIZE                    16384000
+// Define the LLBC_File class BulkRead/BulkWrite method io block size(in bytes) and max in-flight blocks count.
+// If io_uring not supported or any io_uring operation failed, fallback to buffered read/write.
+#define LLBC_CFG_CORE_FILE_BULK_IO_BLOCK_SIZE               1048576
+#define LLBC_CFG_CORE_FILE_BULK_IO_QUEUE_DEPTH              16
+// Determine BulkRead/BulkWrite method read/write blocks asynchronously by io_uring or not(need LLBC_CFG_OS_ENABLE_IO_URING).
+#if LLBC_CFG_OS_ENABLE_IO_URING
+ #define LLBC_CFG_CORE_FILE_BULK_IO_USE_IO_URING            1
+#else // Not enable io_uring
+ #define LLBC_CFG_CORE_FILE_BULK_IO_USE_IO_URING            0
+#endif // LLBC_CFG_OS_ENABLE_IO_URING
 
 /**
  * \brief Core/Utils about config options define.
@@ -60,6 +92,11 @@
 #define LLBC_CFG_THREAD_MINIMUM_STACK_SIZE                  (1 * 1024 * 1024)
 // Message block default size.
 #define LLBC_CFG_THREAD_MSG_BLOCK_DFT_SIZE                  (1024)
+// Enable/Disable futex based adaptive lock & condition variable(Linux platform available only).
+// If disabled, adaptive lock spin then fallback to system mutex, condition variable use system API.
+#define LLBC_CFG_THREAD_ENABLE_FUTEX                        1
+// Adaptive lock spin count before park.
+#define LLBC_CFG_THREAD_ADAPTIVE_LOCK_SPIN_COUNT            128
 
 /**
  * \brief Core/Log about config options define.
@@ -98,6 +135,33 @@
 #define LLBC_CFG_LOG_MAX_LOG_FLUSH_INTERVAL                 1000
 // Default log using mode.
 #define LLBC_CFG_LOG_USING_WITH_STREAM                      1
+// The log macros compile min level, the LLBC_XXX_LOG macros below this level will compile
+// to no-op(message not evaluate), 0: Debug, 1: Info, 2: Warn, 3: Error, 4: Fatal.
+#define LLBC_CFG_LOG_COMPILE_MIN_LEVEL                      0
+// Determine use the cached time(see LLBC_GetCachedMilliSeconds()) to fill log time in service threads or not,
+// cached time refreshed at every service frame begin, the log lines in same frame share the frame begin time,
+// same as the frame's timers, other threads always use system time, default disabled.
+#define LLBC_CFG_LOG_USING_CACHED_TIME                      0
+// Default binary log(deferred formatting, LLBC_XXX_BLOG macros) records buffer size, in bytes.
+#define LLBC_CFG_LOG_DEFAULT_BINARY_BUFFER_SIZE             4194304
+// The max binary log formats count(every LLBC_XXX_BLOG macro call site register one format).
+#define LLBC_CFG_LOG_MAX_BINARY_FORMAT_COUNT                8192
+// The binary log record max encoded arguments size, in bytes, string arguments will truncate if exceed.
+#define LLBC_CFG_LOG_BINARY_MAX_ARGS_SIZE                   1024
+// The log thread drain binary log records interval, in milli-seconds.
+#define LLBC_CFG_LOG_BINARY_DRAIN_INTERVAL                  5
+// Default network log output pattern.
+#define LLBC_CFG_LOG_DEFAULT_NETWORK_LOG_PATTERN            "%T %f:%l@[%N][%L] - %m%n"
+// Default network log(network appender) frame size, in bytes, log records batch into frames to send.
+#define LLBC_CFG_LOG_DEFAULT_NETWORK_FRAME_SIZE             65536
+// Default network log spill buffer size(not sent frames), in bytes, if full, new frames will drop.
+#define LLBC_CFG_LOG_DEFAULT_NETWORK_SPILL_BUFFER_SIZE      4194304
+// Default network log reconnect interval, in milli-seconds, reconnect interval double after every failure.
+#define LLBC_CFG_LOG_DEFAULT_NETWORK_RECONNECT_INTERVAL     500
+// Default network log max reconnect interval, in milli-seconds.
+#define LLBC_CFG_LOG_DEFAULT_NETWORK_MAX_RECONNECT_INTERVAL 30000
+// The network appender finalize flush timeout, in milli-seconds, send not sent frames as possible before close.
+#define LLBC_CFG_LOG_NETWORK_FINALIZE_FLUSH_TIMEOUT         500
 // Default take over config, only using in root logger, when a message log to 
 // unconfiged logger, root logger will take over, if configed takeover to true.
 #define LLBC_CFG_LOG_ROOT_LOGGER_TAKE_OVER_UNCONFIGED       1
@@ -108,6 +172,29 @@
 // strict timer schedule mode.
 #define LLBC_CFG_CORE_TIMER_STRICT_SCHEDULE                 0
 
+/**
+ * \brief core/profiler about configs.
+ */
+// The frame profiler rolling window size, in seconds, cost stats older than this window will be discarded.
+#define LLBC_CFG_CORE_PROFILER_ROLLING_WINDOW_SECS          60
+// The frame profiler slow frame report top offenders count.
+#define LLBC_CFG_CORE_PROFILER_TOP_OFFENDERS_COUNT          5
+
+/**
+ * \brief core/coro about configs.
+ */
+// The coroutine default stack size.
+#define LLBC_CFG_CORE_CORO_DFT_STACK_SIZE                   (128 * 1024)
+// The coroutine default size stacks cache count, finished coroutine stack will be cached for reuse.
+#define LLBC_CFG_CORE_CORO_STACK_CACHE_COUNT                256
+// Determine use the hand written context switch or not(Linux x86_64 only, other platforms use ucontext/fiber).
+// Hand written context switch not save/restore signal mask, no sigprocmask() system call per switch.
+#if LLBC_TARGET_PLATFORM_LINUX && defined(__x86_64__)
+ #define LLBC_CFG_CORE_CORO_USE_ASM_SWITCH                  1
+#else // Non-Linux platform or Non-x86_64 arch
+ #define LLBC_CFG_CORE_CORO_USE_ASM_SWITCH                  0
+#endif // LLBC_TARGET_PLATFORM_LINUX && defined(__x86_64__)
+
 /**
  * \brief ObjBase about configs.
  */
@@ -135,6 +222,16 @@
 #define LLBC_CFG_COMM_DFT_SEND_BUF_SIZE                     65536
 // Default socket recv buffer size.
 #define LLBC_CFG_COMM_DFT_RECV_BUF_SIZE                     65536
+// The max blocks count gathered into one socket send() call(Non-WIN32 platform).
+#define LLBC_CFG_COMM_SEND_GATHER_COUNT                     64
+// Send cork mode, session corked send data size reach this size will flush immediately, see LLBC_IService::SetSendCork().
+#define LLBC_CFG_COMM_SEND_CORK_MAX_SIZE                    65536
+// Send lanes, the max bytes moved from session send lanes to socket send queue per schedule round, see LLBC_IService::SetSendLanePolicy().
+#define LLBC_CFG_COMM_SEND_LANE_ROUND_SIZE                  65536
+// Send lanes weighted mode, the bytes quantum of one weight unit per schedule round.
+#define LLBC_CFG_COMM_SEND_LANE_QUANTUM                     4096
+// Receive rate limit Delay action, the max delayed packets per session, exceed packets will be dropped, see LLBC_IService::SetRecvLimitPolicy().
+#define LLBC_CFG_COMM_RECV_LIMIT_MAX_DELAYED_PACKETS        4096
 // Default service FPS value.
 #define LLBC_CFG_COMM_DFT_SERVICE_FPS                       60
 // Min service FPS value.
@@ -153,22 +250,74 @@
 #define LLBC_CFG_COMM_ENABLE_STATUS_DESC                    1
 // Determine enable the unify pre-subscribe handler support or not.
 #define LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE             1
+// Determine enable the service frame profiler support or not.
+#define LLBC_CFG_COMM_ENABLE_FRAME_PROFILER                 1
+// Default service slow frame threshold, in milli-seconds, 0 means use 2 times of frame interval.
+#define LLBC_CFG_COMM_DFT_SLOW_FRAME_THRESHOLD              0
+// Determine enable the service coroutine handler support or not.
+#define LLBC_CFG_COMM_ENABLE_CORO                           1
+// Determine enable the unix domain socket(AF_UNIX stream/socketpair) support or not(Non-WIN32 platform only).
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+ #define LLBC_CFG_COMM_ENABLE_UNIX_SOCKET                   1
+#else // LLBC_TARGET_PLATFORM_WIN32
+ #define LLBC_CFG_COMM_ENABLE_UNIX_SOCKET                   0
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+// Determine enable the udp(datagram) session support or not(EpollPoller only, Linux platform only).
+#if LLBC_TARGET_PLATFORM_LINUX
+ #define LLBC_CFG_COMM_ENABLE_UDP                           1
+#else // Non-Linux platform
+ #define LLBC_CFG_COMM_ENABLE_UDP                           0
+#endif // LLBC_TARGET_PLATFORM_LINUX
+// The udp datagrams batch size per recvmmsg()/sendmmsg() system call.
+#define LLBC_CFG_COMM_UDP_BATCH_SIZE                        64
+// The udp max datagram size, in bytes, the truncated(larger) datagrams will be dropped.
+#define LLBC_CFG_COMM_UDP_MAX_DATAGRAM_SIZE                 2048
+// The udp peer pseudo-session idle timeout, in seconds, 0 means never timeout.
+#define LLBC_CFG_COMM_UDP_SESSION_IDLE_TIMEOUT              30
+// The udp listen socket max peer pseudo-sessions count, datagrams from new peers will be dropped
+// when reached limit, 0 means unlimited.
+#define LLBC_CFG_COMM_UDP_MAX_PEERS_PER_LISTENER            10000
+// The udp socket send/recv buffer size, listen socket shared by all peers, so much larger than tcp default.
+// If set to 0, will use system default buffer size(limited by net.core.wmem_max/rmem_max).
+#define LLBC_CFG_COMM_UDP_SEND_BUF_SIZE                     1048576
+#define LLBC_CFG_COMM_UDP_RECV_BUF_SIZE                     1048576
+// Determine enable the io_uring poller support or not(need LLBC_CFG_OS_ENABLE_IO_URING).
+// The IoUringPoller need linux kernel 6.0+ at runtime, if not supported, service will fallback to EpollPoller.
+// Set environment variable LLBC_DISABLE_IO_URING=1 can force fallback to EpollPoller at runtime.
+#if LLBC_CFG_OS_ENABLE_IO_URING
+ #define LLBC_CFG_COMM_ENABLE_IO_URING                      1
+#else // Not enable io_uring
+ #define LLBC_CFG_COMM_ENABLE_IO_URING                      0
+#endif // LLBC_CFG_OS_ENABLE_IO_URING
+// The io_uring submission queue entries per poller, completion queue entries is 4 times of it.
+#define LLBC_CFG_COMM_IO_URING_ENTRIES                      4096
+// The io_uring provided recv buffers count(must be power of 2) and every buffer size per poller.
+#define LLBC_CFG_COMM_IO_URING_RECV_BUF_COUNT               1024
+#define LLBC_CFG_COMM_IO_URING_RECV_BUF_SIZE                8192
+// The busy poll mode default idle time(in micro-seconds), busy polling threads fallback to
+// blocking wait after idle this time, see LLBC_IService::SetBusyPoll().
+#define LLBC_CFG_COMM_DFT_BUSY_POLL_IDLE_USECS              2000
+// The busy poll mode sockets SO_BUSY_POLL option value(in micro-seconds, Linux platform only), 0 means not set.
+#define LLBC_CFG_COMM_BUSY_POLL_SOCKET_USECS                50
 
 // The poller model config(Platform specific).
 //  Alloc set one of the follow configs(string format, case insensitive).
 //   "SelectPoller" : Use select poller(All platform available).
+//   "PollPoller"   : Poll poller(Available in Non-WIN32 platform, no FD_SETSIZE limit).
 //   "EpollPoller"  : Epoll poller(Avaliable in LINUX/Android platform).
+//   "IoUringPoller": io_uring poller(Available in LINUX platform, fallback to EpollPoller if kernel not support).
 //   "IocpPoller"   : Iocp poller(Available in WIN32 platform).
+//  Service can override this config before start, see LLBC_IService::SetPollerModel().
 #if LLBC_TARGET_PLATFORM_LINUX
  #define LLBC_CFG_COMM_POLLER_MODEL                 "EpollPoller"
 #elif LLBC_TARGET_PLATFORM_WIN32
  #define LLBC_CFG_COMM_POLLER_MODEL                 "IocpPoller"
 #elif LLBC_TARGET_PLATFORM_IPHONE
- #define LLBC_CFG_COMM_POLLER_MODEL                 "SelectPoller"
+ #define LLBC_CFG_COMM_POLLER_MODEL                 "PollPoller"
 #elif LLBC_TARGET_PLATFORM_MAC
- #define LLBC_CFG_COMM_POLLER_MODEL                 "SelectPoller"
+ #define LLBC_CFG_COMM_POLLER_MODEL                 "PollPoller"
 #else
- #define LLBC_CFG_COMM_POLLER_MODEL                 "SelectPoller"
+ #define LLBC_CFG_COMM_POLLER_MODEL                 "PollPoller"
 #endif
 
 #endif // !__LLBC_COM_CONFIG_H__
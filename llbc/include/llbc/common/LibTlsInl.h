@@ -52,6 +52,9 @@ struct __LLBC_LibTls
 
         /* Timer scheduler. */
         void *timerScheduler;
+
+        /* Current running coroutine. */
+        void *coro;
     } coreTls;
 
     /* ObjBase-Module TLS valus. */
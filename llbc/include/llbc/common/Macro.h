@@ -239,10 +239,17 @@ private:                                            \
 
 /* Memory operations macros. */
 // allocate/reallocate/free.
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+#define LLBC_Malloc(type, size)             (reinterpret_cast<type *>(LLBC_NS LLBC_PoolMalloc(size)))
+#define LLBC_Calloc(type, size)             (reinterpret_cast<type *>(LLBC_NS LLBC_PoolCalloc(size)))
+#define LLBC_Realloc(type, memblock, size)  (reinterpret_cast<type *>(LLBC_NS LLBC_PoolRealloc((memblock), (size))))
+#define LLBC_Free(memblock)                 (LLBC_NS LLBC_PoolFree(memblock))
+#else // !LLBC_CFG_COM_USE_POOL_ALLOCATOR
 #define LLBC_Malloc(type, size)             (reinterpret_cast<type *>(malloc(size)))
 #define LLBC_Calloc(type, size)             (reinterpret_cast<type *>(calloc(size, 1)))
 #define LLBC_Realloc(type, memblock, size)  (reinterpret_cast<type *>(realloc((memblock), (size))))
 #define LLBC_Free(memblock)                 (free(memblock))
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
 #define LLBC_XFree(memblock)        \
     do {                            \
         if (LIKELY(memblock)) {     \
@@ -41,14 +41,25 @@
  #include <libgen.h>
  #include <sys/time.h>
  #include <sys/socket.h>
+ #include <sys/un.h>
+ #include <poll.h>
  #include <netdb.h>
  #include <dirent.h>
  #include <semaphore.h>
  #include <arpa/inet.h>
  #include <dlfcn.h>
+ #include <sys/mman.h>
 
  #if LLBC_TARGET_PLATFORM_LINUX
   #include <sys/epoll.h>
+  #include <sys/ioctl.h>
+  #include <sys/sendfile.h>
+  #include <sys/syscall.h>
+  #include <linux/futex.h>
+  #if LLBC_CFG_OS_ENABLE_IO_URING
+   #include <linux/io_uring.h>
+  #endif
+  #include <ucontext.h>
  #endif
 
  #if LLBC_TARGET_PLATFORM_MAC || LLBC_TARGET_PLATFORM_IPHONE
@@ -86,6 +97,7 @@
 #include <sstream>
 #include <iomanip>
 #include <memory>
+#include <new>
 #include <vector>
 #include <list>
 #include <queue>
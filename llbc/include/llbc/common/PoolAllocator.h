@@ -0,0 +1,220 @@
+/**
+ * @file    PoolAllocator.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The size-class pool allocator, used by LLBC_Malloc/LLBC_Calloc/LLBC_Realloc/LLBC_Free
+ *        macros when LLBC_CFG_COM_USE_POOL_ALLOCATOR enabled.
+ *        Small blocks are allocated from size-class free lists, each thread cache some free
+ *        blocks, and exchange blocks with central free lists by batch, large blocks directly
+ *        allocate from system.
+ *        Classes declared with LLBC_POOL_ALLOCATED_CLASS() allocate objects from pool allocator(per-class
+ *        tagged statistic), and can be placement allocated from a LLBC_PoolArena(eg: service per-frame events).
+ */
+#ifndef __LLBC_COM_POOL_ALLOCATOR_H__
+#define __LLBC_COM_POOL_ALLOCATOR_H__
+
+#include "llbc/common/PFConfig.h"
+
+#include "llbc/common/Config.h"
+#include "llbc/common/OSHeader.h"
+#include "llbc/common/Macro.h"
+#include "llbc/common/BasicDataType.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The pool allocator statistic info, one size class one stat.
+ */
+struct LLBC_EXPORT LLBC_PoolAllocatorStat
+{
+    size_t blockSize;   // The size class block size, 0 means large blocks(allocate from system).
+
+    uint64 allocTimes;  // Allocate times.
+    uint64 freeTimes;   // Free times.
+    uint64 allocBytes;  // Total allocated bytes(user requested size).
+
+    LLBC_PoolAllocatorStat();
+};
+
+/**
+ * \brief The pool allocator tagged statistic info, one tag one stat(tag is registered by
+ *        LLBC_RegisterPoolAllocatorTag(), LLBC_POOL_ALLOCATED_CLASS() use class name as tag name).
+ */
+struct LLBC_EXPORT LLBC_PoolAllocatorTagStat
+{
+    const char *name;   // The tag name.
+
+    uint64 allocTimes;  // Allocate times(include arena allocate times).
+    uint64 freeTimes;   // Free times(include arena allocated objects destroy times).
+    uint64 allocBytes;  // Total allocated bytes(user requested size).
+
+    LLBC_PoolAllocatorTagStat();
+};
+
+/**
+ * \brief The pool arena, bump allocate memory from chunks, all memory release at once when Reset().
+ *        Arena allocated memory can be passed to LLBC_PoolFree()/LLBC_PoolRealloc(), LLBC_PoolFree() do
+ *        nothing on arena memory, so the objects of LLBC_POOL_ALLOCATED_CLASS() classes placement allocated
+ *        from arena can be deleted as normal.
+ * Note: Arena is not thread safe, and all memory must not used after Reset()/arena destroyed.
+ */
+class LLBC_EXPORT LLBC_PoolArena
+{
+public:
+    explicit LLBC_PoolArena(size_t chunkSize = LLBC_CFG_COM_POOL_ARENA_CHUNK_SIZE);
+    ~LLBC_PoolArena();
+
+public:
+    /**
+     * Allocate memory from arena.
+     * @param[in] size - the memory size, in bytes.
+     * @param[in] tag  - the statistic tag, 0 means untagged.
+     * @return void * - the allocated memory, 16 bytes aligned, if failed return NULL.
+     */
+    void *Alloc(size_t size, uint32 tag = 0);
+
+    /**
+     * Release all allocated memory, the first chunk will be reserved for reuse.
+     */
+    void Reset();
+
+public:
+    /**
+     * Get used bytes(include block headers) since last reset.
+     * @return size_t - the used bytes.
+     */
+    size_t GetUsedSize() const;
+
+    /**
+     * Get allocated chunks count.
+     * @return size_t - the chunks count.
+     */
+    size_t GetChunkCount() const;
+
+private:
+    struct _Chunk;
+
+    _Chunk *AllocChunk(size_t size);
+
+private:
+    size_t _chunkSize;
+
+    _Chunk *_chunks;
+    size_t _chunkCount;
+    size_t _usedSize;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_PoolArena);
+};
+
+/**
+ * Allocate memory from pool allocator.
+ * @param[in] size - the memory size, in bytes.
+ * @return void * - the allocated memory, 16 bytes aligned, if failed return NULL.
+ */
+LLBC_EXTERN LLBC_EXPORT void *LLBC_PoolMalloc(size_t size);
+
+/**
+ * Allocate memory from pool allocator, and set memory to zero.
+ * @param[in] size - the memory size, in bytes.
+ * @return void * - the allocated memory, if failed return NULL.
+ */
+LLBC_EXTERN LLBC_EXPORT void *LLBC_PoolCalloc(size_t size);
+
+/**
+ * Allocate memory from pool allocator, and account to tagged statistic.
+ * @param[in] size - the memory size, in bytes.
+ * @param[in] tag  - the statistic tag, 0 means untagged.
+ * @return void * - the allocated memory, 16 bytes aligned, if failed return NULL.
+ */
+LLBC_EXTERN LLBC_EXPORT void *LLBC_PoolTaggedMalloc(size_t size, uint32 tag);
+
+/**
+ * Reallocate memory, same as realloc() semantic, the statistic tag is kept.
+ * @param[in] memblock - the memory block, must allocated from pool allocator, can be NULL.
+ * @param[in] size     - the new size, in bytes.
+ * @return void * - the reallocated memory, if failed return NULL(and memblock still valid).
+ */
+LLBC_EXTERN LLBC_EXPORT void *LLBC_PoolRealloc(void *memblock, size_t size);
+
+/**
+ * Free memory to pool allocator.
+ * @param[in] memblock - the memory block, must allocated from pool allocator, can be NULL.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_PoolFree(void *memblock);
+
+/**
+ * Return current thread cached free blocks to central free lists.
+ * Note: Thread exit will auto return cached blocks, call it if thread will be idle for a long time.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_TrimPoolAllocatorThreadCache();
+
+/**
+ * Get pool allocator statistic infos.
+ * @param[out] stats - the statistic infos, all size classes stats, the last one is large blocks stat.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_GetPoolAllocatorStats(std::vector<LLBC_PoolAllocatorStat> &stats);
+
+/**
+ * Register pool allocator statistic tag, register same name more than once return same tag.
+ * @param[in] name - the tag name, must be a static storage string(eg: string literal).
+ * @return uint32 - the tag, if tags full or name is NULL, return 0(untagged).
+ */
+LLBC_EXTERN LLBC_EXPORT uint32 LLBC_RegisterPoolAllocatorTag(const char *name);
+
+/**
+ * Get pool allocator tagged statistic infos.
+ * @param[out] stats - the statistic infos, all registered tags stats, in register order.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_GetPoolAllocatorTagStats(std::vector<LLBC_PoolAllocatorTagStat> &stats);
+
+__LLBC_NS_END
+
+/**
+ * Declare class objects allocate from pool allocator(tagged by class name), use in class public section.
+ * Placement allocate from LLBC_PoolArena:
+ *      LLBC_Packet *packet = new (arena) LLBC_Packet;
+ *      ...
+ *      LLBC_Delete(packet); // Destruct only, memory release when arena reset.
+ * Note: If LLBC_CFG_COM_USE_POOL_ALLOCATOR disabled, this macro define nothing.
+ */
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+#define LLBC_POOL_ALLOCATED_CLASS(cls)                                                  \
+public:                                                                                 \
+    static void *operator new(size_t size)                                              \
+    {                                                                                   \
+        static const LLBC_NS uint32 tag = LLBC_NS LLBC_RegisterPoolAllocatorTag(#cls);  \
+        void *mem = LLBC_NS LLBC_PoolTaggedMalloc(size, tag);                           \
+        if (UNLIKELY(!mem))                                                             \
+            throw std::bad_alloc();                                                     \
+        return mem;                                                                     \
+    }                                                                                   \
+    static void *operator new(size_t size, LLBC_NS LLBC_PoolArena &arena)               \
+    {                                                                                   \
+        static const LLBC_NS uint32 tag = LLBC_NS LLBC_RegisterPoolAllocatorTag(#cls);  \
+        void *mem = arena.Alloc(size, tag);                                             \
+        if (UNLIKELY(!mem))                                                             \
+            throw std::bad_alloc();                                                     \
+        return mem;                                                                     \
+    }                                                                                   \
+    static void *operator new(size_t size, void *place)                                 \
+    {                                                                                   \
+        return place;                                                                   \
+    }                                                                                   \
+    static void operator delete(void *memblock)                                         \
+    {                                                                                   \
+        LLBC_NS LLBC_PoolFree(memblock);                                                \
+    }                                                                                   \
+    static void operator delete(void *memblock, LLBC_NS LLBC_PoolArena &arena)          \
+    {                                                                                   \
+    }                                                                                   \
+    static void operator delete(void *memblock, void *place)                            \
+    {                                                                                   \
+    }                                                                                   \
+
+#else // !LLBC_CFG_COM_USE_POOL_ALLOCATOR
+#define LLBC_POOL_ALLOCATED_CLASS(cls)
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
+#endif // !__LLBC_COM_POOL_ALLOCATOR_H__
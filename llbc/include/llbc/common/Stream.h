@@ -13,6 +13,7 @@
 
 #include "llbc/common/Macro.h"
 #include "llbc/common/BasicDataType.h"
+#include "llbc/common/PoolAllocator.h"
 
 /** Some stream helper macros define **/
 /*  DeSerialize/Read about macros define  */
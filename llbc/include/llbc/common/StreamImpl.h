@@ -55,7 +55,7 @@ inline LLBC_Stream::LLBC_Stream(size_t size)
 {
     if (size > 0)
     {
-        _buf = calloc(size, 1);
+        _buf = LLBC_Calloc(void, size);
         ASSERT(_buf && "LLBC_Stream object alloc memory from heap failed");
     }
     else
@@ -125,7 +125,7 @@ inline void LLBC_Stream::Assign(const LLBC_Stream &rhs)
 
     if (rhs._buf)
     {
-        _buf = malloc(rhs._size);
+        _buf = LLBC_Malloc(void, rhs._size);
         memcpy(_buf, rhs._buf, rhs._size);
     }
     else
@@ -148,7 +148,7 @@ inline void LLBC_Stream::Assign(void *buf, size_t len)
 
     if (buf && len > 0)
     {
-        _buf = malloc(len);
+        _buf = LLBC_Malloc(void, len);
         memcpy(_buf, buf, len);
 
         _size = len;
@@ -383,7 +383,7 @@ inline void LLBC_Stream::Resize(size_t newSize)
 {
     if (newSize > _size)
     {
-        _buf = realloc(_buf, newSize);
+        _buf = LLBC_Realloc(void, _buf, newSize);
         ASSERT(_buf && "alloc memory from heap fail!");
 
         _size = newSize;
@@ -393,7 +393,7 @@ inline void LLBC_Stream::Resize(size_t newSize)
 inline void LLBC_Stream::Cleanup()
 {
     if (_buf && !_attach)
-        free(_buf);
+        LLBC_Free(_buf);
 
     _buf = NULL;
     _size = _pos = 0;
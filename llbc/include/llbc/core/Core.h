@@ -15,6 +15,7 @@
 #include "llbc/core/bundle/Common.h"
 #include "llbc/core/utils/Common.h"
 #include "llbc/core/sampler/Common.h"
+#include "llbc/core/profiler/Common.h"
 #include "llbc/core/helper/Common.h"
 #include "llbc/core/file/Common.h"
 #include "llbc/core/comstring/Common.h"
@@ -25,6 +26,7 @@
 #include "llbc/core/event/Common.h"
 #include "llbc/core/timer/Common.h"
 #include "llbc/core/thread/Common.h"
+#include "llbc/core/coro/Common.h"
 #include "llbc/core/singleton/Singleton.h"
 #include "llbc/core/log/Common.h"
 #include "llbc/core/random/Common.h"
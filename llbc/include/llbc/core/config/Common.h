@@ -12,5 +12,6 @@
 #include "llbc/core/config/Ini.h"
 #include "llbc/core/config/Config.h"
 #include "llbc/core/config/Property.h"
+#include "llbc/core/config/ConfigSnapshot.h"
 
 #endif // !__LLBC_CORE_CONFIG_COMMON_H__
@@ -0,0 +1,137 @@
+/**
+ * @file    ConfigSnapshot.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_CONFIG_CONFIG_SNAPSHOT_H__
+#define __LLBC_CORE_CONFIG_CONFIG_SNAPSHOT_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/file/MappedFile.h"
+#include "llbc/core/variant/Variant.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * Previous declare some classes.
+ */
+class LLBC_Ini;
+class LLBC_Property;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The config snapshot class encapsulation.
+ *        Config snapshot is the compiled binary format of ini/property config, the snapshot
+ *        file will be memory mapped, and query directly, without any parse operation.
+ *        All snapshot entries are (section, key, value) string triples, sorted by section and key.
+ * Note:
+ *      - Property config compiled entries's section is empty string, key is the property full name.
+ *      - Snapshot file is machine dependent(native endian), do not share it between different machines.
+ */
+class LLBC_EXPORT LLBC_ConfigSnapshot
+{
+    typedef LLBC_ConfigSnapshot This;
+
+public:
+    LLBC_ConfigSnapshot();
+    ~LLBC_ConfigSnapshot();
+
+public:
+    /**
+     * Compile ini config to snapshot file.
+     * @param[in] ini  - the ini config.
+     * @param[in] file - the snapshot file path.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    static int Compile(const LLBC_Ini &ini, const LLBC_String &file);
+
+    /**
+     * Compile property config to snapshot file.
+     * @param[in] property - the property config.
+     * @param[in] file     - the snapshot file path.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    static int Compile(const LLBC_Property &property, const LLBC_String &file);
+
+public:
+    /**
+     * Open snapshot file.
+     * @param[in] file - the snapshot file path.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Open(const LLBC_String &file);
+
+    /**
+     * Check snapshot opened or not.
+     * @return bool - return true if opened, otherwise return false.
+     */
+    bool IsOpened() const;
+
+    /**
+     * Close snapshot.
+     */
+    void Close();
+
+public:
+    /**
+     * Get the snapshot entry count.
+     * @return size_t - the entry count.
+     */
+    size_t GetEntryCount() const;
+
+    /**
+     * Check has specific section/key value or not.
+     * @param[in] section - the section name, property config use empty string.
+     * @param[in] key     - the key.
+     * @return bool - return true if exist, otherwise return false.
+     */
+    bool IsHasKey(const LLBC_String &section, const LLBC_String &key) const;
+
+    /**
+     * Get specific section/key raw value, the value pointer to mapped snapshot file memory,
+     * available until snapshot closed.
+     * @param[in] section - the section name, property config use empty string.
+     * @param[in] key     - the key.
+     * @param[out] len    - the value length, optional.
+     * @return const char * - the value(null-terminated), if not found, return NULL.
+     */
+    const char *GetRawValue(const LLBC_String &section, const LLBC_String &key, size_t *len = NULL) const;
+
+    /**
+     * Get specific section/key value.
+     * @param[in] section - the section name, property config use empty string.
+     * @param[in] key     - the key.
+     * @param[in] dft     - the default value, if not found, return this value.
+     * @return LLBC_Variant - the value, if return default value, LLBC_GetLastError() return LLBC_ERROR_NOT_FOUND.
+     */
+    LLBC_Variant GetValue(const LLBC_String &section,
+                          const LLBC_String &key,
+                          const LLBC_Variant &dft = LLBC_Variant()) const;
+
+private:
+    typedef std::vector<std::pair<std::pair<LLBC_String, LLBC_String>, LLBC_String> > _Triples;
+    static int Compile(_Triples &triples, const LLBC_String &file);
+
+    const void *Find(const LLBC_String &section, const LLBC_String &key) const;
+
+private:
+    LLBC_DISABLE_ASSIGNMENT(LLBC_ConfigSnapshot);
+
+private:
+    LLBC_MappedFile _file;
+
+    size_t _entryCount;
+    const void *_entries;
+    const char *_strPool;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_CONFIG_CONFIG_SNAPSHOT_H__
@@ -158,7 +158,7 @@ public:
 
 public:
     /**
-     * Load ini config from file.
+     * Load ini config from file, the file will be memory mapped and parse in place.
      * @param[in] file - the file name.
      * @return int - return 0 if success, otherwise return -1.
      */
@@ -169,6 +169,13 @@ public:
      * @return int - return 0 if success, otherwise return -1.
      */
     int LoadFromContent(const LLBC_String &content);
+    /**
+     * Load ini config from raw content buffer.
+     * @param[in] content - the content buffer.
+     * @param[in] len     - the content length, in bytes.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int LoadFromContent(const char *content, size_t len);
 
     /**
      * Get load error after called LoadFromContent/LoadFromFile.
@@ -281,27 +288,31 @@ public:
     This &operator =(const This &another);
 
 private:
-    int ParseLine(const LLBC_String &line, size_t lineNum, LLBC_String &sectionName);
-    int TryParseSectionName(const LLBC_String &content,
+    int ParseLine(const char *line, size_t len, size_t lineNum, LLBC_String &sectionName);
+    int TryParseSectionName(const char *content,
+                            size_t len,
                             const LLBC_String &comment,
                             size_t lineNum,
                             size_t contentBeginPos,
                             LLBC_String &sectionName,
                             bool &failedContinue);
-    int Split(const LLBC_String &line,
-              size_t lineNum,
-              size_t beginPos,
-              char sep,
-              LLBC_String &left,
-              LLBC_String &right,
-              bool requireFoundSep = false);
+    int FindSeparator(const char *str,
+                      size_t len,
+                      size_t lineNum,
+                      size_t beginPos,
+                      char sep,
+                      size_t &sepPos,
+                      bool requireFoundSep = false);
 
 private:
     LLBC_String Escape(const LLBC_String &str) const;
-    int UnEscape(LLBC_String &str,
+    int UnEscape(const char *str,
+                 size_t len,
                  size_t lineNum,
                  size_t beginPos,
-                 size_t &unescapeTimes);
+                 LLBC_String *unescaped);
+
+    static bool IsSpace(char ch);
 
     static void EndLine(LLBC_String &str);
 
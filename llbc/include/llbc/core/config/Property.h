@@ -47,7 +47,7 @@ public:
 
 public:
     /**
-     * Load properties data from file.
+     * Load properties data from file, the file will be memory mapped and parse in place.
      * @param[in] file - the file name.
      * @return int - return 0 if success, otherwise return -1.
      */
@@ -60,6 +60,14 @@ public:
      */
     int LoadFromContent(const LLBC_String &content);
 
+    /**
+     * Load properties data from raw content buffer.
+     * @param[in] content - properties content buffer.
+     * @param[in] len     - the content length, in bytes.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int LoadFromContent(const char *content, size_t len);
+
     /**
      * @Save properties to file.
      * @param[in] file - the file name.
@@ -191,7 +199,7 @@ private:
 
     bool CheckName(const LLBC_String &name, bool allowSeparator = true) const;
 
-    LLBC_Strings NormalizeContent(const LLBC_String &content);
+    static const char *NextLine(const char *content, const char *contentEnd, const char *&lineEnd);
 
 
     int ParseLine(const LLBC_String &line, int lineNo);
@@ -0,0 +1,129 @@
+/**
+ * @file    Coro.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The stackful coroutine.
+ *        Linux x86_64 platform use hand written context switch implement(see LLBC_CFG_CORE_CORO_USE_ASM_SWITCH),
+ *        other Linux platforms use ucontext implement, WIN32 platform use fiber implement.
+ *        Linux coroutine stack is mmap allocated, with a PROT_NONE guard page below it.
+ *        Coroutine must be resumed in the thread which first resume it.
+ */
+#ifndef __LLBC_CORE_CORO_CORO_H__
+#define __LLBC_CORE_CORO_CORO_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/utils/Util_DelegateImpl.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The coroutine class encapsulation.
+ */
+class LLBC_EXPORT LLBC_Coro
+{
+public:
+    /**
+     * The coroutine state enumeration.
+     */
+    enum State
+    {
+        Ready,      // Created, not yet resumed.
+        Running,    // Running.
+        Suspended,  // Yielded, wait resume.
+        Finished    // Entry returned.
+    };
+
+public:
+    /**
+     * Construct coroutine.
+     * @param[in] entry     - the coroutine entry delegate, coroutine take over it.
+     * @param[in] stackSize - the coroutine stack size, 0 means use LLBC_CFG_CORE_CORO_DFT_STACK_SIZE.
+     */
+    explicit LLBC_Coro(LLBC_IDelegate0 *entry, size_t stackSize = 0);
+
+    /**
+     * Destruct coroutine.
+     * Note: If coroutine in suspended state, the objects in coroutine stack will not be destructed,
+     *       so always resume coroutine until finished before destruct.
+     */
+    ~LLBC_Coro();
+
+public:
+    /**
+     * Get coroutine Id, unique in process.
+     * @return sint64 - the coroutine Id.
+     */
+    sint64 GetId() const;
+
+    /**
+     * Get coroutine state.
+     * @return int - the coroutine state, see State enumeration.
+     */
+    int GetState() const;
+
+    /**
+     * Resume coroutine, run coroutine until coroutine yield or finished.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Resume();
+
+public:
+    /**
+     * Yield current coroutine, switch back to the resumer.
+     * @return int - return 0 if success, otherwise return -1(not in coroutine).
+     */
+    static int Yield();
+
+    /**
+     * Get current running coroutine.
+     * @return LLBC_Coro * - the current running coroutine, if not in coroutine, return NULL.
+     */
+    static LLBC_Coro *GetCurrent();
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_Coro);
+
+private:
+    /**
+     * Run coroutine entry.
+     */
+    void Run();
+
+#if LLBC_TARGET_PLATFORM_LINUX
+ #if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+    static void Entry(LLBC_Coro *coro);
+ #else // !LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+    static void Entry(uint32 high, uint32 low);
+ #endif // LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+#elif LLBC_TARGET_PLATFORM_WIN32
+    static void WINAPI Entry(void *arg);
+#endif
+
+private:
+    sint64 _id;
+    volatile int _state;
+    LLBC_IDelegate0 *_entry;
+
+    size_t _stackSize;
+    LLBC_Coro *_prevCoro;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    void *_stack;
+ #if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+    void *_sp;
+    void *_callerSp;
+ #else // !LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+    ucontext_t _ctx;
+    ucontext_t _callerCtx;
+ #endif // LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+#elif LLBC_TARGET_PLATFORM_WIN32
+    LPVOID _fiber;
+    LPVOID _callerFiber;
+#endif
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_CORO_CORO_H__
@@ -9,5 +9,6 @@
 
 #include "llbc/core/file/File.h"
 #include "llbc/core/file/Directory.h"
+#include "llbc/core/file/MappedFile.h"
 
 #endif // __LLBC_CORE_FILE_COMMON_H__
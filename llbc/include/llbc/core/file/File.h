@@ -13,6 +13,15 @@
 
 __LLBC_NS_BEGIN
 
+/**
+ * Pre-declare some classes.
+ */
+class LLBC_MappedFile;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
 /**
  * \brief The file mode enumerations
  */
@@ -283,6 +292,18 @@ public:
     LLBC_String ReadToEnd();
     static LLBC_String ReadToEnd(const LLBC_String &filePath);
 
+    /**
+     * Bulk read file data at specified offset, file position not used and not changed.
+     * Note: In linux platform, if io_uring supported, data will split to LLBC_CFG_CORE_FILE_BULK_IO_BLOCK_SIZE blocks
+     *       and read asynchronously(at most LLBC_CFG_CORE_FILE_BULK_IO_QUEUE_DEPTH blocks in flight),
+     *       otherwise fallback to buffered read.
+     * @param[in] buf    - storage location for data.
+     * @param[in] size   - read size in bytes.
+     * @param[in] offset - the file offset.
+     * @return sint64 - actually read size, if -1, read failed, else if less than size, it means reached end of file.
+     */
+    sint64 BulkRead(void *buf, size_t size, sint64 offset);
+
     /**
      * File bytes read method.
      * @param[in] buf  - storage location for data.
@@ -337,6 +358,17 @@ public:
      */
     long Write(const void *buf, size_t size);
 
+    /**
+     * Bulk write data to file at specified offset, file position not used and not changed, see BulkRead().
+     * Note: If file opened in append mode, data always append to end of file(not use io_uring).
+     *       Data already in stdio read buffer not refreshed, Seek before Read to read the written data.
+     * @param[in] buf    - pointer to data to be written.
+     * @param[in] size   - buffer size in bytes.
+     * @param[in] offset - the file offset.
+     * @return sint64 - actually written size, in bytes, if write failed, return -1.
+     */
+    sint64 BulkWrite(const void *buf, size_t size, sint64 offset);
+
     /**
      * Flush file.
      * @return int - return 0 if success, otherwise return -1.
@@ -381,6 +413,8 @@ public:
 public:
     /**
      * Copy file.
+     * Note: In linux platform, will try reflink first, then copy in kernel(copy_file_range/sendfile),
+     *       if all not supported, fallback to copy by user space buffer.
      * @param[in] srcFilePath  - the source file path.
      * @param[in] destFilePath - the destination file path.
      * @param[in] overlapped   - if the new file already exists, the function overrides the existing file and succeeds, otherwise failed.
@@ -409,6 +443,17 @@ public:
     int DeleteFile();
     static int DeleteFile(const LLBC_String &filePath);
 
+public:
+    /**
+     * Map file to memory, get a read-only view of file content.
+     * Note: Non-static version will flush file before map.
+     * @param[in] filePath    - the will map file path.
+     * @param[out] mappedFile - the mapped file, must not opened.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Map(LLBC_MappedFile &mappedFile);
+    static int Map(const LLBC_String &filePath, LLBC_MappedFile &mappedFile);
+
 private:
     /**
      * Parse file mode to system file access mode.
@@ -0,0 +1,99 @@
+/**
+ * @file    MappedFile.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_FILE_MAPPED_FILE_H__
+#define __LLBC_CORE_FILE_MAPPED_FILE_H__
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The read-only memory mapped file class encapsulation.
+ *        Map whole file content to process address space, the file content can be
+ *        accessed directly, without copy to user-space buffer.
+ */
+class LLBC_EXPORT LLBC_MappedFile
+{
+public:
+    /**
+     * Default constructor.
+     */
+    LLBC_MappedFile();
+
+    /**
+     * Construct mapped file object and map the given file.
+     * Note: Use IsOpened() method to check file map success or not.
+     * @param[in] path - the file path.
+     */
+    explicit LLBC_MappedFile(const LLBC_String &path);
+
+    /**
+     * Destructor, will unmap the file.
+     */
+    ~LLBC_MappedFile();
+
+public:
+    /**
+     * Map the given file(read-only).
+     * Note: Empty file can be mapped too, but GetData() will return NULL.
+     * @param[in] path - the file path.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Open(const LLBC_String &path);
+
+    /**
+     * Check file mapped or not.
+     * @return bool - return true if mapped, otherwise return false.
+     */
+    bool IsOpened() const;
+
+    /**
+     * Unmap the file.
+     */
+    void Close();
+
+public:
+    /**
+     * Get the mapped file path.
+     * @return const LLBC_String & - the file path.
+     */
+    const LLBC_String &GetPath() const;
+
+    /**
+     * Get the mapped file content.
+     * @return const char * - the file content begin, if file is empty, return NULL.
+     */
+    const char *GetData() const;
+
+    /**
+     * Get the mapped file size.
+     * @return size_t - the file size, in bytes.
+     */
+    size_t GetSize() const;
+
+private:
+    LLBC_DISABLE_ASSIGNMENT(LLBC_MappedFile);
+
+private:
+    LLBC_String _path;
+    bool _opened;
+
+    const char *_data;
+    size_t _size;
+
+#if LLBC_TARGET_PLATFORM_WIN32
+    HANDLE _mapping;
+#endif // LLBC_TARGET_PLATFORM_WIN32
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/file/MappedFileImpl.h"
+
+#endif // !__LLBC_CORE_FILE_MAPPED_FILE_H__
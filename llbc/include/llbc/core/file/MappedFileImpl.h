@@ -0,0 +1,35 @@
+/**
+ * @file    MappedFileImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifdef __LLBC_CORE_FILE_MAPPED_FILE_H__
+
+__LLBC_NS_BEGIN
+
+inline bool LLBC_MappedFile::IsOpened() const
+{
+    return _opened;
+}
+
+inline const LLBC_String &LLBC_MappedFile::GetPath() const
+{
+    return _path;
+}
+
+inline const char *LLBC_MappedFile::GetData() const
+{
+    return _data;
+}
+
+inline size_t LLBC_MappedFile::GetSize() const
+{
+    return _size;
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_FILE_MAPPED_FILE_H__
@@ -0,0 +1,325 @@
+#ifndef JSON_DOCUMENT_H_INCLUDED
+# define JSON_DOCUMENT_H_INCLUDED
+
+# include "forwards.h"
+# include <string>
+# include <vector>
+
+__LLBC_NS_BEGIN
+
+namespace Json {
+
+   /** \brief Structural index of a <a HREF="http://www.json.org">JSON</a> document (parse stage 1).
+    *
+    * Scan the document 64 bytes per step (SSE2 when available), resolve escapes and string
+    * regions with bit operations, and record the offset of every structural character
+    * ('{', '}', '[', ']', ':', ',') and every scalar start (string quote, number, literal)
+    * outside strings. UTF-8 and control characters in strings are validated at the same time.
+    *
+    * The index refers to the scanned document, document must outlive the index.
+    */
+   class JSON_API StructuralIndex
+   {
+   public:
+      StructuralIndex();
+
+      /** \brief Build structural index of document [begin, end).
+       * \return \c true if success, \c false if document has unclosed string, invalid UTF-8,
+       *         control character in string or exceed 4GB.
+       */
+      bool build( const char *begin, const char *end );
+
+      /// Get document begin/end.
+      const char *begin() const;
+      const char *end() const;
+
+      /// Get structurals count.
+      unsigned int size() const;
+
+      /// Get the structural offset at index position.
+      unsigned int operator[]( unsigned int index ) const;
+
+      /// Get the structural character at index position.
+      char charAt( unsigned int index ) const;
+
+      /// Get the error message & error offset of last build failed.
+      const std::string &getErrorMessage() const;
+      unsigned int getErrorOffset() const;
+
+   private:
+      bool fail( const char *message, unsigned int offset );
+
+   private:
+      const char *begin_;
+      const char *end_;
+      std::vector<unsigned int> positions_;
+      std::string errorMessage_;
+      unsigned int errorOffset_;
+   };
+
+   /** \brief Arena backed DOM of a <a HREF="http://www.json.org">JSON</a> document (parse stage 2).
+    *
+    * All nodes are stored in one flat node array(depth first order, containers record their subtree end,
+    * so skip a subtree is O(1)), all decoded strings are stored in one string arena.
+    * Parse again reuses the node array & string arena, no per node allocation.
+    *
+    * Parse is strict <a HREF="http://www.ietf.org/rfc/rfc4627.txt">RFC 4627</a>: no comments,
+    * no trailing content, numbers without leading zeros, lone surrogate escapes rejected.
+    * Object members keep document order, duplicated member names are all kept.
+    *
+    * Usage:
+    * \code
+    * Json::Document doc;
+    * if ( doc.parse( text ) )
+    *    int port = (int)doc.root()["listen"]["port"].asInt64();
+    * \endcode
+    */
+   class JSON_API Document
+   {
+   public:
+      enum NodeType
+      {
+         nullNode = 0,
+         falseNode,
+         trueNode,
+         int64Node,     ///< integer in [minLong, maxLong].
+         uint64Node,    ///< integer in (maxLong, maxULong].
+         doubleNode,    ///< number with fraction/exponent, or integer out of 64 bits range.
+         stringNode,
+         arrayNode,
+         objectNode
+      };
+
+   private:
+      struct Entry
+      {
+         unsigned int type;
+         unsigned int next;   // Index of next sibling entry(subtree end).
+         unsigned int size;   // Container: elements/members count, string: string length.
+         union
+         {
+            LongLong int64_;
+            ULongLong uint64_;
+            double double_;
+            unsigned int string_; // Offset in string arena.
+         } value_;
+      };
+
+   public:
+      class Iterator;
+
+      /** \brief Lightweight read only handle of a DOM node, valid until document parse again or destroyed.
+       */
+      class JSON_API Node
+      {
+      public:
+         Node();
+
+         bool isValid() const;
+         NodeType type() const;
+
+         bool isNull() const;
+         bool isBool() const;
+         bool isNumber() const;
+         bool isIntegral() const;
+         bool isString() const;
+         bool isArray() const;
+         bool isObject() const;
+
+         bool asBool() const;
+         LongLong asInt64() const;
+         ULongLong asUInt64() const;
+         double asDouble() const;
+         const char *asCString() const;
+         unsigned int stringLength() const;
+         std::string asString() const;
+
+         /// Elements/members count if is array/object, otherwise return 0.
+         unsigned int size() const;
+
+         /// Get array element, return invalid node if not array or index out of range.
+         Node operator[]( unsigned int index ) const;
+
+         /// Get object member(the last one if duplicated), return invalid node if not object or not found.
+         Node operator[]( const char *key ) const;
+         Node operator[]( const std::string &key ) const;
+
+         /// Iterate array elements/object members.
+         Iterator begin() const;
+         Iterator end() const;
+
+      private:
+         friend class Document;
+         friend class Iterator;
+         Node( const Document *document, unsigned int index );
+
+         const Entry &entry() const;
+         Node findMember( const char *key, unsigned int keyLength ) const;
+
+      private:
+         const Document *document_;
+         unsigned int index_;
+      };
+
+      /** \brief Array element/object member iterator.
+       */
+      class JSON_API Iterator
+      {
+      public:
+         Iterator();
+
+         /// Member key node, invalid node if iterating array.
+         Node key() const;
+         Node value() const;
+
+         Iterator &operator++();
+         bool operator ==( const Iterator &other ) const;
+         bool operator !=( const Iterator &other ) const;
+
+      private:
+         friend class Node;
+         Iterator( const Document *document, unsigned int index, bool isObject );
+
+      private:
+         const Document *document_;
+         unsigned int index_;
+         bool isObject_;
+      };
+
+   public:
+      Document();
+
+      /** \brief Parse a document, previous parsed nodes become invalid.
+       * \return \c true if success, \c false if failed, error message see getErrorMessage().
+       */
+      bool parse( const char *begin, const char *end );
+      bool parse( const std::string &document );
+
+      /** \brief Build DOM from a structural index built by StructuralIndex::build().
+       */
+      bool parse( const StructuralIndex &index );
+
+      /// Get root node, invalid node if not parsed or parse failed.
+      Node root() const;
+
+      /// Convert node to Value(Value stays an adapter over the DOM, number types same as Reader).
+      static void toValue( const Node &node, Value &value );
+
+      /** \brief Build Value directly from a structural index, skip DOM(used by Reader), number types same as Reader.
+       * \return \c true if success, \c false if failed(root may be partially assigned).
+       */
+      static bool toValue( const StructuralIndex &index, Value &root );
+
+      /// Get the error message & error offset of last parse failed.
+      const std::string &getErrorMessage() const;
+      unsigned int getErrorOffset() const;
+
+   private:
+      class Builder;
+      friend class Builder;
+      friend class Node;
+      friend class Iterator;
+
+      bool fail( const char *message, unsigned int offset );
+
+   private:
+      StructuralIndex index_;
+      std::vector<Entry> entries_;
+      std::vector<char> strings_;
+      std::vector<unsigned int> openContainers_;
+      std::string errorMessage_;
+      unsigned int errorOffset_;
+      bool parsed_;
+   };
+
+   /** \brief On demand cursor of a <a HREF="http://www.json.org">JSON</a> document.
+    *
+    * Only run parse stage 1(structural index & brackets matching), scalars are decoded when accessed,
+    * unvisited subtrees are skipped by matched brackets, no DOM built.
+    * Suit for picking a few fields from a large document.
+    *
+    * Grammar errors are detected lazily: accessing a malformed part returns invalid element/false.
+    * Document must outlive the cursor.
+    */
+   class JSON_API Cursor
+   {
+   public:
+      /** \brief Lightweight element handle, valid until cursor reset or destroyed.
+       */
+      class JSON_API Element
+      {
+      public:
+         Element();
+
+         bool isValid() const;
+
+         /// Get element type, integers resolve to int64Node/uint64Node/doubleNode same as Document.
+         Document::NodeType type() const;
+
+         bool isNull() const;
+         bool getBool( bool &value ) const;
+         bool getInt64( LongLong &value ) const;
+         bool getUInt64( ULongLong &value ) const;
+         bool getDouble( double &value ) const;
+         bool getString( std::string &value ) const;
+
+         /// Elements/members count if is array/object, otherwise return 0.
+         unsigned int size() const;
+
+         /// Get array element, return invalid element if not array or index out of range.
+         Element operator[]( unsigned int index ) const;
+
+         /// Get object member(the first one if duplicated), return invalid element if not object or not found.
+         Element operator[]( const char *key ) const;
+         Element operator[]( const std::string &key ) const;
+
+      private:
+         friend class Cursor;
+         Element( const Cursor *cursor, unsigned int index );
+
+         char firstChar() const;
+         unsigned int skip( unsigned int index ) const;
+         bool keyEquals( unsigned int index, const char *key, unsigned int keyLength ) const;
+         Element findMember( const char *key, unsigned int keyLength ) const;
+
+      private:
+         const Cursor *cursor_;
+         unsigned int index_;
+      };
+
+   public:
+      Cursor();
+
+      /** \brief Reset cursor to a new document, run parse stage 1.
+       * \return \c true if success, \c false if structural index build failed or brackets mismatched.
+       */
+      bool reset( const char *begin, const char *end );
+      bool reset( const std::string &document );
+
+      /// Get root element, invalid element if reset failed.
+      Element root() const;
+
+      /// Get the error message & error offset of last reset failed.
+      const std::string &getErrorMessage() const;
+      unsigned int getErrorOffset() const;
+
+   private:
+      StructuralIndex index_;
+      std::vector<unsigned int> matches_; // Open bracket's matched close bracket structural index.
+      std::vector<unsigned int> openBrackets_;
+      std::string errorMessage_;
+      unsigned int errorOffset_;
+      bool ready_;
+   };
+
+} // namespace Json
+
+/**
+ * Json document/cursor typedef.
+ */
+typedef Json::Document LLBC_JsonDocument;
+typedef Json::Cursor LLBC_JsonCursor;
+
+__LLBC_NS_END
+
+#endif // JSON_DOCUMENT_H_INCLUDED
@@ -14,6 +14,11 @@ namespace Json {
    // reader.h
    class Reader;
 
+   // document.h
+   class StructuralIndex;
+   class Document;
+   class Cursor;
+
    // features.h
    class Features;
 
@@ -5,6 +5,7 @@
 # include "value.h"
 # include "reader.h"
 # include "writer.h"
+# include "document.h"
 # include "features.h"
 
 #endif // JSON_JSON_H_INCLUDED
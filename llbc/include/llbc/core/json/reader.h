@@ -3,6 +3,7 @@
 
 # include "features.h"
 # include "value.h"
+# include "document.h"
 # include <deque>
 # include <stack>
 # include <string>
@@ -14,6 +15,9 @@ namespace Json {
 
    /** \brief Unserialize a <a HREF="http://www.json.org">JSON</a> document into a Value.
     *
+    * Document is parsed by the structural index parser(see StructuralIndex & Document) into Value,
+    * documents it rejects(comments, non strict syntax, errors) fallback to the scalar parser,
+    * so parse results and error messages are same as before.
     */
    class JSON_API Reader
    {
@@ -152,6 +156,7 @@ namespace Json {
                        Location end, 
                        CommentPlacement placement );
       void skipCommentTokens( Token &token );
+      bool fastParse( const char *beginDoc, const char *endDoc, Value &root );
    
       typedef std::stack<Value *> Nodes;
       Nodes nodes_;
@@ -165,6 +170,7 @@ namespace Json {
       std::string commentsBefore_;
       Features features_;
       bool collectComments_;
+      StructuralIndex fastIndex_;
    };
 
    /** \brief Read from 'sin' into 'root'.
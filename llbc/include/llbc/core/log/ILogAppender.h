@@ -63,6 +63,12 @@ struct LLBC_LogAppenderInitInfo
 
     LLBC_String ip;                 // Ip address, used in Network type appender.
     uint16 port;                    // port, used in Network type appender.
+    bool networkUdp;                // use udp protocol flag, used in Network type appender.
+    int frameSize;                  // max frame size, in bytes, used in Network type appender.
+    int spillBufferSize;            // max not sent frames size, in bytes, used in Network type appender.
+    int flushInterval;              // frame max wait time before send, in milli-seconds, used in Network type appender.
+    int reconnectInterval;          // reconnect interval, in milli-seconds, used in Network type appender.
+    int maxReconnectInterval;       // max reconnect interval(backoff limit), in milli-seconds, used in Network type appender.
 };
 
 /**
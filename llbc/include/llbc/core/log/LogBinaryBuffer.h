@@ -0,0 +1,93 @@
+/**
+ * @file    LogBinaryBuffer.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The binary log records buffer, multi producers/single consumer, lock free.
+ */
+#ifndef __LLBC_CORE_LOG_LOG_BINARY_BUFFER_H__
+#define __LLBC_CORE_LOG_LOG_BINARY_BUFFER_H__
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The binary log record, follow with encoded arguments.
+ */
+struct LLBC_EXPORT LLBC_LogBinaryRecord
+{
+    sint32 fmtId;                         // The format Id.
+    uint32 argsLen;                       // The encoded arguments length.
+    sint64 logTime;                       // Log time.
+    uint64 threadHandle;                  // Log native thread handle.
+};
+
+/**
+ * \brief The binary log records ring buffer.
+ *
+ * Producers reserve record space by CAS, write record, then commit it, if buffer full, record
+ * will drop(never block producer); consumer(log thread) peek committed records in order.
+ */
+class LLBC_EXPORT LLBC_LogBinaryBuffer
+{
+public:
+    /**
+     * Construct binary buffer.
+     * @param[in] capacity - the buffer capacity, in bytes, will round up to power of 2.
+     */
+    explicit LLBC_LogBinaryBuffer(size_t capacity);
+    ~LLBC_LogBinaryBuffer();
+
+public:
+    /**
+     * Reserve record space, thread safe.
+     * @param[in] size - the record size.
+     * @return void * - the record space, if buffer full, return NULL.
+     */
+    void *Reserve(uint32 size);
+
+    /**
+     * Commit reserved record, thread safe.
+     * @param[in] record - the record space, returned by Reserve().
+     */
+    void Commit(void *record);
+
+    /**
+     * Peek the oldest committed record, only can call in consumer thread.
+     * @param[out] size - the record size.
+     * @return const void * - the record, if no committed record, return NULL.
+     */
+    const void *Peek(uint32 &size);
+
+    /**
+     * Release the peeked record, only can call in consumer thread.
+     */
+    void Release();
+
+    /**
+     * Get dropped records count(buffer full).
+     * @return sint64 - the dropped records count.
+     */
+    sint64 GetDroppedCount() const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_LogBinaryBuffer);
+
+private:
+    char *_buf;
+    sint64 _cap;
+    sint64 _mask;
+
+    // Producers and consumer positions keep in different cache lines.
+    char _pad0[64];
+    volatile sint64 _writePos;
+    volatile sint64 _dropped;
+    char _pad1[64];
+    volatile sint64 _readPos;
+    char _pad2[64];
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_LOG_LOG_BINARY_BUFFER_H__
@@ -0,0 +1,98 @@
+/**
+ * @file    LogBinaryFile.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The binary log file writer, binary log file decode offline by tools/blog_decoder.py.
+ *
+ * Binary log file layout(native byte order):
+ *  - file head:     "LLBCBLOG"(8 bytes) + version(uint32) + logger name length(uint32) + logger name.
+ *  - format entry:  'F'(uint8) + id(sint32) + level(sint32) + line(sint32)
+ *                   + tag/file/fmt(every one: length(uint32) + string)
+ *                   + argument count(uint32) + argument types(uint8 * argument count).
+ *  - record entry:  'R'(uint8) + LLBC_LogBinaryRecord + encoded arguments.
+ *  Format entry always written before the first record entry which use it.
+ */
+#ifndef __LLBC_CORE_LOG_LOG_BINARY_FILE_H__
+#define __LLBC_CORE_LOG_LOG_BINARY_FILE_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/file/File.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * Pre-declare some classes.
+ */
+struct LLBC_LogBinaryRecord;
+struct LLBC_LogFormatInfo;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The binary log file writer, only use in log thread.
+ */
+class LLBC_EXPORT LLBC_LogBinaryFile
+{
+public:
+    LLBC_LogBinaryFile();
+    ~LLBC_LogBinaryFile();
+
+public:
+    /**
+     * Open binary log file, if file exist, will truncate it.
+     * @param[in] path       - the binary log file path.
+     * @param[in] loggerName - the logger name.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Open(const LLBC_String &path, const LLBC_String &loggerName);
+
+    /**
+     * Close binary log file.
+     */
+    void Close();
+
+    /**
+     * Check binary log file opened or not.
+     * @return bool - return true if opened, otherwise return false.
+     */
+    bool IsOpened() const;
+
+    /**
+     * Write binary log record, if record format not write yet, will write format first.
+     * @param[in] info   - the record format info.
+     * @param[in] record - the binary log record, follow with encoded arguments.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Write(const LLBC_LogFormatInfo &info, const LLBC_LogBinaryRecord &record);
+
+    /**
+     * Flush binary log file.
+     */
+    void Flush();
+
+private:
+    /**
+     * Write format entry.
+     */
+    int WriteFormat(const LLBC_LogFormatInfo &info);
+
+    /**
+     * Write string, length(uint32) + string.
+     */
+    void WriteString(const LLBC_String &str);
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_LogBinaryFile);
+
+private:
+    LLBC_File _file;
+    std::vector<bool> _writtenFmts;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_LOG_LOG_BINARY_FILE_H__
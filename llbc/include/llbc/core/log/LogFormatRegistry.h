@@ -0,0 +1,146 @@
+/**
+ * @file    LogFormatRegistry.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The binary log(deferred formatting) format registry.
+ */
+#ifndef __LLBC_CORE_LOG_LOG_FORMAT_REGISTRY_H__
+#define __LLBC_CORE_LOG_LOG_FORMAT_REGISTRY_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/singleton/Singleton.h"
+#include "llbc/core/thread/SpinLock.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The binary log argument type enumeration.
+ */
+class LLBC_EXPORT LLBC_LogArgType
+{
+public:
+    enum
+    {
+        Begin = 1,
+
+        Int32 = Begin,  // int/char/short, 4 bytes.
+        Int64,          // long long/int64(and long/size_t on 64bit platform), 8 bytes.
+        Double,         // float/double, 8 bytes.
+        LongDouble,     // long double, encode as double, 8 bytes.
+        String,         // const char *, encode as uint32 length + string bytes.
+        Pointer,        // void *, encode as uint64, 8 bytes.
+
+        End
+    };
+};
+
+/**
+ * \brief The binary log format info, registered once per log call site.
+ */
+struct LLBC_EXPORT LLBC_LogFormatInfo
+{
+    /**
+     * \brief The format segment, literal text follow with at most one conversion spec.
+     */
+    struct Segment
+    {
+        LLBC_String literal;  // The literal text.
+        LLBC_String spec;     // The normalized conversion spec, empty if not exist.
+        int starCount;        // The '*' width/precision count, use Int32 arguments.
+        int argType;          // The conversion argument type.
+    };
+
+    sint32 id;                // The format Id, start from 1.
+    int level;                // Log level.
+    LLBC_String tag;          // Log tag.
+    LLBC_String file;         // Log source file name.
+    int line;                 // Log source file line number.
+    LLBC_String fmt;          // The original format control string.
+
+    std::vector<Segment> segments;
+    std::vector<uint8> argTypes; // All arguments type, include '*' width/precision arguments.
+};
+
+/**
+ * \brief The binary log format registry, log call site register format string once,
+ *        log time only encode raw arguments, format in log thread or offline.
+ */
+class LLBC_EXPORT LLBC_LogFormatRegistry
+{
+public:
+    LLBC_LogFormatRegistry();
+    ~LLBC_LogFormatRegistry();
+
+public:
+    /**
+     * Register log format, same call site(file + line + fmt) always return same format Id.
+     * @param[in] level - log level.
+     * @param[in] tag   - log tag, can set to NULL.
+     * @param[in] file  - log file name.
+     * @param[in] line  - log file line.
+     * @param[in] fmt   - format control string(printf style, not support %n and wide string).
+     * @return sint32 - the format Id(> 0), if failed, return -1.
+     */
+    sint32 Register(int level, const char *tag, const char *file, int line, const char *fmt);
+
+    /**
+     * Get format info, lock free.
+     * @param[in] id - the format Id.
+     * @return const LLBC_LogFormatInfo * - the format info, if not found, return NULL.
+     */
+    const LLBC_LogFormatInfo *GetFormatInfo(sint32 id) const;
+
+public:
+    /**
+     * Encode arguments, string arguments will truncate if buffer not enough.
+     * @param[in] info    - the format info.
+     * @param[in] ap      - the arguments.
+     * @param[in] buf     - the encode buffer.
+     * @param[in] bufSize - the encode buffer size.
+     * @return int - the encoded size, if failed, return -1.
+     */
+    static int EncodeArgs(const LLBC_LogFormatInfo &info, va_list ap, char *buf, uint32 bufSize);
+
+    /**
+     * Format encoded arguments.
+     * @param[in] info      - the format info.
+     * @param[in] args      - the encoded arguments.
+     * @param[in] argsLen   - the encoded arguments length.
+     * @param[out] formatted - the formatted message.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    static int FormatArgs(const LLBC_LogFormatInfo &info, const char *args, uint32 argsLen, LLBC_String &formatted);
+
+private:
+    /**
+     * Parse format control string to segments and arguments type.
+     * @param[in/out] info - the format info.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    static int ParseFormat(LLBC_LogFormatInfo &info);
+
+private:
+    LLBC_SpinLock _lock;
+
+    typedef std::pair<const char *, const char *> _SiteKey0;
+    typedef std::pair<_SiteKey0, int> _SiteKey;
+    std::map<_SiteKey, sint32> _siteIds;
+
+    sint32 _count;
+    LLBC_LogFormatInfo * volatile *_infos;
+};
+
+/**
+ * Singleton class macro define.
+ */
+template class LLBC_EXPORT LLBC_Singleton<LLBC_LogFormatRegistry>;
+#define LLBC_LogFormatRegistrySingleton LLBC_Singleton<LLBC_NS LLBC_LogFormatRegistry>::Instance()
+
+__LLBC_NS_END
+
+#include "llbc/core/log/LogFormatRegistryImpl.h"
+
+#endif // !__LLBC_CORE_LOG_LOG_FORMAT_REGISTRY_H__
@@ -0,0 +1,23 @@
+/**
+ * @file    LogFormatRegistryImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifdef __LLBC_CORE_LOG_LOG_FORMAT_REGISTRY_H__
+
+__LLBC_NS_BEGIN
+
+inline const LLBC_LogFormatInfo *LLBC_LogFormatRegistry::GetFormatInfo(sint32 id) const
+{
+    if (UNLIKELY(id <= 0 || id > LLBC_CFG_LOG_MAX_BINARY_FORMAT_COUNT))
+        return NULL;
+
+    return _infos[id - 1];
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_LOG_LOG_FORMAT_REGISTRY_H__
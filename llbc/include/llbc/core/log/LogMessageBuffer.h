@@ -19,9 +19,17 @@ __LLBC_NS_BEGIN
  * \brief The Insertion operator for STL manipulators such as std::fixed.
  */
 typedef std::ios_base & (*ios_base_manip)(std::ios_base &);
+/**
+ * \brief The Insertion operator for STL stream manipulators such as std::endl.
+ */
+typedef std::basic_ostream<char> & (*ostream_manip)(std::basic_ostream<char> &);
 
 /**
  * \brief The log message buffer class encapsulation.
+ *
+ * Message formatted directly into a heap buffer(include stream output, the stream is
+ * constructed lazily on the same buffer), the buffer can detach and take over by the
+ * log data, no more format/copy when output.
  */
 class LLBC_EXPORT LLBC_LogMessageBuffer
 {
@@ -42,29 +50,31 @@ public:
     LLBC_LogMessageBuffer &operator <<(char msg);
 
     /**
-     * Built-in type stream output operator support.
+     * Built-in type stream output operator support, if stream not created, value will
+     * format into buffer directly.
      * @param[in] val - value to append.
-     * @return std::basic_ostream<char> & - stream object.
+     * @return LLBC_LogMessageBuffer & - message buffer.
      */
-    std::basic_ostream<char> &operator <<(bool val);
-    std::basic_ostream<char> &operator <<(uint8 val);
-    std::basic_ostream<char> &operator <<(sint16 val);
-    std::basic_ostream<char> &operator <<(uint16 val);
-    std::basic_ostream<char> &operator <<(sint32 val);
-    std::basic_ostream<char> &operator <<(uint32 val);
-    std::basic_ostream<char> &operator <<(sint64 val);
-    std::basic_ostream<char> &operator <<(uint64 val);
-    std::basic_ostream<char> &operator <<(long val);
-    std::basic_ostream<char> &operator <<(ulong val);
-    std::basic_ostream<char> &operator <<(float val);
-    std::basic_ostream<char> &operator <<(double val);
-    std::basic_ostream<char> &operator <<(ldouble val);
+    LLBC_LogMessageBuffer &operator <<(bool val);
+    LLBC_LogMessageBuffer &operator <<(uint8 val);
+    LLBC_LogMessageBuffer &operator <<(sint16 val);
+    LLBC_LogMessageBuffer &operator <<(uint16 val);
+    LLBC_LogMessageBuffer &operator <<(sint32 val);
+    LLBC_LogMessageBuffer &operator <<(uint32 val);
+    LLBC_LogMessageBuffer &operator <<(sint64 val);
+    LLBC_LogMessageBuffer &operator <<(uint64 val);
+    LLBC_LogMessageBuffer &operator <<(long val);
+    LLBC_LogMessageBuffer &operator <<(ulong val);
+    LLBC_LogMessageBuffer &operator <<(float val);
+    LLBC_LogMessageBuffer &operator <<(double val);
+    LLBC_LogMessageBuffer &operator <<(ldouble val);
     std::basic_ostream<char> &operator <<(void *val);
 
     /**
      * Insertion operator for STL manipulators such as std::fixed.
      */
     std::basic_ostream<char> &operator <<(ios_base_manip manip);
+    std::basic_ostream<char> &operator <<(ostream_manip manip);
 
     /**
      * Cast to basic_ostream.
@@ -79,12 +89,49 @@ public:
     const LLBC_String &str(LLBC_LogMessageBuffer &);
     const LLBC_String &str(std::basic_ostream<char> &);
 
+    /**
+     * Get message length.
+     * @return int - the message length, not include tailing character.
+     */
+    int GetLength() const;
+
+    /**
+     * Detach the message buffer, after detach, the buffer will be reset.
+     * @param[out] len - the message length, not include tailing character.
+     * @return char * - the message, allocated by LLBC_Malloc, caller take over it.
+     */
+    char *Detach(int &len);
+
+private:
+    /**
+     * Append data to buffer.
+     * @param[in] data - the data.
+     * @param[in] len  - the data length.
+     */
+    void Append(const char *data, size_t len);
+
+    /**
+     * Format value and append to buffer.
+     * @param[in] fmt - the format control string.
+     * @param[in] ... - the value.
+     */
+    void AppendFormat(const char *fmt, ...);
+
 private:
     LLBC_DISABLE_ASSIGNMENT(LLBC_LogMessageBuffer);
     
 private:
-    LLBC_String _buf;
-    std::basic_ostringstream<char> *_stream;
+    class _StreamBuf;
+    friend class _StreamBuf;
+
+    char *_buf;
+    int _len;
+    int _cap;
+
+    _StreamBuf *_streamBuf;
+    std::basic_ostream<char> *_stream;
+
+    LLBC_String _str;
 };
 
 __LLBC_NS_END
@@ -4,7 +4,12 @@
  * @date    2103/06/11
  * @version 1.0
  *
- * @brief
+ * @brief   The network log appender, batch formatted log records into frames and ship
+ *          to log collector by non-blocking tcp/udp connection.
+ *
+ * Frame layout(network byte order):
+ *  - frame length(uint32, include frame head) + records count(uint32) + formatted records.
+ *  Using tcp protocol, frames send as stream; using udp protocol, every frame send as one datagram.
  */
 #ifndef __LLBC_CORE_LOG_LOG_NETWORK_APPENDER_H__
 #define __LLBC_CORE_LOG_LOG_NETWORK_APPENDER_H__
@@ -15,8 +20,21 @@
 
 __LLBC_NS_BEGIN
 
+/**
+ * Pre-declare some classes.
+ */
+class LLBC_MessageBlock;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
 /**
  * \brief Network log appender class encapsulation.
+ *
+ * Appender never block log thread: connect/send all non-blocking, not sent frames hold
+ * in bounded spill buffer, if spill buffer full, new frames will drop and count, the dropped
+ * records count will report to collector in-band after space available.
  */
 class LLBC_LogNetworkAppender : public LLBC_BaseLogAppender
 {
@@ -26,7 +44,6 @@ public:
     LLBC_LogNetworkAppender();
     virtual ~LLBC_LogNetworkAppender();
 
-public:
 public:
     /**
      * Get log appender type, see LLBC_LogAppenderType.
@@ -54,9 +71,109 @@ public:
      */
     virtual int Output(const LLBC_LogData &data);
 
+public:
+    /**
+     * Get dropped log records count(spill buffer full or udp send failed).
+     * @return sint64 - the dropped log records count.
+     */
+    sint64 GetDroppedCount() const;
+
+    /**
+     * Get sent log records count.
+     * @return sint64 - the sent log records count.
+     */
+    sint64 GetSentCount() const;
+
+protected:
+    /**
+     * Flush method, seal current frame and try send all pending frames.
+     */
+    virtual void Flush();
+
+private:
+    /**
+     * The connection states.
+     */
+    enum _ConnState
+    {
+        _Disconnected,
+        _Connecting,
+        _Connected
+    };
+
+    /**
+     * Seal current frame, and move it to spill buffer.
+     */
+    void SealFrame();
+
+    /**
+     * Drive connection and send pending frames, never block.
+     * @param[in] now - now time, monotonic clock, in milli-seconds.
+     */
+    void Pump(sint64 now);
+
+    /**
+     * Start non-blocking connect to collector.
+     */
+    void Connect(sint64 now);
+
+    /**
+     * Check non-blocking connect finished or not.
+     */
+    void CheckConnect(sint64 now);
+
+    /**
+     * Close connection and schedule reconnect(exponential backoff).
+     */
+    void Disconnect(sint64 now);
+
+    /**
+     * Send pending frames until all sent or socket would block.
+     */
+    void SendFrames(sint64 now);
+
+    /**
+     * Pop and delete spill buffer head frame.
+     */
+    void PopFrame();
+
+    /**
+     * Drop spill buffer head frame, and count dropped records.
+     */
+    void DropFrame();
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_LogNetworkAppender);
+
 private:
     LLBC_String _ip;
     uint16 _port;
+    bool _udp;
+
+    size_t _frameSize;
+    size_t _spillBufferSize;
+    sint64 _flushInterval;
+    sint64 _reconnectInterval;
+    sint64 _maxReconnectInterval;
+
+    LLBC_SocketHandle _sock;
+    int _connState;
+    sint64 _connectTime;
+    sint64 _nextConnectTime;
+    sint64 _curReconnectInterval;
+
+    LLBC_String _frame;
+    uint32 _frameRecords;
+    sint64 _frameBeginTime;
+    sint64 _frameNoticeDropped;
+
+    std::deque<LLBC_MessageBlock *> _frames;
+    std::deque<uint32> _framesRecords;
+    std::deque<sint64> _framesNoticeDropped;
+    size_t _spillSize;
+
+    sint64 _droppedCount;
+    sint64 _reportedDroppedCount;
+    sint64 _sentCount;
 };
 
 __LLBC_NS_END
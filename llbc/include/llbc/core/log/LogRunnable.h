@@ -20,6 +20,8 @@ __LLBC_NS_BEGIN
  */
 struct LLBC_LogData;
 class LLBC_ILogAppender;
+class LLBC_LogBinaryFile;
+class LLBC_LogBinaryBuffer;
 
 __LLBC_NS_END
 
@@ -51,6 +53,15 @@ public:
      */
     void SetFlushInterval(sint64 flushInterval);
 
+    /**
+     * Set binary log records input, binary log records will drain and format in log thread.
+     * @param[in] loggerName - the logger name.
+     * @param[in] buffer     - the binary log records buffer.
+     * @param[in] binaryFile - the binary log file, if not NULL, records will write to
+     *                         file without formatting.
+     */
+    void SetBinaryInput(const LLBC_String &loggerName, LLBC_LogBinaryBuffer *buffer, LLBC_LogBinaryFile *binaryFile);
+
 public:
     /**
      * Add log appender.
@@ -76,12 +87,47 @@ public:
      */
     static void FreeLogData(LLBC_LogData *data);
 
+private:
+    /**
+     * Drain all committed binary log records.
+     */
+    void DrainBinaryRecords();
+
+    /**
+     * Format binary log record and output to appenders.
+     * @param[in] record - the binary log record.
+     */
+    void OutputBinaryRecord(const void *record);
+
+    /**
+     * Output text message to appenders.
+     * @param[in] level        - log level.
+     * @param[in] tag          - log tag.
+     * @param[in] file         - log file name.
+     * @param[in] line         - log file line.
+     * @param[in] logTime      - log time.
+     * @param[in] threadHandle - log native thread handle.
+     * @param[in] msg          - the message.
+     */
+    void OutputText(int level,
+                    const LLBC_String &tag,
+                    const LLBC_String &file,
+                    int line,
+                    sint64 logTime,
+                    LLBC_NativeThreadHandle threadHandle,
+                    const LLBC_String &msg);
+
 private:
     volatile bool _stoped;
     LLBC_ILogAppender *_head;
 
     sint64 _lastFlushTime;
     sint64 _flushInterval;
+
+    LLBC_String _loggerName;
+    LLBC_LogBinaryBuffer *_binBuffer;
+    LLBC_LogBinaryFile *_binFile;
+    sint64 _reportedBinDropped;
 };
 
 __LLBC_NS_END
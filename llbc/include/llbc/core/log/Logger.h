@@ -20,6 +20,8 @@ __LLBC_NS_BEGIN
  */
 struct LLBC_LogData;
 class LLBC_LogRunnable;
+class LLBC_LogBinaryFile;
+class LLBC_LogBinaryBuffer;
 class LLBC_LoggerConfigInfo;
 
 __LLBC_NS_END
@@ -80,6 +82,25 @@ public:
      */
     bool IsTakeOver() const;
 
+    /**
+     * Check specific level log enabled or not, lock free, use to skip message format when disabled.
+     * @param[in] level - the log level.
+     * @return bool - return true if enabled, if logger not init, always return false.
+     */
+    bool IsLevelEnabled(int level) const;
+
+    /**
+     * Check logger in binary mode(deferred formatting) or not, lock free.
+     * @return bool - return true if in binary mode, otherwise return false.
+     */
+    bool IsBinaryMode() const;
+
+    /**
+     * Get dropped binary log records count(binary log records buffer full).
+     * @return sint64 - the dropped binary log records count.
+     */
+    sint64 GetBinaryDroppedCount() const;
+
 public:
     /**
      * Output specific level message.
@@ -119,6 +140,28 @@ public:
      */
     int OutputNonFormat(int level, const char *tag, const char *file, int line, const char *message, size_t messageLen = -1);
 
+    /**
+     * Like OutputNonFormat() method, but logger take over the message, no copy.
+     * Note: level not check, call IsLevelEnabled() before build the message.
+     * @param[in] level      - log level.
+     * @param[in] tag        - log tag, can set to NULL.
+     * @param[in] file       - log file name.
+     * @param[in] line       - log file line.
+     * @param[in] message    - message string, must allocated by LLBC_Malloc.
+     * @param[in] messageLen - message string length, not include tailing character.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int OutputNonFormatOwned(int level, const char *tag, const char *file, int line, char *message, int messageLen);
+
+    /**
+     * Output binary log record, only encode raw arguments, format in log thread or offline.
+     * Note: level not check, and logger must in binary mode.
+     * @param[in] fmtId    - the format Id, register by LLBC_LogFormatRegistry.
+     * @param[in] argument - the format arguments.
+     * @return int - return 0 if success, otherwise return -1(if buffer full, error is LLBC_ERROR_LIMIT).
+     */
+    int OutputBinary(sint32 fmtId, ...);
+
 private:
     /**
      * Direct output message using given level.
@@ -150,8 +193,13 @@ private:
     const LLBC_LoggerConfigInfo *_config;
 
     LLBC_LogRunnable *_logRunnable;
+
+    LLBC_LogBinaryBuffer *_binBuffer;
+    LLBC_LogBinaryFile *_binFile;
 };
 
 __LLBC_NS_END
 
+#include "llbc/core/log/LoggerImpl.h"
+
 #endif // !__LLBC_CORE_LOG_LOGGER_H__
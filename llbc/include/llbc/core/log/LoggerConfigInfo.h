@@ -58,6 +58,12 @@ public:
      */
     int GetFlushInterval() const;
 
+    /**
+     * Get log thread CPU affinity, only available in asynchronous mode.
+     * @return const std::vector<int> & - the log thread bind CPUs, empty if not bind.
+     */
+    const std::vector<int> &GetThreadAffinity() const;
+
 public:
     /**
      * Get log to console switch.
@@ -138,6 +144,87 @@ public:
      */
     int GetFileBufferSize() const;
 
+public:
+    /**
+     * Get binary mode(deferred formatting) switch, only available in asynchronous mode.
+     * @return bool - binary mode switch.
+     */
+    bool IsBinaryMode() const;
+
+    /**
+     * Get binary log file, if not empty, binary log records will write to this file
+     * without formatting(decode offline), otherwise format in log thread.
+     * @return const LLBC_String & - the binary log file.
+     */
+    const LLBC_String &GetBinaryLogFile() const;
+
+    /**
+     * Get binary log records buffer size.
+     * @return int - the binary log records buffer size, in bytes.
+     */
+    int GetBinaryBufferSize() const;
+
+public:
+    /**
+     * Get log to network switch.
+     * @return bool - log to network switch.
+     */
+    bool IsLogToNetwork() const;
+
+    /**
+     * Get network log level.
+     * @return int - network log level.
+     */
+    int GetNetworkLogLevel() const;
+
+    /**
+     * Get network log pattern.
+     * @return const LLBC_String & - network log pattern.
+     */
+    const LLBC_String &GetNetworkPattern() const;
+
+    /**
+     * Get log collector ip.
+     * @return const LLBC_String & - log collector ip.
+     */
+    const LLBC_String &GetNetworkIp() const;
+
+    /**
+     * Get log collector port.
+     * @return uint16 - log collector port.
+     */
+    uint16 GetNetworkPort() const;
+
+    /**
+     * Get network log use udp protocol or not(default use tcp protocol).
+     * @return bool - return true if use udp protocol, otherwise return false.
+     */
+    bool IsNetworkUdp() const;
+
+    /**
+     * Get network log frame size.
+     * @return int - network log frame size, in bytes.
+     */
+    int GetNetworkFrameSize() const;
+
+    /**
+     * Get network log spill buffer(not sent frames) size.
+     * @return int - network log spill buffer size, in bytes.
+     */
+    int GetNetworkSpillBufferSize() const;
+
+    /**
+     * Get network log reconnect interval.
+     * @return int - network log reconnect interval, in milli-seconds.
+     */
+    int GetNetworkReconnectInterval() const;
+
+    /**
+     * Get network log max reconnect interval.
+     * @return int - network log max reconnect interval, in milli-seconds.
+     */
+    int GetNetworkMaxReconnectInterval() const;
+
 public:
     /**
      * Get take over option.
@@ -160,6 +247,7 @@ private:
     int _logLevel;
     bool _asyncMode;
     int _flushInterval;
+    std::vector<int> _threadAffinity;
 
     bool _logToConsole;
     int _consoleLogLevel;
@@ -176,6 +264,21 @@ private:
     int _maxBackupIndex;
     int _fileBufferSize;
 
+    bool _binaryMode;
+    LLBC_String _binaryLogFile;
+    int _binaryBufferSize;
+
+    bool _logToNetwork;
+    int _networkLogLevel;
+    LLBC_String _networkPattern;
+    LLBC_String _networkIp;
+    uint16 _networkPort;
+    bool _networkUdp;
+    int _networkFrameSize;
+    int _networkSpillBufferSize;
+    int _networkReconnectInterval;
+    int _networkMaxReconnectInterval;
+
     bool _takeOver;
 };
 
@@ -0,0 +1,25 @@
+/**
+ * @file    LoggerImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifdef __LLBC_CORE_LOG_LOGGER_H__
+
+__LLBC_NS_BEGIN
+
+inline bool LLBC_Logger::IsLevelEnabled(int level) const
+{
+    return LIKELY(_logRunnable) && level >= _logLevel;
+}
+
+inline bool LLBC_Logger::IsBinaryMode() const
+{
+    return _binBuffer != NULL;
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_LOG_LOGGER_H__
@@ -14,6 +14,10 @@
 #include "llbc/core/singleton/Singleton.h"
 #include "llbc/core/thread/RecursiveLock.h"
 
+#include "llbc/core/log/LogLevel.h"
+#include "llbc/core/log/Logger.h"
+#include "llbc/core/log/LogFormatRegistry.h"
+
 #if LLBC_CFG_LOG_USING_WITH_STREAM
 #include "llbc/core/log/LogMessageBuffer.h"
 #endif
@@ -23,7 +27,6 @@ __LLBC_NS_BEGIN
 /**
  * Pre-declare some classes.
  */
-class LLBC_Logger;
 class LLBC_LoggerConfigurator;
 
 __LLBC_NS_END
@@ -64,6 +67,12 @@ public:
      */
     LLBC_Logger *GetRootLogger() const;
 
+    /**
+     * Get root logger, lock free and not set last error, use in log macros.
+     * @return LLBC_Logger * - root logger, if not init, return NULL.
+     */
+    LLBC_Logger *GetRootLoggerFast() const;
+
     /**
      * Get logger by name.
      * @param[in] name - logger name.
@@ -87,243 +96,195 @@ template class LLBC_EXPORT LLBC_Singleton<LLBC_LoggerManager>;
 #define LLBC_LoggerManagerSingleton LLBC_Singleton<LLBC_NS LLBC_LoggerManager>::Instance()
 
 /**
- * root logger operations macro define.
+ * Library internal warning output function, output to root logger if logger manager initialized,
+ * otherwise output to stderr, make sure library warnings(eg: resource limit reached, feature fallback)
+ * not lost when logger not configured, use LLBC_LIB_WARN_LOG() macro instead of call it directly.
  */
-#if LLBC_CFG_LOG_USING_WITH_STREAM
-
-#define LLBC_DEBUG_LOG(message)                                                        \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Debug(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());     \
-    } while(0)                                                                         \
-
-#define LLBC_INFO_LOG(message)                                                         \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Info(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());      \
-    } while(0)                                                                         \
-
-#define LLBC_WARN_LOG(message)                                                         \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Warn(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());      \
-    } while(0)                                                                         \
-
-#define LLBC_ERROR_LOG(message)                                                        \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Error(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());     \
-    } while(0)                                                                         \
-
-#define LLBC_FATAL_LOG(message)                                                        \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Fatal(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());     \
-    } while(0)                                                                         \
-
-#define LLBC_DEBUG_LOG2(tag, message)                                                  \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Debug(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());      \
-    } while(0)                                                                         \
-
-#define LLBC_INFO_LOG2(tag, message)                                                   \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Info(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());       \
-    } while(0)                                                                         \
-
-#define LLBC_WARN_LOG2(tag, message)                                                   \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Warn(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());       \
-    } while(0)                                                                         \
-
-#define LLBC_ERROR_LOG2(tag, message)                                                  \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Error(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());      \
-    } while(0)                                                                         \
-
-#define LLBC_FATAL_LOG2(tag, message)                                                  \
-    do {                                                                               \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                             \
-        LLBC_NS LLBC_Logger *l = LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger(); \
-        l->Fatal(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());      \
-    } while(0)                                                                         \
-
-#else // !LLBC_CFG_LOG_USING_WITH_STREAM
-
-#define LLBC_DEBUG_LOG(message, ...)                            \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Debug(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__) \
-
-#define LLBC_INFO_LOG(message, ...)                             \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Info(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
-
-#define LLBC_WARN_LOG(message, ...)                             \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Warn(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+LLBC_EXTERN LLBC_EXPORT void __LLBC_LibWarnLog(const char *file, int line, const char *fmt, ...);
 
-#define LLBC_ERROR_LOG(message, ...)                            \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Error(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__) \
-
-#define LLBC_FATAL_LOG(message, ...)                            \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Fatal(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__) \
-
-#define LLBC_DEBUG_LOG2(tag, message, ...)                      \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Debug(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
-
-#define LLBC_INFO_LOG2(tag, message, ...)                       \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Info(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)   \
+__LLBC_NS_END
 
-#define LLBC_WARN_LOG2(tag, message, ...)                       \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Warn(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)   \
+#include "llbc/core/log/LoggerManagerImpl.h"
 
-#define LLBC_ERROR_LOG2(tag, message, ...)                      \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Error(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+/**
+ * Internal log output macro, check level first(lock free), then format message only once:
+ *  - stream mode:     message stream output into the log message buffer, the buffer take over by log data directly.
+ *  - non-stream mode: message format into the log data message buffer directly.
+ */
+#if LLBC_CFG_LOG_USING_WITH_STREAM
+#define __LLBC_LOG_OUTPUT(logger, level, tag, message)                                      \
+    do {                                                                                    \
+        LLBC_NS LLBC_Logger *__l = (logger);                                                \
+        if (__l && __l->IsLevelEnabled(level)) {                                            \
+            LLBC_NS LLBC_LogMessageBuffer __oss;                                            \
+            __oss << message;                                                               \
+            int __msgLen; char *__msg = __oss.Detach(__msgLen);                             \
+            __l->OutputNonFormatOwned(level, tag, __FILE__, __LINE__, __msg, __msgLen);     \
+        }                                                                                   \
+    } while (0)                                                                             \
 
-#define LLBC_FATAL_LOG2(tag, message, ...)                      \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetRootLogger()->      \
-        Fatal(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+#else // !LLBC_CFG_LOG_USING_WITH_STREAM
+#define __LLBC_LOG_OUTPUT(logger, level, tag, message, ...)                                 \
+    do {                                                                                    \
+        LLBC_NS LLBC_Logger *__l = (logger);                                                \
+        if (__l && __l->IsLevelEnabled(level))                                              \
+            __l->Output(level, tag, __FILE__, __LINE__, message, ##__VA_ARGS__);            \
+    } while (0)                                                                             \
 
 #endif // LLBC_CFG_LOG_USING_WITH_STREAM
 
 /**
- * Specific logger operations macro.
+ * Internal level log output macros, the level below LLBC_CFG_LOG_COMPILE_MIN_LEVEL compile to no-op.
  */
-#if LLBC_CFG_LOG_USING_WITH_STREAM
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 0
+ #define __LLBC_DEBUG_LOG_OUTPUT(logger, tag, ...) __LLBC_LOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Debug, tag, __VA_ARGS__)
+#else
+ #define __LLBC_DEBUG_LOG_OUTPUT(logger, tag, ...) do { } while (0)
+#endif
 
-#define LLBC_DEBUG_LOG_SPEC(logger, message)                                         \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Debug(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());   \
-    } while(0)                                                                       \
-
-#define LLBC_INFO_LOG_SPEC(logger, message)                                          \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Info(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());    \
-    } while(0)                                                                       \
-
-#define LLBC_WARN_LOG_SPEC(logger, message)                                          \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Warn(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());    \
-    } while(0)                                                                       \
-
-#define LLBC_ERROR_LOG_SPEC(logger, message)                                         \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Error(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());   \
-    } while(0)                                                                       \
-
-#define LLBC_FATAL_LOG_SPEC(logger, message)                                         \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Fatal(NULL, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());   \
-    } while(0)                                                                       \
-
-#define LLBC_DEBUG_LOG_SPEC2(logger, tag, message)                                   \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Debug(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());    \
-    } while(0)                                                                       \
-
-#define LLBC_INFO_LOG_SPEC2(logger, tag, message)                                    \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Info(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());     \
-    } while(0)                                                                       \
-
-#define LLBC_WARN_LOG_SPEC2(logger, tag, message)                                    \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Warn(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());     \
-    } while(0)                                                                       \
-
-#define LLBC_ERROR_LOG_SPEC2(logger, tag, message)                                   \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Error(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());    \
-    } while(0)                                                                       \
-
-#define LLBC_FATAL_LOG_SPEC2(logger, tag, message)                                   \
-    do {                                                                             \
-        LLBC_NS LLBC_LogMessageBuffer oss;                                           \
-        LLBC_NS LLBC_Logger *l = LLBC_LoggerManagerSingleton->GetLogger(logger);     \
-        l->Fatal(tag, __FILE__, __LINE__, "%s", oss.str(oss << message).c_str());    \
-    } while(0)                                                                       \
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 1
+ #define __LLBC_INFO_LOG_OUTPUT(logger, tag, ...) __LLBC_LOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Info, tag, __VA_ARGS__)
+#else
+ #define __LLBC_INFO_LOG_OUTPUT(logger, tag, ...) do { } while (0)
+#endif
 
-#else // !LLBC_CFG_LOG_USING_WITH_STREAM
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 2
+ #define __LLBC_WARN_LOG_OUTPUT(logger, tag, ...) __LLBC_LOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Warn, tag, __VA_ARGS__)
+#else
+ #define __LLBC_WARN_LOG_OUTPUT(logger, tag, ...) do { } while (0)
+#endif
 
-#define LLBC_DEBUG_LOG_SPEC(logger, message, ...)               \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Debug(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__) \
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 3
+ #define __LLBC_ERROR_LOG_OUTPUT(logger, tag, ...) __LLBC_LOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Error, tag, __VA_ARGS__)
+#else
+ #define __LLBC_ERROR_LOG_OUTPUT(logger, tag, ...) do { } while (0)
+#endif
 
-#define LLBC_INFO_LOG_SPEC(logger, message, ...)                \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Info(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 4
+ #define __LLBC_FATAL_LOG_OUTPUT(logger, tag, ...) __LLBC_LOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Fatal, tag, __VA_ARGS__)
+#else
+ #define __LLBC_FATAL_LOG_OUTPUT(logger, tag, ...) do { } while (0)
+#endif
 
-#define LLBC_WARN_LOG_SPEC(logger, message, ...)                \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Warn(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+/**
+ * root logger operations macro define.
+ * stream mode:     LLBC_XXX_LOG(message), LLBC_XXX_LOG2(tag, message), message like: "a: " <<a <<", b: " <<b.
+ * non-stream mode: LLBC_XXX_LOG(fmt, ...), LLBC_XXX_LOG2(tag, fmt, ...).
+ */
+#define LLBC_DEBUG_LOG(...) __LLBC_DEBUG_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, __VA_ARGS__)
+#define LLBC_INFO_LOG(...) __LLBC_INFO_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, __VA_ARGS__)
+#define LLBC_WARN_LOG(...) __LLBC_WARN_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, __VA_ARGS__)
+#define LLBC_ERROR_LOG(...) __LLBC_ERROR_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, __VA_ARGS__)
+#define LLBC_FATAL_LOG(...) __LLBC_FATAL_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, __VA_ARGS__)
+
+#define LLBC_DEBUG_LOG2(tag, ...) __LLBC_DEBUG_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, __VA_ARGS__)
+#define LLBC_INFO_LOG2(tag, ...) __LLBC_INFO_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, __VA_ARGS__)
+#define LLBC_WARN_LOG2(tag, ...) __LLBC_WARN_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, __VA_ARGS__)
+#define LLBC_ERROR_LOG2(tag, ...) __LLBC_ERROR_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, __VA_ARGS__)
+#define LLBC_FATAL_LOG2(tag, ...) __LLBC_FATAL_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, __VA_ARGS__)
 
-#define LLBC_ERROR_LOG_SPEC(logger, message, ...)               \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Error(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__) \
+/**
+ * Specific logger operations macro, usage same as root logger operations macro.
+ */
+#define LLBC_DEBUG_LOG_SPEC(logger, ...) __LLBC_DEBUG_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, __VA_ARGS__)
+#define LLBC_INFO_LOG_SPEC(logger, ...) __LLBC_INFO_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, __VA_ARGS__)
+#define LLBC_WARN_LOG_SPEC(logger, ...) __LLBC_WARN_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, __VA_ARGS__)
+#define LLBC_ERROR_LOG_SPEC(logger, ...) __LLBC_ERROR_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, __VA_ARGS__)
+#define LLBC_FATAL_LOG_SPEC(logger, ...) __LLBC_FATAL_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, __VA_ARGS__)
+
+#define LLBC_DEBUG_LOG_SPEC2(logger, tag, ...) __LLBC_DEBUG_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, __VA_ARGS__)
+#define LLBC_INFO_LOG_SPEC2(logger, tag, ...) __LLBC_INFO_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, __VA_ARGS__)
+#define LLBC_WARN_LOG_SPEC2(logger, tag, ...) __LLBC_WARN_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, __VA_ARGS__)
+#define LLBC_ERROR_LOG_SPEC2(logger, tag, ...) __LLBC_ERROR_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, __VA_ARGS__)
+#define LLBC_FATAL_LOG_SPEC2(logger, tag, ...) __LLBC_FATAL_LOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, __VA_ARGS__)
 
-#define LLBC_FATAL_LOG_SPEC(logger, message, ...)               \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Fatal(NULL, __FILE__, __LINE__, message, ##__VA_ARGS__) \
+/**
+ * Internal binary log output macro, call site register format once(fmt must be string literal),
+ * log time only encode raw arguments, if logger not in binary mode or format not support,
+ * fallback to format output.
+ */
+#define __LLBC_BLOG_OUTPUT(logger, level, tag, fmt, ...)                                    \
+    do {                                                                                    \
+        LLBC_NS LLBC_Logger *__l = (logger);                                                \
+        if (__l && __l->IsLevelEnabled(level)) {                                            \
+            static LLBC_NS sint32 __fmtId = 0;                                              \
+            if (__l->IsBinaryMode()) {                                                      \
+                if (UNLIKELY(__fmtId == 0))                                                 \
+                    __fmtId = LLBC_NS LLBC_LogFormatRegistrySingleton->                     \
+                        Register(level, tag, __FILE__, __LINE__, "" fmt);                   \
+                if (__fmtId > 0) {                                                          \
+                    __l->OutputBinary(__fmtId, ##__VA_ARGS__);                              \
+                    break;                                                                  \
+                }                                                                           \
+            }                                                                               \
+            __l->Output(level, tag, __FILE__, __LINE__, fmt, ##__VA_ARGS__);                \
+        }                                                                                   \
+    } while (0)                                                                             \
 
-#define LLBC_DEBUG_LOG_SPEC2(logger, tag, message, ...)         \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Debug(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+/**
+ * Internal level binary log output macros, the level below LLBC_CFG_LOG_COMPILE_MIN_LEVEL compile to no-op.
+ */
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 0
+ #define __LLBC_DEBUG_BLOG_OUTPUT(logger, tag, fmt, ...) __LLBC_BLOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Debug, tag, fmt, ##__VA_ARGS__)
+#else
+ #define __LLBC_DEBUG_BLOG_OUTPUT(logger, tag, fmt, ...) do { } while (0)
+#endif
 
-#define LLBC_INFO_LOG_SPEC2(logger, tag, message, ...)          \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Info(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)   \
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 1
+ #define __LLBC_INFO_BLOG_OUTPUT(logger, tag, fmt, ...) __LLBC_BLOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Info, tag, fmt, ##__VA_ARGS__)
+#else
+ #define __LLBC_INFO_BLOG_OUTPUT(logger, tag, fmt, ...) do { } while (0)
+#endif
 
-#define LLBC_WARN_LOG_SPEC2(logger, tag, message, ...)          \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Warn(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)   \
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 2
+ #define __LLBC_WARN_BLOG_OUTPUT(logger, tag, fmt, ...) __LLBC_BLOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Warn, tag, fmt, ##__VA_ARGS__)
+#else
+ #define __LLBC_WARN_BLOG_OUTPUT(logger, tag, fmt, ...) do { } while (0)
+#endif
 
-#define LLBC_ERROR_LOG_SPEC2(logger, tag, message, ...)         \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Error(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 3
+ #define __LLBC_ERROR_BLOG_OUTPUT(logger, tag, fmt, ...) __LLBC_BLOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Error, tag, fmt, ##__VA_ARGS__)
+#else
+ #define __LLBC_ERROR_BLOG_OUTPUT(logger, tag, fmt, ...) do { } while (0)
+#endif
 
-#define LLBC_FATAL_LOG_SPEC2(logger, tag, message, ...)         \
-    LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger)->    \
-        Fatal(tag, __FILE__, __LINE__, message, ##__VA_ARGS__)  \
+#if LLBC_CFG_LOG_COMPILE_MIN_LEVEL <= 4
+ #define __LLBC_FATAL_BLOG_OUTPUT(logger, tag, fmt, ...) __LLBC_BLOG_OUTPUT(logger, LLBC_NS LLBC_LogLevel::Fatal, tag, fmt, ##__VA_ARGS__)
+#else
+ #define __LLBC_FATAL_BLOG_OUTPUT(logger, tag, fmt, ...) do { } while (0)
+#endif
 
-#endif // LLBC_CFG_LOG_USING_WITH_STREAM
+/**
+ * Binary log(deferred formatting) operations macro define, printf style, available in all log using mode.
+ * LLBC_XXX_BLOG(fmt, ...), LLBC_XXX_BLOG2(tag, fmt, ...), LLBC_XXX_BLOG_SPEC(logger, fmt, ...), LLBC_XXX_BLOG_SPEC2(logger, tag, fmt, ...).
+ */
+#define LLBC_DEBUG_BLOG(fmt, ...) __LLBC_DEBUG_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_INFO_BLOG(fmt, ...) __LLBC_INFO_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_WARN_BLOG(fmt, ...) __LLBC_WARN_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_ERROR_BLOG(fmt, ...) __LLBC_ERROR_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_FATAL_BLOG(fmt, ...) __LLBC_FATAL_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), NULL, fmt, ##__VA_ARGS__)
+
+#define LLBC_DEBUG_BLOG2(tag, fmt, ...) __LLBC_DEBUG_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, fmt, ##__VA_ARGS__)
+#define LLBC_INFO_BLOG2(tag, fmt, ...) __LLBC_INFO_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, fmt, ##__VA_ARGS__)
+#define LLBC_WARN_BLOG2(tag, fmt, ...) __LLBC_WARN_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, fmt, ##__VA_ARGS__)
+#define LLBC_ERROR_BLOG2(tag, fmt, ...) __LLBC_ERROR_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, fmt, ##__VA_ARGS__)
+#define LLBC_FATAL_BLOG2(tag, fmt, ...) __LLBC_FATAL_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetRootLoggerFast(), tag, fmt, ##__VA_ARGS__)
+
+#define LLBC_DEBUG_BLOG_SPEC(logger, fmt, ...) __LLBC_DEBUG_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_INFO_BLOG_SPEC(logger, fmt, ...) __LLBC_INFO_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_WARN_BLOG_SPEC(logger, fmt, ...) __LLBC_WARN_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_ERROR_BLOG_SPEC(logger, fmt, ...) __LLBC_ERROR_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, fmt, ##__VA_ARGS__)
+#define LLBC_FATAL_BLOG_SPEC(logger, fmt, ...) __LLBC_FATAL_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), NULL, fmt, ##__VA_ARGS__)
+
+#define LLBC_DEBUG_BLOG_SPEC2(logger, tag, fmt, ...) __LLBC_DEBUG_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, fmt, ##__VA_ARGS__)
+#define LLBC_INFO_BLOG_SPEC2(logger, tag, fmt, ...) __LLBC_INFO_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, fmt, ##__VA_ARGS__)
+#define LLBC_WARN_BLOG_SPEC2(logger, tag, fmt, ...) __LLBC_WARN_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, fmt, ##__VA_ARGS__)
+#define LLBC_ERROR_BLOG_SPEC2(logger, tag, fmt, ...) __LLBC_ERROR_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, fmt, ##__VA_ARGS__)
+#define LLBC_FATAL_BLOG_SPEC2(logger, tag, fmt, ...) __LLBC_FATAL_BLOG_OUTPUT(LLBC_NS LLBC_LoggerManagerSingleton->GetLogger(logger), tag, fmt, ##__VA_ARGS__)
 
-__LLBC_NS_END
+/**
+ * Library internal warning log macro, printf style, available in all log using mode, see __LLBC_LibWarnLog().
+ */
+#define LLBC_LIB_WARN_LOG(fmt, ...) LLBC_NS __LLBC_LibWarnLog(__FILE__, __LINE__, fmt, ##__VA_ARGS__)
 
 #endif // !__LLBC_CORE_LOG_LOGGER_MANAGER_H__
@@ -0,0 +1,20 @@
+/**
+ * @file    LoggerManagerImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifdef __LLBC_CORE_LOG_LOGGER_MANAGER_H__
+
+__LLBC_NS_BEGIN
+
+inline LLBC_Logger *LLBC_LoggerManager::GetRootLoggerFast() const
+{
+    return _root;
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_LOG_LOGGER_MANAGER_H__
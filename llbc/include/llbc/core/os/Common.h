@@ -17,10 +17,12 @@
 #include "llbc/core/os/OS_Console.h"
 #include "llbc/core/os/OS_Socket.h"
 #include "llbc/core/os/OS_Select.h"
+#include "llbc/core/os/OS_Poll.h"
 #include "llbc/core/os/OS_Network.h"
 
 #if LLBC_TARGET_PLATFORM_LINUX
 #include "llbc/core/os/OS_Epoll.h"
+#include "llbc/core/os/OS_IoUring.h"
 #endif
 #if LLBC_TARGET_PLATFORM_WIN32
 #include "llbc/core/os/OS_Iocp.h"
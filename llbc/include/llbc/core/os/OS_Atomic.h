@@ -48,6 +48,45 @@ inline sint64 LLBC_AtomicGet(volatile sint64 *ptr)
 #endif
 }
 
+/**
+ * Relaxed atomic get 64 bit value, no barrier, readers never see torn value.
+ * Use for single writer counters(see LLBC_AtomicRelaxedSet()).
+ * @param[in] ptr - value pointer.
+ * @return sint64 - the ptr variable pointer to value.
+ */
+inline sint64 LLBC_AtomicRelaxedGet(const volatile sint64 *ptr)
+{
+#if LLBC_TARGET_PLATFORM_WIN32
+ #if defined(_WIN64)
+    return *ptr;
+ #else
+    return ::InterlockedCompareExchange64(const_cast<volatile sint64 *>(ptr), 0, 0);
+ #endif
+#else
+    return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * Relaxed atomic set 64 bit value, no barrier, not a read-modify-write operation.
+ * Single writer counter(only owner thread update, other threads read) update:
+ *      LLBC_AtomicRelaxedSet(ptr, LLBC_AtomicRelaxedGet(ptr) + value);
+ * @param[in/out] ptr - will set's value pointer.
+ * @param[in] value   - value.
+ */
+inline void LLBC_AtomicRelaxedSet(volatile sint64 *ptr, sint64 value)
+{
+#if LLBC_TARGET_PLATFORM_WIN32
+ #if defined(_WIN64)
+    *ptr = value;
+ #else
+    ::InterlockedExchange64(ptr, value);
+ #endif
+#else
+    __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+#endif
+}
+
 /**
  * Atomic set value operation(32/64 bit version).
  * @param[in/out] ptr - will set's value pointer.
@@ -313,6 +352,36 @@ inline sint64 LLBC_AtomicCompareAndExchange(volatile sint64 *ptr, sint64 exchang
 #endif
 }
 
+/**
+ * Atomic get pointer value(full barrier).
+ * @param[in] ptr - the pointer address.
+ * @return void * - the pointer value.
+ */
+inline void *LLBC_AtomicGetPtr(void * volatile *ptr)
+{
+#if LLBC_TARGET_PLATFORM_WIN32
+    return ::InterlockedCompareExchangePointer(ptr, NULL, NULL);
+#else
+    return __sync_val_compare_and_swap(ptr, (void *)NULL, (void *)NULL);
+#endif
+}
+
+/**
+ * Atomic set pointer value(full barrier).
+ * @param[in/out] ptr - the pointer address.
+ * @param[in] value   - the new pointer value.
+ * @return void * - the old pointer value.
+ */
+inline void *LLBC_AtomicSetPtr(void * volatile *ptr, void *value)
+{
+#if LLBC_TARGET_PLATFORM_WIN32
+    return ::InterlockedExchangePointer(ptr, value);
+#else
+    // Note: __sync_lock_test_and_set() is acquire barrier only, the stores before it may be reordered after it.
+    return __atomic_exchange_n(ptr, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
 __LLBC_NS_END
 
 #endif // !__LLBC_CORE_OS_OS_ATOMIC_H__
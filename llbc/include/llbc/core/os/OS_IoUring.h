@@ -0,0 +1,130 @@
+/**
+ * @file    OS_IoUring.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The io_uring raw system call wrappers(not depend on liburing).
+ */
+#ifndef __LLBC_CORE_OS_OS_IO_URING_H__
+#define __LLBC_CORE_OS_OS_IO_URING_H__
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+#if LLBC_CFG_OS_ENABLE_IO_URING
+
+/**
+ * \brief The io_uring submission/completion queue entry structures typedef.
+ */
+typedef struct io_uring_sqe LLBC_IoUringSqe;
+typedef struct io_uring_cqe LLBC_IoUringCqe;
+
+/**
+ * \brief The io_uring instance structure, hold the mapped submission/completion queue rings.
+ *        All queue operations must call in one thread.
+ */
+struct LLBC_EXPORT LLBC_IoUring
+{
+    LLBC_Handle fd;
+    uint32 features;
+
+    // Submission queue.
+    uint32 *sqHead;
+    uint32 *sqTail;
+    uint32 sqMask;
+    uint32 sqEntries;
+    LLBC_IoUringSqe *sqes;
+    uint32 sqeTail;    // The local tail, entries in [*sqTail, sqeTail) got but not flush to kernel yet.
+
+    // Completion queue.
+    uint32 *cqHead;
+    uint32 *cqTail;
+    uint32 cqMask;
+    LLBC_IoUringCqe *cqes;
+
+    // The mapped memory.
+    void *sqRing;
+    size_t sqRingSize;
+    void *cqRing;
+    size_t cqRingSize;
+    size_t sqesSize;
+};
+
+/**
+ * Check io_uring support or not, need linux kernel 6.0+(multishot accept/recv, provided buffer ring, ext arg).
+ * @return bool - return true if supported, otherwise return false.
+ */
+LLBC_EXTERN LLBC_EXPORT bool LLBC_IoUringIsSupported();
+
+/**
+ * Setup io_uring instance and map the queue rings.
+ * @param[in] entries   - the submission queue entries.
+ * @param[in] cqEntries - the completion queue entries, must greater than entries.
+ * @param[out] ring     - the io_uring instance.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_IoUringQueueInit(uint32 entries, uint32 cqEntries, LLBC_IoUring &ring);
+
+/**
+ * Unmap the queue rings and close io_uring instance, all in-flight requests will be canceled.
+ * @param[in] ring - the io_uring instance.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_IoUringQueueExit(LLBC_IoUring &ring);
+
+/**
+ * Get a zeroed submission queue entry.
+ * @param[in] ring - the io_uring instance.
+ * @return LLBC_IoUringSqe * - the submission queue entry, if submission queue full, return NULL.
+ */
+LLBC_EXTERN LLBC_EXPORT LLBC_IoUringSqe *LLBC_IoUringGetSqe(LLBC_IoUring &ring);
+
+/**
+ * Submit all got submission queue entries, and wait completions.
+ * @param[in] ring    - the io_uring instance.
+ * @param[in] waitNr  - the wait completions count, 0 means submit only.
+ * @param[in] timeout - wait timeout, in milliseconds, only used when waitNr > 0.
+ * @return int - return submitted entries count if success(timeout also success), otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_IoUringSubmit(LLBC_IoUring &ring, uint32 waitNr, int timeout);
+
+/**
+ * Get the completion queue entry at completion queue head.
+ * @param[in] ring - the io_uring instance.
+ * @return LLBC_IoUringCqe * - the completion queue entry, if completion queue empty, return NULL.
+ */
+LLBC_EXTERN LLBC_EXPORT LLBC_IoUringCqe *LLBC_IoUringPeekCqe(LLBC_IoUring &ring);
+
+/**
+ * Mark completion queue head entry consumed.
+ * @param[in] ring - the io_uring instance.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_IoUringCqeSeen(LLBC_IoUring &ring);
+
+/**
+ * Register the provided buffer ring.
+ * @param[in] ring    - the io_uring instance.
+ * @param[in] bufRing - the buffer ring, must page aligned.
+ * @param[in] entries - the buffer ring entries count, must be power of 2.
+ * @param[in] groupId - the buffer group id.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_IoUringRegisterBufRing(LLBC_IoUring &ring,
+                                                        struct io_uring_buf_ring *bufRing,
+                                                        uint32 entries,
+                                                        uint16 groupId);
+
+/**
+ * Unregister the provided buffer ring.
+ * @param[in] ring    - the io_uring instance.
+ * @param[in] groupId - the buffer group id.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_IoUringUnregisterBufRing(LLBC_IoUring &ring, uint16 groupId);
+
+#endif // LLBC_CFG_OS_ENABLE_IO_URING
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_OS_OS_IO_URING_H__
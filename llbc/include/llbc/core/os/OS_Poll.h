@@ -0,0 +1,65 @@
+/**
+ * @file    OS_Poll.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_OS_OS_POLL_H__
+#define __LLBC_CORE_OS_OS_POLL_H__
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+
+/**
+ * \brief The poll fd structure typedef.
+ */
+typedef struct pollfd LLBC_PollFd;
+
+/**
+ * Wait for some event on a set of file descriptors.
+ * @param[in] fds     - the file descriptors array.
+ * @param[in] count   - the file descriptors count.
+ * @param[in] timeout - timeout value, in milliseconds, -1 means infinite.
+ * @return int - When successful, return the number of file descriptors have nonzero revents,
+ *               or zero if no file descriptor became ready during the requested timeout milliseconds.
+ *               When an error occurs, the function return -1 and to call LLBC_GetLastError() to fetch error.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_Poll(LLBC_PollFd *fds, uint32 count, int timeout);
+
+/**
+ * Create poll wakeup pipe, both ends are non-blocking.
+ * Watch handles[0] readable in LLBC_Poll(), call LLBC_WakeupPoll(handles[1]) to wakeup it.
+ * @param[out] handles - the pipe handles, [0] is read end, [1] is write end.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_CreatePollWakeupPipe(LLBC_Handle handles[2]);
+
+/**
+ * Wakeup the poll which watching the wakeup pipe read end.
+ * @param[in] writeHandle - the wakeup pipe write end.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_WakeupPoll(LLBC_Handle writeHandle);
+
+/**
+ * Drain all wakeup signals in the wakeup pipe.
+ * @param[in] readHandle - the wakeup pipe read end.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_DrainPollWakeupPipe(LLBC_Handle readHandle);
+
+/**
+ * Close the wakeup pipe.
+ * @param[in/out] handles - the pipe handles, will set to LLBC_INVALID_HANDLE after closed.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_ClosePollWakeupPipe(LLBC_Handle handles[2]);
+
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_OS_OS_POLL_H__
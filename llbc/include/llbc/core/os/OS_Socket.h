@@ -68,6 +68,16 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_ShutdownSocketInputOutput(LLBC_SocketHandle han
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_Send(LLBC_SocketHandle handle, const void *buf, int len, int flags);
 
+/**
+ * Gather sends buffers data on a connected socket by one system call.
+ * @param[in] handle      - socket handle.
+ * @param[in] buffers     - pointer to array of LLBC_SockBuf structures.
+ * @param[in] bufferCount - number of LLBC_SockBuf structures in the buffers, at most LLBC_CFG_COMM_SEND_GATHER_COUNT.
+ * @param[in] flags       - flags.
+ * @return int - if no error occurs, return the total number bytes sent, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_SendV(LLBC_SocketHandle handle, const LLBC_SockBuf *buffers, int bufferCount, int flags);
+
 /**
  * Send data on a connected socket(WIN32 specific).
  * @param[in]  handle         - socket handle.
@@ -300,6 +310,76 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_GetSocketOption(LLBC_SocketHandle handle, int l
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_SetSocketOption(LLBC_SocketHandle handle, int level, int optname, const void *optval, LLBC_SocketLen len);
 
+/**
+ * Get socket address family.
+ * @param[in] handle - socket handle.
+ * @return int - the address family(eg: AF_INET, AF_UNIX), if failed, return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_GetSocketAddressFamily(LLBC_SocketHandle handle);
+
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+/**
+ * Create unix domain stream socket.
+ * @return LLBC_SocketHandle - socket handle, if failed, return LLBC_INVALID_SOCKET_HANDLE.
+ */
+LLBC_EXTERN LLBC_EXPORT LLBC_SocketHandle LLBC_CreateUnixSocket();
+
+/**
+ * Create a pair of connected unix domain stream sockets.
+ * @param[out] handles - the socket handles.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_CreateUnixSocketPair(LLBC_SocketHandle handles[2]);
+
+/**
+ * Bind unix domain socket to specific path.
+ * Note:
+ *      - If path start with '@', path will bind to linux abstract namespace(no file create).
+ *      - Otherwise, the stale socket file(no process listening on it) will be removed before bind,
+ *        if path is not socket file or socket file still in use, bind failed with EADDRINUSE error.
+ * @param[in] handle - socket handle.
+ * @param[in] path   - the unix socket path.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_BindToUnixPath(LLBC_SocketHandle handle, const char *path);
+
+/**
+ * Establish a connection to a specified unix socket path.
+ * @param[in] handle - socket handle.
+ * @param[in] path   - the unix socket path, if start with '@', means linux abstract namespace.
+ * @return int - if no error occurs, returns zero, return -1 and a specific error set to LLBC_ErrNo.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_ConnectToUnixPath(LLBC_SocketHandle handle, const char *path);
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+/**
+ * Create UDP socket.
+ * @return LLBC_SocketHandle - socket handle, if failed, return LLBC_INVALID_SOCKET_HANDLE.
+ */
+LLBC_EXTERN LLBC_EXPORT LLBC_SocketHandle LLBC_CreateUdpSocket();
+
+/**
+ * Receive multiple datagrams from socket in one system call(recvmmsg).
+ * @param[in] handle - socket handle.
+ * @param[in] msgs   - the message headers.
+ * @param[in] count  - the message headers count.
+ * @return int - the received datagrams count, if failed, return -1, if would block,
+ *               last error set to LLBC_ERROR_WBLOCK or LLBC_ERROR_AGAIN.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_RecvMultiMsgs(LLBC_SocketHandle handle, struct mmsghdr *msgs, uint32 count);
+
+/**
+ * Send multiple datagrams to socket in one system call(sendmmsg).
+ * @param[in] handle - socket handle.
+ * @param[in] msgs   - the message headers.
+ * @param[in] count  - the message headers count.
+ * @return int - the sent datagrams count, if failed, return -1, if would block,
+ *               last error set to LLBC_ERROR_WBLOCK or LLBC_ERROR_AGAIN.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_SendMultiMsgs(LLBC_SocketHandle handle, struct mmsghdr *msgs, uint32 count);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
 __LLBC_NS_END
 
 #endif // !__LLBC_CORE_OS_OS_SOCKET_H__
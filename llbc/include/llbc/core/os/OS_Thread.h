@@ -108,6 +108,57 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_GetThreadPriority(LLBC_NativeThreadHandle handl
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_SetThreadPriority(LLBC_NativeThreadHandle handle, int priority);
 
+/**
+ * Get the online CPU(logic processor) count.
+ * @return int - the CPU count, at least return 1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_GetCPUCount();
+
+/**
+ * Bind thread to specific CPU(logic processor).
+ * @param[in] handle - native thread handle.
+ * @param[in] cpuNo  - the CPU number, start from 0, must less than LLBC_GetCPUCount().
+ * @return int - return 0 if successed, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_SetThreadAffinity(LLBC_NativeThreadHandle handle, int cpuNo);
+
+/**
+ * Bind thread to specific CPU(logic processor) set.
+ * @param[in] handle - native thread handle.
+ * @param[in] cpuNos - the CPU numbers, start from 0, every CPU number must less than LLBC_GetCPUCount().
+ * @return int - return 0 if successed, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_SetThreadAffinity(LLBC_NativeThreadHandle handle, const std::vector<int> &cpuNos);
+
+/**
+ * Get the NUMA node count.
+ * @return int - the NUMA node count, if system not support NUMA, return 1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_GetNUMANodeCount();
+
+/**
+ * Get specific NUMA node's online CPUs(logic processors).
+ * @param[in]  node   - the NUMA node, start from 0, must less than LLBC_GetNUMANodeCount().
+ * @param[out] cpuNos - the node's CPU numbers, in ascending order.
+ * @return int - return 0 if successed, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_GetNUMANodeCPUs(int node, std::vector<int> &cpuNos);
+
+/**
+ * Allocate page aligned memory, and prefer to place it on specific NUMA node.
+ * @param[in] size - the memory size, in bytes.
+ * @param[in] node - the preferred NUMA node, if less than 0, use system default policy(first touch).
+ * @return void * - the allocated memory, must free by LLBC_NUMAFree(), if failed, return NULL.
+ */
+LLBC_EXTERN LLBC_EXPORT void *LLBC_NUMAAlloc(size_t size, int node);
+
+/**
+ * Free the memory allocated by LLBC_NUMAAlloc().
+ * @param[in] mem  - the memory.
+ * @param[in] size - the memory size, must same as allocated size.
+ */
+LLBC_EXTERN LLBC_EXPORT void LLBC_NUMAFree(void *mem, size_t size);
+
 /**
  * Suspend thread.
  * @param[in] handle - native thread handle.
@@ -155,6 +206,31 @@ LLBC_EXTERN LLBC_EXPORT void LLBC_Sleep(int milliSeconds);
  */
 LLBC_EXTERN LLBC_EXPORT void LLBC_CPURelax();
 
+#if LLBC_CFG_THREAD_ENABLE_FUTEX && LLBC_TARGET_PLATFORM_LINUX
+ #define LLBC_SUPPORT_FUTEX 1
+#else
+ #define LLBC_SUPPORT_FUTEX 0
+#endif
+
+#if LLBC_SUPPORT_FUTEX
+/**
+ * Futex wait, if *addr == expect, block until waked up or timed out(process private futex).
+ * @param[in] addr         - the futex address.
+ * @param[in] expect       - the expect value.
+ * @param[in] milliSeconds - time-out value, LLBC_INFINITE means wait forever.
+ * @return int - return 0 if waked up(maybe spurious) or *addr != expect, return -1 if timed out.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_FutexWait(volatile sint32 *addr, sint32 expect, int milliSeconds);
+
+/**
+ * Futex wake, wake up at most count waiters which waiting on addr.
+ * @param[in] addr  - the futex address.
+ * @param[in] count - the maximum wake up waiters count.
+ * @return int - the waked up waiters count, if failed, return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_FutexWake(volatile sint32 *addr, int count);
+#endif // LLBC_SUPPORT_FUTEX
+
 /**
  * Alloc thread local storage handle.
  * @param[out] handle - thread local storage handle.
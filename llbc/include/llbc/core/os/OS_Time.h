@@ -54,6 +54,47 @@ LLBC_EXTERN sint64 LLBC_GetMilliSeconds();
  */
 LLBC_EXTERN sint64 LLBC_GetMicroSeconds();
 
+/**
+ * Get the current time from the coarse clock, cheaper than LLBC_GetMilliSeconds(), but
+ * the resolution is only the kernel tick(generally 1~4 milli-seconds).
+ * In Non-LINUX platform, this function equivalent to LLBC_GetMilliSeconds().
+ * @return sint64 - current time, in milli-seconds since midnight(0:0:0),
+ *                  January 1, 1970, coordinated universal time(UTC).
+ */
+LLBC_EXTERN sint64 LLBC_GetCoarseMilliSeconds();
+
+/**
+ * Get the monotonic clock time, not affected by system time adjustment(ntp step/manual set),
+ * use it to measure elapsed time, not use it as calendar time.
+ * @return sint64 - the monotonic time, in micro-seconds since an unspecified start point(generally system boot).
+ */
+LLBC_EXTERN sint64 LLBC_GetMonotonicMicroSeconds();
+
+/**
+ * Get the monotonic time from the coarse clock, cheaper than LLBC_GetMonotonicMicroSeconds(), but
+ * the resolution is only the kernel tick(generally 1~4 milli-seconds).
+ * In Non-LINUX platform, this function equivalent to LLBC_GetMonotonicMicroSeconds() / 1000.
+ * @return sint64 - the monotonic time, in milli-seconds since an unspecified start point(generally system boot).
+ */
+LLBC_EXTERN sint64 LLBC_GetCoarseMonotonicMilliSeconds();
+
+/**
+ * Get the process-wide cached time, the cached time is refreshed by LLBC_UpdateCachedMilliSeconds(),
+ * all self-drive/external-drive services will refresh it at every frame begin.
+ * Note:
+ *      If cached time never refreshed, this function will refresh it first.
+ * @return sint64 - the cached time, in milli-seconds since midnight(0:0:0),
+ *                  January 1, 1970, coordinated universal time(UTC).
+ */
+LLBC_EXTERN LLBC_EXPORT sint64 LLBC_GetCachedMilliSeconds();
+
+/**
+ * Refresh the process-wide cached time, cached time never go back when multi threads refresh concurrently,
+ * unless system time step back more than 1 second.
+ * @return sint64 - the refreshed time(the newer cached time if refreshed by other thread), in milli-seconds.
+ */
+LLBC_EXTERN LLBC_EXPORT sint64 LLBC_UpdateCachedMilliSeconds();
+
 /**
  * Retrieves the number of milliseconds that have elapsed since the system was started, up to 49.7 days.
  * @return uint64 - the number of milliseconds that have elapsed since the system was started.
@@ -90,6 +90,50 @@ inline sint64 LLBC_GetMicroSeconds()
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+inline sint64 LLBC_GetCoarseMilliSeconds()
+{
+#if LLBC_TARGET_PLATFORM_LINUX && defined(CLOCK_REALTIME_COARSE)
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+
+    return (sint64)ts.tv_sec * 1000 + ts.tv_nsec / (1000 * 1000);
+#else // Non-LINUX platform or not support coarse clock
+    return LLBC_GetMilliSeconds();
+#endif // LLBC_TARGET_PLATFORM_LINUX && defined(CLOCK_REALTIME_COARSE)
+}
+
+inline sint64 LLBC_GetMonotonicMicroSeconds()
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (sint64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else // LLBC_TARGET_PLATFORM_WIN32
+    static LARGE_INTEGER freq;
+    if (UNLIKELY(freq.QuadPart == 0))
+        ::QueryPerformanceFrequency(&freq);
+
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+
+    return (sint64)(counter.QuadPart / freq.QuadPart * 1000000 +
+                    counter.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
+inline sint64 LLBC_GetCoarseMonotonicMilliSeconds()
+{
+#if LLBC_TARGET_PLATFORM_LINUX && defined(CLOCK_MONOTONIC_COARSE)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+
+    return (sint64)ts.tv_sec * 1000 + ts.tv_nsec / (1000 * 1000);
+#else // Non-LINUX platform or not support coarse clock
+    return LLBC_GetMonotonicMicroSeconds() / 1000;
+#endif // LLBC_TARGET_PLATFORM_LINUX && defined(CLOCK_MONOTONIC_COARSE)
+}
+
 #if LLBC_TARGET_PLATFORM_WIN32
 inline void LLBC_WinFileTime2TimeSpec(const FILETIME &fileTime, timespec &ts)
 {
@@ -0,0 +1,15 @@
+/**
+ * @file    Common.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_PROFILER_COMMON_H__
+#define __LLBC_CORE_PROFILER_COMMON_H__
+
+#include "llbc/core/profiler/CostStat.h"
+#include "llbc/core/profiler/FrameProfiler.h"
+
+#endif // !__LLBC_CORE_PROFILER_COMMON_H__
@@ -0,0 +1,81 @@
+/**
+ * @file    CostStat.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The cost statistic(times/total/max/histogram) info.
+ */
+#ifndef __LLBC_CORE_PROFILER_COST_STAT_H__
+#define __LLBC_CORE_PROFILER_COST_STAT_H__
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The cost statistic info, all costs in micro-seconds.
+ */
+struct LLBC_EXPORT LLBC_CostStat
+{
+    /**
+     * The cost histogram buckets, in micro-seconds:
+     *  [0, 10), [10, 100), [100, 1000), [1000, 10000), [10000, 100000), [100000, +inf)
+     */
+    enum { HistogramBucketCount = 6 };
+
+    uint64 times;             // Cost times.
+    sint64 totalCost;         // Total cost, in micro-seconds.
+    sint64 maxCost;           // Max cost, in micro-seconds.
+    uint64 histogram[HistogramBucketCount];
+
+    LLBC_CostStat();
+
+    /**
+     * Add one time cost.
+     * @param[in] cost - the cost, in micro-seconds.
+     */
+    void Add(sint64 cost);
+
+    /**
+     * Add one time cost, single writer version, only owner thread can call it, other threads
+     * can use AtomicCopyTo() to read the stat without lock.
+     * @param[in] cost - the cost, in micro-seconds.
+     */
+    void AtomicAdd(sint64 cost);
+
+    /**
+     * Copy stat to other stat, each field read atomically(fields may be from slightly different
+     * AtomicAdd() calls), use to read the stat updated by AtomicAdd() in other thread.
+     * @param[out] to - the copy destination.
+     */
+    void AtomicCopyTo(LLBC_CostStat &to) const;
+
+    /**
+     * Merge other cost stat into this stat.
+     * @param[in] other - other cost stat.
+     */
+    void Merge(const LLBC_CostStat &other);
+
+    /**
+     * Reset the cost stat.
+     */
+    void Reset();
+
+    /**
+     * Get average cost.
+     * @return double - the average cost, in micro-seconds.
+     */
+    double GetAverageCost() const;
+
+    /**
+     * Get the histogram bucket upper bound(exclude).
+     * @param[in] bucket - the bucket index.
+     * @return sint64 - the bucket upper bound, in micro-seconds, the last bucket return -1(means +inf).
+     */
+    static sint64 GetHistogramBucketUpperBound(int bucket);
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_PROFILER_COST_STAT_H__
@@ -0,0 +1,161 @@
+/**
+ * @file    FrameProfiler.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The frame profiler, use to profile frame driven loop(eg: service main loop) costs.
+ *        All record methods must be called in the frame driven thread, costs buffered in
+ *        frame and merge into rolling window stats when frame end, so lock only taken once per frame.
+ */
+#ifndef __LLBC_CORE_PROFILER_FRAME_PROFILER_H__
+#define __LLBC_CORE_PROFILER_FRAME_PROFILER_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/thread/SpinLock.h"
+#include "llbc/core/profiler/CostStat.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The frame profile, describe one rolling window costs.
+ */
+struct LLBC_EXPORT LLBC_FrameProfile
+{
+    sint64 beginTime;                         // Window begin time, in milli-seconds.
+    sint64 endTime;                           // Window end time(last frame end time), in milli-seconds.
+
+    LLBC_CostStat frameCost;                  // Frame cost stat.
+    uint64 slowFrames;                        // Slow frames count.
+
+    std::vector<LLBC_String> phaseNames;      // Phase names.
+    std::vector<LLBC_CostStat> phaseCosts;    // Phase cost stats, index by phase.
+
+    typedef std::map<int, LLBC_CostStat> OpcodeCosts;
+    OpcodeCosts opcodeCosts;                  // Opcode handler cost stats.
+
+    typedef std::map<LLBC_TimerId, LLBC_CostStat> TimerCosts;
+    TimerCosts timerCosts;                    // Timer callback cost stats.
+
+    LLBC_FrameProfile();
+
+    /**
+     * Reset the profile(phase names not reset).
+     */
+    void Reset();
+};
+
+/**
+ * \brief The frame profiler class encapsulation.
+ */
+class LLBC_EXPORT LLBC_FrameProfiler
+{
+public:
+    /**
+     * The frame inside cost type enumeration.
+     */
+    enum CostType
+    {
+        Opcode,
+        Timer
+    };
+
+public:
+    /**
+     * Construct frame profiler.
+     * @param[in] name       - the profiler name, use to report.
+     * @param[in] phaseNames - the phase names.
+     * @param[in] phaseCount - the phase count.
+     */
+    LLBC_FrameProfiler(const LLBC_String &name, const char * const phaseNames[], int phaseCount);
+    ~LLBC_FrameProfiler();
+
+public:
+    /**
+     * Get/Set slow frame threshold, when frame cost greater than threshold, will report top offenders to logger.
+     * @param[in] threshold - the threshold, in milli-seconds, 0 means disable slow frame report.
+     */
+    sint64 GetSlowFrameThreshold() const;
+    void SetSlowFrameThreshold(sint64 threshold);
+
+public:
+    /**
+     * Begin frame.
+     */
+    void BeginFrame();
+
+    /**
+     * End phase, the phase cost is the time elapsed since last phase end(or frame begin).
+     * @param[in] phase - the phase index.
+     */
+    void EndPhase(int phase);
+
+    /**
+     * Add frame inside cost, eg: opcode handler cost, timer callback cost.
+     * @param[in] type - the cost type, see CostType enumeration.
+     * @param[in] id   - the cost Id, opcode or timer Id.
+     * @param[in] cost - the cost, in micro-seconds.
+     */
+    void AddCost(int type, sint64 id, sint64 cost);
+
+    /**
+     * End frame, merge frame costs into rolling window, report top offenders if frame is slow.
+     * @return bool - return true if frame is slow frame, otherwise return false.
+     */
+    bool EndFrame();
+
+public:
+    /**
+     * Get frame profile.
+     * @param[out] profile   - the frame profile.
+     * @param[in]  lastWindow - get last(completed) rolling window profile or not, default get current window.
+     */
+    void GetProfile(LLBC_FrameProfile &profile, bool lastWindow = false);
+
+    /**
+     * Get last slow frame report.
+     * @return LLBC_String - the last slow frame report, if no slow frame, return empty string.
+     */
+    LLBC_String GetLastSlowFrameReport();
+
+    /**
+     * Reset all profiles.
+     */
+    void Reset();
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_FrameProfiler);
+
+private:
+    /**
+     * Build slow frame report.
+     */
+    LLBC_String BuildSlowFrameReport(sint64 frameCost) const;
+
+private:
+    struct _Entry
+    {
+        int type;
+        sint64 id;
+        sint64 cost;
+    };
+
+private:
+    LLBC_String _name;
+    sint64 _slowFrameThreshold;
+
+    sint64 _frameBegTime;                     // Frame begin time, monotonic clock, in micro-seconds.
+    sint64 _phaseBegTime;                     // Phase begin time, monotonic clock, in micro-seconds.
+    std::vector<sint64> _phaseCosts;
+    std::vector<_Entry> _entries;
+
+    LLBC_SpinLock _lock;
+    sint64 _windowBegTime;                    // Current window begin time, monotonic clock, in micro-seconds.
+    LLBC_FrameProfile _curProfile;
+    LLBC_FrameProfile _lastProfile;
+    LLBC_String _lastSlowFrameReport;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_PROFILER_FRAME_PROFILER_H__
@@ -11,7 +11,7 @@
 
 #include "llbc/common/Common.h"
 
-#include "llbc/core/thread/SpinLock.h"
+#include "llbc/core/thread/AdaptiveLock.h"
 
 __LLBC_NS_BEGIN
 
@@ -119,7 +119,7 @@ public:
     LLBC_DISABLE_ASSIGNMENT(LLBC_Random);
 
 private:
-    static LLBC_SpinLock _lock;
+    static LLBC_AdaptiveLock _lock;
 };
 
 __LLBC_NS_END
@@ -14,6 +14,7 @@
 #include "llbc/core/sampler/CountSampler.h"
 #include "llbc/core/sampler/IntervalSampler.h"
 #include "llbc/core/sampler/LimitSampler.h"
+#include "llbc/core/sampler/TokenBucketSampler.h"
 
 #include "llbc/core/sampler/SamplerGroup.h"
 
@@ -26,6 +26,7 @@ public:
         CountSampler = Begin,
         IntervalSampler,
         LimitSampler,
+        TokenBucketSampler,
 
         End
     };
@@ -0,0 +1,117 @@
+/**
+ * @file    TokenBucketSampler.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_SAMPLER_TOKEN_BUCKET_SAMPLER_H__
+#define __LLBC_CORE_SAMPLER_TOKEN_BUCKET_SAMPLER_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/sampler/LimitSampler.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The token bucket type sampler class encapsulation.
+ *        Bucket refill rate tokens per second, hold at most burst tokens, sampling
+ *        consume tokens, if tokens not enough, sampling failed(rate limited).
+ *        Refill measured by coarse monotonic clock, system time adjustment not affect it.
+ */
+class LLBC_EXPORT LLBC_TokenBucketSampler : public LLBC_LimitSampler
+{
+    typedef LLBC_LimitSampler _Base;
+
+public:
+    LLBC_TokenBucketSampler();
+    virtual ~LLBC_TokenBucketSampler();
+
+public:
+   /**
+    * Get sampler type.
+    * @return int - sampler type.
+    */
+    virtual int GetType() const;
+
+    /**
+     * Reset sampler, bucket will be refilled to full.
+     */
+     virtual void Reset();
+
+public:
+    /**
+     * Set the token bucket rate.
+     * @param[in] rate  - the refill rate, tokens per second, 0 means not limit.
+     * @param[in] burst - the bucket capacity, if less than or equal to 0, use rate as capacity.
+     */
+    void SetRate(sint64 rate, sint64 burst = 0);
+
+    /**
+     * Get the refill rate.
+     * @return sint64 - the refill rate, tokens per second.
+     */
+    sint64 GetRate() const;
+
+    /**
+     * Get the bucket capacity.
+     * @return sint64 - the bucket capacity.
+     */
+    sint64 GetBurst() const;
+
+public:
+    /**
+     * Sampling function, consume value tokens.
+     * @param[in] value   - the consume tokens.
+      *@param[in] appData - current time sampling value.
+     * @return int - return 0 if success, if tokens not enough, return -1 and set last error to LLBC_ERROR_LIMIT.
+     */
+    virtual int Sampling(sint64 value, void *appData = NULL);
+
+    /**
+     * Check bucket has enough tokens or not, not consume tokens.
+     * @param[in] value - the tokens.
+     * @return bool - return true if tokens enough, otherwise return false.
+     */
+    bool IsAvailable(sint64 value);
+
+    /**
+     * Get the current available tokens.
+     * @return sint64 - the available tokens, if not limit, return -1.
+     */
+    sint64 GetTokens();
+
+    /**
+     * Get the rate limited(tokens not enough) sampling times.
+     * @return uint64 - the limited times.
+     */
+    uint64 GetLimitedTimes() const;
+
+protected:
+    /**
+     * Get current time used to refill tokens, default use coarse monotonic clock.
+     * @return sint64 - the current time, in milli-seconds.
+     */
+    virtual sint64 GetNowTime() const;
+
+private:
+    /**
+     * Refill tokens by elapsed time.
+     */
+    void Refill();
+
+private:
+    sint64 _rate;
+    sint64 _burst;
+
+    sint64 _milliTokens; // Available tokens * 1000, keeps sub-token precision in milli-seconds refill.
+    sint64 _lastRefillTime;
+
+    uint64 _limitedTimes;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_SAMPLER_TOKEN_BUCKET_SAMPLER_H__
@@ -0,0 +1,79 @@
+/**
+ * @file    AdaptiveLock.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The adaptive(spin-then-park) lock.
+ *        Lock spin LLBC_CFG_THREAD_ADAPTIVE_LOCK_SPIN_COUNT rounds with LLBC_CPURelax(), if still
+ *        contended, park in kernel(futex on linux platform), so descheduled lock holder not burn waiters cores.
+ */
+#ifndef __LLBC_CORE_THREAD_ADAPTIVE_LOCK_H__
+#define __LLBC_CORE_THREAD_ADAPTIVE_LOCK_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/os/OS_Thread.h"
+#include "llbc/core/thread/ILock.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief Adaptive lock encapsulation.
+ *        In futex implementation, the uncontended Lock()/Unlock() is one atomic operation and inlined,
+ *        use LLBC_LockGuard<LLBC_AdaptiveLock> to avoid virtual call.
+ */
+class LLBC_EXPORT LLBC_AdaptiveLock : public LLBC_ILock
+{
+public:
+    LLBC_AdaptiveLock();
+    virtual ~LLBC_AdaptiveLock();
+
+public:
+    /**
+     * Acquire lock.
+     */
+    virtual void Lock();
+
+    /**
+     * Try acquire lock.
+     */
+    virtual bool TryLock();
+
+    /**
+     * Release lock.
+     */
+    virtual void Unlock();
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+private:
+    friend class LLBC_ConditionVariable;
+    virtual void *Handle();
+#endif
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_AdaptiveLock);
+
+private:
+    /**
+     * Contended lock/unlock slow path.
+     */
+    void LockSlow();
+#if LLBC_SUPPORT_FUTEX
+    void UnlockSlow();
+#endif
+
+private:
+#if LLBC_SUPPORT_FUTEX
+    // Lock state: 0 - unlocked, 1 - locked, no waiters, 2 - locked, maybe has waiters.
+    volatile sint32 _state;
+#else
+    LLBC_MutexHandle _handle;
+#endif
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/thread/AdaptiveLockImpl.h"
+
+#endif // !__LLBC_CORE_THREAD_ADAPTIVE_LOCK_H__
@@ -0,0 +1,39 @@
+/**
+ * @file    AdaptiveLockImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#ifdef __LLBC_CORE_THREAD_ADAPTIVE_LOCK_H__
+
+__LLBC_NS_BEGIN
+
+#if LLBC_SUPPORT_FUTEX
+inline void LLBC_AdaptiveLock::Lock()
+{
+    if (LIKELY(LLBC_AtomicCompareAndExchange(&_state, 1, 0) == 0))
+        return;
+
+    LockSlow();
+}
+
+inline bool LLBC_AdaptiveLock::TryLock()
+{
+    return LLBC_AtomicCompareAndExchange(&_state, 1, 0) == 0;
+}
+
+inline void LLBC_AdaptiveLock::Unlock()
+{
+    if (LIKELY(LLBC_AtomicFetchAndSub(&_state, 1) == 1))
+        return;
+
+    UnlockSlow();
+}
+#endif // LLBC_SUPPORT_FUTEX
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_THREAD_ADAPTIVE_LOCK_H__
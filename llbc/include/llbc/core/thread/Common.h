@@ -14,6 +14,7 @@
 #include "llbc/core/thread/RecursiveLock.h"
 #include "llbc/core/thread/FastLock.h"
 #include "llbc/core/thread/SpinLock.h"
+#include "llbc/core/thread/AdaptiveLock.h"
 #include "llbc/core/thread/RWLock.h"
 #include "llbc/core/thread/Guard.h"
 #include "llbc/core/thread/ReverseGuard.h"
@@ -23,7 +24,12 @@
 #include "llbc/core/thread/MessageBlock.h"
 #include "llbc/core/thread/MessageBuffer.h"
 #include "llbc/core/thread/MessageQueue.h"
+#include "llbc/core/thread/MpscQueue.h"
 #include "llbc/core/thread/ThreadManager.h"
 #include "llbc/core/thread/Task.h"
+#include "llbc/core/thread/Executor.h"
+#include "llbc/core/thread/Future.h"
+#include "llbc/core/thread/ThreadPool.h"
+#include "llbc/core/thread/ParallelFor.h"
 
 #endif // !__LLBC_CORE_THREAD_COMMON_H__
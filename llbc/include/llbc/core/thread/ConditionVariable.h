@@ -11,6 +11,8 @@
 
 #include "llbc/common/Common.h"
 
+#include "llbc/core/os/OS_Thread.h"
+
 __LLBC_NS_BEGIN
 class LLBC_ILock;
 __LLBC_NS_END
@@ -19,6 +21,7 @@ __LLBC_NS_BEGIN
 
 /**
  * \brief CV class encapsulation.
+ *        In futex implementation, CV not depend on lock native handle, can use with any LLBC_ILock.
  */
 class LLBC_EXPORT LLBC_ConditionVariable
 {
@@ -67,7 +70,10 @@ private:
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
 private:
-#if LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_SUPPORT_FUTEX
+    volatile sint32 _seq;     // Notify sequence, every notify/broadcast increase it.
+    volatile sint32 _waiters; // Waiters count, use to skip wake up syscall when no waiters.
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
     pthread_cond_t m_handle;
 #else // LLBC_TARGET_PLATFORM_WIN32
     struct 
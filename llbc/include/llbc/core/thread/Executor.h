@@ -0,0 +1,39 @@
+/**
+ * @file    Executor.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_THREAD_EXECUTOR_H__
+#define __LLBC_CORE_THREAD_EXECUTOR_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/utils/Util_DelegateImpl.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The executor interface, executor run the task in it's own thread(s).
+ */
+class LLBC_EXPORT LLBC_IExecutor
+{
+public:
+    virtual ~LLBC_IExecutor() {  }
+
+public:
+    /**
+     * Execute task, the task will run in executor's thread(s).
+     * Note: Executor take over the task, whether execute success or not, the task
+     *       will be deleted by executor(after executed).
+     * @param[in] task - the task delegate.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Execute(LLBC_IDelegate0 *task) = 0;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_THREAD_EXECUTOR_H__
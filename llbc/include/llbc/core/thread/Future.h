@@ -0,0 +1,120 @@
+/**
+ * @file    Future.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_THREAD_FUTURE_H__
+#define __LLBC_CORE_THREAD_FUTURE_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/utils/Util_DelegateImpl.h"
+#include "llbc/core/thread/Executor.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * Pre-declare some classes.
+ */
+class LLBC_FutureState;
+class LLBC_ThreadPool;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The future class encapsulation, use to wait task completed or chain continuations.
+ *        Future is a reference of the task completion state, copy future is cheap.
+ *        Task result should be stored in task object, when future is done, the result is visible.
+ */
+class LLBC_EXPORT LLBC_Future
+{
+public:
+    LLBC_Future();
+    LLBC_Future(const LLBC_Future &other);
+    ~LLBC_Future();
+
+public:
+    /**
+     * Check future is valid or not(future submit failed is invalid).
+     * @return bool - the valid flag.
+     */
+    bool IsValid() const;
+
+    /**
+     * Check the task is done or not.
+     * @return bool - the done flag.
+     */
+    bool IsDone() const;
+
+    /**
+     * Wait the task done, if call in thread pool worker thread, will help run other tasks while waiting.
+     * @param[in] milliSeconds - the wait timeout, in milli-seconds, default is LLBC_INFINITE.
+     * @return int - return 0 if task done, otherwise return -1(timeout or invalid future).
+     */
+    int Wait(int milliSeconds = LLBC_INFINITE) const;
+
+    /**
+     * Add continuation, when task done, continuation will be executed.
+     * @param[in] continuation - the continuation delegate, future take over it.
+     * @param[in] executor     - the continuation executor, if NULL, continuation run in the
+     *                           task completed thread(or caller thread when task already done).
+     *                           Eg: pass service executor to let continuation run in service thread.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Then(LLBC_IDelegate0 *continuation, LLBC_IExecutor *executor = NULL);
+
+    /**
+     * Add continuation, when task done, continuation will be executed.
+     * @param[in] obj      - the continuation object.
+     * @param[in] method   - the continuation method.
+     * @param[in] executor - the continuation executor.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    template <typename ObjType>
+    int Then(ObjType *obj, void (ObjType::*method)(), LLBC_IExecutor *executor = NULL);
+
+public:
+    LLBC_Future &operator =(const LLBC_Future &other);
+
+private:
+    friend class LLBC_ThreadPool;
+
+    /**
+     * Create new future, call by thread pool.
+     * @param[in] pool - the thread pool.
+     * @return LLBC_Future - the new future.
+     */
+    static LLBC_Future Create(LLBC_ThreadPool *pool);
+
+    /**
+     * Get the future state, call by thread pool.
+     * @return LLBC_FutureState * - the future state.
+     */
+    LLBC_FutureState *GetState() const;
+
+    /**
+     * Set the future state done, call by thread pool.
+     * @param[in] state - the future state.
+     */
+    static void SetDone(LLBC_FutureState *state);
+
+    /**
+     * Retain/Release the future state.
+     */
+    static void RetainState(LLBC_FutureState *state);
+    static void ReleaseState(LLBC_FutureState *state);
+
+private:
+    LLBC_FutureState *_state;
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/thread/FutureImpl.h"
+
+#endif // !__LLBC_CORE_THREAD_FUTURE_H__
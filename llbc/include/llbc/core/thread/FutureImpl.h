@@ -0,0 +1,22 @@
+/**
+ * @file    FutureImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#ifdef __LLBC_CORE_THREAD_FUTURE_H__
+
+__LLBC_NS_BEGIN
+
+template <typename ObjType>
+inline int LLBC_Future::Then(ObjType *obj, void (ObjType::*method)(), LLBC_IExecutor *executor)
+{
+    return Then(new LLBC_Delegate0<ObjType>(obj, method), executor);
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_THREAD_FUTURE_H__
@@ -34,6 +34,28 @@ private:
     LLBC_ILock &_lock;
 };
 
+/**
+ * \brief Non-virtual guardian template class encapsulation.
+ *        Lock/Unlock called by qualified name, so no virtual call, and inline lock fast path
+ *        (eg: LLBC_AdaptiveLock) can be inlined.
+ * Note: LockType must be concrete lock type, can't be LLBC_ILock.
+ */
+template <typename LockType>
+class LLBC_LockGuard
+{
+public:
+    explicit LLBC_LockGuard(LockType &lock);
+
+    ~LLBC_LockGuard();
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_LockGuard);
+
+private:
+    LockType &_lock;
+};
+
 __LLBC_NS_END
 
+#include "llbc/core/thread/GuardImpl.h"
+
 #endif // __LLBC_CORE_THREAD_GUARD_H__
@@ -0,0 +1,29 @@
+/**
+ * @file    GuardImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#ifdef __LLBC_CORE_THREAD_GUARD_H__
+
+__LLBC_NS_BEGIN
+
+template <typename LockType>
+inline LLBC_LockGuard<LockType>::LLBC_LockGuard(LockType &lock)
+: _lock(lock)
+{
+    _lock.LockType::Lock();
+}
+
+template <typename LockType>
+inline LLBC_LockGuard<LockType>::~LLBC_LockGuard()
+{
+    _lock.LockType::Unlock();
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_THREAD_GUARD_H__
@@ -18,6 +18,8 @@ __LLBC_NS_BEGIN
  */
 class LLBC_EXPORT LLBC_MessageBlock
 {
+    LLBC_POOL_ALLOCATED_CLASS(LLBC_MessageBlock);
+
 public:
     static const size_t npos = -1;
 
@@ -82,6 +82,7 @@ public:
 
 private:
     LLBC_MessageBlock *_head;
+    LLBC_MessageBlock *_tail; // Only valid when _head not NULL, make Append() O(1).
 };
 
 __LLBC_NS_END
@@ -12,7 +12,7 @@
 #include "llbc/common/Common.h"
 
 #if LLBC_TARGET_PLATFORM_NON_WIN32
-#include "llbc/core/thread/SimpleLock.h"
+#include "llbc/core/thread/AdaptiveLock.h"
 #include "llbc/core/thread/ConditionVariable.h"
 #else // LLBC_TARGET_PLATFORM_WIN32
 #include "llbc/core/thread/SpinLock.h"
@@ -159,7 +159,7 @@ private:
 
 public:
 #if LLBC_TARGET_PLATFORM_NON_WIN32
-    LLBC_SimpleLock _lock;
+    LLBC_AdaptiveLock _lock;
     LLBC_ConditionVariable _cond;
 #else // LLBC_TARGET_PLATFORM_WIN32
     LLBC_SpinLock _lock;
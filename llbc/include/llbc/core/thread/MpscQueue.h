@@ -0,0 +1,68 @@
+/**
+ * @file    MpscQueue.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The lock-free multi-producer single-consumer queue.
+ *        Push is wait-free(one atomic exchange), pop is lock-free and only allowed in one consumer thread.
+ *        Note: When producer preempted between exchange and link, consumer may temporary see queue empty,
+ *              the element will be seen after producer resumed.
+ */
+#ifndef __LLBC_CORE_THREAD_MPSC_QUEUE_H__
+#define __LLBC_CORE_THREAD_MPSC_QUEUE_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The lock-free multi-producer single-consumer queue class encapsulation.
+ */
+template <typename T>
+class LLBC_MpscQueue
+{
+public:
+    LLBC_MpscQueue();
+    ~LLBC_MpscQueue();
+
+public:
+    /**
+     * Push element to queue tail, thread safe.
+     * @param[in] value - the element.
+     */
+    void Push(const T &value);
+
+    /**
+     * Try pop element from queue head, only can call in consumer thread.
+     * @param[out] value - the popped element.
+     * @return bool - return true if popped, otherwise return false.
+     */
+    bool TryPop(T &value);
+
+    /**
+     * Check queue is empty or not, only can call in consumer thread.
+     * @return bool - return true if empty, otherwise return false.
+     */
+    bool IsEmpty() const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_MpscQueue);
+
+private:
+    struct _Node
+    {
+        _Node * volatile next;
+        T value;
+    };
+
+    _Node * volatile _tail; // Producers side.
+    _Node *_head;           // Consumer side, always point to stub node.
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/thread/MpscQueueImpl.h"
+
+#endif // !__LLBC_CORE_THREAD_MPSC_QUEUE_H__
@@ -0,0 +1,73 @@
+/**
+ * @file    MpscQueueImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#ifdef __LLBC_CORE_THREAD_MPSC_QUEUE_H__
+
+__LLBC_NS_BEGIN
+
+template <typename T>
+inline LLBC_MpscQueue<T>::LLBC_MpscQueue()
+{
+    _Node *stub = new _Node;
+    stub->next = NULL;
+
+    _tail = stub;
+    _head = stub;
+}
+
+template <typename T>
+inline LLBC_MpscQueue<T>::~LLBC_MpscQueue()
+{
+    while (_head)
+    {
+        _Node *next = _head->next;
+        delete _head;
+        _head = next;
+    }
+}
+
+template <typename T>
+inline void LLBC_MpscQueue<T>::Push(const T &value)
+{
+    _Node *node = new _Node;
+    node->next = NULL;
+    node->value = value;
+
+    // Swing tail to new node, then link previous tail to new node.
+    // Link is full barrier(release at least), node value must be visible before consumer see the link.
+    _Node *prev = reinterpret_cast<_Node *>(
+        LLBC_AtomicSetPtr(reinterpret_cast<void * volatile *>(&_tail), node));
+    LLBC_AtomicSetPtr(reinterpret_cast<void * volatile *>(&prev->next), node);
+}
+
+template <typename T>
+inline bool LLBC_MpscQueue<T>::TryPop(T &value)
+{
+    _Node *next = reinterpret_cast<_Node *>(
+        LLBC_AtomicGetPtr(reinterpret_cast<void * volatile *>(&_head->next)));
+    if (!next)
+        return false;
+
+    // The next node become new stub node.
+    value = next->value;
+    delete _head;
+    _head = next;
+
+    return true;
+}
+
+template <typename T>
+inline bool LLBC_MpscQueue<T>::IsEmpty() const
+{
+    return _head->next == NULL;
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_THREAD_MPSC_QUEUE_H__
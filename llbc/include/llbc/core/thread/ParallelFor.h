@@ -0,0 +1,148 @@
+/**
+ * @file    ParallelFor.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The parallel-for/parallel-reduce helpers, base on LLBC_ThreadPool.
+ *        Index range split into fixed grain size chunks, the chunks claimed dynamically by
+ *        caller thread and pool workers, caller thread always participate and join before return.
+ */
+#ifndef __LLBC_CORE_THREAD_PARALLEL_FOR_H__
+#define __LLBC_CORE_THREAD_PARALLEL_FOR_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/thread/ThreadPool.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The parallel job base class, implement chunk claim/help/join logic.
+ *        Parallel job object always create in heap and reference counted, pool helper
+ *        tasks may run after job joined, these tasks only release the reference.
+ */
+class LLBC_EXPORT LLBC_ParallelJob
+{
+public:
+    /**
+     * Run the job, caller thread participate and wait all chunks finished.
+     * If pool not started, all chunks run in caller thread.
+     * @param[in] pool - the thread pool.
+     */
+    void Run(LLBC_ThreadPool &pool);
+
+    /**
+     * Release job reference, when reference count reach 0, job will be deleted.
+     */
+    void Release();
+
+protected:
+    explicit LLBC_ParallelJob(int chunkCount);
+    virtual ~LLBC_ParallelJob();
+
+    /**
+     * Run specific chunk, implement by subclass.
+     * @param[in] chunk - the chunk index.
+     */
+    virtual void RunChunk(int chunk) = 0;
+
+    /**
+     * Get chunk count.
+     */
+    int GetChunkCount() const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_ParallelJob);
+
+private:
+    /**
+     * Claim and run chunks until no chunk can claim.
+     */
+    void RunChunks();
+
+    /**
+     * The pool helper task entry.
+     */
+    void Help();
+
+private:
+    const int _chunkCount;
+
+    volatile sint32 _refs;
+    volatile sint32 _nextChunk;
+    volatile sint32 _finishedChunks;
+};
+
+/**
+ * Calculate parallel chunk grain size.
+ * @param[in] pool      - the thread pool.
+ * @param[in] count     - the elements count.
+ * @param[in] grainSize - the user specific grain size, if <= 0, auto calculate(about 4 chunks per worker).
+ * @return int - the grain size, always >= 1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_CalcParallelGrainSize(const LLBC_ThreadPool &pool, int count, int grainSize);
+
+/**
+ * Parallel for, call func(idx) for every index in [begin, end).
+ * Note:
+ *      - func will be called concurrently, must be thread safe.
+ *      - function return after all indexes processed(deterministic join).
+ * @param[in] pool      - the thread pool.
+ * @param[in] begin     - the begin index.
+ * @param[in] end       - the end index(not include).
+ * @param[in] func      - the function or functor, signature: void (int idx).
+ * @param[in] grainSize - the chunk grain size, <= 0 means auto calculate.
+ */
+template <typename Func>
+void LLBC_ParallelFor(LLBC_ThreadPool &pool, int begin, int end, Func &func, int grainSize = 0);
+
+/**
+ * Parallel for, call (obj->*method)(idx) for every index in [begin, end).
+ * @param[in] pool      - the thread pool.
+ * @param[in] begin     - the begin index.
+ * @param[in] end       - the end index(not include).
+ * @param[in] obj       - the object.
+ * @param[in] method    - the object method.
+ * @param[in] grainSize - the chunk grain size, <= 0 means auto calculate.
+ */
+template <typename ObjType>
+void LLBC_ParallelFor(LLBC_ThreadPool &pool, int begin, int end, ObjType *obj, void (ObjType::*method)(int), int grainSize = 0);
+
+/**
+ * Parallel for each, call func(elem) for every element in random access iterator range [first, last).
+ * @param[in] pool      - the thread pool.
+ * @param[in] first     - the first iterator.
+ * @param[in] last      - the last iterator.
+ * @param[in] func      - the function or functor, signature: void (Elem &elem).
+ * @param[in] grainSize - the chunk grain size, <= 0 means auto calculate.
+ */
+template <typename RandomIter, typename Func>
+void LLBC_ParallelForEach(LLBC_ThreadPool &pool, RandomIter first, RandomIter last, Func &func, int grainSize = 0);
+
+/**
+ * Parallel reduce, result = reduce(...reduce(reduce(identity, map(begin)), map(begin + 1))..., map(end - 1)).
+ * Every chunk reduce from identity, chunk results reduce in chunk order in caller thread,
+ * so for same grain size, result is deterministic(eg: float sum).
+ * @param[in] pool      - the thread pool.
+ * @param[in] begin     - the begin index.
+ * @param[in] end       - the end index(not include).
+ * @param[in] identity  - the reduce identity value.
+ * @param[in] mapFunc   - the map function or functor, signature: T (int idx).
+ * @param[in] reduceFunc - the reduce function or functor, signature: T (const T &left, const T &right).
+ * @param[in] grainSize - the chunk grain size, <= 0 means auto calculate.
+ * @return T - the reduce result.
+ */
+template <typename T, typename MapFunc, typename ReduceFunc>
+T LLBC_ParallelReduce(LLBC_ThreadPool &pool,
+                      int begin,
+                      int end,
+                      const T &identity,
+                      MapFunc &mapFunc,
+                      ReduceFunc &reduceFunc,
+                      int grainSize = 0);
+
+__LLBC_NS_END
+
+#include "llbc/core/thread/ParallelForImpl.h"
+
+#endif // !__LLBC_CORE_THREAD_PARALLEL_FOR_H__
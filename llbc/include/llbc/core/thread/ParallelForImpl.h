@@ -0,0 +1,218 @@
+/**
+ * @file    ParallelForImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#ifdef __LLBC_CORE_THREAD_PARALLEL_FOR_H__
+
+__LLBC_INTERNAL_NS_BEGIN
+
+/**
+ * \brief The parallel for job.
+ */
+template <typename Func>
+class __LLBC_ParallelForJob : public LLBC_NS LLBC_ParallelJob
+{
+public:
+    __LLBC_ParallelForJob(int begin, int end, int grainSize, Func &func)
+    : LLBC_NS LLBC_ParallelJob((end - begin + grainSize - 1) / grainSize)
+    , _begin(begin)
+    , _end(end)
+    , _grainSize(grainSize)
+    , _func(func)
+    {
+    }
+
+protected:
+    virtual void RunChunk(int chunk)
+    {
+        const int chunkBegin = _begin + chunk * _grainSize;
+        const int chunkEnd = MIN(chunkBegin + _grainSize, _end);
+        for (int idx = chunkBegin; idx < chunkEnd; ++idx)
+            _func(idx);
+    }
+
+private:
+    const int _begin;
+    const int _end;
+    const int _grainSize;
+    Func &_func;
+};
+
+/**
+ * \brief The parallel reduce job, every chunk result stored in chunk slot.
+ */
+template <typename T, typename MapFunc, typename ReduceFunc>
+class __LLBC_ParallelReduceJob : public LLBC_NS LLBC_ParallelJob
+{
+public:
+    __LLBC_ParallelReduceJob(int begin, int end, int grainSize, const T &identity, MapFunc &mapFunc, ReduceFunc &reduceFunc)
+    : LLBC_NS LLBC_ParallelJob((end - begin + grainSize - 1) / grainSize)
+    , _begin(begin)
+    , _end(end)
+    , _grainSize(grainSize)
+    , _identity(identity)
+    , _mapFunc(mapFunc)
+    , _reduceFunc(reduceFunc)
+    , _results(GetChunkCount(), identity)
+    {
+    }
+
+public:
+    T Join() const
+    {
+        T result = _identity;
+        for (size_t chunk = 0; chunk < _results.size(); ++chunk)
+            result = _reduceFunc(result, _results[chunk]);
+
+        return result;
+    }
+
+protected:
+    virtual void RunChunk(int chunk)
+    {
+        const int chunkBegin = _begin + chunk * _grainSize;
+        const int chunkEnd = MIN(chunkBegin + _grainSize, _end);
+
+        T result = _identity;
+        for (int idx = chunkBegin; idx < chunkEnd; ++idx)
+            result = _reduceFunc(result, _mapFunc(idx));
+
+        _results[chunk] = result;
+    }
+
+private:
+    const int _begin;
+    const int _end;
+    const int _grainSize;
+
+    const T _identity;
+    MapFunc &_mapFunc;
+    ReduceFunc &_reduceFunc;
+
+    std::vector<T> _results;
+};
+
+/**
+ * \brief The object method adapter, adapt (obj->*method)(idx) to func(idx).
+ */
+template <typename ObjType>
+class __LLBC_ParallelMethodAdapter
+{
+public:
+    __LLBC_ParallelMethodAdapter(ObjType *obj, void (ObjType::*method)(int))
+    : _obj(obj)
+    , _method(method)
+    {
+    }
+
+    void operator ()(int idx)
+    {
+        (_obj->*_method)(idx);
+    }
+
+private:
+    ObjType *_obj;
+    void (ObjType::*_method)(int);
+};
+
+/**
+ * \brief The random access iterator adapter, adapt func(*(first + idx)) to func(idx).
+ */
+template <typename RandomIter, typename Func>
+class __LLBC_ParallelIterAdapter
+{
+public:
+    __LLBC_ParallelIterAdapter(RandomIter first, Func &func)
+    : _first(first)
+    , _func(func)
+    {
+    }
+
+    void operator ()(int idx)
+    {
+        _func(*(_first + idx));
+    }
+
+private:
+    RandomIter _first;
+    Func &_func;
+};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+inline int LLBC_ParallelJob::GetChunkCount() const
+{
+    return _chunkCount;
+}
+
+template <typename Func>
+inline void LLBC_ParallelFor(LLBC_ThreadPool &pool, int begin, int end, Func &func, int grainSize)
+{
+    if (UNLIKELY(begin >= end))
+        return;
+
+    grainSize = LLBC_CalcParallelGrainSize(pool, end - begin, grainSize);
+
+    // Only one chunk, run in caller thread directly, no heap job.
+    if (end - begin <= grainSize)
+    {
+        for (int idx = begin; idx < end; ++idx)
+            func(idx);
+
+        return;
+    }
+
+    LLBC_INL_NS __LLBC_ParallelForJob<Func> *job =
+        new LLBC_INL_NS __LLBC_ParallelForJob<Func>(begin, end, grainSize, func);
+    job->Run(pool);
+    job->Release();
+}
+
+template <typename ObjType>
+inline void LLBC_ParallelFor(LLBC_ThreadPool &pool, int begin, int end, ObjType *obj, void (ObjType::*method)(int), int grainSize)
+{
+    LLBC_INL_NS __LLBC_ParallelMethodAdapter<ObjType> adapter(obj, method);
+    LLBC_ParallelFor(pool, begin, end, adapter, grainSize);
+}
+
+template <typename RandomIter, typename Func>
+inline void LLBC_ParallelForEach(LLBC_ThreadPool &pool, RandomIter first, RandomIter last, Func &func, int grainSize)
+{
+    LLBC_INL_NS __LLBC_ParallelIterAdapter<RandomIter, Func> adapter(first, func);
+    LLBC_ParallelFor(pool, 0, static_cast<int>(last - first), adapter, grainSize);
+}
+
+template <typename T, typename MapFunc, typename ReduceFunc>
+inline T LLBC_ParallelReduce(LLBC_ThreadPool &pool,
+                             int begin,
+                             int end,
+                             const T &identity,
+                             MapFunc &mapFunc,
+                             ReduceFunc &reduceFunc,
+                             int grainSize)
+{
+    if (UNLIKELY(begin >= end))
+        return identity;
+
+    grainSize = LLBC_CalcParallelGrainSize(pool, end - begin, grainSize);
+
+    typedef LLBC_INL_NS __LLBC_ParallelReduceJob<T, MapFunc, ReduceFunc> _ReduceJob;
+    _ReduceJob *job = new _ReduceJob(begin, end, grainSize, identity, mapFunc, reduceFunc);
+    job->Run(pool);
+
+    const T result = job->Join();
+    job->Release();
+
+    return result;
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_THREAD_PARALLEL_FOR_H__
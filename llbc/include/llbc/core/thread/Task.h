@@ -58,6 +58,18 @@ public:
      */
     int GetThreadCount() const;
 
+    /**
+     * Set task threads CPU affinity, must call before Activate(), every task thread bind itself at thread startup.
+     * @param[in] cpuNos - the CPU numbers, if empty, not bind.
+     */
+    void SetCPUAffinity(const std::vector<int> &cpuNos);
+
+    /**
+     * Get task threads CPU affinity.
+     * @return const std::vector<int> & - the CPU numbers, empty if not bind.
+     */
+    const std::vector<int> &GetCPUAffinity() const;
+
 public:
     /**
      * Wait current task.
@@ -130,6 +142,12 @@ public:
      */
     virtual int TimedPop(LLBC_MessageBlock *&block, int interval);
 
+    /**
+     * Get the queued message blocks count.
+     * @return ulong - the queued message blocks count.
+     */
+    ulong GetMessageSize() const;
+
 public:
     /**
      * When task thread start, will call this event handler.
@@ -151,6 +169,7 @@ private:
     int _curThreadNum;
     volatile bool _startCompleted;
     LLBC_ThreadManager *_threadManager;
+    std::vector<int> _cpuAffinity;
 
     LLBC_SpinLock _lock;
 
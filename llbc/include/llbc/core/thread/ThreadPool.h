@@ -0,0 +1,159 @@
+/**
+ * @file    ThreadPool.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief The work-stealing thread pool.
+ *        Every worker owns a task deque, worker pop self deque in LIFO order and steal
+ *        other workers deque in FIFO order when self deque empty.
+ */
+#ifndef __LLBC_CORE_THREAD_THREAD_POOL_H__
+#define __LLBC_CORE_THREAD_THREAD_POOL_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/utils/Util_DelegateImpl.h"
+#include "llbc/core/thread/SimpleLock.h"
+#include "llbc/core/thread/ConditionVariable.h"
+#include "llbc/core/thread/Semaphore.h"
+#include "llbc/core/thread/Executor.h"
+#include "llbc/core/thread/Future.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The work-stealing thread pool class encapsulation.
+ */
+class LLBC_EXPORT LLBC_ThreadPool : public LLBC_IExecutor
+{
+public:
+    LLBC_ThreadPool();
+    virtual ~LLBC_ThreadPool();
+
+public:
+    /**
+     * Start thread pool.
+     * @param[in] threadNum - the worker thread number, 0 means use CPU count.
+     * @param[in] bindCPU   - bind worker N to CPU(N % CPU count) or not, default is false.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Start(int threadNum = 0, bool bindCPU = false);
+
+    /**
+     * Stop thread pool, all queued tasks will be executed before worker threads exit,
+     * once stop begin, the new submitted tasks will be rejected.
+     * Note: Don't call this method in worker thread.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Stop();
+
+    /**
+     * Check thread pool started or not.
+     * @return bool - the started flag.
+     */
+    bool IsStarted() const;
+
+    /**
+     * Get worker thread count.
+     * @return int - the worker thread count.
+     */
+    int GetThreadCount() const;
+
+    /**
+     * Check current thread is this thread pool's worker thread or not.
+     * @return bool - return true if current thread is worker thread.
+     */
+    bool IsInWorkerThread() const;
+
+    /**
+     * Get the pending(queued, not yet executed) tasks count.
+     * @return int - the pending tasks count.
+     */
+    int GetPendingTaskCount() const;
+
+public:
+    /**
+     * Submit task, if submit in worker thread, task will push to current worker deque,
+     * otherwise push to workers deque in round-robin order.
+     * @param[in] task - the task delegate, thread pool take over it.
+     * @return LLBC_Future - the task future, if submit failed(not started or stopping), return invalid future.
+     */
+    LLBC_Future Submit(LLBC_IDelegate0 *task);
+
+    /**
+     * Submit task.
+     * @param[in] obj    - the task object.
+     * @param[in] method - the task method.
+     * @return LLBC_Future - the task future, if submit failed, return invalid future.
+     */
+    template <typename ObjType>
+    LLBC_Future Submit(ObjType *obj, void (ObjType::*method)());
+
+    /**
+     * Execute task(fire and forget), implement LLBC_IExecutor interface.
+     * @param[in] task - the task delegate, thread pool take over it.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Execute(LLBC_IDelegate0 *task);
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_ThreadPool);
+
+private:
+    struct _Task;
+    struct _Worker;
+
+    /**
+     * Push task to worker deque, if thread pool stopping, return -1.
+     */
+    int PushTask(_Task *task);
+
+    /**
+     * Pop task from current worker deque or steal from other workers, return NULL if no task.
+     */
+    _Task *PopTask(_Worker *worker);
+
+    /**
+     * Run one task, return false if no task can run.
+     * Use to help run tasks when waiting future in worker thread.
+     */
+    friend class LLBC_Future;
+    bool RunOneTask();
+
+    /**
+     * Execute task and complete task future.
+     */
+    void RunTask(_Task *task);
+
+    /**
+     * Worker thread entry.
+     */
+    static int WorkerEntry(void *arg);
+    void WorkerLoop(_Worker *worker);
+
+private:
+    volatile bool _started;
+    volatile sint32 _stopping;
+    volatile sint32 _pushingTasks;
+    bool _bindCPU;
+
+    LLBC_Handle _groupHandle;
+    LLBC_TlsHandle _curWorker;
+
+    std::vector<_Worker *> _workers;
+    volatile sint32 _startedWorkers;
+    volatile sint32 _nextWorker;
+
+    volatile sint32 _pendingTasks;
+    volatile sint32 _sleepingWorkers;
+    LLBC_SimpleLock _sleepLock;
+    LLBC_ConditionVariable _sleepCond;
+
+    LLBC_Semaphore _stoppedSem;
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/thread/ThreadPoolImpl.h"
+
+#endif // !__LLBC_CORE_THREAD_THREAD_POOL_H__
@@ -0,0 +1,22 @@
+/**
+ * @file    ThreadPoolImpl.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#ifdef __LLBC_CORE_THREAD_THREAD_POOL_H__
+
+__LLBC_NS_BEGIN
+
+template <typename ObjType>
+inline LLBC_Future LLBC_ThreadPool::Submit(ObjType *obj, void (ObjType::*method)())
+{
+    return Submit(new LLBC_Delegate0<ObjType>(obj, method));
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_THREAD_THREAD_POOL_H__
@@ -17,6 +17,7 @@ __LLBC_NS_BEGIN
 
 class LLBC_BaseTimer;
 struct LLBC_TimerData;
+class LLBC_FrameProfiler;
 
 __LLBC_NS_END
 
@@ -71,6 +72,13 @@ public:
      */
     void Update();
 
+    /**
+     * Timer manager update drive function, use given time as now.
+     * Use to let all timers in one frame share the frame begin time, avoid read clock again.
+     * @param[in] now - the now time, in milli-seconds.
+     */
+    void Update(uint64 now);
+
     /**
      * Check timer scheduler is enabled or not.
      * @return bool - enable flag.
@@ -83,6 +91,12 @@ public:
      */
     void SetEnabled(bool enabled);
 
+    /**
+     * Set frame profiler, if set, all timer callbacks cost will be added to profiler.
+     * @param[in] profiler - the frame profiler, NULL means not profile.
+     */
+    void SetProfiler(LLBC_FrameProfiler *profiler);
+
 public:
     /**
      * Cancel all timers.
@@ -122,6 +136,7 @@ private:
     LLBC_TimerId _maxTimerId;
     bool _enabled;
     bool _destroyed;
+    LLBC_FrameProfiler *_profiler;
 
     _Heap _heap;
     _IdxMap _idxMap;
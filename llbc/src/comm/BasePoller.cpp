@@ -19,7 +19,10 @@
 #include "llbc/comm/SelectPoller.h"
 #include "llbc/comm/IocpPoller.h"
 #include "llbc/comm/EpollPoller.h"
+#include "llbc/comm/PollPoller.h"
+#include "llbc/comm/IoUringPoller.h"
 #include "llbc/comm/PollerMgr.h"
+#include "llbc/comm/PollerStat.h"
 #include "llbc/comm/IService.h"
 
 namespace
@@ -36,7 +39,8 @@ This::_Handler This::_handlers[LLBC_PollerEvent::End] =
     &This::HandleEv_Send,
     &This::HandleEv_Close,
     &This::HandleEv_Monitor,
-    &This::HandleEv_TakeOverSession
+    &This::HandleEv_TakeOverSession,
+    &This::HandleEv_FlushSends
 };
 
 LLBC_BasePoller::LLBC_BasePoller()
@@ -47,6 +51,15 @@ LLBC_BasePoller::LLBC_BasePoller()
 , _brotherCount(0)
 , _svc(NULL)
 , _pollerMgr(NULL)
+, _numaNode(-1)
+, _busyPollIdleUSecs(0)
+, _busyPollActiveTime(0)
+, _sendCork(false)
+, _sendLanePolicy(NULL)
+, _recvLimitPolicy(NULL)
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+, _stat(NULL)
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 
 , _sockets()
 , _sessions()
@@ -80,6 +93,18 @@ This *LLBC_BasePoller::Create(int type)
         break;
 #endif
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    case LLBC_PollerType::PollPoller:
+        poller = LLBC_New(LLBC_PollPoller);
+        break;
+#endif
+
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    case LLBC_PollerType::IoUringPoller:
+        poller = LLBC_New(LLBC_IoUringPoller);
+        break;
+#endif
+
     default:
         break;
     }
@@ -110,6 +135,39 @@ void LLBC_BasePoller::SetPollerMgr(LLBC_PollerMgr *mgr)
     _pollerMgr = mgr;
 }
 
+void LLBC_BasePoller::SetNUMANode(int node)
+{
+    _numaNode = node;
+}
+
+void LLBC_BasePoller::SetBusyPoll(int idleUSecs)
+{
+    _busyPollIdleUSecs = MAX(0, idleUSecs);
+    _busyPollActiveTime = _busyPollIdleUSecs > 0 ? LLBC_GetMonotonicMicroSeconds() : 0;
+}
+
+void LLBC_BasePoller::SetSendCork(bool cork)
+{
+    _sendCork = cork;
+}
+
+void LLBC_BasePoller::SetSendLanePolicy(const LLBC_SendLanePolicy *policy)
+{
+    _sendLanePolicy = policy;
+}
+
+void LLBC_BasePoller::SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy)
+{
+    _recvLimitPolicy = policy;
+}
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+void LLBC_BasePoller::SetStat(LLBC_PollerStat *stat)
+{
+    _stat = stat;
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 int LLBC_BasePoller::Start()
 {
     ASSERT(false && "Please implement LLBC_BasePoller::Start() method!");
@@ -152,6 +210,12 @@ void LLBC_BasePoller::Cleanup()
          it++)
         it->second->GetSocket()->DeleteAllOverlappeds();
 #endif // LLBC_TARGET_PLATFORM_WIN32
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    for (_Sessions::iterator it = _sessions.begin();
+         it != _sessions.end();
+         it++)
+        _stat->RemoveSession(it->first);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
     LLBC_STLHelper::DeleteContainer(_sessions);
     _sockets.clear();
 
@@ -165,10 +229,28 @@ void LLBC_BasePoller::Cleanup()
     _started = false;
 }
 
-void LLBC_BasePoller::HandleQueuedEvents(int waitTime)
+#if LLBC_CFG_COMM_ENABLE_UDP
+int LLBC_BasePoller::SendDatagram(LLBC_Session *session, LLBC_MessageBlock *block)
+{
+    LLBC_Delete(block);
+
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return LLBC_FAILED;
+}
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+bool LLBC_BasePoller::HandleQueuedEvents(int waitTime)
 {
+    // Receive paused sessions check tokens refilled or not, at least once per poller loop.
+    if (!_recvPausedSessions.empty())
+        HandleRecvPausedSessions();
+
+    // Wait first event, then drain all queued events and return, let poller do post-drain works(eg: flush datagrams).
     LLBC_MessageBlock *block;
-    while (TimedPop(block, waitTime) == LLBC_OK)
+    if (TimedPop(block, waitTime) != LLBC_OK)
+        return false;
+
+    do
     {
         LLBC_PollerEvent &ev = 
             *reinterpret_cast< LLBC_PollerEvent *>(block->GetData());
@@ -176,9 +258,61 @@ void LLBC_BasePoller::HandleQueuedEvents(int waitTime)
         (this->*_handlers[ev.type])(ev);
 
         LLBC_Delete(block);
+    } while (TryPop(block) == LLBC_OK);
+
+    return true;
+}
+
+void LLBC_BasePoller::PauseSessionRecv(LLBC_Session *session)
+{
+    _recvPausedSessions.push_back(session->GetId());
+}
+
+void LLBC_BasePoller::ResumeSessionRecv(LLBC_Session *session)
+{
+}
+
+void LLBC_BasePoller::HandleRecvPausedSessions()
+{
+    // Session maybe paused again while resuming(resume will read socket), so swap out first.
+    std::vector<int> pausedSessions;
+    pausedSessions.swap(_recvPausedSessions);
+
+    for (size_t i = 0; i < pausedSessions.size(); ++i)
+    {
+        _Sessions::iterator it = _sessions.find(pausedSessions[i]);
+        if (it == _sessions.end())
+            continue;
+
+        LLBC_Session *session = it->second;
+        if (session->ReleaseDelayedPackets())
+            ResumeSessionRecv(session);
+        else
+            _recvPausedSessions.push_back(pausedSessions[i]);
     }
 }
 
+int LLBC_BasePoller::GetWaitTimeout(int blockingTimeout) const
+{
+    if (_busyPollIdleUSecs <= 0)
+        return blockingTimeout;
+
+    // Idle too long, fallback to blocking wait, next event will switch back to busy polling.
+    return LLBC_GetMonotonicMicroSeconds() - _busyPollActiveTime < _busyPollIdleUSecs ? 0 : blockingTimeout;
+}
+
+void LLBC_BasePoller::MarkBusy()
+{
+    if (_busyPollIdleUSecs > 0)
+        _busyPollActiveTime = LLBC_GetMonotonicMicroSeconds();
+}
+
+void LLBC_BasePoller::BusyPollRelax(int waitTimeout)
+{
+    if (waitTimeout == 0)
+        LLBC_CPURelax();
+}
+
 void LLBC_BasePoller::HandleEv_AddSock(LLBC_PollerEvent &ev)
 {
     AddSession(CreateSession(ev.un.socket, ev.sessionId));
@@ -201,9 +335,27 @@ void LLBC_BasePoller::HandleEv_Send(LLBC_PollerEvent &ev)
 
     LLBC_Session *session = it->second;
     if (UNLIKELY(session->IsListen()))
+    {
         LLBC_Delete(ev.un.packet);
-    else if (UNLIKELY(session->Send(ev.un.packet) != LLBC_OK))
+        return;
+    }
+
+    const bool flushNow = ev.un.packet->IsFlushNow();
+    const bool corkPending = session->GetCorkedSize() > 0;
+    if (UNLIKELY(session->Send(ev.un.packet) != LLBC_OK))
+    {
         session->OnClose();
+        return;
+    }
+
+    // Corked session flush at frame end, unless flush now packet or too many data corked.
+    if (session->GetCorkedSize() == 0)
+        return;
+
+    if (flushNow || session->GetCorkedSize() >= LLBC_CFG_COMM_SEND_CORK_MAX_SIZE)
+        FlushCorkedSession(session);
+    else if (!corkPending)
+        _corkedSessions.push_back(session->GetId());
 }
 
 void LLBC_BasePoller::HandleEv_Close(LLBC_PollerEvent &ev)
@@ -216,6 +368,17 @@ void LLBC_BasePoller::HandleEv_Close(LLBC_PollerEvent &ev)
         new LLBC_SessionCloseInfo(ev.un.closeReason);
     LLBC_XFree(ev.un.closeReason);
 
+    // Flush corked data before close, if flush failed, session already closed.
+    if (it->second->GetCorkedSize() > 0)
+    {
+        FlushCorkedSession(it->second);
+        if ((it = _sessions.find(ev.sessionId)) == _sessions.end())
+        {
+            LLBC_Delete(closeInfo);
+            return;
+        }
+    }
+
     LLBC_Session *session = it->second;
 #if LLBC_TARGET_PLATFORM_NON_WIN32
     session->OnClose(closeInfo);
@@ -229,6 +392,26 @@ void LLBC_BasePoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
     ASSERT(false && "Please implement LLBC_BasePoller::HandleEv_Monitor() method!");
 }
 
+void LLBC_BasePoller::HandleEv_FlushSends(LLBC_PollerEvent &ev)
+{
+    for (size_t i = 0; i < _corkedSessions.size(); ++i)
+    {
+        _Sessions::iterator it = _sessions.find(_corkedSessions[i]);
+        if (it != _sessions.end() && it->second->GetCorkedSize() > 0)
+            FlushCorkedSession(it->second);
+    }
+
+    _corkedSessions.clear();
+}
+
+void LLBC_BasePoller::FlushCorkedSession(LLBC_Session *session)
+{
+    session->ResetCorkedSize();
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    session->OnSend();
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
 void LLBC_BasePoller::HandleEv_TakeOverSession(LLBC_PollerEvent &ev)
 {
     AddSession(ev.un.session);
@@ -245,12 +428,29 @@ LLBC_Session *LLBC_BasePoller::CreateSession(LLBC_Socket *socket, int sessionId)
     session->SetId(sessionId);
     session->SetSocket(socket);
     session->SetService(_svc);
+    if (_sendCork && !socket->IsListen())
+        session->SetSendCorked(true);
+    if (_sendLanePolicy && !socket->IsListen())
+        socket->SetSendLanePolicy(_sendLanePolicy);
+    if (_recvLimitPolicy && !socket->IsListen())
+        session->SetRecvLimitPolicy(_recvLimitPolicy);
 
     socket->SetSession(session);
 
     return session;
 }
 
+int LLBC_BasePoller::AllocSelfSessionId()
+{
+    int sessionId;
+    do
+    {
+        sessionId = _pollerMgr->AllocSessionId();
+    } while (sessionId % _brotherCount != _id);
+
+    return sessionId;
+}
+
 void LLBC_BasePoller::AddToPoller(LLBC_Session *session)
 {
     const int hash = session->GetId() % _brotherCount;
@@ -280,8 +480,14 @@ void LLBC_BasePoller::AddSession(LLBC_Session *session, bool needAddToIocp)
 {
     // Insert to socket & session map.
     session->SetPoller(this);
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    session->SetStat(_stat, _stat->AddSession(session->GetId()));
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
     _sessions.insert(std::make_pair(session->GetId(), session));
-    _sockets.insert(std::make_pair(session->GetSocketHandle(), session));
+#if LLBC_CFG_COMM_ENABLE_UDP
+    if (!session->GetSocket()->IsDatagramPeer()) // Datagram peer share listen socket handle.
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+        _sockets.insert(std::make_pair(session->GetSocketHandle(), session));
 
     // Build event and push to service.
     LLBC_Socket *sock = session->GetSocket();
@@ -298,7 +504,13 @@ void LLBC_BasePoller::AddSession(LLBC_Session *session, bool needAddToIocp)
 void LLBC_BasePoller::RemoveSession(LLBC_Session *session)
 {
     _sessions.erase(session->GetId());
-    _sockets.erase(session->GetSocketHandle());
+#if LLBC_CFG_COMM_ENABLE_UDP
+    if (!session->GetSocket()->IsDatagramPeer())
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+        _sockets.erase(session->GetSocketHandle());
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    _stat->RemoveSession(session->GetId());
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 
     LLBC_Delete(session);
 }
@@ -312,6 +524,16 @@ void LLBC_BasePoller::SetConnectedSocketDftOpts(LLBC_Socket *sock)
         sock->SetSendBufSize(LLBC_CFG_COMM_DFT_SEND_BUF_SIZE);
     if (LLBC_CFG_COMM_DFT_RECV_BUF_SIZE > 0)
         sock->SetRecvBufSize(LLBC_CFG_COMM_DFT_RECV_BUF_SIZE);
+
+#if LLBC_TARGET_PLATFORM_LINUX && defined(SO_BUSY_POLL)
+    // Busy poll mode, let kernel busy poll device queue when socket no data(ignore failure,
+    // value greater than net.core.busy_read need CAP_NET_ADMIN).
+    if (_busyPollIdleUSecs > 0 && LLBC_CFG_COMM_BUSY_POLL_SOCKET_USECS > 0)
+    {
+        const int busyPollUSecs = LLBC_CFG_COMM_BUSY_POLL_SOCKET_USECS;
+        sock->SetOption(SOL_SOCKET, SO_BUSY_POLL, &busyPollUSecs, sizeof(busyPollUSecs));
+    }
+#endif // LLBC_TARGET_PLATFORM_LINUX && defined(SO_BUSY_POLL)
 }
 
 __LLBC_NS_END
@@ -25,11 +25,28 @@ namespace
     typedef LLBC_NS LLBC_BasePoller Base;
 }
 
+__LLBC_INTERNAL_NS_BEGIN
+
+// The fd slot tag connecting flag.
+static const LLBC_NS uint32 __connectingFlag = 0x01;
+
+__LLBC_INTERNAL_NS_END
+
 __LLBC_NS_BEGIN
 
 LLBC_EpollPoller::LLBC_EpollPoller()
 : _epoll(LLBC_INVALID_HANDLE)
 , _monitor(NULL)
+
+, _fdSlots()
+, _fdGeneration(0)
+#if LLBC_CFG_COMM_ENABLE_UDP
+, _dgramListens()
+, _dgramLastCheckTime(0)
+
+, _dgramSendCount(0)
+, _dgramRecvBuf(NULL)
+#endif // LLBC_CFG_COMM_ENABLE_UDP
 {
 }
 
@@ -78,7 +95,16 @@ void LLBC_EpollPoller::Svc()
 
     while (!_stopping)
     {
-        HandleQueuedEvents(20);
+        const int waitTimeout = GetWaitTimeout(20);
+        if (HandleQueuedEvents(waitTimeout))
+            MarkBusy();
+        else
+            BusyPollRelax(waitTimeout);
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+        FlushDatagrams();
+        CheckDatagramPeersTimeout();
+#endif // LLBC_CFG_COMM_ENABLE_UDP
     }
 }
 
@@ -89,6 +115,21 @@ void LLBC_EpollPoller::Cleanup()
     LLBC_EpollClose(_epoll);
     _epoll = LLBC_INVALID_HANDLE;
 
+    _fdSlots.clear();
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    for (int i = 0; i < _dgramSendCount; ++i)
+        LLBC_Delete(_dgramSends[i].block);
+    _dgramSendCount = 0;
+
+    _dgramListens.clear();
+    if (_dgramRecvBuf)
+    {
+        LLBC_NUMAFree(_dgramRecvBuf, LLBC_CFG_COMM_UDP_BATCH_SIZE * LLBC_CFG_COMM_UDP_MAX_DATAGRAM_SIZE);
+        _dgramRecvBuf = NULL;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
     Base::Cleanup();
 }
 
@@ -121,7 +162,7 @@ void LLBC_EpollPoller::HandleEv_AsyncConn(LLBC_PollerEvent &ev)
         _connecting.insert(std::make_pair(handle, asyncInfo));
 
         LLBC_EpollEvent epev;
-        epev.data.fd = handle;
+        epev.data.u64 = BindFdSlot(handle, NULL, true);
         epev.events = EPOLLOUT | EPOLLET;
         LLBC_EpollCtl(_epoll, EPOLL_CTL_ADD, handle, &epev);
     }
@@ -153,14 +194,28 @@ void LLBC_EpollPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
     for (int i = 0; i < count; i++)
     {
         const LLBC_EpollEvent &ev = evs[i];
-        if (HandleConnecting(ev.data.fd, ev.events))
+        const LLBC_SocketHandle handle = static_cast<LLBC_SocketHandle>(ev.data.u64 & 0xffffffff);
+        const uint32 tag = static_cast<uint32>(ev.data.u64 >> 32);
+
+        // Discard stale event, socket removed or handle reused after epoll_wait.
+        if (UNLIKELY(static_cast<size_t>(handle) >= _fdSlots.size() || _fdSlots[handle].tag != tag))
+            continue;
+
+        if (UNLIKELY(tag & LLBC_INL_NS __connectingFlag))
+        {
+            HandleConnecting(handle, ev.events);
             continue;
+        }
 
-        _Sockets::iterator it = _sockets.find(ev.data.fd);
-        if (UNLIKELY(it == _sockets.end()))
+        LLBC_Session *session = _fdSlots[handle].session;
+#if LLBC_CFG_COMM_ENABLE_UDP
+        if (session->GetSocket()->IsDatagram() && !(ev.events & (EPOLLHUP|EPOLLERR)))
+        {
+            RecvDatagrams(session);
             continue;
+        }
+#endif // LLBC_CFG_COMM_ENABLE_UDP
 
-        LLBC_Session *session = it->second;
         if (ev.events & (EPOLLHUP|EPOLLERR))
         {
             LLBC_Socket *sock = session->GetSocket();
@@ -183,7 +238,7 @@ void LLBC_EpollPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
                     Accept(session);
                     continue;
                 }
-                else
+                else if (!session->IsRecvPaused())
                 {
                     session->OnRecv();
                 }
@@ -192,8 +247,7 @@ void LLBC_EpollPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
             {
                 // Maybe in session removed while calling OnRecv() method.
                 if ((ev.events & EPOLLIN) && 
-                        UNLIKELY(_sockets.find(
-                            ev.data.fd) == _sockets.end()))
+                        UNLIKELY(_fdSlots[handle].tag != tag))
                     continue;
 
                 session->OnSend();
@@ -209,6 +263,12 @@ void LLBC_EpollPoller::HandleEv_TakeOverSession(LLBC_PollerEvent &ev)
     Base::HandleEv_TakeOverSession(ev);
 }
 
+void LLBC_EpollPoller::ResumeSessionRecv(LLBC_Session *session)
+{
+    // Paused session not read socket(EPOLLIN ignored), data remain in kernel buffer.
+    session->OnRecv();
+}
+
 void LLBC_EpollPoller::AddSession(LLBC_Session *session)
 {
     Base::AddSession(session);
@@ -216,22 +276,54 @@ void LLBC_EpollPoller::AddSession(LLBC_Session *session)
     LLBC_Socket *sock = session->GetSocket();
     const LLBC_SocketHandle handle = sock->Handle();
 
+#if LLBC_CFG_COMM_ENABLE_UDP
+    // Datagram peer pseudo-session share listen socket, datagram socket never wait writable.
+    if (sock->IsDatagramPeer())
+        return;
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
     LLBC_EpollEvent epev;
-    epev.data.fd = handle;
+    epev.data.u64 = BindFdSlot(handle, session, false);
     epev.events = EPOLLIN | EPOLLET | EPOLLHUP | EPOLLERR;
+#if LLBC_CFG_COMM_ENABLE_UDP
+
+    if (sock->IsDatagram())
+    {
+        if (sock->IsListen())
+            _dgramListens.insert(std::make_pair(handle, _DgramPeers()));
+    }
+    else if (!sock->IsListen())
+    {
+        epev.events |= EPOLLOUT;
+    }
+#else // !LLBC_CFG_COMM_ENABLE_UDP
     if (!sock->IsListen())
         epev.events |= EPOLLOUT;
+#endif // LLBC_CFG_COMM_ENABLE_UDP
 
     LLBC_EpollCtl(_epoll, EPOLL_CTL_ADD, handle, &epev);
 }
 
 void LLBC_EpollPoller::RemoveSession(LLBC_Session *session)
 {
+#if LLBC_CFG_COMM_ENABLE_UDP
+    if (session->GetSocket()->IsDatagram())
+    {
+        RemoveDatagramSession(session);
+        if (session->GetSocket()->IsDatagramPeer())
+        {
+            Base::RemoveSession(session);
+            return;
+        }
+    }
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
     // For compatible before 2.6.9 version kernel, we pass event point to LLBC_EpollCtl() API,
     // even through this argument is ignored.
     LLBC_EpollEvent epev;
     epev.events = EPOLLIN | EPOLLOUT | EPOLLET | EPOLLHUP | EPOLLERR;
     LLBC_EpollCtl(_epoll, EPOLL_CTL_DEL, session->GetSocketHandle(), &epev);
+    UnbindFdSlot(session->GetSocketHandle());
 
     Base::RemoveSession(session);
 }
@@ -242,6 +334,7 @@ int LLBC_EpollPoller::StartupMonitor()
         LLBC_EpollPoller>(this, &LLBC_EpollPoller::MonitorSvc);
 
     _monitor = new LLBC_PollerMonitor(deleg);
+    _monitor->SetCPUAffinity(GetCPUAffinity()); // Monitor thread run on poller's CPUs.
     if (_monitor->Start() != LLBC_OK)
     {
         LLBC_XDelete(_monitor);
@@ -261,19 +354,22 @@ void LLBC_EpollPoller::MonitorSvc()
     int ret = LLBC_EpollWait(_epoll,
                              _events,
                              LLBC_CFG_COMM_MAX_EVENT_COUNT,
-                             50);
+                             GetWaitTimeout(50));
     if (ret <= 0)
         return;
 
+    MarkBusy();
     Push(LLBC_PollerEvUtil::BuildEpollMonitorEv(_events, ret));
 }
 
-bool LLBC_EpollPoller::HandleConnecting(LLBC_SocketHandle handle, int events)
+void LLBC_EpollPoller::HandleConnecting(LLBC_SocketHandle handle, int events)
 {
     _Connecting::iterator it = _connecting.find(handle);
-    if (it == _connecting.end())
-        return false;
-    
+    if (UNLIKELY(it == _connecting.end()))
+        return;
+
+    UnbindFdSlot(handle);
+
     LLBC_AsyncConnInfo &asyncInfo = it->second;
     LLBC_Socket *sock = asyncInfo.socket;
 
@@ -306,7 +402,39 @@ bool LLBC_EpollPoller::HandleConnecting(LLBC_SocketHandle handle, int events)
     }
 
     _connecting.erase(it);
-    return true;
+}
+
+uint64 LLBC_EpollPoller::BindFdSlot(LLBC_SocketHandle handle, LLBC_Session *session, bool connecting)
+{
+    const size_t index = static_cast<size_t>(handle);
+    if (index >= _fdSlots.size())
+    {
+        _FdSlot emptySlot;
+        emptySlot.tag = 0;
+        emptySlot.session = NULL;
+        _fdSlots.resize(MAX(index + 1, _fdSlots.size() * 2), emptySlot);
+    }
+
+    // Generation never be zero, zero tag means slot not in use.
+    if (UNLIKELY(++_fdGeneration > 0x7fffffff))
+        _fdGeneration = 1;
+
+    _FdSlot &slot = _fdSlots[index];
+    slot.tag = (_fdGeneration << 1) | (connecting ? LLBC_INL_NS __connectingFlag : 0);
+    slot.session = session;
+
+    return (static_cast<uint64>(slot.tag) << 32) | static_cast<uint32>(handle);
+}
+
+void LLBC_EpollPoller::UnbindFdSlot(LLBC_SocketHandle handle)
+{
+    const size_t index = static_cast<size_t>(handle);
+    if (index >= _fdSlots.size())
+        return;
+
+    _FdSlot &slot = _fdSlots[index];
+    slot.tag = 0;
+    slot.session = NULL;
 }
 
 void LLBC_EpollPoller::Accept(LLBC_Session *session)
@@ -325,6 +453,284 @@ void LLBC_EpollPoller::Accept(LLBC_Session *session)
     }
 }
 
+#if LLBC_CFG_COMM_ENABLE_UDP
+int LLBC_EpollPoller::SendDatagram(LLBC_Session *session, LLBC_MessageBlock *block)
+{
+    if (UNLIKELY(block->GetReadableSize() > LLBC_CFG_COMM_UDP_MAX_DATAGRAM_SIZE))
+    {
+        trace("LLBC_EpollPoller::SendDatagram() datagram too large, size: %d, discard it\n",
+              static_cast<int>(block->GetReadableSize()));
+        LLBC_Delete(block);
+
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_FAILED;
+    }
+
+    if (_dgramSendCount == LLBC_CFG_COMM_UDP_BATCH_SIZE)
+        FlushDatagrams();
+
+    LLBC_Socket *sock = session->GetSocket();
+    _DgramSend &dgram = _dgramSends[_dgramSendCount++];
+    dgram.handle = session->GetSocketHandle();
+    dgram.hasPeer = sock->IsDatagramPeer();
+    if (dgram.hasPeer)
+        dgram.peer = sock->GetPeerAddress().ToOSDataType();
+    dgram.block = block;
+
+    return LLBC_OK;
+}
+
+void LLBC_EpollPoller::RecvDatagrams(LLBC_Session *session)
+{
+    if (UNLIKELY(!_dgramRecvBuf))
+        _dgramRecvBuf = reinterpret_cast<char *>(
+            LLBC_NUMAAlloc(LLBC_CFG_COMM_UDP_BATCH_SIZE * LLBC_CFG_COMM_UDP_MAX_DATAGRAM_SIZE, _numaNode));
+
+    const LLBC_SocketHandle handle = session->GetSocketHandle();
+    const uint32 tag = _fdSlots[handle].tag;
+    const bool listen = session->IsListen();
+    for (; ;)
+    {
+        // Reset message headers, kernel will overwrite name length and flags.
+        for (int i = 0; i < LLBC_CFG_COMM_UDP_BATCH_SIZE; ++i)
+        {
+            struct iovec &iov = _dgramRecvIovs[i];
+            iov.iov_base = _dgramRecvBuf + i * LLBC_CFG_COMM_UDP_MAX_DATAGRAM_SIZE;
+            iov.iov_len = LLBC_CFG_COMM_UDP_MAX_DATAGRAM_SIZE;
+
+            struct msghdr &hdr = _dgramRecvMsgs[i].msg_hdr;
+            LLBC_MemSet(&hdr, 0, sizeof(struct msghdr));
+            hdr.msg_iov = &iov;
+            hdr.msg_iovlen = 1;
+            if (listen)
+            {
+                hdr.msg_name = &_dgramRecvAddrs[i];
+                hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+        }
+
+        const int recved = LLBC_RecvMultiMsgs(handle, _dgramRecvMsgs, LLBC_CFG_COMM_UDP_BATCH_SIZE);
+        session->OnSysCalls(0, 1);
+        if (recved < 0)
+        {
+            // Connected datagram socket error(eg: peer port unreachable), close it.
+            const int errNo = LLBC_GetLastError();
+            if (!listen && errNo != LLBC_ERROR_WBLOCK && errNo != LLBC_ERROR_AGAIN)
+                session->OnClose();
+
+            return;
+        }
+
+        for (int i = 0; i < recved; ++i)
+        {
+            const struct mmsghdr &msg = _dgramRecvMsgs[i];
+            if (msg.msg_len == 0)
+                continue;
+            else if (UNLIKELY(msg.msg_hdr.msg_flags & MSG_TRUNC))
+            {
+                trace("LLBC_EpollPoller::RecvDatagrams() datagram truncated, discard it\n");
+                continue;
+            }
+
+            LLBC_Session *recvSession = listen ? AcceptDatagramPeer(session, _dgramRecvAddrs[i]) : session;
+            if (UNLIKELY(!recvSession))
+                continue;
+
+            LLBC_MessageBlock *block = LLBC_New1(LLBC_MessageBlock, msg.msg_len);
+            block->Write(_dgramRecvIovs[i].iov_base, msg.msg_len);
+            if (!recvSession->OnDatagramRecved(block) &&
+                !listen &&
+                _fdSlots[handle].tag != tag)
+                return;
+        }
+
+        if (recved < LLBC_CFG_COMM_UDP_BATCH_SIZE)
+            return;
+    }
+}
+
+LLBC_Session *LLBC_EpollPoller::AcceptDatagramPeer(LLBC_Session *listenSession, const sockaddr_in &addr)
+{
+    _DgramListens::iterator listenIt = _dgramListens.find(listenSession->GetSocketHandle());
+    if (UNLIKELY(listenIt == _dgramListens.end()))
+        return NULL;
+
+    _DgramPeers &peers = listenIt->second;
+    const uint64 peerKey = (static_cast<uint64>(addr.sin_addr.s_addr) << 16) | addr.sin_port;
+    _DgramPeers::iterator peerIt = peers.find(peerKey);
+    if (peerIt != peers.end())
+    {
+        peerIt->second.lastActiveTime = LLBC_GetCoarseMonotonicMilliSeconds();
+        return peerIt->second.session;
+    }
+
+    // Limit the peer pseudo-sessions count, avoid spoofed source addresses exhaust memory/session ids.
+    if (LLBC_CFG_COMM_UDP_MAX_PEERS_PER_LISTENER > 0 &&
+        peers.size() >= static_cast<size_t>(LLBC_CFG_COMM_UDP_MAX_PEERS_PER_LISTENER))
+    {
+        trace("LLBC_EpollPoller::AcceptDatagramPeer() peers count limit reached, discard new peer datagram\n");
+        return NULL;
+    }
+
+    LLBC_SockAddr_IN peerAddr;
+    peerAddr.FromOSDataType(&addr);
+    LLBC_Socket *peerSock = listenSession->GetSocket()->CreateDatagramPeer(peerAddr);
+    if (UNLIKELY(!peerSock))
+        return NULL;
+
+    // Peer pseudo-session must hash to self poller, all datagrams received and sent in listen socket's poller.
+    LLBC_Session *session = CreateSession(peerSock, AllocSelfSessionId());
+
+    _DgramPeer &peer = peers[peerKey];
+    peer.session = session;
+    peer.lastActiveTime = LLBC_GetCoarseMonotonicMilliSeconds();
+
+    AddSession(session);
+
+    return session;
+}
+
+void LLBC_EpollPoller::FlushDatagrams()
+{
+    // Batch send contiguous same socket's datagrams.
+    int begin = 0;
+    while (begin < _dgramSendCount)
+    {
+        const LLBC_SocketHandle handle = _dgramSends[begin].handle;
+
+        int end = begin;
+        for (; end < _dgramSendCount && _dgramSends[end].handle == handle; ++end)
+        {
+            _DgramSend &dgram = _dgramSends[end];
+
+            struct iovec &iov = _dgramSendIovs[end];
+            iov.iov_base = dgram.block->GetDataStartWithReadPos();
+            iov.iov_len = dgram.block->GetReadableSize();
+
+            struct msghdr &hdr = _dgramSendMsgs[end].msg_hdr;
+            LLBC_MemSet(&hdr, 0, sizeof(struct msghdr));
+            hdr.msg_iov = &iov;
+            hdr.msg_iovlen = 1;
+            if (dgram.hasPeer)
+            {
+                hdr.msg_name = &dgram.peer;
+                hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+        }
+
+        // Datagram is unreliable, when socket send buffer full, discard remain datagrams.
+        int sendCalls = 0;
+        for (int sent = begin; sent < end; )
+        {
+            const int ret = LLBC_SendMultiMsgs(handle, _dgramSendMsgs + sent, end - sent);
+            ++sendCalls;
+            if (ret > 0)
+            {
+                sent += ret;
+                continue;
+            }
+
+            const int errNo = LLBC_GetLastError();
+            if (errNo == LLBC_ERROR_WBLOCK || errNo == LLBC_ERROR_AGAIN)
+                break;
+
+            ++sent; // Skip the error datagram.
+        }
+
+        LLBC_Session *session = 
+            static_cast<size_t>(handle) < _fdSlots.size() ? _fdSlots[handle].session : NULL;
+        if (session)
+            session->OnSysCalls(sendCalls, 0);
+
+        begin = end;
+    }
+
+    for (int i = 0; i < _dgramSendCount; ++i)
+        LLBC_Delete(_dgramSends[i].block);
+    _dgramSendCount = 0;
+}
+
+void LLBC_EpollPoller::DiscardDatagrams(LLBC_SocketHandle handle)
+{
+    int remain = 0;
+    for (int i = 0; i < _dgramSendCount; ++i)
+    {
+        if (_dgramSends[i].handle == handle)
+            LLBC_Delete(_dgramSends[i].block);
+        else
+            _dgramSends[remain++] = _dgramSends[i];
+    }
+
+    _dgramSendCount = remain;
+}
+
+void LLBC_EpollPoller::RemoveDatagramSession(LLBC_Session *session)
+{
+    LLBC_Socket *sock = session->GetSocket();
+    const LLBC_SocketHandle handle = session->GetSocketHandle();
+    if (sock->IsDatagramPeer())
+    {
+        _DgramListens::iterator listenIt = _dgramListens.find(handle);
+        if (listenIt == _dgramListens.end())
+            return;
+
+        const LLBC_SockAddr_IN &peerAddr = sock->GetPeerAddress();
+        const uint64 peerKey = 
+            (static_cast<uint64>(static_cast<uint32>(peerAddr.GetIpAsNumberN())) << 16) | peerAddr.GetPortN();
+        listenIt->second.erase(peerKey);
+
+        return;
+    }
+
+    DiscardDatagrams(handle);
+
+    _DgramListens::iterator listenIt = _dgramListens.find(handle);
+    if (listenIt == _dgramListens.end())
+        return;
+
+    // Take over peers first, peer pseudo-session close will remove self from peers.
+    _DgramPeers peers;
+    peers.swap(listenIt->second);
+    _dgramListens.erase(listenIt);
+
+    for (_DgramPeers::iterator it = peers.begin();
+         it != peers.end();
+         ++it)
+        it->second.session->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_NOT_OPEN, 0));
+}
+
+void LLBC_EpollPoller::CheckDatagramPeersTimeout()
+{
+    if (LLBC_CFG_COMM_UDP_SESSION_IDLE_TIMEOUT <= 0 || _dgramListens.empty())
+        return;
+
+    const sint64 now = LLBC_GetCoarseMonotonicMilliSeconds();
+    if (now - _dgramLastCheckTime < 1000)
+        return;
+
+    _dgramLastCheckTime = now;
+    const sint64 expireTime = now - LLBC_CFG_COMM_UDP_SESSION_IDLE_TIMEOUT * 1000;
+
+    std::vector<LLBC_Session *> timeouts;
+    for (_DgramListens::iterator listenIt = _dgramListens.begin();
+         listenIt != _dgramListens.end();
+         ++listenIt)
+    {
+        _DgramPeers &peers = listenIt->second;
+        for (_DgramPeers::iterator peerIt = peers.begin();
+             peerIt != peers.end();
+             ++peerIt)
+        {
+            if (peerIt->second.lastActiveTime < expireTime)
+                timeouts.push_back(peerIt->second.session);
+        }
+    }
+
+    for (size_t i = 0; i < timeouts.size(); ++i)
+        timeouts[i]->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_TIMEOUT, 0));
+}
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
 __LLBC_NS_END
 
 #endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
@@ -0,0 +1,852 @@
+/**
+ * @file    IoUringPoller.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/log/LoggerManager.h"
+
+#include "llbc/comm/Packet.h"
+#include "llbc/comm/Socket.h"
+#include "llbc/comm/Session.h"
+#include "llbc/comm/ServiceEvent.h"
+#include "llbc/comm/PollerType.h"
+#include "llbc/comm/IoUringPoller.h"
+#include "llbc/comm/IService.h"
+
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+
+namespace
+{
+    typedef LLBC_NS LLBC_BasePoller Base;
+}
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The wait completions timeout, in milliseconds, queued events will wakeup poller immediately.
+static const int __waitTimeout = 20;
+
+// The provided recv buffers group id.
+static const LLBC_NS uint16 __recvBufGroup = 0;
+
+// The request kinds, request user data layout: [kind:4][generation:28][socket handle:32].
+enum __RequestKind
+{
+    __Wakeup = 1,
+    __Accept,
+    __Recv,
+    __Send,
+    __Connect,
+    __Cancel
+};
+
+static const LLBC_NS uint32 __genMask = 0x0fffffff;
+
+static inline LLBC_NS uint64 __BuildUserData(int kind, LLBC_NS uint32 gen, LLBC_NS LLBC_SocketHandle handle)
+{
+    return (static_cast<LLBC_NS uint64>(kind) << 60) |
+           (static_cast<LLBC_NS uint64>(gen & __genMask) << 32) |
+           static_cast<LLBC_NS uint32>(handle);
+}
+
+static inline int __GetKind(LLBC_NS uint64 userData)
+{
+    return static_cast<int>(userData >> 60);
+}
+
+static inline LLBC_NS uint32 __GetGen(LLBC_NS uint64 userData)
+{
+    return static_cast<LLBC_NS uint32>(userData >> 32) & __genMask;
+}
+
+static inline LLBC_NS LLBC_SocketHandle __GetHandle(LLBC_NS uint64 userData)
+{
+    return static_cast<LLBC_NS LLBC_SocketHandle>(userData & 0xffffffff);
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_IoUringPoller::LLBC_IoUringPoller()
+: _wakeupSignaled(0)
+
+, _bufRing(NULL)
+, _recvBufs(NULL)
+, _bufRingTail(0)
+
+, _fdSlots()
+, _fdGeneration(0)
+, _sqFullTimes(0)
+
+, _pendingSends()
+, _pendingCancels()
+, _orphanSends()
+{
+    LLBC_MemSet(&_ring, 0, sizeof(LLBC_IoUring));
+    _ring.fd = LLBC_INVALID_HANDLE;
+
+    _wakeupPipe[0] = _wakeupPipe[1] = LLBC_INVALID_HANDLE;
+}
+
+LLBC_IoUringPoller::~LLBC_IoUringPoller()
+{
+    Stop();
+}
+
+int LLBC_IoUringPoller::Start()
+{
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_FAILED;
+    }
+
+    if (LLBC_IoUringQueueInit(LLBC_CFG_COMM_IO_URING_ENTRIES,
+                              LLBC_CFG_COMM_IO_URING_ENTRIES * 4,
+                              _ring) != LLBC_OK)
+        return LLBC_FAILED;
+
+    if (CreateBufRing() != LLBC_OK)
+    {
+        LLBC_IoUringQueueExit(_ring);
+        return LLBC_FAILED;
+    }
+
+    if (LLBC_CreatePollWakeupPipe(_wakeupPipe) != LLBC_OK)
+    {
+        DestroyBufRing();
+        LLBC_IoUringQueueExit(_ring);
+
+        return LLBC_FAILED;
+    }
+
+    _wakeupSignaled = 0;
+    ArmWakeup();
+
+    if (Activate(1) != LLBC_OK)
+    {
+        LLBC_IoUringQueueExit(_ring);
+        DestroyBufRing();
+        LLBC_ClosePollWakeupPipe(_wakeupPipe);
+
+        return LLBC_FAILED;
+    }
+
+    _started = true;
+    return LLBC_OK;
+}
+
+void LLBC_IoUringPoller::Svc()
+{
+    while (!_started)
+        LLBC_Sleep(20);
+
+    while (!_stopping)
+    {
+        if (HandleQueuedEvents(0))
+            MarkBusy();
+        FlushCancels();
+        FlushSends();
+
+        // Busy polling only submit and peek completions, not wait.
+        const int waitTimeout = GetWaitTimeout(LLBC_INL_NS __waitTimeout);
+        LLBC_IoUringSubmit(_ring, waitTimeout != 0 ? 1 : 0, waitTimeout);
+        if (HandleCompletions())
+            MarkBusy();
+        else
+            BusyPollRelax(waitTimeout);
+    }
+}
+
+void LLBC_IoUringPoller::Cleanup()
+{
+    // Close ring first, all in-flight requests will be canceled, then free the request buffers.
+    LLBC_IoUringQueueExit(_ring);
+    DestroyBufRing();
+    LLBC_ClosePollWakeupPipe(_wakeupPipe);
+
+    for (size_t i = 0; i < _fdSlots.size(); ++i)
+        LLBC_XDelete(_fdSlots[i].sending);
+    _fdSlots.clear();
+    _pendingSends.clear();
+    _pendingCancels.clear();
+    LLBC_STLHelper::DeleteContainer(_orphanSends);
+
+    Base::Cleanup();
+}
+
+int LLBC_IoUringPoller::Push(LLBC_MessageBlock *block)
+{
+    if (Base::Push(block) != LLBC_OK)
+        return LLBC_FAILED;
+
+    // Coalesce wakeup signals, only the first push after poller drained the wakeup pipe need signal.
+    if (LLBC_AtomicCompareAndExchange(&_wakeupSignaled, 1, 0) == 0 &&
+            _wakeupPipe[1] != LLBC_INVALID_HANDLE)
+        LLBC_WakeupPoll(_wakeupPipe[1]);
+
+    return LLBC_OK;
+}
+
+void LLBC_IoUringPoller::HandleEv_AddSock(LLBC_PollerEvent &ev)
+{
+    Base::HandleEv_AddSock(ev);
+}
+
+void LLBC_IoUringPoller::HandleEv_AsyncConn(LLBC_PollerEvent &ev)
+{
+    LLBC_Socket *sock = LLBC_New(LLBC_Socket);
+    const LLBC_SocketHandle handle = sock->Handle();
+
+    sock->SetNonBlocking();
+    sock->SetPollerType(LLBC_PollerType::IoUringPoller);
+    if (sock->Connect(ev.peerAddr) == LLBC_OK)
+    {
+        _svc->Push(LLBC_SvcEvUtil::
+                BuildAsyncConnResultEv(true, "Success", ev.peerAddr));
+
+        SetConnectedSocketDftOpts(sock);
+        AddSession(CreateSession(sock, ev.sessionId));
+    }
+    else if (LLBC_GetLastError() == LLBC_ERROR_WBLOCK)
+    {
+        LLBC_AsyncConnInfo asyncInfo;
+        asyncInfo.socket = sock;
+        asyncInfo.peerAddr = ev.peerAddr;
+        asyncInfo.sessionId = ev.sessionId;
+        _connecting.insert(std::make_pair(handle, asyncInfo));
+
+        BindFdSlot(handle, NULL);
+
+        LLBC_IoUringSqe *sqe = GetSqe();
+        if (UNLIKELY(!sqe))
+        {
+            HandleConnecting(handle, -EAGAIN);
+            return;
+        }
+
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = handle;
+        sqe->poll32_events = POLLOUT;
+        sqe->user_data = LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Connect, _fdSlots[handle].gen, handle);
+    }
+    else
+    {
+        const LLBC_String &reason = LLBC_FormatLastError();
+        _svc->Push(LLBC_SvcEvUtil::BuildAsyncConnResultEv(false, reason, ev.peerAddr));
+
+        LLBC_Delete(sock);
+    }
+}
+
+void LLBC_IoUringPoller::HandleEv_Send(LLBC_PollerEvent &ev)
+{
+    const int sessionId = ev.un.packet->GetSessionId();
+    Base::HandleEv_Send(ev);
+
+    // Session send only append data to socket, send requests batch submit after queued events drained,
+    // corked session queue send when flush.
+    _Sessions::iterator it = _sessions.find(sessionId);
+    if (it != _sessions.end() && it->second->GetCorkedSize() == 0)
+        QueueSend(it->second->GetSocketHandle());
+}
+
+void LLBC_IoUringPoller::HandleEv_Close(LLBC_PollerEvent &ev)
+{
+    Base::HandleEv_Close(ev);
+}
+
+void LLBC_IoUringPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
+{
+    ASSERT(false && "IoUring Poller could not process Monitor Event");
+}
+
+void LLBC_IoUringPoller::HandleEv_TakeOverSession(LLBC_PollerEvent &ev)
+{
+    Base::HandleEv_TakeOverSession(ev);
+}
+
+void LLBC_IoUringPoller::FlushCorkedSession(LLBC_Session *session)
+{
+    session->ResetCorkedSize();
+    QueueSend(session->GetSocketHandle());
+}
+
+void LLBC_IoUringPoller::PauseSessionRecv(LLBC_Session *session)
+{
+    Base::PauseSessionRecv(session);
+
+    // Already completed recvs still deliver, session delay them too.
+    const LLBC_SocketHandle handle = session->GetSocketHandle();
+    _FdSlot &slot = _fdSlots[handle];
+    if (slot.recvArmed)
+        CancelRequest(LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Recv, slot.gen, handle));
+}
+
+void LLBC_IoUringPoller::ResumeSessionRecv(LLBC_Session *session)
+{
+    // If cancel not completed yet, will rearm in cancel completion.
+    const LLBC_SocketHandle handle = session->GetSocketHandle();
+    if (!_fdSlots[handle].recvArmed)
+        ArmRecv(handle);
+}
+
+void LLBC_IoUringPoller::AddSession(LLBC_Session *session)
+{
+    Base::AddSession(session);
+
+    LLBC_Socket *sock = session->GetSocket();
+    const LLBC_SocketHandle handle = session->GetSocketHandle();
+    BindFdSlot(handle, session);
+
+    if (sock->IsListen())
+    {
+        ArmAccept(handle);
+    }
+    else
+    {
+        ArmRecv(handle);
+        if (sock->IsExistNoSendData())
+            QueueSend(handle);
+    }
+}
+
+void LLBC_IoUringPoller::RemoveSession(LLBC_Session *session)
+{
+    // Cancel in-flight requests, the submitted send block keep alive until send request completed.
+    const LLBC_SocketHandle handle = session->GetSocketHandle();
+    if (static_cast<size_t>(handle) < _fdSlots.size() && _fdSlots[handle].session == session)
+    {
+        _FdSlot &slot = _fdSlots[handle];
+        if (slot.recvArmed)
+            CancelRequest(LLBC_INL_NS __BuildUserData(
+                session->IsListen() ? LLBC_INL_NS __Accept : LLBC_INL_NS __Recv, slot.gen, handle));
+
+        if (slot.sending && slot.sendSubmitted)
+        {
+            const uint64 userData = LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Send, slot.gen, handle);
+            _orphanSends.insert(std::make_pair(userData, slot.sending));
+            slot.sending = NULL;
+
+            CancelRequest(userData);
+        }
+        else if (slot.sending)
+        {
+            // Send request not submitted(submission queue full), no completion will arrive.
+            LLBC_Delete(slot.sending);
+            slot.sending = NULL;
+        }
+
+        UnbindFdSlot(handle);
+    }
+
+    Base::RemoveSession(session);
+}
+
+int LLBC_IoUringPoller::CreateBufRing()
+{
+    // Buffer ring and recv buffers allocate on poller's NUMA node, mapped memory already page aligned and zeroed.
+    const uint32 count = LLBC_CFG_COMM_IO_URING_RECV_BUF_COUNT;
+    _bufRing = reinterpret_cast<struct io_uring_buf_ring *>(
+        LLBC_NUMAAlloc(count * sizeof(struct io_uring_buf), _numaNode));
+    if (!_bufRing)
+        return LLBC_FAILED;
+
+    if (LLBC_IoUringRegisterBufRing(_ring, _bufRing, count, LLBC_INL_NS __recvBufGroup) != LLBC_OK)
+    {
+        LLBC_NUMAFree(_bufRing, count * sizeof(struct io_uring_buf));
+        _bufRing = NULL;
+
+        return LLBC_FAILED;
+    }
+
+    _recvBufs = reinterpret_cast<char *>(
+        LLBC_NUMAAlloc(count * LLBC_CFG_COMM_IO_URING_RECV_BUF_SIZE, _numaNode));
+    if (!_recvBufs)
+    {
+        DestroyBufRing();
+        return LLBC_FAILED;
+    }
+
+    _bufRingTail = 0;
+    for (uint32 i = 0; i < count; ++i)
+        RecycleBuf(static_cast<uint16>(i));
+
+    return LLBC_OK;
+}
+
+void LLBC_IoUringPoller::DestroyBufRing()
+{
+    // Buffer ring auto unregistered when ring exit, if ring still alive, unregister it.
+    if (_ring.fd != LLBC_INVALID_HANDLE && _bufRing)
+        LLBC_IoUringUnregisterBufRing(_ring, LLBC_INL_NS __recvBufGroup);
+
+    if (_bufRing)
+    {
+        LLBC_NUMAFree(_bufRing, LLBC_CFG_COMM_IO_URING_RECV_BUF_COUNT * sizeof(struct io_uring_buf));
+        _bufRing = NULL;
+    }
+
+    if (_recvBufs)
+    {
+        LLBC_NUMAFree(_recvBufs, LLBC_CFG_COMM_IO_URING_RECV_BUF_COUNT * LLBC_CFG_COMM_IO_URING_RECV_BUF_SIZE);
+        _recvBufs = NULL;
+    }
+}
+
+void LLBC_IoUringPoller::RecycleBuf(uint16 bufId)
+{
+    const uint32 mask = LLBC_CFG_COMM_IO_URING_RECV_BUF_COUNT - 1;
+
+    // Buffer ring entries start at ring head, the tail overlaid with first entry's resv field.
+    // Not use io_uring_buf_ring::bufs member, its flex array declaration shift 8 bytes in C++.
+    struct io_uring_buf &buf = reinterpret_cast<struct io_uring_buf *>(_bufRing)[_bufRingTail & mask];
+    buf.addr = reinterpret_cast<uint64>(_recvBufs + static_cast<size_t>(bufId) * LLBC_CFG_COMM_IO_URING_RECV_BUF_SIZE);
+    buf.len = LLBC_CFG_COMM_IO_URING_RECV_BUF_SIZE;
+    buf.bid = bufId;
+
+    __atomic_store_n(&_bufRing->tail, ++_bufRingTail, __ATOMIC_RELEASE);
+}
+
+LLBC_IoUringSqe *LLBC_IoUringPoller::GetSqe()
+{
+    LLBC_IoUringSqe *sqe = LLBC_IoUringGetSqe(_ring);
+    if (LIKELY(sqe))
+        return sqe;
+
+    // Submission queue full, submit all got entries and retry.
+    LLBC_IoUringSubmit(_ring, 0, 0);
+    if (UNLIKELY(!(sqe = LLBC_IoUringGetSqe(_ring))))
+    {
+        // Still full(kernel not consumed entries), request dropped(or deferred) by caller, report at 1, 2, 4, 8... times.
+        ++_sqFullTimes;
+        if ((_sqFullTimes & (_sqFullTimes - 1)) == 0)
+            LLBC_LIB_WARN_LOG("IoUringPoller[%d] submission queue full, times: %llu", _id, _sqFullTimes);
+    }
+
+    return sqe;
+}
+
+void LLBC_IoUringPoller::ArmWakeup()
+{
+    LLBC_IoUringSqe *sqe = GetSqe();
+    if (UNLIKELY(!sqe))
+        return;
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = _wakeupPipe[0];
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Wakeup, 0, _wakeupPipe[0]);
+}
+
+void LLBC_IoUringPoller::ArmAccept(LLBC_SocketHandle handle)
+{
+    _FdSlot &slot = _fdSlots[handle];
+
+    LLBC_IoUringSqe *sqe = GetSqe();
+    if (UNLIKELY(!sqe))
+    {
+        slot.session->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_LIMIT, 0));
+        return;
+    }
+
+    // Multishot accept, peer address fetch after accepted, so not pass address buffer.
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = handle;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    sqe->user_data = LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Accept, slot.gen, handle);
+
+    slot.recvArmed = true;
+}
+
+void LLBC_IoUringPoller::ArmRecv(LLBC_SocketHandle handle)
+{
+    _FdSlot &slot = _fdSlots[handle];
+
+    LLBC_IoUringSqe *sqe = GetSqe();
+    if (UNLIKELY(!sqe))
+    {
+        slot.session->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_LIMIT, 0));
+        return;
+    }
+
+    // Multishot recv, kernel select buffer from provided buffer ring.
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = handle;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = LLBC_INL_NS __recvBufGroup;
+    sqe->user_data = LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Recv, slot.gen, handle);
+
+    slot.recvArmed = true;
+}
+
+void LLBC_IoUringPoller::SubmitSend(LLBC_SocketHandle handle)
+{
+    _FdSlot &slot = _fdSlots[handle];
+    if (!slot.sending && !(slot.sending = slot.session->GetSocket()->DetachNoSendData()))
+        return;
+
+    LLBC_IoUringSqe *sqe = GetSqe();
+    if (UNLIKELY(!sqe))
+    {
+        slot.session->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_LIMIT, 0));
+        return;
+    }
+
+    LLBC_MessageBlock *block = slot.sending;
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = handle;
+    sqe->addr = reinterpret_cast<uint64>(block->GetDataStartWithReadPos());
+    sqe->len = static_cast<uint32>(block->GetReadableSize());
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Send, slot.gen, handle);
+
+    slot.sendSubmitted = true;
+}
+
+void LLBC_IoUringPoller::CancelRequest(uint64 userData)
+{
+    // Cancel can't be dropped(multishot requests never complete, orphan send blocks never free), defer it.
+    LLBC_IoUringSqe *sqe = GetSqe();
+    if (UNLIKELY(!sqe))
+    {
+        _pendingCancels.push_back(userData);
+        return;
+    }
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->addr = userData;
+    sqe->user_data = LLBC_INL_NS __BuildUserData(LLBC_INL_NS __Cancel, 0, 0);
+}
+
+void LLBC_IoUringPoller::FlushCancels()
+{
+    if (LIKELY(_pendingCancels.empty()))
+        return;
+
+    // Still failed cancels will defer again.
+    std::vector<uint64> cancels;
+    cancels.swap(_pendingCancels);
+    for (size_t i = 0; i < cancels.size(); ++i)
+        CancelRequest(cancels[i]);
+}
+
+void LLBC_IoUringPoller::QueueSend(LLBC_SocketHandle handle)
+{
+    // If send in-flight, remain data will send after send request completed.
+    _FdSlot &slot = _fdSlots[handle];
+    if (slot.sendQueued || slot.sending)
+        return;
+
+    slot.sendQueued = true;
+    _pendingSends.push_back(handle);
+}
+
+void LLBC_IoUringPoller::FlushSends()
+{
+    for (size_t i = 0; i < _pendingSends.size(); ++i)
+    {
+        const LLBC_SocketHandle handle = _pendingSends[i];
+        _FdSlot &slot = _fdSlots[handle];
+        if (!slot.sendQueued)
+            continue;
+
+        slot.sendQueued = false;
+        SubmitSend(handle);
+    }
+
+    _pendingSends.clear();
+}
+
+bool LLBC_IoUringPoller::HandleCompletions()
+{
+    bool handled = false;
+    LLBC_IoUringCqe *cqe;
+    while ((cqe = LLBC_IoUringPeekCqe(_ring)))
+    {
+        handled = true;
+        const uint64 userData = cqe->user_data;
+        const int res = cqe->res;
+        const uint32 flags = cqe->flags;
+        LLBC_IoUringCqeSeen(_ring);
+
+        switch (LLBC_INL_NS __GetKind(userData))
+        {
+        case LLBC_INL_NS __Wakeup:
+            // Drain wakeup pipe, reset signaled flag, then queued events will handle in next loop.
+            LLBC_DrainPollWakeupPipe(_wakeupPipe[0]);
+            LLBC_AtomicSet(&_wakeupSignaled, 0);
+            if (!(flags & IORING_CQE_F_MORE))
+                ArmWakeup();
+            break;
+
+        case LLBC_INL_NS __Accept:
+            HandleAccept(userData, res, flags);
+            break;
+
+        case LLBC_INL_NS __Recv:
+            HandleRecv(userData, res, flags);
+            break;
+
+        case LLBC_INL_NS __Send:
+            HandleSend(userData, res);
+            break;
+
+        case LLBC_INL_NS __Connect:
+            {
+                const LLBC_SocketHandle handle = LLBC_INL_NS __GetHandle(userData);
+                if (GetFdSlot(handle, LLBC_INL_NS __GetGen(userData)))
+                    HandleConnecting(handle, res);
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return handled;
+}
+
+void LLBC_IoUringPoller::HandleAccept(uint64 userData, int res, uint32 flags)
+{
+    const LLBC_SocketHandle handle = LLBC_INL_NS __GetHandle(userData);
+    const uint32 gen = LLBC_INL_NS __GetGen(userData);
+
+    _FdSlot *slot = GetFdSlot(handle, gen);
+    if (UNLIKELY(!slot))
+    {
+        // Listen session already removed, close the accepted socket.
+        if (res >= 0)
+            ::close(res);
+        return;
+    }
+
+    if (!(flags & IORING_CQE_F_MORE))
+        slot->recvArmed = false;
+
+    if (res >= 0)
+    {
+        LLBC_Socket *listenSock = slot->session->GetSocket();
+        LLBC_Socket *newSock = LLBC_New1(LLBC_Socket, res);
+        newSock->SetPollerType(LLBC_PollerType::IoUringPoller);
+        if (listenSock->IsUnixSocket())
+            newSock->SetUnixSocket(true);
+
+        SetConnectedSocketDftOpts(newSock);
+        AddToPoller(CreateSession(newSock));
+
+        // Fd slots maybe reallocated while adding session.
+        if (!(slot = GetFdSlot(handle, gen)))
+            return;
+    }
+    else if (res != -ECANCELED)
+    {
+        trace("LLBC_IoUringPoller::HandleAccept() accept failed, errno: %d\n", -res);
+    }
+
+    if (!slot->recvArmed)
+        ArmAccept(handle);
+}
+
+void LLBC_IoUringPoller::HandleRecv(uint64 userData, int res, uint32 flags)
+{
+    const LLBC_SocketHandle handle = LLBC_INL_NS __GetHandle(userData);
+    const uint32 gen = LLBC_INL_NS __GetGen(userData);
+
+    const bool hasBuf = (flags & IORING_CQE_F_BUFFER) != 0;
+    const uint16 bufId = static_cast<uint16>(flags >> IORING_CQE_BUFFER_SHIFT);
+
+    _FdSlot *slot = GetFdSlot(handle, gen);
+    if (UNLIKELY(!slot))
+    {
+        if (hasBuf)
+            RecycleBuf(bufId);
+        return;
+    }
+
+    if (!(flags & IORING_CQE_F_MORE))
+        slot->recvArmed = false;
+
+    LLBC_Session *session = slot->session;
+    if (res > 0)
+    {
+        // Copy out and give back buffer immediately, let kernel reuse it.
+        LLBC_MessageBlock *block = LLBC_New1(LLBC_MessageBlock, static_cast<size_t>(res));
+        block->Write(_recvBufs + static_cast<size_t>(bufId) * LLBC_CFG_COMM_IO_URING_RECV_BUF_SIZE, res);
+        RecycleBuf(bufId);
+
+        if (!session->OnRecved(block))
+            return;
+
+        if (!(slot = GetFdSlot(handle, gen)))
+            return;
+
+        if (!slot->recvArmed && !session->IsRecvPaused())
+            ArmRecv(handle);
+
+        return;
+    }
+
+    if (hasBuf)
+        RecycleBuf(bufId);
+
+    if (res == -ENOBUFS || res == -ECANCELED)
+    {
+        // Provided buffers exhausted(buffers already given back) or canceled by pause receive, rearm it if not paused.
+        if (!slot->recvArmed && !session->IsRecvPaused())
+            ArmRecv(handle);
+    }
+    else if (res == 0) // Connection gracefully close by peer, explicit set error number to ECONNRESET.
+    {
+        session->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_CLIB, ECONNRESET));
+    }
+    else
+    {
+        session->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_CLIB, -res));
+    }
+}
+
+void LLBC_IoUringPoller::HandleSend(uint64 userData, int res)
+{
+    const LLBC_SocketHandle handle = LLBC_INL_NS __GetHandle(userData);
+    _FdSlot *slot = GetFdSlot(handle, LLBC_INL_NS __GetGen(userData));
+    if (UNLIKELY(!slot))
+    {
+        // Session already removed, delete the orphan send block.
+        std::map<uint64, LLBC_MessageBlock *>::iterator it = _orphanSends.find(userData);
+        if (it != _orphanSends.end())
+        {
+            LLBC_Delete(it->second);
+            _orphanSends.erase(it);
+        }
+
+        return;
+    }
+
+    slot->sendSubmitted = false;
+
+    LLBC_Session *session = slot->session;
+    LLBC_MessageBlock *block = slot->sending;
+    if (res < 0)
+    {
+        LLBC_Delete(block);
+        slot->sending = NULL;
+
+        session->OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_CLIB, -res));
+        return;
+    }
+
+    if (res > 0)
+    {
+        block->ShiftReadPos(res);
+        session->OnSent(static_cast<size_t>(res));
+    }
+
+    // Partial sent means socket send buffer full.
+    session->GetSocket()->SetSendCongested(block->GetReadableSize() > 0);
+
+    // Partial sent, continue send remain data, otherwise send new appended data.
+    if (block->GetReadableSize() == 0)
+    {
+        LLBC_Delete(block);
+        slot->sending = NULL;
+    }
+
+    SubmitSend(handle);
+}
+
+void LLBC_IoUringPoller::HandleConnecting(LLBC_SocketHandle handle, int res)
+{
+    _Connecting::iterator it = _connecting.find(handle);
+    if (UNLIKELY(it == _connecting.end()))
+        return;
+
+    UnbindFdSlot(handle);
+
+    LLBC_AsyncConnInfo &asyncInfo = it->second;
+    LLBC_Socket *sock = asyncInfo.socket;
+
+    bool connected = false;
+    if (res > 0 && (res & POLLOUT))
+    {
+        int optval;
+        LLBC_SocketLen optlen = sizeof(int);
+        if (sock->GetOption(SOL_SOCKET,
+                            SO_ERROR,
+                            &optval,
+                            &optlen) == LLBC_OK && optval == 0)
+            connected = true;
+    }
+
+    _svc->Push(LLBC_SvcEvUtil::BuildAsyncConnResultEv(connected,
+                connected ? "Success" : LLBC_FormatLastError(), asyncInfo.peerAddr));
+
+    if (connected)
+    {
+        SetConnectedSocketDftOpts(sock);
+        AddSession(CreateSession(sock, asyncInfo.sessionId));
+    }
+    else
+    {
+        LLBC_XDelete(sock);
+    }
+
+    _connecting.erase(it);
+}
+
+void LLBC_IoUringPoller::BindFdSlot(LLBC_SocketHandle handle, LLBC_Session *session)
+{
+    const size_t index = static_cast<size_t>(handle);
+    if (index >= _fdSlots.size())
+    {
+        _FdSlot emptySlot;
+        LLBC_MemSet(&emptySlot, 0, sizeof(_FdSlot));
+        _fdSlots.resize(MAX(index + 1, _fdSlots.size() * 2), emptySlot);
+    }
+
+    // Generation never be zero, zero generation means slot not in use.
+    if (UNLIKELY(++_fdGeneration > LLBC_INL_NS __genMask))
+        _fdGeneration = 1;
+
+    _FdSlot &slot = _fdSlots[index];
+    slot.gen = _fdGeneration;
+    slot.session = session;
+    slot.recvArmed = false;
+    slot.sendQueued = false;
+    slot.sending = NULL;
+    slot.sendSubmitted = false;
+}
+
+void LLBC_IoUringPoller::UnbindFdSlot(LLBC_SocketHandle handle)
+{
+    if (static_cast<size_t>(handle) >= _fdSlots.size())
+        return;
+
+    LLBC_MemSet(&_fdSlots[handle], 0, sizeof(_FdSlot));
+}
+
+LLBC_IoUringPoller::_FdSlot *LLBC_IoUringPoller::GetFdSlot(LLBC_SocketHandle handle, uint32 gen)
+{
+    if (UNLIKELY(static_cast<size_t>(handle) >= _fdSlots.size()))
+        return NULL;
+
+    _FdSlot &slot = _fdSlots[handle];
+    return slot.gen == gen && gen != 0 ? &slot : NULL;
+}
+
+__LLBC_NS_END
+
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+
+#include "llbc/common/AfterIncl.h"
@@ -245,6 +245,7 @@ int LLBC_IocpPoller::StartupMonitor()
         LLBC_IocpPoller>(this, &LLBC_IocpPoller::MonitorSvc);
 
     _monitor = new LLBC_PollerMonitor(deleg);
+    _monitor->SetCPUAffinity(GetCPUAffinity()); // Monitor thread run on poller's CPUs.
     if (_monitor->Start() != LLBC_OK)
     {
         LLBC_XDelete(_monitor);
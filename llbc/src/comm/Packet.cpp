@@ -34,6 +34,8 @@ LLBC_Packet::LLBC_Packet()
 , _lenOffset(_HDAccessor::GetHeaderDesc()->GetLenPartOffset())
 
 , _sessionId(0)
+, _flushNow(false)
+, _sendPriority(-1)
 
 , _encoder(NULL)
 , _decoder(NULL)
@@ -0,0 +1,418 @@
+/**
+ * @file    PollPoller.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/Packet.h"
+#include "llbc/comm/Socket.h"
+#include "llbc/comm/Session.h"
+#include "llbc/comm/ServiceEvent.h"
+#include "llbc/comm/PollerType.h"
+#include "llbc/comm/PollPoller.h"
+#include "llbc/comm/IService.h"
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+
+namespace
+{
+    typedef LLBC_NS LLBC_BasePoller Base;
+}
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The poll timeout, in milliseconds, queued events will wakeup poll immediately.
+static const int __pollTimeout = 20;
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_PollPoller::LLBC_PollPoller()
+: _wakeupSignaled(0)
+
+, _fds()
+, _fdSessions()
+, _fdIndexes()
+
+, _readyFds()
+{
+    _wakeupPipe[0] = _wakeupPipe[1] = LLBC_INVALID_HANDLE;
+}
+
+LLBC_PollPoller::~LLBC_PollPoller()
+{
+    Stop();
+}
+
+int LLBC_PollPoller::Start()
+{
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_FAILED;
+    }
+
+    if (LLBC_CreatePollWakeupPipe(_wakeupPipe) != LLBC_OK)
+        return LLBC_FAILED;
+
+    _wakeupSignaled = 0;
+    AddFd(_wakeupPipe[0], POLLIN, NULL);
+
+    if (Activate(1) != LLBC_OK)
+    {
+        RemoveFd(_wakeupPipe[0]);
+        LLBC_ClosePollWakeupPipe(_wakeupPipe);
+
+        return LLBC_FAILED;
+    }
+
+    _started = true;
+    return LLBC_OK;
+}
+
+void LLBC_PollPoller::Svc()
+{
+    while (!_started)
+        LLBC_Sleep(20);
+
+    while (!_stopping)
+    {
+        if (HandleQueuedEvents(0))
+            MarkBusy();
+
+        Poll(GetWaitTimeout(LLBC_INL_NS __pollTimeout));
+    }
+}
+
+void LLBC_PollPoller::Cleanup()
+{
+    LLBC_ClosePollWakeupPipe(_wakeupPipe);
+
+    _fds.clear();
+    _fdSessions.clear();
+    _fdIndexes.clear();
+
+    Base::Cleanup();
+}
+
+int LLBC_PollPoller::Push(LLBC_MessageBlock *block)
+{
+    if (Base::Push(block) != LLBC_OK)
+        return LLBC_FAILED;
+
+    // Coalesce wakeup signals, only the first push after poller drained the wakeup pipe need signal.
+    if (LLBC_AtomicCompareAndExchange(&_wakeupSignaled, 1, 0) == 0 &&
+            _wakeupPipe[1] != LLBC_INVALID_HANDLE)
+        LLBC_WakeupPoll(_wakeupPipe[1]);
+
+    return LLBC_OK;
+}
+
+void LLBC_PollPoller::HandleEv_AddSock(LLBC_PollerEvent &ev)
+{
+    Base::HandleEv_AddSock(ev);
+}
+
+void LLBC_PollPoller::HandleEv_AsyncConn(LLBC_PollerEvent &ev)
+{
+    LLBC_Socket *sock = LLBC_New(LLBC_Socket);
+    const LLBC_SocketHandle handle = sock->Handle();
+
+    sock->SetNonBlocking();
+    sock->SetPollerType(LLBC_PollerType::PollPoller);
+    if (sock->Connect(ev.peerAddr) == LLBC_OK)
+    {
+        _svc->Push(LLBC_SvcEvUtil::
+                BuildAsyncConnResultEv(true, "Success", ev.peerAddr));
+
+        SetConnectedSocketDftOpts(sock);
+        AddSession(CreateSession(sock, ev.sessionId));
+    }
+    else if (LLBC_GetLastError() == LLBC_ERROR_WBLOCK)
+    {
+        LLBC_AsyncConnInfo asyncInfo;
+        asyncInfo.socket = sock;
+        asyncInfo.peerAddr = ev.peerAddr;
+        asyncInfo.sessionId = ev.sessionId;
+        _connecting.insert(std::make_pair(handle, asyncInfo));
+
+        AddFd(handle, POLLOUT, NULL);
+    }
+    else
+    {
+        const LLBC_String &reason = LLBC_FormatLastError();
+        _svc->Push(LLBC_SvcEvUtil::BuildAsyncConnResultEv(false, reason, ev.peerAddr));
+
+        LLBC_Delete(sock);
+    }
+}
+
+void LLBC_PollPoller::HandleEv_Send(LLBC_PollerEvent &ev)
+{
+    const int sessionId = ev.un.packet->GetSessionId();
+    Base::HandleEv_Send(ev);
+
+    // Session send will try send immediately, if has remain data, wait writable(corked session wait flush).
+    _Sessions::iterator it = _sessions.find(sessionId);
+    if (it != _sessions.end() && it->second->GetCorkedSize() == 0)
+        UpdateWriteEvent(it->second);
+}
+
+void LLBC_PollPoller::HandleEv_Close(LLBC_PollerEvent &ev)
+{
+    Base::HandleEv_Close(ev);
+}
+
+void LLBC_PollPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
+{
+    ASSERT(false && "Poll Poller could not process Monitor Event");
+}
+
+void LLBC_PollPoller::HandleEv_TakeOverSession(LLBC_PollerEvent &ev)
+{
+    Base::HandleEv_TakeOverSession(ev);
+}
+
+void LLBC_PollPoller::FlushCorkedSession(LLBC_Session *session)
+{
+    const int sessionId = session->GetId();
+    Base::FlushCorkedSession(session);
+
+    _Sessions::iterator it = _sessions.find(sessionId);
+    if (it != _sessions.end())
+        UpdateWriteEvent(it->second);
+}
+
+void LLBC_PollPoller::PauseSessionRecv(LLBC_Session *session)
+{
+    Base::PauseSessionRecv(session);
+
+    const int fdIndex = GetFdIndex(session->GetSocketHandle());
+    if (LIKELY(fdIndex != -1))
+        _fds[fdIndex].events &= ~POLLIN;
+}
+
+void LLBC_PollPoller::ResumeSessionRecv(LLBC_Session *session)
+{
+    const int fdIndex = GetFdIndex(session->GetSocketHandle());
+    if (LIKELY(fdIndex != -1))
+        _fds[fdIndex].events |= POLLIN;
+}
+
+void LLBC_PollPoller::AddSession(LLBC_Session *session)
+{
+    Base::AddSession(session);
+
+    AddFd(session->GetSocketHandle(), POLLIN, session);
+    UpdateWriteEvent(session);
+}
+
+void LLBC_PollPoller::RemoveSession(LLBC_Session *session)
+{
+    RemoveFd(session->GetSocketHandle());
+
+    Base::RemoveSession(session);
+}
+
+void LLBC_PollPoller::Poll(int timeout)
+{
+    const int readyCount = LLBC_Poll(&_fds[0], static_cast<uint32>(_fds.size()), timeout);
+    if (readyCount <= 0)
+        return;
+
+    MarkBusy();
+
+    // Collect ready fds first, the pollfd array will change while handling events(accept/close).
+    _readyFds.clear();
+    for (size_t i = 0; i < _fds.size() && _readyFds.size() < static_cast<size_t>(readyCount); ++i)
+    {
+        if (_fds[i].revents != 0)
+            _readyFds.push_back(_fds[i]);
+    }
+
+    for (size_t i = 0; i < _readyFds.size(); ++i)
+    {
+        const LLBC_PollFd &readyFd = _readyFds[i];
+        const LLBC_SocketHandle handle = readyFd.fd;
+        const short revents = readyFd.revents;
+
+        // Wakeup pipe, reset signaled flag after drained, then queued events will handle in next loop.
+        if (handle == _wakeupPipe[0])
+        {
+            LLBC_DrainPollWakeupPipe(handle);
+            LLBC_AtomicSet(&_wakeupSignaled, 0);
+
+            continue;
+        }
+
+        if (HandleConnecting(handle, revents))
+            continue;
+
+        const int fdIndex = GetFdIndex(handle);
+        if (UNLIKELY(fdIndex == -1))
+            continue;
+
+        LLBC_Session *session = _fdSessions[fdIndex];
+        if (revents & (POLLHUP | POLLERR | POLLNVAL))
+        {
+            LLBC_Socket *sock = session->GetSocket();
+
+            int sockErr;
+            LLBC_SessionCloseInfo *closeInfo;
+            if (sock->GetPendingError(sockErr) != LLBC_OK)
+                closeInfo = new LLBC_SessionCloseInfo();
+            else
+                closeInfo = new LLBC_SessionCloseInfo(LLBC_ERROR_CLIB, sockErr);
+
+            session->OnClose(closeInfo);
+
+            continue;
+        }
+
+        if (revents & POLLIN)
+        {
+            if (session->IsListen())
+            {
+                Accept(session);
+                continue;
+            }
+
+            session->OnRecv();
+        }
+
+        if (revents & POLLOUT)
+        {
+            // Maybe in session removed while calling OnRecv() method.
+            if ((revents & POLLIN) && UNLIKELY(GetFdIndex(handle) == -1))
+                continue;
+
+            session->OnSend();
+            if (LIKELY(GetFdIndex(handle) != -1))
+                UpdateWriteEvent(session);
+        }
+    }
+}
+
+void LLBC_PollPoller::AddFd(LLBC_SocketHandle handle, short events, LLBC_Session *session)
+{
+    if (static_cast<size_t>(handle) >= _fdIndexes.size())
+        _fdIndexes.resize(handle + 1, -1);
+
+    LLBC_PollFd pollFd;
+    pollFd.fd = handle;
+    pollFd.events = events;
+    pollFd.revents = 0;
+
+    _fdIndexes[handle] = static_cast<int>(_fds.size());
+    _fds.push_back(pollFd);
+    _fdSessions.push_back(session);
+}
+
+void LLBC_PollPoller::RemoveFd(LLBC_SocketHandle handle)
+{
+    const int fdIndex = GetFdIndex(handle);
+    if (fdIndex == -1)
+        return;
+
+    // Swap remove, move the last pollfd to removed position, keep array compact.
+    const int lastIndex = static_cast<int>(_fds.size()) - 1;
+    if (fdIndex != lastIndex)
+    {
+        _fds[fdIndex] = _fds[lastIndex];
+        _fdSessions[fdIndex] = _fdSessions[lastIndex];
+        _fdIndexes[_fds[fdIndex].fd] = fdIndex;
+    }
+
+    _fds.pop_back();
+    _fdSessions.pop_back();
+    _fdIndexes[handle] = -1;
+}
+
+int LLBC_PollPoller::GetFdIndex(LLBC_SocketHandle handle) const
+{
+    if (UNLIKELY(handle < 0 || static_cast<size_t>(handle) >= _fdIndexes.size()))
+        return -1;
+
+    return _fdIndexes[handle];
+}
+
+void LLBC_PollPoller::UpdateWriteEvent(LLBC_Session *session)
+{
+    const int fdIndex = GetFdIndex(session->GetSocketHandle());
+    if (UNLIKELY(fdIndex == -1))
+        return;
+
+    LLBC_PollFd &pollFd = _fds[fdIndex];
+    if (session->GetSocket()->IsExistNoSendData())
+        pollFd.events |= POLLOUT;
+    else
+        pollFd.events &= ~POLLOUT;
+}
+
+bool LLBC_PollPoller::HandleConnecting(LLBC_SocketHandle handle, short revents)
+{
+    _Connecting::iterator it = _connecting.find(handle);
+    if (it == _connecting.end())
+        return false;
+
+    LLBC_AsyncConnInfo &asyncInfo = it->second;
+    LLBC_Socket *sock = asyncInfo.socket;
+
+    bool connected = false;
+    if (revents & POLLOUT)
+    {
+        int optval;
+        LLBC_SocketLen optlen = sizeof(int);
+        if (sock->GetOption(SOL_SOCKET,
+                            SO_ERROR,
+                            &optval,
+                            &optlen) == LLBC_OK && optval == 0)
+            connected = true;
+    }
+
+    _svc->Push(LLBC_SvcEvUtil::BuildAsyncConnResultEv(connected,
+                connected ? "Success" : LLBC_FormatLastError(), asyncInfo.peerAddr));
+
+    RemoveFd(handle);
+    if (connected)
+    {
+        SetConnectedSocketDftOpts(sock);
+        AddSession(CreateSession(sock, asyncInfo.sessionId));
+    }
+    else
+    {
+        LLBC_XDelete(sock);
+    }
+
+    _connecting.erase(it);
+    return true;
+}
+
+void LLBC_PollPoller::Accept(LLBC_Session *session)
+{
+    LLBC_Socket *newSock;
+    LLBC_Socket *sock = session->GetSocket();
+    for (; ;)
+    {
+        if (!(newSock = sock->Accept()))
+            break;
+
+        newSock->SetNonBlocking();
+
+        SetConnectedSocketDftOpts(newSock);
+        AddToPoller(CreateSession(newSock));
+    }
+}
+
+__LLBC_NS_END
+
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+#include "llbc/common/AfterIncl.h"
@@ -136,6 +136,16 @@ LLBC_MessageBlock *LLBC_PollerEvUtil::BuildTakeOverSessionEv(LLBC_Session *sessi
     return block;
 }
 
+LLBC_MessageBlock *LLBC_PollerEvUtil::BuildFlushSendsEv()
+{
+    _Block *block = LLBC_New1(_Block, sizeof(_Ev));
+    _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
+    ev.type = _Ev::FlushSends;
+
+    block->SetWritePos(sizeof(_Ev));
+    return block;
+}
+
 void LLBC_PollerEvUtil::DestroyEv(LLBC_PollerEvent &ev)
 {
     switch (ev.type)
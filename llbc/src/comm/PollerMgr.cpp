@@ -10,12 +10,15 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/log/LoggerManager.h"
+
 #include "llbc/comm/Packet.h"
 #include "llbc/comm/Socket.h"
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/PollerEvent.h"
 #include "llbc/comm/BasePoller.h"
 #include "llbc/comm/PollerMgr.h"
+#include "llbc/comm/PollerStat.h"
 
 namespace
 {
@@ -48,9 +51,21 @@ LLBC_PollerMgr::LLBC_PollerMgr()
 : _type(LLBC_PollerType::End)
 , _svc(NULL)
 
+, _numaNode(-1)
+, _placementCPUs()
+, _firstPollerCPU(-1)
+, _busyPollIdleUSecs(0)
+, _sendCork(false)
+, _sendLanePolicy(NULL)
+, _recvLimitPolicy(NULL)
+
 , _pollerCount(0)
 , _pollers(NULL)
 , _pollerLock()
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+, _pollerStatCount(0)
+, _pollerStats(NULL)
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 
 , _maxSessionId(1)
 
@@ -62,6 +77,10 @@ LLBC_PollerMgr::LLBC_PollerMgr()
 LLBC_PollerMgr::~LLBC_PollerMgr()
 {
     Stop();
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_XDeletes(_pollerStats);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 }
 
 void LLBC_PollerMgr::SetPollerType(int type)
@@ -69,6 +88,38 @@ void LLBC_PollerMgr::SetPollerType(int type)
     _type = type;
 }
 
+int LLBC_PollerMgr::GetPollerType() const
+{
+    return _type;
+}
+
+void LLBC_PollerMgr::SetThreadPlacement(int numaNode, const std::vector<int> &cpuNos, int firstCPU)
+{
+    _numaNode = numaNode;
+    _placementCPUs = cpuNos;
+    _firstPollerCPU = cpuNos.empty() ? -1 : firstCPU;
+}
+
+void LLBC_PollerMgr::SetBusyPoll(int idleUSecs)
+{
+    _busyPollIdleUSecs = idleUSecs;
+}
+
+void LLBC_PollerMgr::SetSendCork(bool cork)
+{
+    _sendCork = cork;
+}
+
+void LLBC_PollerMgr::SetSendLanePolicy(const LLBC_SendLanePolicy *policy)
+{
+    _sendLanePolicy = policy;
+}
+
+void LLBC_PollerMgr::SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy)
+{
+    _recvLimitPolicy = policy;
+}
+
 void LLBC_PollerMgr::SetService(LLBC_IService *svc)
 {
     _svc = svc;
@@ -87,10 +138,38 @@ int LLBC_PollerMgr::Start(int count)
         return LLBC_FAILED;
     }
 
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    // If running kernel not support io_uring features poller required, or io_uring disabled by
+    // LLBC_DISABLE_IO_URING environment variable, fallback to epoll poller.
+    const char *disableIoUring = ::getenv("LLBC_DISABLE_IO_URING");
+    const bool ioUringDisabled = disableIoUring && *disableIoUring && strcmp(disableIoUring, "0") != 0;
+    if (_type == LLBC_PollerType::IoUringPoller && (ioUringDisabled || !LLBC_IoUringIsSupported()))
+    {
+        const char *reason = ioUringDisabled ? "disabled by LLBC_DISABLE_IO_URING" : "not supported";
+        LLBC_LIB_WARN_LOG("io_uring %s, poller fallback to EpollPoller", reason);
+
+        _type = LLBC_PollerType::EpollPoller;
+        for (_PendingAddSocks::iterator it = _pendingAddSocks.begin();
+             it != _pendingAddSocks.end();
+             it++)
+            it->second->SetPollerType(_type);
+    }
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+
     _pollerCount = count;
     _pollers = LLBC_Malloc(LLBC_BasePoller *, sizeof(LLBC_BasePoller *) * count);
     ::memset(_pollers, 0, sizeof(LLBC_BasePoller *) * count);
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    // Create poller stats, the last started pollers stats keep until restart, so
+    // service still can get the stat after stopped.
+    _pollerLock.Lock();
+    LLBC_XDeletes(_pollerStats);
+    _pollerStatCount = count;
+    _pollerStats = new LLBC_PollerStat[count];
+    _pollerLock.Unlock();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
     // Create pollers.
     for (int i = 0; i < count; i++)
     {
@@ -99,6 +178,27 @@ int LLBC_PollerMgr::Start(int count)
         _pollers[i]->SetService(_svc);
         _pollers[i]->SetPollerMgr(this);
         _pollers[i]->SetBrothersCount(count);
+
+        // Bind poller N to Nth placement CPU, keeps pollers not compete for same core.
+        _pollers[i]->SetNUMANode(_numaNode);
+        if (_firstPollerCPU >= 0)
+            _pollers[i]->SetCPUAffinity(std::vector<int>(
+                1, _placementCPUs[(_firstPollerCPU + i) % _placementCPUs.size()]));
+        else
+            _pollers[i]->SetCPUAffinity(_placementCPUs);
+        _pollers[i]->SetBusyPoll(_busyPollIdleUSecs);
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+        // Select poller send when writable, not support send cork(Iocp poller too).
+        _pollers[i]->SetSendCork(_sendCork && _type != LLBC_PollerType::SelectPoller);
+        _pollers[i]->SetSendLanePolicy(_sendLanePolicy);
+#else // LLBC_TARGET_PLATFORM_WIN32
+        // Iocp poller post send data immediately, not support send lanes.
+        _pollers[i]->SetSendLanePolicy(_type != LLBC_PollerType::IocpPoller ? _sendLanePolicy : NULL);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+        _pollers[i]->SetRecvLimitPolicy(_recvLimitPolicy);
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        _pollers[i]->SetStat(&_pollerStats[i]);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
     }
 
     // Startup all pollers.
@@ -162,14 +262,7 @@ int LLBC_PollerMgr::Listen(const char *ip, uint16 port)
         return 0;
     }
 
-    const int sessionId = AllocSessionId();
-    if (LIKELY(_pollers))
-        _pollers[sessionId % _pollerCount]->Push(
-                LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
-    else
-        _pendingAddSocks.insert(std::make_pair(sessionId, sock));
-
-    return sessionId;
+    return AddSock(sock);
 }
 
 int LLBC_PollerMgr::Connect(const char *ip, uint16 port)
@@ -191,15 +284,7 @@ int LLBC_PollerMgr::Connect(const char *ip, uint16 port)
 
     sock->SetNonBlocking();
 
-    const int sessionId = AllocSessionId();
-
-    if (LIKELY(_pollers))
-        _pollers[sessionId % _pollerCount]->Push(
-                LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
-    else
-        _pendingAddSocks.insert(std::make_pair(sessionId, sock));
-
-    return sessionId;
+    return AddSock(sock);
 }
 
 int LLBC_PollerMgr::AsyncConn(const char *ip, uint16 port)
@@ -218,6 +303,157 @@ int LLBC_PollerMgr::AsyncConn(const char *ip, uint16 port)
     return LLBC_OK;
 }
 
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+int LLBC_PollerMgr::ListenUnix(const char *path)
+{
+    const LLBC_SocketHandle handle = LLBC_CreateUnixSocket();
+    if (handle == LLBC_INVALID_SOCKET_HANDLE)
+        return 0;
+
+    LLBC_Socket *sock = LLBC_New1(LLBC_Socket, handle);
+    sock->SetPollerType(_type);
+    sock->SetUnixSocket(true);
+    if (sock->SetNonBlocking() != LLBC_OK ||
+            sock->BindTo(path) != LLBC_OK ||
+            sock->Listen() != LLBC_OK)
+    {
+        LLBC_Delete(sock);
+        return 0;
+    }
+
+    return AddSock(sock);
+}
+
+int LLBC_PollerMgr::ConnectUnix(const char *path)
+{
+    const LLBC_SocketHandle handle = LLBC_CreateUnixSocket();
+    if (handle == LLBC_INVALID_SOCKET_HANDLE)
+        return 0;
+
+    LLBC_Socket *sock = LLBC_New1(LLBC_Socket, handle);
+    sock->SetPollerType(_type);
+    sock->SetUnixSocket(true);
+    if (sock->Connect(path) != LLBC_OK)
+    {
+        LLBC_Delete(sock);
+        return 0;
+    }
+
+    sock->SetNonBlocking();
+
+    return AddSock(sock);
+}
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+int LLBC_PollerMgr::ListenUdp(const char *ip, uint16 port)
+{
+    if (_type != LLBC_PollerType::EpollPoller)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+        return 0;
+    }
+
+    LLBC_SockAddr_IN local;
+    if (This::GetAddr(ip, port, local) != LLBC_OK)
+        return 0;
+
+    const LLBC_SocketHandle handle = LLBC_CreateUdpSocket();
+    if (handle == LLBC_INVALID_SOCKET_HANDLE)
+        return 0;
+
+    LLBC_Socket *sock = LLBC_New1(LLBC_Socket, handle);
+    sock->SetPollerType(_type);
+    sock->SetDatagram(true);
+    if (sock->SetNonBlocking() != LLBC_OK ||
+            sock->EnableAddressReusable() != LLBC_OK ||
+            sock->BindTo(local) != LLBC_OK ||
+            sock->Listen() != LLBC_OK)
+    {
+        LLBC_Delete(sock);
+        return 0;
+    }
+
+    if (LLBC_CFG_COMM_UDP_SEND_BUF_SIZE > 0)
+        sock->SetSendBufSize(LLBC_CFG_COMM_UDP_SEND_BUF_SIZE);
+    if (LLBC_CFG_COMM_UDP_RECV_BUF_SIZE > 0)
+        sock->SetRecvBufSize(LLBC_CFG_COMM_UDP_RECV_BUF_SIZE);
+
+    return AddSock(sock);
+}
+
+int LLBC_PollerMgr::ConnectUdp(const char *ip, uint16 port)
+{
+    if (_type != LLBC_PollerType::EpollPoller)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+        return 0;
+    }
+
+    LLBC_SockAddr_IN peer;
+    if (This::GetAddr(ip, port, peer) != LLBC_OK)
+        return 0;
+
+    const LLBC_SocketHandle handle = LLBC_CreateUdpSocket();
+    if (handle == LLBC_INVALID_SOCKET_HANDLE)
+        return 0;
+
+    LLBC_Socket *sock = LLBC_New1(LLBC_Socket, handle);
+    sock->SetPollerType(_type);
+    sock->SetDatagram(true);
+    if (sock->Connect(peer) != LLBC_OK ||
+            sock->SetNonBlocking() != LLBC_OK)
+    {
+        LLBC_Delete(sock);
+        return 0;
+    }
+
+    return AddSock(sock);
+}
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+int LLBC_PollerMgr::AdoptSocket(LLBC_SocketHandle handle)
+{
+    // Only support connected AF_INET/AF_UNIX stream socket, check before take ownership,
+    // so if adopt failed, the socket handle still owned by caller.
+    const int family = LLBC_GetSocketAddressFamily(handle);
+    if (family == -1)
+        return 0;
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    if (family != AF_INET && family != AF_UNIX)
+#else // !LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    if (family != AF_INET)
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return 0;
+    }
+
+#if LLBC_TARGET_PLATFORM_WIN32
+    // Iocp poller need overlapped socket, could not adopt exist socket.
+    if (_type == LLBC_PollerType::IocpPoller)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+        return 0;
+    }
+#endif // LLBC_TARGET_PLATFORM_WIN32
+
+    LLBC_SockAddr_IN peer;
+    if (LLBC_GetPeerSocketName(handle, peer) != LLBC_OK)
+        return 0;
+
+    LLBC_Socket *sock = LLBC_New1(LLBC_Socket, handle);
+    sock->SetPollerType(_type);
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    sock->SetUnixSocket(family == AF_UNIX);
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    sock->SetNonBlocking();
+    sock->UpdateLocalAddress();
+    sock->UpdatePeerAddress();
+
+    return AddSock(sock);
+}
+
 int LLBC_PollerMgr::Send(LLBC_Packet *packet)
 {
     _pollers[packet->GetSessionId() % 
@@ -230,6 +466,54 @@ void LLBC_PollerMgr::Close(int sessionId, const char *reason)
     _pollers[sessionId % _pollerCount]->Push(LLBC_PollerEvUtil::BuildCloseEv(sessionId, reason));
 }
 
+void LLBC_PollerMgr::FlushSends()
+{
+    for (int i = 0; i < _pollerCount; ++i)
+        _pollers[i]->Push(LLBC_PollerEvUtil::BuildFlushSendsEv());
+}
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+void LLBC_PollerMgr::CollectStat(bool withSessions, LLBC_ServiceStat &stat)
+{
+    LLBC_Guard guard(_pollerLock);
+    for (int i = 0; i < _pollerStatCount; i++)
+        _pollerStats[i].MergeTo(withSessions, stat);
+
+    for (int i = 0; i < _pollerCount; i++)
+    {
+        if (_pollers[i])
+            stat.pollerQueuedEvents += _pollers[i]->GetMessageSize();
+    }
+}
+
+void LLBC_PollerMgr::CollectTraffic(uint64 &sentBytes, uint64 &recvedBytes)
+{
+    sentBytes = recvedBytes = 0;
+
+    LLBC_Guard guard(_pollerLock);
+    for (int i = 0; i < _pollerStatCount; i++)
+    {
+        uint64 pollerSent, pollerRecved;
+        _pollerStats[i].GetTraffic(pollerSent, pollerRecved);
+
+        sentBytes += pollerSent;
+        recvedBytes += pollerRecved;
+    }
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+int LLBC_PollerMgr::AddSock(LLBC_Socket *sock)
+{
+    const int sessionId = AllocSessionId();
+    if (LIKELY(_pollers))
+        _pollers[sessionId % _pollerCount]->Push(
+                LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
+    else
+        _pendingAddSocks.insert(std::make_pair(sessionId, sock));
+
+    return sessionId;
+}
+
 int LLBC_PollerMgr::AllocSessionId()
 {
     return LLBC_AtomicFetchAndAdd(&_maxSessionId, 1);
@@ -0,0 +1,228 @@
+/**
+ * @file    PollerStat.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/PollerStat.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// Single writer(owner poller thread) counter add, readers never see torn counter.
+static inline void __Add(LLBC_NS uint64 &counter, LLBC_NS uint64 value)
+{
+    volatile LLBC_NS sint64 *ptr = reinterpret_cast<volatile LLBC_NS sint64 *>(&counter);
+    LLBC_NS LLBC_AtomicRelaxedSet(ptr, static_cast<LLBC_NS sint64>(counter + value));
+}
+
+static inline void __Add(LLBC_NS sint64 &counter, LLBC_NS sint64 value)
+{
+    LLBC_NS LLBC_AtomicRelaxedSet(&counter, counter + value);
+}
+
+static inline LLBC_NS uint64 __Get(const LLBC_NS uint64 &counter)
+{
+    return static_cast<LLBC_NS uint64>(
+        LLBC_NS LLBC_AtomicRelaxedGet(reinterpret_cast<const volatile LLBC_NS sint64 *>(&counter)));
+}
+
+static inline LLBC_NS sint64 __Get(const LLBC_NS sint64 &counter)
+{
+    return LLBC_NS LLBC_AtomicRelaxedGet(&counter);
+}
+
+static void __Copy(const LLBC_NS LLBC_SessionStat &from, LLBC_NS LLBC_SessionStat &to)
+{
+    to.sessionId = from.sessionId;
+
+    to.sentBytes = __Get(from.sentBytes);
+    to.sentPackets = __Get(from.sentPackets);
+    to.sendCalls = __Get(from.sendCalls);
+    to.sendDroppedPackets = __Get(from.sendDroppedPackets);
+
+    to.recvedBytes = __Get(from.recvedBytes);
+    to.recvedPackets = __Get(from.recvedPackets);
+    to.recvCalls = __Get(from.recvCalls);
+    to.recvLimitedPackets = __Get(from.recvLimitedPackets);
+    to.recvDroppedPackets = __Get(from.recvDroppedPackets);
+
+    to.pendingSendBytes = __Get(from.pendingSendBytes);
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_PollerStat::LLBC_PollerStat()
+: _lock()
+
+, _total()
+, _sessionStats()
+, _opcodeStats()
+{
+}
+
+LLBC_PollerStat::~LLBC_PollerStat()
+{
+}
+
+LLBC_SessionStat *LLBC_PollerStat::AddSession(int sessionId)
+{
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_lock);
+
+    LLBC_SessionStat &stat = _sessionStats[sessionId];
+    stat = LLBC_SessionStat();
+    stat.sessionId = sessionId;
+
+    return &stat;
+}
+
+void LLBC_PollerStat::RemoveSession(int sessionId)
+{
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_lock);
+
+    _SessionStats::iterator it = _sessionStats.find(sessionId);
+    if (it == _sessionStats.end())
+        return;
+
+    // The not sent data will be discarded.
+    LLBC_INL_NS __Add(_total.pendingSendBytes, -it->second.pendingSendBytes);
+    _sessionStats.erase(it);
+}
+
+void LLBC_PollerStat::OnWillSend(LLBC_SessionStat *stat, size_t len)
+{
+    LLBC_INL_NS __Add(stat->pendingSendBytes, static_cast<sint64>(len));
+    LLBC_INL_NS __Add(_total.pendingSendBytes, static_cast<sint64>(len));
+}
+
+void LLBC_PollerStat::OnSent(LLBC_SessionStat *stat, size_t len)
+{
+    LLBC_INL_NS __Add(stat->sentBytes, len);
+    LLBC_INL_NS __Add(stat->pendingSendBytes, -static_cast<sint64>(len));
+
+    LLBC_INL_NS __Add(_total.sentBytes, len);
+    LLBC_INL_NS __Add(_total.pendingSendBytes, -static_cast<sint64>(len));
+}
+
+void LLBC_PollerStat::OnSendDropped(LLBC_SessionStat *stat, int packets, size_t len)
+{
+    LLBC_INL_NS __Add(stat->sendDroppedPackets, static_cast<uint64>(packets));
+    LLBC_INL_NS __Add(stat->pendingSendBytes, -static_cast<sint64>(len));
+
+    LLBC_INL_NS __Add(_total.sendDroppedPackets, static_cast<uint64>(packets));
+    LLBC_INL_NS __Add(_total.pendingSendBytes, -static_cast<sint64>(len));
+}
+
+void LLBC_PollerStat::OnRecvLimited(LLBC_SessionStat *stat, bool dropped)
+{
+    LLBC_INL_NS __Add(stat->recvLimitedPackets, 1);
+    LLBC_INL_NS __Add(_total.recvLimitedPackets, 1);
+    if (dropped)
+    {
+        LLBC_INL_NS __Add(stat->recvDroppedPackets, 1);
+        LLBC_INL_NS __Add(_total.recvDroppedPackets, 1);
+    }
+}
+
+void LLBC_PollerStat::OnRecved(LLBC_SessionStat *stat, size_t len)
+{
+    LLBC_INL_NS __Add(stat->recvedBytes, len);
+    LLBC_INL_NS __Add(_total.recvedBytes, len);
+}
+
+void LLBC_PollerStat::OnSysCalls(LLBC_SessionStat *stat, int sendCalls, int recvCalls)
+{
+    LLBC_INL_NS __Add(stat->sendCalls, static_cast<uint64>(sendCalls));
+    LLBC_INL_NS __Add(stat->recvCalls, static_cast<uint64>(recvCalls));
+
+    LLBC_INL_NS __Add(_total.sendCalls, static_cast<uint64>(sendCalls));
+    LLBC_INL_NS __Add(_total.recvCalls, static_cast<uint64>(recvCalls));
+}
+
+void LLBC_PollerStat::OnPacketSent(LLBC_SessionStat *stat, int opcode, size_t len)
+{
+    LLBC_INL_NS __Add(stat->sentPackets, 1);
+    LLBC_INL_NS __Add(_total.sentPackets, 1);
+
+    LLBC_OpcodeStat &opStat = GetOpcodeStat(opcode);
+    LLBC_INL_NS __Add(opStat.sentPackets, 1);
+    LLBC_INL_NS __Add(opStat.sentBytes, len);
+}
+
+void LLBC_PollerStat::OnPacketRecved(LLBC_SessionStat *stat, int opcode, size_t len)
+{
+    LLBC_INL_NS __Add(stat->recvedPackets, 1);
+    LLBC_INL_NS __Add(_total.recvedPackets, 1);
+
+    LLBC_OpcodeStat &opStat = GetOpcodeStat(opcode);
+    LLBC_INL_NS __Add(opStat.recvedPackets, 1);
+    LLBC_INL_NS __Add(opStat.recvedBytes, len);
+}
+
+void LLBC_PollerStat::MergeTo(bool withSessions, LLBC_ServiceStat &stat)
+{
+    LLBC_SessionStat copied;
+    LLBC_INL_NS __Copy(_total, copied);
+    stat.total.Merge(copied);
+
+    // Lock to prevent poller add/remove sessions & opcodes while reading.
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_lock);
+
+    stat.sessionCount += _sessionStats.size();
+
+    for (_OpcodeStats::const_iterator it = _opcodeStats.begin();
+         it != _opcodeStats.end();
+         it++)
+    {
+        LLBC_OpcodeStat &opStat = stat.opcodeStats[it->first];
+        opStat.opcode = it->first;
+        opStat.sentBytes += LLBC_INL_NS __Get(it->second.sentBytes);
+        opStat.sentPackets += LLBC_INL_NS __Get(it->second.sentPackets);
+        opStat.recvedBytes += LLBC_INL_NS __Get(it->second.recvedBytes);
+        opStat.recvedPackets += LLBC_INL_NS __Get(it->second.recvedPackets);
+    }
+
+    if (!withSessions)
+        return;
+
+    stat.sessionStats.reserve(stat.sessionStats.size() + _sessionStats.size());
+    for (_SessionStats::const_iterator it = _sessionStats.begin();
+         it != _sessionStats.end();
+         it++)
+    {
+        stat.sessionStats.push_back(LLBC_SessionStat());
+        LLBC_INL_NS __Copy(it->second, stat.sessionStats.back());
+    }
+}
+
+void LLBC_PollerStat::GetTraffic(uint64 &sentBytes, uint64 &recvedBytes)
+{
+    sentBytes = LLBC_INL_NS __Get(_total.sentBytes);
+    recvedBytes = LLBC_INL_NS __Get(_total.recvedBytes);
+}
+
+LLBC_OpcodeStat &LLBC_PollerStat::GetOpcodeStat(int opcode)
+{
+    // Only owner poller thread modify the opcode stats, find without lock.
+    _OpcodeStats::iterator it = _opcodeStats.find(opcode);
+    if (LIKELY(it != _opcodeStats.end()))
+        return it->second;
+
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_lock);
+
+    LLBC_OpcodeStat &opStat = _opcodeStats[opcode];
+    opStat.opcode = opcode;
+
+    return opStat;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -27,6 +27,12 @@ static const LLBC_NS LLBC_String __g_descs[] =
 #elif LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
     "EpollPoller",
 #endif // LLBC_TARGET_PLATFORM_WIN32
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    "PollPoller",
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    "IoUringPoller",
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
 
     "Invalid"
 };
@@ -0,0 +1,116 @@
+/**
+ * @file    RecvLimit.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/RecvLimit.h"
+
+namespace
+{
+    typedef LLBC_NS LLBC_RecvLimitAction This;
+}
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static const LLBC_NS LLBC_String __g_descs[] =
+{
+    "Drop",
+    "Delay",
+    "Disconnect",
+
+    "Invalid"
+};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+bool LLBC_RecvLimitAction::IsValid(int action)
+{
+    return action >= This::Begin && action < This::End;
+}
+
+const LLBC_String &LLBC_RecvLimitAction::Action2Str(int action)
+{
+    return LLBC_INL_NS __g_descs[IsValid(action) ? action : This::End];
+}
+
+LLBC_RecvLimitPolicy::Rate::Rate(int rate, int burst)
+: rate(rate)
+, burst(burst)
+{
+}
+
+LLBC_RecvLimitPolicy::LLBC_RecvLimitPolicy()
+: action(LLBC_RecvLimitAction::Drop)
+, sessionRate()
+, opcodeRates()
+{
+}
+
+LLBC_RecvLimiter::LLBC_RecvLimiter(const LLBC_RecvLimitPolicy &policy, bool canDelay)
+: _action(policy.action)
+, _sessionBucket()
+, _opcodeBuckets()
+{
+    if (_action == LLBC_RecvLimitAction::Delay && !canDelay)
+        _action = LLBC_RecvLimitAction::Drop;
+
+    _sessionBucket.SetRate(policy.sessionRate.rate, policy.sessionRate.burst);
+    for (std::map<int, LLBC_RecvLimitPolicy::Rate>::const_iterator it = policy.opcodeRates.begin();
+         it != policy.opcodeRates.end();
+         ++it)
+    {
+        if (it->second.rate <= 0)
+            continue;
+
+        LLBC_TokenBucketSampler *bucket = LLBC_New(LLBC_TokenBucketSampler);
+        bucket->SetRate(it->second.rate, it->second.burst);
+        _opcodeBuckets.insert(std::make_pair(it->first, bucket));
+    }
+}
+
+LLBC_RecvLimiter::~LLBC_RecvLimiter()
+{
+    LLBC_STLHelper::DeleteContainer(_opcodeBuckets);
+}
+
+int LLBC_RecvLimiter::GetAction() const
+{
+    return _action;
+}
+
+bool LLBC_RecvLimiter::Allow(int opcode)
+{
+    // Check opcode bucket first, only take tokens when both buckets allowed.
+    LLBC_TokenBucketSampler *opcodeBucket = NULL;
+    if (!_opcodeBuckets.empty())
+    {
+        _OpcodeBuckets::iterator it = _opcodeBuckets.find(opcode);
+        if (it != _opcodeBuckets.end())
+        {
+            opcodeBucket = it->second;
+            if (!opcodeBucket->IsAvailable(1))
+                return false;
+        }
+    }
+
+    if (_sessionBucket.Sampling(1) != LLBC_OK)
+        return false;
+
+    if (opcodeBucket)
+        opcodeBucket->Sampling(1);
+
+    return true;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
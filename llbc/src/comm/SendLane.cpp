@@ -0,0 +1,55 @@
+/**
+ * @file    SendLane.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/SendLane.h"
+
+namespace
+{
+    typedef LLBC_NS LLBC_SendPriority This;
+}
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static const LLBC_NS LLBC_String __g_descs[] =
+{
+    "High",
+    "Normal",
+    "Low",
+
+    "Invalid"
+};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+bool LLBC_SendPriority::IsValid(int priority)
+{
+    return priority >= This::Begin && priority < This::End;
+}
+
+const LLBC_String &LLBC_SendPriority::Priority2Str(int priority)
+{
+    return LLBC_INL_NS __g_descs[IsValid(priority) ? priority : This::End];
+}
+
+LLBC_SendLanePolicy::LLBC_SendLanePolicy()
+: weighted(false)
+, lowStaleTimeout(0)
+{
+    for (int priority = LLBC_SendPriority::Begin; priority < LLBC_SendPriority::End; ++priority)
+        weights[priority] = 1;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
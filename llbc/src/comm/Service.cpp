@@ -13,6 +13,7 @@
 #include "llbc/comm/ICoder.h"
 #include "llbc/comm/Packet.h"
 #include "llbc/comm/PollerType.h"
+#include "llbc/comm/Session.h"
 #include "llbc/comm/protocol/IProtocol.h"
 #include "llbc/comm/protocol/IProtocolFilter.h"
 #include "llbc/comm/protocol/ProtocolStack.h"
@@ -27,15 +28,175 @@ namespace
 
 __LLBC_INTERNAL_NS_BEGIN
 
+static LLBC_NS LLBC_ServiceEvent *__BuildLocalSessionCreateEv(int sessionId)
+{
+    LLBC_NS LLBC_SvcEv_SessionCreate *ev = LLBC_New(LLBC_NS LLBC_SvcEv_SessionCreate);
+    ev->isListen = false;
+    ev->sessionId = sessionId;
+    ev->handle = LLBC_INVALID_SOCKET_HANDLE;
+
+    return ev;
+}
+
+static LLBC_NS LLBC_ServiceEvent *__BuildLocalSessionDestroyEv(int sessionId, const char *reason)
+{
+    LLBC_NS LLBC_SvcEv_SessionDestroy *ev = LLBC_New(LLBC_NS LLBC_SvcEv_SessionDestroy);
+    ev->isListen = false;
+    ev->sessionId = sessionId;
+    ev->handle = LLBC_INVALID_SOCKET_HANDLE;
+    ev->closeInfo = LLBC_New1(LLBC_NS LLBC_SessionCloseInfo, const_cast<char *>(reason ? reason : ""));
+
+    return ev;
+}
+
 static void __DeletePacket(void *data)
 {
-    LLBC_Delete(reinterpret_cast<LLBC_NS LLBC_Packet *>(data));
+    // The data is the packet pointer address, packet pointer maybe reset to NULL when packet taken over.
+    LLBC_XDelete(*reinterpret_cast<LLBC_NS LLBC_Packet **>(data));
 }
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT || LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+/**
+ * \brief The packet handle cost recorder, record handle cost when leave scope.
+ */
+class __HandleCostRecorder
+{
+public:
+    explicit __HandleCostRecorder(int opcode)
+    : _opcode(opcode)
+    , _beginTime(LLBC_NS LLBC_GetMonotonicMicroSeconds())
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    , _lock(NULL)
+    , _stats(NULL)
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    , _profiler(NULL)
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    {
+    }
+
+    ~__HandleCostRecorder()
+    {
+        const LLBC_NS sint64 cost = LLBC_NS LLBC_GetMonotonicMicroSeconds() - _beginTime;
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        if (_stats)
+        {
+            // Only service thread update handle stats, lock only when add new opcode stat.
+            std::map<int, LLBC_NS LLBC_OpcodeStat>::iterator it = _stats->find(_opcode);
+            if (UNLIKELY(it == _stats->end()))
+            {
+                LLBC_NS LLBC_LockGuard<LLBC_NS LLBC_AdaptiveLock> guard(*_lock);
+                it = _stats->insert(std::make_pair(_opcode, LLBC_NS LLBC_OpcodeStat())).first;
+                it->second.opcode = _opcode;
+            }
+
+            it->second.handleCost.AtomicAdd(cost);
+        }
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+        if (_profiler)
+            _profiler->AddCost(LLBC_NS LLBC_FrameProfiler::Opcode, _opcode, cost);
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    }
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    void SetStats(LLBC_NS LLBC_AdaptiveLock &lock, std::map<int, LLBC_NS LLBC_OpcodeStat> &stats)
+    {
+        _lock = &lock;
+        _stats = &stats;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    void SetProfiler(LLBC_NS LLBC_FrameProfiler *profiler)
+    {
+        _profiler = profiler;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
+    LLBC_DISABLE_ASSIGNMENT(__HandleCostRecorder);
+
+private:
+    int _opcode;
+    LLBC_NS sint64 _beginTime;
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_NS LLBC_AdaptiveLock *_lock;
+    std::map<int, LLBC_NS LLBC_OpcodeStat> *_stats;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    LLBC_NS LLBC_FrameProfiler *_profiler;
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+};
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT || LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+/**
+ * \brief The service frame phases.
+ */
+struct __FramePhase
+{
+    enum
+    {
+        BeforeFrameTasks,
+        HandleEvents,
+        UpdateFacades,
+        UpdateTimers,
+        UpdateReleasePool,
+        AfterFrameTasks,
+        Idle,
+
+        End
+    };
+};
+
+static const char *__framePhaseNames[__FramePhase::End] =
+{
+    "BeforeFrameTasks",
+    "HandleEvents",
+    "UpdateFacades",
+    "UpdateTimers",
+    "UpdateReleasePool",
+    "AfterFrameTasks",
+    "Idle"
+};
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
 
+/**
+ * \brief The local session link, shared by the two local sessions of two services.
+ *        Link reference held by two services' local session table, link closed when any side
+ *        removed or stopped, after closed, no packet/event will be pushed to any side.
+ */
+struct LLBC_Service::_LocalLink
+{
+    LLBC_AdaptiveLock lock;
+    bool closed;
+    LLBC_Service *svcs[2];
+    int sessionIds[2];
+
+    volatile sint32 refs;
+
+    _LocalLink()
+    : closed(false)
+    , refs(0)
+    {
+        svcs[0] = svcs[1] = NULL;
+        sessionIds[0] = sessionIds[1] = 0;
+    }
+
+    void Release()
+    {
+        if (LLBC_AtomicFetchAndSub(&refs, 1) == 1)
+            delete this;
+    }
+};
+
 int LLBC_Service::_maxId = 1;
 
 LLBC_Service::_EvHandler LLBC_Service::_evHandlers[LLBC_SvcEvType::End] = 
@@ -72,12 +233,26 @@ LLBC_Service::LLBC_Service(This::Type type, const LLBC_String &name)
 , _fps(LLBC_CFG_COMM_DFT_SERVICE_FPS)
 , _frameInterval(1000 / LLBC_CFG_COMM_DFT_SERVICE_FPS)
 , _begHeartbeatTime(0)
+, _begHeartbeatMonoTime(0)
+, _busyPollIdleUSecs(0)
+, _busyPollActiveTime(0)
+, _sendCork(false)
+, _corkedSends(0)
+, _sendLanePolicy(NULL)
+, _opcodeSendPriorities()
+, _recvLimitPolicy(NULL)
 , _sinkIntoLoop(false)
 , _afterStop(false)
 
 , _pollerMgr()
 , _connectedSessionIds()
 , _connectedSessionIdsLock()
+, _localSessions()
+, _localSessionCount(0)
+, _localEvents()
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+, _curFrameArena(0)
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
 #if !LLBC_CFG_COMM_USE_FULL_STACK
 , _stack(LLBC_ProtocolStack::CodecStack)
 #endif
@@ -86,6 +261,9 @@ LLBC_Service::LLBC_Service(This::Type type, const LLBC_String &name)
 , _coders()
 , _handlers()
 , _preHandlers()
+#if LLBC_CFG_COMM_ENABLE_CORO
+, _coroHandlers()
+#endif // LLBC_CFG_COMM_ENABLE_CORO
 #if LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
 , _unifyPreHandler(NULL)
 #endif
@@ -106,6 +284,7 @@ LLBC_Service::LLBC_Service(This::Type type, const LLBC_String &name)
 , _handlingBeforeFrameTasks(false)
 , _handledBeforeFrameTasks(false)
 , _handlingAfterFrameTasks(false)
+, _frameTasksLock()
 
 #if LLBC_CFG_OBJBASE_ENABLED
 , _releasePoolStack(NULL)
@@ -115,17 +294,53 @@ LLBC_Service::LLBC_Service(This::Type type, const LLBC_String &name)
 
 , _evManager()
 
+, _executor()
+#if LLBC_CFG_COMM_ENABLE_CORO
+, _coroScheduler()
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+, _statLock()
+, _handleStats()
+
+, _lastSamplingTime(0)
+, _lastSentBytes(0)
+, _lastRecvedBytes(0)
+, _sentSampler()
+, _recvedSampler()
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+, _slowFrameThreshold(LLBC_CFG_COMM_DFT_SLOW_FRAME_THRESHOLD)
+, _profiler(NULL)
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 , _svcMgr(*LLBC_ServiceMgrSingleton)
 {
     if (_name.empty())
         _name.format("S%d-%s", _id, LLBC_GUIDHelper::GenStr().c_str());
 
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    // Create frame profiler.
+    LLBC_String profilerName;
+    profilerName.format("Service[%s]", _name.c_str());
+    _profiler = LLBC_New3(LLBC_FrameProfiler,
+                          profilerName,
+                          LLBC_INL_NS __framePhaseNames,
+                          LLBC_INL_NS __FramePhase::End);
+    ApplySlowFrameThreshold();
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
     // Get the poller type from Config.h.
     const char *pollerModel = LLBC_CFG_COMM_POLLER_MODEL;
     const int pollerType = LLBC_PollerType::Str2Type(pollerModel);
     ASSERT (LLBC_PollerType::IsValid(pollerType) && "Invalid LLBC_CFG_COMM_POLLER_MODEL config!");
 
     _pollerMgr.SetService(this);
+    _executor.SetService(this);
+#if LLBC_CFG_COMM_ENABLE_CORO
+    _coroScheduler.SetService(this);
+#endif // LLBC_CFG_COMM_ENABLE_CORO
     _pollerMgr.SetPollerType(pollerType);
 
     // Force cleanup _filters array again.
@@ -150,7 +365,12 @@ LLBC_Service::~LLBC_Service()
     DestroyFacades();
     LLBC_STLHelper::DeleteContainer(_coders);
     LLBC_STLHelper::DeleteContainer(_handlers);
+    LLBC_XDelete(_sendLanePolicy);
+    LLBC_XDelete(_recvLimitPolicy);
     LLBC_STLHelper::DeleteContainer(_preHandlers);
+#if LLBC_CFG_COMM_ENABLE_CORO
+    LLBC_STLHelper::DeleteContainer(_coroHandlers);
+#endif // LLBC_CFG_COMM_ENABLE_CORO
 #if LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
     LLBC_XDelete(_unifyPreHandler);
 #endif // LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
@@ -173,6 +393,10 @@ LLBC_Service::~LLBC_Service()
     _handledBeforeFrameTasks = false;
     DestroyFrameTasks(_beforeFrameTasks, _handlingBeforeFrameTasks);
     DestroyFrameTasks(_afterFrameTasks, _handlingAfterFrameTasks);
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    LLBC_XDelete(_profiler);
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
 }
 
 int LLBC_Service::GetId() const
@@ -221,6 +445,42 @@ int LLBC_Service::SetDriveMode(This::DriveMode mode)
     return LLBC_OK;
 }
 
+const LLBC_String &LLBC_Service::GetPollerModel() const
+{
+    return LLBC_PollerType::Type2Str(_pollerMgr.GetPollerType());
+}
+
+int LLBC_Service::SetPollerModel(const LLBC_String &model)
+{
+    const int pollerType = LLBC_PollerType::Str2Type(model);
+    if (!LLBC_PollerType::IsValid(pollerType))
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+
+    // The created sockets already bind to poller type.
+    _connectedSessionIdsLock.Lock();
+    const bool hasSessions = !_connectedSessionIds.empty();
+    _connectedSessionIdsLock.Unlock();
+    if (hasSessions)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return LLBC_FAILED;
+    }
+
+    _pollerMgr.SetPollerType(pollerType);
+
+    return LLBC_OK;
+}
+
 int LLBC_Service::SuppressCoderNotFoundWarning()
 {
     LLBC_Guard guard(_lock);
@@ -237,6 +497,218 @@ int LLBC_Service::SuppressCoderNotFoundWarning()
     return LLBC_OK;
 }
 
+int LLBC_Service::SetThreadPlacement(int numaNode, int svcCPU, int firstPollerCPU)
+{
+    // Candidate CPUs is the node's CPUs, if not limit node, is all CPUs.
+    std::vector<int> cpuNos;
+    if (numaNode >= 0)
+    {
+        if (LLBC_GetNUMANodeCPUs(numaNode, cpuNos) != LLBC_OK)
+            return LLBC_FAILED;
+    }
+    else
+    {
+        numaNode = -1;
+        const int cpuCount = LLBC_GetCPUCount();
+        for (int cpuNo = 0; cpuNo < cpuCount; ++cpuNo)
+            cpuNos.push_back(cpuNo);
+    }
+
+    if (svcCPU >= static_cast<int>(cpuNos.size()) ||
+        firstPollerCPU >= static_cast<int>(cpuNos.size()))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+
+    // Not limit node and not bind CPU, means unbind.
+    const bool floatAll = numaNode < 0;
+    if (svcCPU >= 0)
+        SetCPUAffinity(std::vector<int>(1, cpuNos[svcCPU]));
+    else
+        SetCPUAffinity(floatAll ? std::vector<int>() : cpuNos);
+
+    if (firstPollerCPU >= 0)
+        _pollerMgr.SetThreadPlacement(numaNode, cpuNos, firstPollerCPU);
+    else
+        _pollerMgr.SetThreadPlacement(numaNode, floatAll ? std::vector<int>() : cpuNos, -1);
+
+    return LLBC_OK;
+}
+
+int LLBC_Service::SetBusyPoll(bool enabled, int idleUSecs)
+{
+    if (enabled && idleUSecs <= 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+
+    _busyPollIdleUSecs = enabled ? idleUSecs : 0;
+    _pollerMgr.SetBusyPoll(_busyPollIdleUSecs);
+
+    return LLBC_OK;
+}
+
+bool LLBC_Service::IsBusyPoll() const
+{
+    return _busyPollIdleUSecs > 0;
+}
+
+int LLBC_Service::SetSendCork(bool cork)
+{
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+
+    _sendCork = cork;
+    _pollerMgr.SetSendCork(cork);
+
+    return LLBC_OK;
+}
+
+bool LLBC_Service::IsSendCork() const
+{
+    return _sendCork;
+}
+
+int LLBC_Service::SetSendLanePolicy(const LLBC_SendLanePolicy *policy)
+{
+    if (policy)
+    {
+        if (policy->lowStaleTimeout < 0)
+        {
+            LLBC_SetLastError(LLBC_ERROR_ARG);
+            return LLBC_FAILED;
+        }
+
+        for (int priority = LLBC_SendPriority::Begin; priority < LLBC_SendPriority::End; ++priority)
+        {
+            if (policy->weighted && policy->weights[priority] <= 0)
+            {
+                LLBC_SetLastError(LLBC_ERROR_ARG);
+                return LLBC_FAILED;
+            }
+        }
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+
+    if (!policy)
+    {
+        LLBC_XDelete(_sendLanePolicy);
+    }
+    else
+    {
+        if (!_sendLanePolicy)
+            _sendLanePolicy = LLBC_New(LLBC_SendLanePolicy);
+        *_sendLanePolicy = *policy;
+    }
+
+    _pollerMgr.SetSendLanePolicy(_sendLanePolicy);
+
+    return LLBC_OK;
+}
+
+const LLBC_SendLanePolicy *LLBC_Service::GetSendLanePolicy() const
+{
+    return _sendLanePolicy;
+}
+
+int LLBC_Service::SetOpcodeSendPriority(int opcode, int priority)
+{
+    if (!LLBC_SendPriority::IsValid(priority))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+
+    _opcodeSendPriorities[opcode] = priority;
+
+    return LLBC_OK;
+}
+
+int LLBC_Service::SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy)
+{
+    if (policy)
+    {
+        if (!LLBC_RecvLimitAction::IsValid(policy->action) ||
+            policy->sessionRate.rate < 0 ||
+            policy->sessionRate.burst < 0)
+        {
+            LLBC_SetLastError(LLBC_ERROR_ARG);
+            return LLBC_FAILED;
+        }
+
+        for (std::map<int, LLBC_RecvLimitPolicy::Rate>::const_iterator it = policy->opcodeRates.begin();
+             it != policy->opcodeRates.end();
+             ++it)
+        {
+            if (it->second.rate < 0 || it->second.burst < 0)
+            {
+                LLBC_SetLastError(LLBC_ERROR_ARG);
+                return LLBC_FAILED;
+            }
+        }
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+
+    if (!policy)
+    {
+        LLBC_XDelete(_recvLimitPolicy);
+    }
+    else
+    {
+        if (!_recvLimitPolicy)
+            _recvLimitPolicy = LLBC_New(LLBC_RecvLimitPolicy);
+        *_recvLimitPolicy = *policy;
+    }
+
+    _pollerMgr.SetRecvLimitPolicy(_recvLimitPolicy);
+
+    return LLBC_OK;
+}
+
+const LLBC_RecvLimitPolicy *LLBC_Service::GetRecvLimitPolicy() const
+{
+    return _recvLimitPolicy;
+}
+
 int LLBC_Service::Start(int pollerCount)
 {
     if (pollerCount <= 0)
@@ -349,6 +821,10 @@ int LLBC_Service::SetFPS(int fps)
 
         _fps = fps;
         _frameInterval = 1000 / _fps;
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+        ApplySlowFrameThreshold();
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
         return LLBC_OK;
     }
 
@@ -392,12 +868,134 @@ int LLBC_Service::Connect(const char *ip, uint16 port, double timeout)
     return sessionId;
 }
 
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+int LLBC_Service::ListenUnix(const char *path)
+{
+    LLBC_Guard guard(_lock);
+    const int sessionId = _pollerMgr.ListenUnix(path);
+    if (sessionId != 0)
+    {
+        _connectedSessionIdsLock.Lock();
+        _connectedSessionIds.insert(sessionId);
+        _connectedSessionIdsLock.Unlock();
+    }
+
+    return sessionId;
+}
+
+int LLBC_Service::ConnectUnix(const char *path)
+{
+    LLBC_Guard guard(_lock);
+    const int sessionId = _pollerMgr.ConnectUnix(path);
+    if (sessionId != 0)
+    {
+        _connectedSessionIdsLock.Lock();
+        _connectedSessionIds.insert(sessionId);
+        _connectedSessionIdsLock.Unlock();
+    }
+
+    return sessionId;
+}
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+int LLBC_Service::ListenUdp(const char *ip, uint16 port)
+{
+    LLBC_Guard guard(_lock);
+    const int sessionId = _pollerMgr.ListenUdp(ip, port);
+    if (sessionId != 0)
+    {
+        _connectedSessionIdsLock.Lock();
+        _connectedSessionIds.insert(sessionId);
+        _connectedSessionIdsLock.Unlock();
+    }
+
+    return sessionId;
+}
+
+int LLBC_Service::ConnectUdp(const char *ip, uint16 port)
+{
+    LLBC_Guard guard(_lock);
+    const int sessionId = _pollerMgr.ConnectUdp(ip, port);
+    if (sessionId != 0)
+    {
+        _connectedSessionIdsLock.Lock();
+        _connectedSessionIds.insert(sessionId);
+        _connectedSessionIdsLock.Unlock();
+    }
+
+    return sessionId;
+}
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+int LLBC_Service::AdoptSocket(LLBC_SocketHandle handle)
+{
+    LLBC_Guard guard(_lock);
+    const int sessionId = _pollerMgr.AdoptSocket(handle);
+    if (sessionId != 0)
+    {
+        _connectedSessionIdsLock.Lock();
+        _connectedSessionIds.insert(sessionId);
+        _connectedSessionIdsLock.Unlock();
+    }
+
+    return sessionId;
+}
+
 int LLBC_Service::AsyncConn(const char *ip, uint16 port, double timeout)
 {
     LLBC_Guard guard(_lock);
     return _pollerMgr.AsyncConn(ip, port);
 }
 
+int LLBC_Service::ConnectLocal(LLBC_IService *peer)
+{
+#if LLBC_CFG_COMM_USE_FULL_STACK
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return 0;
+#else // !LLBC_CFG_COMM_USE_FULL_STACK
+    if (UNLIKELY(!peer || peer == this))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return 0;
+    }
+
+    LLBC_Service *peerSvc = static_cast<LLBC_Service *>(peer);
+    if (peerSvc->_type != _type)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return 0;
+    }
+
+    // Lock two services in service Id order, avoid dead lock.
+    LLBC_Service *firstLockSvc = _id < peerSvc->_id ? this : peerSvc;
+    LLBC_Service *secondLockSvc = firstLockSvc == this ? peerSvc : this;
+    LLBC_Guard firstGuard(firstLockSvc->_lock);
+    LLBC_Guard secondGuard(secondLockSvc->_lock);
+    // Stopping service local links will be closed(or already closed) by Cleanup(), don't create new link.
+    if (!_started || _stopping || !peerSvc->_started || peerSvc->_stopping)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return 0;
+    }
+
+    _LocalLink *link = new _LocalLink;
+    link->svcs[0] = this;
+    link->sessionIds[0] = _pollerMgr.AllocSessionId();
+    link->svcs[1] = peerSvc;
+    link->sessionIds[1] = peerSvc->_pollerMgr.AllocSessionId();
+    link->refs = 2;
+
+    // Push session create events before add local session, makesure session create event before any data.
+    for (int side = 0; side < 2; ++side)
+        link->svcs[side]->_localEvents.Push(LLBC_INL_NS __BuildLocalSessionCreateEv(link->sessionIds[side]));
+    for (int side = 0; side < 2; ++side)
+        link->svcs[side]->AddLocalSession(link->sessionIds[side], link);
+
+    return link->sessionIds[0];
+#endif // LLBC_CFG_COMM_USE_FULL_STACK
+}
+
 bool LLBC_Service::IsSessionValidate(int sessionId)
 {
     if (UNLIKELY(sessionId == 0))
@@ -547,7 +1145,7 @@ int LLBC_Service::Broadcast2(int svcId, int opcode, const void *bytes, size_t le
     // Foreach to call internal method LockableSend() method to complete.
     // lock = false
     // validCheck = false
-    LLBC_Guard connSIdsGuard(_connectedSessionIdsLock);
+    LLBC_LockGuard<LLBC_AdaptiveLock> connSIdsGuard(_connectedSessionIdsLock);
     for (LLBC_SessionIdSetCIter sessionIt = _connectedSessionIds.begin();
          sessionIt != _connectedSessionIds.end();
          sessionIt++)
@@ -568,7 +1166,7 @@ int LLBC_Service::RemoveSession(int sessionId, const char *reason)
         return LLBC_FAILED;
     }
 
-    LLBC_Guard connSIdsGuard(_connectedSessionIdsLock);
+    LLBC_LockGuard<LLBC_AdaptiveLock> connSIdsGuard(_connectedSessionIdsLock);
 
     LLBC_SessionIdSetIter sessionIdIt = _connectedSessionIds.find(sessionId);
     if (sessionIdIt == _connectedSessionIds.end())
@@ -577,7 +1175,14 @@ int LLBC_Service::RemoveSession(int sessionId, const char *reason)
         return LLBC_FAILED;
     }
 
-    _pollerMgr.Close(sessionId, reason);
+    // Local session, close local link, local session will be erased when session destroy event handled.
+    _LocalSessions::iterator localIt;
+    if (LLBC_AtomicGet(&_localSessionCount) > 0 &&
+        (localIt = _localSessions.find(sessionId)) != _localSessions.end())
+        CloseLocalLink(localIt->second, reason);
+    else
+        _pollerMgr.Close(sessionId, reason);
+
     _connectedSessionIds.erase(sessionIdIt);
 
     return LLBC_OK;
@@ -683,6 +1288,13 @@ int LLBC_Service::Subscribe(int opcode, LLBC_IDelegate1<LLBC_Packet &> *deleg)
         LLBC_SetLastError(LLBC_ERROR_INVALID);
         return LLBC_FAILED;
     }
+#if LLBC_CFG_COMM_ENABLE_CORO
+    else if (_coroHandlers.find(opcode) != _coroHandlers.end())
+    {
+        LLBC_SetLastError(LLBC_ERROR_REPEAT);
+        return LLBC_FAILED;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_CORO
     else if (!_handlers.insert(std::make_pair(opcode, deleg)).second)
     {
         LLBC_SetLastError(LLBC_ERROR_REPEAT);
@@ -692,6 +1304,37 @@ int LLBC_Service::Subscribe(int opcode, LLBC_IDelegate1<LLBC_Packet &> *deleg)
     return LLBC_OK;
 }
 
+#if LLBC_CFG_COMM_ENABLE_CORO
+int LLBC_Service::SubscribeCoro(int opcode, LLBC_IDelegate1<LLBC_Packet &> *deleg)
+{
+    if (UNLIKELY(!deleg))
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (UNLIKELY(_started))
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_FAILED;
+    }
+    else if (_type == This::Raw && opcode != 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_FAILED;
+    }
+    else if (_handlers.find(opcode) != _handlers.end() ||
+             !_coroHandlers.insert(std::make_pair(opcode, deleg)).second)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REPEAT);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
 int LLBC_Service::PreSubscribe(int opcode, LLBC_IDelegateEx<LLBC_Packet &> *deleg)
 {
     if (UNLIKELY(!deleg))
@@ -861,7 +1504,7 @@ LLBC_ListenerStub LLBC_Service::SubscribeEvent(int event, LLBC_IDelegate1<LLBC_E
     }
 
     const LLBC_ListenerStub stub = LLBC_GUIDHelper::GenStr();
-    Push(LLBC_SvcEvUtil::BuildSubscribeEvEv(event, stub, deleg));
+    Push(LLBC_SvcEvUtil::BuildSubscribeEvEv(event, stub, deleg, GetFrameArena()));
 
     return stub;
 }
@@ -869,18 +1512,18 @@ LLBC_ListenerStub LLBC_Service::SubscribeEvent(int event, LLBC_IDelegate1<LLBC_E
 void LLBC_Service::UnsubscribeEvent(int event)
 {
     Push(LLBC_SvcEvUtil::
-        BuildUnsubscribeEvEv(event, LLBC_INVALID_LISTENER_STUB));
+        BuildUnsubscribeEvEv(event, LLBC_INVALID_LISTENER_STUB, GetFrameArena()));
 }
 
 void LLBC_Service::UnsubscribeEvent(const LLBC_ListenerStub &stub)
 {
     Push(LLBC_SvcEvUtil::
-        BuildUnsubscribeEvEv(0, stub));
+        BuildUnsubscribeEvEv(0, stub, GetFrameArena()));
 }
 
 void LLBC_Service::FireEvent(LLBC_Event *ev)
 {
-    Push(LLBC_SvcEvUtil::BuildFireEvEv(ev));
+    Push(LLBC_SvcEvUtil::BuildFireEvEv(ev, GetFrameArena()));
 }
 
 int LLBC_Service::Post(LLBC_IDelegate1<LLBC_Service::Base *> *deleg)
@@ -891,7 +1534,7 @@ int LLBC_Service::Post(LLBC_IDelegate1<LLBC_Service::Base *> *deleg)
         return LLBC_FAILED;
     }
 
-    LLBC_Guard guard(_lock);
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_frameTasksLock);
     if (UNLIKELY(_handlingBeforeFrameTasks && _handlingAfterFrameTasks))
     {
         LLBC_SetLastError(LLBC_ERROR_UNKNOWN);
@@ -927,6 +1570,94 @@ int LLBC_Service::Post(LLBC_IDelegate1<LLBC_Service::Base *> *deleg)
     return LLBC_OK;
 }
 
+LLBC_IExecutor *LLBC_Service::GetExecutor()
+{
+    return &_executor;
+}
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+LLBC_Packet *LLBC_Service::AwaitReply(int sessionId, int opcode, int timeout)
+{
+    return _coroScheduler.AwaitReply(sessionId, opcode, timeout);
+}
+
+int LLBC_Service::CoroSleep(int milliSeconds)
+{
+    return _coroScheduler.Sleep(milliSeconds);
+}
+
+int LLBC_Service::AwaitFuture(const LLBC_Future &future, int timeout)
+{
+    return _coroScheduler.AwaitFuture(future, timeout);
+}
+
+int LLBC_Service::GetCoroCount() const
+{
+    return _coroScheduler.GetCoroCount();
+}
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+int LLBC_Service::GetStat(LLBC_ServiceStat &stat, bool withSessions)
+{
+    stat.Reset();
+    stat.svcId = _id;
+    stat.svcQueuedEvents = GetMessageSize();
+
+    _pollerMgr.CollectStat(withSessions, stat);
+
+    // Handle stats updated by service thread without lock, copy handle costs atomically.
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_statLock);
+    for (_OpcodeStats::const_iterator it = _handleStats.begin();
+         it != _handleStats.end();
+         it++)
+    {
+        LLBC_OpcodeStat &opStat = stat.opcodeStats[it->first];
+        opStat.opcode = it->first;
+
+        LLBC_CostStat handleCost;
+        it->second.handleCost.AtomicCopyTo(handleCost);
+        opStat.handleCost.Merge(handleCost);
+    }
+
+    stat.sentBytesPerSec = _sentSampler.GetSpeedInSecs(1);
+    stat.recvedBytesPerSec = _recvedSampler.GetSpeedInSecs(1);
+
+    return LLBC_OK;
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+int LLBC_Service::GetSlowFrameThreshold() const
+{
+    This *ncThis = const_cast<This *>(this);
+
+    LLBC_Guard guard(ncThis->_lock);
+    return _slowFrameThreshold;
+}
+
+int LLBC_Service::SetSlowFrameThreshold(int threshold)
+{
+    LLBC_Guard guard(_lock);
+
+    _slowFrameThreshold = threshold;
+    ApplySlowFrameThreshold();
+
+    return LLBC_OK;
+}
+
+int LLBC_Service::GetFrameProfile(LLBC_FrameProfile &profile, bool lastWindow)
+{
+    _profiler->GetProfile(profile, lastWindow);
+    return LLBC_OK;
+}
+
+LLBC_String LLBC_Service::GetLastSlowFrameReport()
+{
+    return _profiler->GetLastSlowFrameReport();
+}
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 void LLBC_Service::OnSvc(bool fullFrame)
 {
     if (UNLIKELY(!_started))
@@ -939,32 +1670,81 @@ void LLBC_Service::OnSvc(bool fullFrame)
 
     _sinkIntoLoop = true;
 
-    // Record begin heartbeat time.
-    _begHeartbeatTime = LLBC_GetMilliSeconds();
+    // Record begin heartbeat time, and refresh process-wide cached time.
+    // Busy poll frame wait measured by monotonic clock, system time step not make it spin/sleep forever.
+    _begHeartbeatTime = LLBC_UpdateCachedMilliSeconds();
+    if (_busyPollIdleUSecs > 0)
+        _begHeartbeatMonoTime = LLBC_GetMonotonicMicroSeconds();
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    _profiler->BeginFrame();
+# define __LLBC_END_FRAME_PHASE(phase) _profiler->EndPhase(LLBC_INL_NS __FramePhase::phase)
+#else // !LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+# define __LLBC_END_FRAME_PHASE(phase)
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
 
     // Handle before frame-tasks.
     HandleFrameTasks(_beforeFrameTasks, _handlingBeforeFrameTasks);
     _handledBeforeFrameTasks = true;
+    __LLBC_END_FRAME_PHASE(BeforeFrameTasks);
 
-    // Process queued events.
+    // Process queued events, in busy poll mode, has queued events means service busy.
+    if (_busyPollIdleUSecs > 0 && HasQueuedEvents())
+        _busyPollActiveTime = LLBC_GetMonotonicMicroSeconds();
     HandleQueuedEvents();
+#if LLBC_CFG_COMM_ENABLE_CORO
+    _coroScheduler.Update();
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+    __LLBC_END_FRAME_PHASE(HandleEvents);
 
     // Update all components.
     UpdateFacades();
+    __LLBC_END_FRAME_PHASE(UpdateFacades);
     UpdateTimers();
+#if LLBC_CFG_COMM_ENABLE_CORO
+    _coroScheduler.Update();
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+    __LLBC_END_FRAME_PHASE(UpdateTimers);
 #if LLBC_CFG_OBJBASE_ENABLED
     UpdateAutoReleasePool();
+    __LLBC_END_FRAME_PHASE(UpdateReleasePool);
 #endif // LLBC_CFG_OBJBASE_ENABLED
 
     // Handle after frame-tasks.
     HandleFrameTasks(_afterFrameTasks, _handlingAfterFrameTasks);
     _handledBeforeFrameTasks = false;
 
+    // Flush this frame corked sends(include other threads' sends after last flush).
+    if (LLBC_AtomicSet(&_corkedSends, 0) != 0)
+        _pollerMgr.FlushSends();
+    __LLBC_END_FRAME_PHASE(AfterFrameTasks);
+
     // Process Idle.
     ProcessIdle();
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    // Update traffic samplers.
+    UpdateSamplers();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    __LLBC_END_FRAME_PHASE(Idle);
+#undef __LLBC_END_FRAME_PHASE
+
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+    // Switch frame arena, the switched to arena allocated events were all handled in this frame, reset it.
+    _curFrameArena ^= 1;
+    _frameArenas[_curFrameArena].Reset();
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    // End frame profile(sleep time not include), slow frame will be reported in EndFrame().
+    _profiler->EndFrame();
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
     // Sleep FrameInterval - ElapsedTime milli-seconds, if need.
-    if (fullFrame)
+    if (fullFrame && _busyPollIdleUSecs > 0)
+    {
+        BusyWaitNextFrame();
+    }
+    else if (fullFrame)
     {
         const sint64 elapsed = LLBC_GetMilliSeconds() - _begHeartbeatTime;
         if (elapsed >= 0 && elapsed < _frameInterval)
@@ -1051,8 +1831,14 @@ void LLBC_Service::Svc()
 
 void LLBC_Service::Cleanup()
 {
-    // Stop poller manager.
+    // Stop poller manager, and close all local sessions.
     _pollerMgr.Stop();
+    CloseLocalSessions();
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+    // Cancel all coroutine handlers, awaiting coroutines will be woken with END error.
+    _coroScheduler.CancelAll();
+#endif // LLBC_CFG_COMM_ENABLE_CORO
 
     // If drivemode is external-drive, cancel all timers first.
     if (_driveMode == This::ExternalDrive)
@@ -1075,6 +1861,18 @@ void LLBC_Service::Cleanup()
     while (TryPop(block) == LLBC_OK)
         LLBC_SvcEvUtil::DestroyEvBlock(block);
 
+    // All local links closed by CloseLocalSessions()(closed link reject SendLocal()), and no new local link
+    // can be created when stopping, so no more local events will be pushed after this final drain.
+    LLBC_ServiceEvent *localEv;
+    while (_localEvents.TryPop(localEv))
+        LLBC_Delete(localEv);
+
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+    // All frame arenas allocated events destroyed, reset arenas.
+    _frameArenas[0].Reset();
+    _frameArenas[1].Reset();
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
     // If is self-drive servie, notify service manager self stopped.
     if (_driveMode == This::SelfDrive)
     {
@@ -1130,13 +1928,23 @@ bool LLBC_Service::IsCanContinueDriveService()
 
 void LLBC_Service::HandleFrameTasks(LLBC_Service::_FrameTasks &tasks, bool &usingFlag)
 {
+    // Tasks maybe posted by other threads(eg: service executor), swap out tasks under lock.
+    _FrameTasks handlingTasks;
+    _frameTasksLock.Lock();
     usingFlag = true;
-    for (_FrameTasks::iterator it = tasks.begin();
-         it != tasks.end();
+    handlingTasks.swap(tasks);
+    _frameTasksLock.Unlock();
+
+    for (_FrameTasks::iterator it = handlingTasks.begin();
+         it != handlingTasks.end();
          it++)
         (*it)->Invoke(this);
 
-    DestroyFrameTasks(tasks, usingFlag);
+    _frameTasksLock.Lock();
+    usingFlag = false;
+    _frameTasksLock.Unlock();
+
+    LLBC_STLHelper::DeleteContainer(handlingTasks, true);
 }
 
 void LLBC_Service::DestroyFrameTasks(_FrameTasks &tasks, bool &usingFlag)
@@ -1160,6 +1968,63 @@ void LLBC_Service::HandleQueuedEvents()
         LLBC_Delete(ev);
         LLBC_Delete(block);
     }
+
+    // Process local sessions events.
+    HandleLocalEvents();
+}
+
+bool LLBC_Service::HasQueuedEvents() const
+{
+    return GetMessageSize() > 0 || !_localEvents.IsEmpty();
+}
+
+LLBC_PoolArena *LLBC_Service::GetFrameArena()
+{
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+    if (!_started || _stopping)
+        return NULL;
+
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+    for (int idx = 0; idx <= LLBC_CFG_COMM_PER_THREAD_DRIVE_MAX_SVC_COUNT; ++idx)
+    {
+        if (tls->commTls.services[idx] == this)
+            return &_frameArenas[_curFrameArena];
+        else if (!tls->commTls.services[idx])
+            break;
+    }
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
+    return NULL;
+}
+
+void LLBC_Service::BusyWaitNextFrame()
+{
+    const sint64 frameEndTime = _begHeartbeatMonoTime + _frameInterval * 1000;
+    while (true)
+    {
+        const sint64 now = LLBC_GetMonotonicMicroSeconds();
+        if (now >= frameEndTime)
+            break;
+
+        // Event arrived, begin next frame immediately.
+        if (HasQueuedEvents())
+        {
+            _busyPollActiveTime = now;
+            break;
+        }
+
+        // Idle too long, fallback to sleep, next frame handled events will switch back to busy polling.
+        if (now - _busyPollActiveTime >= _busyPollIdleUSecs)
+        {
+            const int sleepTime = static_cast<int>((frameEndTime - now) / 1000);
+            if (sleepTime > 0)
+                LLBC_Sleep(sleepTime);
+
+            break;
+        }
+
+        LLBC_CPURelax();
+    }
 }
 
 void LLBC_Service::HandleEv_SessionCreate(LLBC_ServiceEvent &_)
@@ -1191,11 +2056,30 @@ void LLBC_Service::HandleEv_SessionDestroy(LLBC_ServiceEvent &_)
     typedef LLBC_SvcEv_SessionDestroy _Ev;
     _Ev &ev = static_cast<_Ev &>(_);
 
-    // Erase session from connected sessionIds set.
+    // Erase session from connected sessionIds set(and local sessions table, if is local session).
+    _LocalLink *localLink = NULL;
     _connectedSessionIdsLock.Lock();
     _connectedSessionIds.erase(ev.sessionId);
+    if (LLBC_AtomicGet(&_localSessionCount) > 0)
+    {
+        _LocalSessions::iterator localIt = _localSessions.find(ev.sessionId);
+        if (localIt != _localSessions.end())
+        {
+            localLink = localIt->second;
+            _localSessions.erase(localIt);
+            LLBC_AtomicFetchAndSub(&_localSessionCount, 1);
+        }
+    }
     _connectedSessionIdsLock.Unlock();
 
+    if (localLink)
+        localLink->Release();
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+    // Wake the coroutines which awaiting this session's reply.
+    _coroScheduler.OnSessionDestroy(ev.sessionId);
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
     // Build session info.
     LLBC_SessionInfo *sessionInfo = LLBC_New(LLBC_SessionInfo);
     sessionInfo->SetSessionId(ev.sessionId);
@@ -1262,11 +2146,28 @@ void LLBC_Service::HandleEv_DataArrival(LLBC_ServiceEvent &_)
     }
 #endif
 
+#if LLBC_CFG_COMM_ENABLE_CORO
+    // If any coroutine awaiting this packet, dispatch to coroutine.
+    if (_coroScheduler.DispatchReply(packet))
+        return;
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
     // Create invoke-guard to delete packet.
-    LLBC_InvokeGuard delPacketGuard(&LLBC_INL_NS __DeletePacket, packet);
+    LLBC_InvokeGuard delPacketGuard(&LLBC_INL_NS __DeletePacket, &packet);
 
     const int opcode = packet->GetOpcode();
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT || LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    // Create handle-cost recorder, record the cost when packet handled.
+    LLBC_INL_NS __HandleCostRecorder costRecorder(opcode);
+# if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    costRecorder.SetStats(_statLock, _handleStats);
+# endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+# if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    costRecorder.SetProfiler(_profiler);
+# endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT || LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 #if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER || LLBC_CFG_COMM_ENABLE_STATUS_DESC
     const int status = packet->GetStatus();
     if (status != 0)
@@ -1314,6 +2215,19 @@ void LLBC_Service::HandleEv_DataArrival(LLBC_ServiceEvent &_)
     }
 #endif // LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
 
+#if LLBC_CFG_COMM_ENABLE_CORO
+    // Coroutine handler take over the packet.
+    _Handlers::iterator coroIt = _coroHandlers.find(opcode);
+    if (coroIt != _coroHandlers.end())
+    {
+        LLBC_Packet *coroPacket = packet;
+        packet = NULL;
+
+        _coroScheduler.Spawn(coroIt->second, coroPacket);
+        return;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
     _Handlers::iterator it = _handlers.find(opcode);
     if (it != _handlers.end())
     {
@@ -1375,6 +2289,97 @@ void LLBC_Service::HandleEv_FireEv(LLBC_ServiceEvent &_)
     ev.ev = NULL;
 }
 
+void LLBC_Service::AddLocalSession(int sessionId, _LocalLink *link)
+{
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_connectedSessionIdsLock);
+
+    _connectedSessionIds.insert(sessionId);
+    _localSessions.insert(std::make_pair(sessionId, link));
+    LLBC_AtomicFetchAndAdd(&_localSessionCount, 1);
+}
+
+LLBC_Service::_LocalLink *LLBC_Service::RetainLocalLink(int sessionId)
+{
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_connectedSessionIdsLock);
+
+    _LocalSessions::iterator it = _localSessions.find(sessionId);
+    if (it == _localSessions.end())
+        return NULL;
+
+    LLBC_AtomicFetchAndAdd(&it->second->refs, 1);
+
+    return it->second;
+}
+
+int LLBC_Service::SendLocal(_LocalLink *link, LLBC_Packet *packet)
+{
+    link->lock.Lock();
+    if (UNLIKELY(link->closed))
+    {
+        link->lock.Unlock();
+        link->Release();
+
+        LLBC_Delete(packet);
+
+        LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+        return LLBC_FAILED;
+    }
+
+    // Hand over packet to peer service by pointer.
+    const int peerSide = link->svcs[0] == this ? 1 : 0;
+    packet->SetSessionId(link->sessionIds[peerSide]);
+
+    LLBC_SvcEv_DataArrival *ev = LLBC_New(LLBC_SvcEv_DataArrival);
+    ev->packet = packet;
+    link->svcs[peerSide]->_localEvents.Push(ev);
+
+    link->lock.Unlock();
+    link->Release();
+
+    return LLBC_OK;
+}
+
+void LLBC_Service::CloseLocalLink(_LocalLink *link, const char *reason)
+{
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(link->lock);
+    if (link->closed)
+        return;
+
+    // Both sides receive session destroy event.
+    link->closed = true;
+    for (int side = 0; side < 2; ++side)
+        link->svcs[side]->_localEvents.Push(
+            LLBC_INL_NS __BuildLocalSessionDestroyEv(link->sessionIds[side], reason));
+}
+
+void LLBC_Service::CloseLocalSessions()
+{
+    _LocalSessions localSessions;
+
+    _connectedSessionIdsLock.Lock();
+    localSessions.swap(_localSessions);
+    LLBC_AtomicSet(&_localSessionCount, 0);
+    _connectedSessionIdsLock.Unlock();
+
+    for (_LocalSessions::iterator it = localSessions.begin();
+         it != localSessions.end();
+         it++)
+    {
+        CloseLocalLink(it->second, "Service stopped");
+        it->second->Release();
+    }
+}
+
+void LLBC_Service::HandleLocalEvents()
+{
+    LLBC_ServiceEvent *ev;
+    while (_localEvents.TryPop(ev))
+    {
+        (this->*_evHandlers[ev->type])(*ev);
+        LLBC_Delete(ev);
+    }
+}
+
 void LLBC_Service::InitFacades()
 {
     for (_Facades::iterator it = _facades.begin();
@@ -1465,26 +2470,70 @@ void LLBC_Service::GetTimerScheduler()
 
 void LLBC_Service::UpdateTimers()
 {
-    _timerScheduler->Update();
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    // Timer scheduler maybe shared by multi services(ExternalDrive), only profile in this service update.
+    _timerScheduler->SetProfiler(_profiler);
+    _timerScheduler->Update(_begHeartbeatTime);
+    _timerScheduler->SetProfiler(NULL);
+#else // !LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    _timerScheduler->Update(_begHeartbeatTime);
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
 }
 
 void LLBC_Service::ProcessIdle()
 {
+    // Frame elapsed time base on frame begin time, facades' OnIdle() cost measured by cheap coarse clock,
+    // coarse clock maybe lag behind frame begin time less than one kernel tick, treat as not elapsed.
     for (_Facades::iterator it = _facades.begin();
          it != _facades.end();
          it++)
     {
-        sint64 elapsed = LLBC_GetMilliSeconds() - _begHeartbeatTime;
-        if (LIKELY(elapsed >= 0))
-        {
-            if (elapsed >= _frameInterval)
-                break;
+        const sint64 elapsed = MAX(LLBC_GetCoarseMilliSeconds() - _begHeartbeatTime, 0);
+        if (elapsed >= _frameInterval)
+            break;
 
-            (*it)->OnIdle(static_cast<int>(_frameInterval - elapsed));
-        }
+        (*it)->OnIdle(static_cast<int>(_frameInterval - elapsed));
     }
 }
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+void LLBC_Service::UpdateSamplers()
+{
+    const time_t now = static_cast<time_t>(_begHeartbeatTime / 1000);
+    if (now == _lastSamplingTime)
+        return;
+
+    uint64 sentBytes, recvedBytes;
+    _pollerMgr.CollectTraffic(sentBytes, recvedBytes);
+
+    // Poller stats reset when pollers restart, avoid negative sampling value.
+    if (sentBytes < _lastSentBytes || recvedBytes < _lastRecvedBytes)
+        _lastSentBytes = _lastRecvedBytes = 0;
+
+    LLBC_LockGuard<LLBC_AdaptiveLock> guard(_statLock);
+    _sentSampler.Sampling(static_cast<sint64>(sentBytes - _lastSentBytes));
+    _recvedSampler.Sampling(static_cast<sint64>(recvedBytes - _lastRecvedBytes));
+    _sentSampler.Update(now);
+    _recvedSampler.Update(now);
+
+    _lastSamplingTime = now;
+    _lastSentBytes = sentBytes;
+    _lastRecvedBytes = recvedBytes;
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+void LLBC_Service::ApplySlowFrameThreshold()
+{
+    if (_slowFrameThreshold < 0)
+        _profiler->SetSlowFrameThreshold(0);
+    else if (_slowFrameThreshold == 0)
+        _profiler->SetSlowFrameThreshold(_frameInterval * 2);
+    else
+        _profiler->SetSlowFrameThreshold(_slowFrameThreshold);
+}
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
 int LLBC_Service::LockableSend(LLBC_Packet *packet,
                                bool lock,
                                bool validCheck)
@@ -1506,7 +2555,7 @@ int LLBC_Service::LockableSend(LLBC_Packet *packet,
     const int sessionId = packet->GetSessionId();
     if (validCheck)
     {
-        LLBC_Guard connSIdsGuard(_connectedSessionIdsLock);
+        LLBC_LockGuard<LLBC_AdaptiveLock> connSIdsGuard(_connectedSessionIdsLock);
         if (_connectedSessionIds.find(sessionId) == _connectedSessionIds.end())
         {
             if (lock)
@@ -1519,11 +2568,28 @@ int LLBC_Service::LockableSend(LLBC_Packet *packet,
         }
     }
 
+    // Send lanes enabled, not specified send priority packet use opcode send priority.
+    if (_sendLanePolicy &&
+        !_opcodeSendPriorities.empty() &&
+        !LLBC_SendPriority::IsValid(packet->GetSendPriority()))
+    {
+        std::map<int, int>::const_iterator it = _opcodeSendPriorities.find(packet->GetOpcode());
+        if (it != _opcodeSendPriorities.end())
+            packet->SetSendPriority(it->second);
+    }
+
 #if !LLBC_CFG_COMM_USE_FULL_STACK
+    // If is local session, retain the local link before encode.
+    // Local session count read without lock(sender threads), use atomic get pair with AddLocalSession().
+    _LocalLink *localLink = LLBC_AtomicGet(&_localSessionCount) > 0 ? RetainLocalLink(sessionId) : NULL;
+
     bool removeSession;
     LLBC_Packet *encoded;
     if (_stack.SendCodec(packet, encoded, removeSession) != LLBC_OK)
     {
+        if (localLink)
+            localLink->Release();
+
         if (removeSession)
             RemoveSession(sessionId, LLBC_FormatLastError());
 
@@ -1533,13 +2599,17 @@ int LLBC_Service::LockableSend(LLBC_Packet *packet,
         return LLBC_FAILED;
     }
 
-    const int ret = _pollerMgr.Send(encoded);
+    const int ret = localLink ? SendLocal(localLink, encoded) : _pollerMgr.Send(encoded);
+    if (_sendCork && !localLink)
+        LLBC_AtomicSet(&_corkedSends, 1);
     if (lock)
         _lock.Unlock();
 
     return ret;
 #else
     const int ret = _pollerMgr.Send(packet);
+    if (_sendCork)
+        LLBC_AtomicSet(&_corkedSends, 1);
     if (lock)
         _lock.Unlock();
 
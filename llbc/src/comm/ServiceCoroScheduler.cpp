@@ -0,0 +1,420 @@
+/**
+ * @file    ServiceCoroScheduler.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/Packet.h"
+#include "llbc/comm/IService.h"
+#include "llbc/comm/ServiceCoroScheduler.h"
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The coroutine wait timer, wake coroutine when timeout.
+ */
+class LLBC_ServiceCoroScheduler::_WaitTimer : public LLBC_BaseTimer
+{
+public:
+    _WaitTimer()
+    : _scheduler(NULL)
+    , _coroId(0)
+    , _waitId(0)
+    , _result(LLBC_OK)
+    {
+    }
+
+public:
+    void Set(LLBC_ServiceCoroScheduler *scheduler, sint64 coroId, uint32 waitId, int result)
+    {
+        _scheduler = scheduler;
+        _coroId = coroId;
+        _waitId = waitId;
+        _result = result;
+    }
+
+    virtual bool OnTimeout()
+    {
+        // Only mark coroutine woken, coroutine resume in scheduler Update().
+        _scheduler->Wake(_coroId, _waitId, _result, NULL);
+        return false;
+    }
+
+    virtual void OnCancel()
+    {
+    }
+
+private:
+    LLBC_ServiceCoroScheduler *_scheduler;
+    sint64 _coroId;
+    uint32 _waitId;
+    int _result;
+};
+
+/**
+ * \brief The future continuation, wake coroutine when future done(run in service thread).
+ */
+class LLBC_ServiceCoroScheduler::_FutureWaker : public LLBC_IDelegate0
+{
+public:
+    _FutureWaker(LLBC_ServiceCoroScheduler *scheduler, sint64 coroId, uint32 waitId)
+    : _scheduler(scheduler)
+    , _coroId(coroId)
+    , _waitId(waitId)
+    {
+    }
+
+public:
+    virtual void Invoke()
+    {
+        _scheduler->Wake(_coroId, _waitId, LLBC_OK, NULL);
+    }
+
+private:
+    LLBC_ServiceCoroScheduler *_scheduler;
+    sint64 _coroId;
+    uint32 _waitId;
+};
+
+/**
+ * \brief The coroutine context.
+ */
+struct LLBC_ServiceCoroScheduler::_CoroCtx
+{
+    LLBC_Coro *coro;
+    LLBC_IDelegate1<LLBC_Packet &> *handler;
+    LLBC_Packet *packet;
+    std::vector<LLBC_Packet *> replies;
+
+    bool waiting;
+    uint32 waitId;
+    int waitResult;
+    LLBC_Packet *waitReply;
+    _WaitTimer timer;
+
+    _CoroCtx(LLBC_IDelegate1<LLBC_Packet &> *handler, LLBC_Packet *packet)
+    : coro(NULL)
+    , handler(handler)
+    , packet(packet)
+
+    , waiting(false)
+    , waitId(0)
+    , waitResult(LLBC_OK)
+    , waitReply(NULL)
+    {
+    }
+
+    ~_CoroCtx()
+    {
+        timer.Cancel();
+
+        LLBC_XDelete(coro);
+        LLBC_XDelete(packet);
+        for (size_t i = 0; i < replies.size(); ++i)
+            LLBC_Delete(replies[i]);
+    }
+
+    void Run()
+    {
+        handler->Invoke(*packet);
+    }
+};
+
+LLBC_ServiceCoroScheduler::LLBC_ServiceCoroScheduler()
+: _svc(NULL)
+, _cancelling(false)
+, _maxWaitId(0)
+
+, _ctxs()
+, _ready()
+
+, _replyWaiters()
+{
+}
+
+LLBC_ServiceCoroScheduler::~LLBC_ServiceCoroScheduler()
+{
+    CancelAll();
+}
+
+void LLBC_ServiceCoroScheduler::SetService(LLBC_IService *svc)
+{
+    _svc = svc;
+}
+
+int LLBC_ServiceCoroScheduler::GetCoroCount() const
+{
+    return static_cast<int>(_ctxs.size());
+}
+
+int LLBC_ServiceCoroScheduler::Spawn(LLBC_IDelegate1<LLBC_Packet &> *handler, LLBC_Packet *packet)
+{
+    _CoroCtx *ctx = new _CoroCtx(handler, packet);
+    if (UNLIKELY(_cancelling))
+    {
+        delete ctx;
+
+        LLBC_SetLastError(LLBC_ERROR_END);
+        return LLBC_FAILED;
+    }
+
+    ctx->coro = new LLBC_Coro(new LLBC_Delegate0<_CoroCtx>(ctx, &_CoroCtx::Run));
+    _ctxs.insert(std::make_pair(ctx->coro->GetId(), ctx));
+
+    Resume(ctx);
+
+    return LLBC_OK;
+}
+
+bool LLBC_ServiceCoroScheduler::DispatchReply(LLBC_Packet *packet)
+{
+    if (_replyWaiters.empty())
+        return false;
+
+    _ReplyWaiters::iterator it = _replyWaiters.find(
+        _ReplyKey(packet->GetSessionId(), packet->GetOpcode()));
+    if (it == _replyWaiters.end())
+        return false;
+
+    // Wake the first awaiting coroutine(FIFO).
+    bool woken = false;
+    std::deque<_Waiter> &waiters = it->second;
+    while (!woken && !waiters.empty())
+    {
+        const _Waiter waiter = waiters.front();
+        waiters.pop_front();
+
+        woken = Wake(waiter.first, waiter.second, LLBC_OK, packet);
+    }
+
+    if (waiters.empty())
+        _replyWaiters.erase(it);
+
+    return woken;
+}
+
+void LLBC_ServiceCoroScheduler::OnSessionDestroy(int sessionId)
+{
+    if (_replyWaiters.empty())
+        return;
+
+    _ReplyWaiters::iterator it = _replyWaiters.lower_bound(_ReplyKey(sessionId, INT_MIN));
+    while (it != _replyWaiters.end() && it->first.first == sessionId)
+    {
+        std::deque<_Waiter> &waiters = it->second;
+        for (size_t i = 0; i < waiters.size(); ++i)
+            Wake(waiters[i].first, waiters[i].second, LLBC_ERROR_NOT_FOUND, NULL);
+
+        _replyWaiters.erase(it++);
+    }
+}
+
+void LLBC_ServiceCoroScheduler::Update()
+{
+    if (_ready.empty())
+        return;
+
+    // Coroutines woken in resuming will be resumed in next Update() call.
+    std::vector<_CoroCtx *> ready;
+    ready.swap(_ready);
+    for (size_t i = 0; i < ready.size(); ++i)
+        Resume(ready[i]);
+}
+
+void LLBC_ServiceCoroScheduler::CancelAll()
+{
+    _cancelling = true;
+
+    // Wake all awaiting coroutines with END error, and resume until all finished.
+    while (!_ctxs.empty())
+    {
+        for (_Ctxs::iterator it = _ctxs.begin(); it != _ctxs.end(); ++it)
+        {
+            if (it->second->waiting)
+                Wake(it->first, it->second->waitId, LLBC_ERROR_END, NULL);
+        }
+
+        if (_ready.empty())
+            break;
+
+        Update();
+    }
+
+    // Not finished coroutines(normally impossible), force destroy.
+    for (_Ctxs::iterator it = _ctxs.begin(); it != _ctxs.end(); ++it)
+        delete it->second;
+
+    _ctxs.clear();
+    _ready.clear();
+    _replyWaiters.clear();
+
+    _cancelling = false;
+}
+
+LLBC_Packet *LLBC_ServiceCoroScheduler::AwaitReply(int sessionId, int opcode, int timeout)
+{
+    _CoroCtx *ctx = GetCurrentCtx();
+    if (UNLIKELY(!ctx))
+        return NULL;
+
+    const uint32 waitId = ++_maxWaitId;
+    const _ReplyKey key(sessionId, opcode);
+    _replyWaiters[key].push_back(_Waiter(ctx->coro->GetId(), waitId));
+
+    if (Wait(ctx, waitId, timeout, LLBC_ERROR_TIMEOUT) != LLBC_OK)
+    {
+        // Wait failed(timeout or cancelled), remove waiter if still in waiters queue.
+        _ReplyWaiters::iterator it = _replyWaiters.find(key);
+        if (it != _replyWaiters.end())
+        {
+            std::deque<_Waiter> &waiters = it->second;
+            for (std::deque<_Waiter>::iterator waiterIt = waiters.begin();
+                 waiterIt != waiters.end();
+                 ++waiterIt)
+            {
+                if (waiterIt->second == waitId)
+                {
+                    waiters.erase(waiterIt);
+                    break;
+                }
+            }
+
+            if (waiters.empty())
+                _replyWaiters.erase(it);
+        }
+
+        return NULL;
+    }
+
+    LLBC_Packet *reply = ctx->waitReply;
+    ctx->waitReply = NULL;
+    ctx->replies.push_back(reply);
+
+    return reply;
+}
+
+int LLBC_ServiceCoroScheduler::Sleep(int milliSeconds)
+{
+    _CoroCtx *ctx = GetCurrentCtx();
+    if (UNLIKELY(!ctx))
+        return LLBC_FAILED;
+
+    return Wait(ctx, ++_maxWaitId, MAX(milliSeconds, 0), LLBC_OK);
+}
+
+int LLBC_ServiceCoroScheduler::AwaitFuture(const LLBC_Future &future, int timeout)
+{
+    if (UNLIKELY(!future.IsValid()))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    _CoroCtx *ctx = GetCurrentCtx();
+    if (UNLIKELY(!ctx))
+        return LLBC_FAILED;
+
+    if (future.IsDone())
+        return LLBC_OK;
+
+    // Continuation run in service thread(via service executor), then wake coroutine.
+    const uint32 waitId = ++_maxWaitId;
+    _FutureWaker *waker = new _FutureWaker(this, ctx->coro->GetId(), waitId);
+    LLBC_Future awaitFuture(future);
+    if (awaitFuture.Then(waker, _svc->GetExecutor()) != LLBC_OK)
+        return LLBC_FAILED;
+
+    return Wait(ctx, waitId, timeout, LLBC_ERROR_TIMEOUT);
+}
+
+LLBC_ServiceCoroScheduler::_CoroCtx *LLBC_ServiceCoroScheduler::GetCurrentCtx()
+{
+    if (UNLIKELY(_cancelling))
+    {
+        LLBC_SetLastError(LLBC_ERROR_END);
+        return NULL;
+    }
+
+    LLBC_Coro *coro = LLBC_Coro::GetCurrent();
+    _Ctxs::iterator it;
+    if (UNLIKELY(!coro || (it = _ctxs.find(coro->GetId())) == _ctxs.end()))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return NULL;
+    }
+
+    return it->second;
+}
+
+int LLBC_ServiceCoroScheduler::Wait(_CoroCtx *ctx, uint32 waitId, int timeout, int timerResult)
+{
+    ctx->waiting = true;
+    ctx->waitId = waitId;
+    ctx->waitResult = LLBC_OK;
+    ctx->waitReply = NULL;
+
+    if (timeout != LLBC_INFINITE)
+    {
+        ctx->timer.Set(this, ctx->coro->GetId(), ctx->waitId, timerResult);
+        if (ctx->timer.Schedule(MAX(timeout, 0)) != LLBC_OK)
+        {
+            ctx->waiting = false;
+            return LLBC_FAILED;
+        }
+    }
+
+    LLBC_Coro::Yield();
+
+    if (ctx->timer.IsScheduling())
+        ctx->timer.Cancel();
+
+    if (ctx->waitResult != LLBC_OK)
+    {
+        LLBC_SetLastError(ctx->waitResult);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+bool LLBC_ServiceCoroScheduler::Wake(sint64 coroId, uint32 waitId, int result, LLBC_Packet *reply)
+{
+    _Ctxs::iterator it = _ctxs.find(coroId);
+    if (it == _ctxs.end() ||
+        !it->second->waiting ||
+        it->second->waitId != waitId)
+        return false;
+
+    _CoroCtx *ctx = it->second;
+    ctx->waiting = false;
+    ctx->waitResult = result;
+    ctx->waitReply = reply;
+
+    _ready.push_back(ctx);
+
+    return true;
+}
+
+void LLBC_ServiceCoroScheduler::Resume(_CoroCtx *ctx)
+{
+    ctx->coro->Resume();
+    if (ctx->coro->GetState() == LLBC_Coro::Finished)
+    {
+        _ctxs.erase(ctx->coro->GetId());
+        delete ctx;
+    }
+}
+
+__LLBC_NS_END
+
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+#include "llbc/common/AfterIncl.h"
@@ -31,6 +31,39 @@ namespace
 
         return block;
     }
+
+    template <typename Ev>
+    static Ev *__CreateEv(LLBC_NS LLBC_PoolArena *arena)
+    {
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+        if (arena)
+            return new (*arena) Ev;
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
+        return LLBC_New(Ev);
+    }
+
+    template <typename Ev>
+    static _Block *__CreateEvBlock(Ev *ev, LLBC_NS LLBC_PoolArena *arena)
+    {
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+        if (arena)
+        {
+            // Block buffer attached, will not free when block destroy.
+            void *buf = arena->Alloc(sizeof(int) + sizeof(Ev *));
+            if (LIKELY(buf))
+            {
+                _Block *block = new (*arena) _Block(buf, sizeof(int) + sizeof(Ev *));
+                block->Write(&ev->type, sizeof(int));
+                block->Write(&ev, sizeof(Ev *));
+
+                return block;
+            }
+        }
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
+        return __CreateEvBlock(ev);
+    }
 }
 
 __LLBC_NS_BEGIN
@@ -216,37 +249,40 @@ LLBC_MessageBlock *LLBC_SvcEvUtil::BuildProtoReportEv(int sessionId,
 
 LLBC_MessageBlock *LLBC_SvcEvUtil::BuildSubscribeEvEv(int id,
                                                       const LLBC_String &stub,
-                                                      LLBC_IDelegate1<LLBC_Event *> *deleg)
+                                                      LLBC_IDelegate1<LLBC_Event *> *deleg,
+                                                      LLBC_PoolArena *arena)
 {
     typedef LLBC_SvcEv_SubscribeEv _Ev;
 
-    _Ev *ev = LLBC_New(_Ev);
+    _Ev *ev = __CreateEv<_Ev>(arena);
     ev->id = id;
     ev->stub.append(stub);
     ev->deleg = deleg;
 
-    return __CreateEvBlock(ev);
+    return __CreateEvBlock(ev, arena);
 }
 
-LLBC_MessageBlock *LLBC_SvcEvUtil::BuildUnsubscribeEvEv(int id, const LLBC_String &stub)
+LLBC_MessageBlock *LLBC_SvcEvUtil::BuildUnsubscribeEvEv(int id,
+                                                        const LLBC_String &stub,
+                                                        LLBC_PoolArena *arena)
 {
     typedef LLBC_SvcEv_UnsubscribeEv _Ev;
 
-    _Ev *ev = LLBC_New(_Ev);
+    _Ev *ev = __CreateEv<_Ev>(arena);
     ev->id = id;
     ev->stub.append(stub);
 
-    return __CreateEvBlock(ev);
+    return __CreateEvBlock(ev, arena);
 }
 
-LLBC_MessageBlock *LLBC_SvcEvUtil::BuildFireEvEv(LLBC_Event *ev)
+LLBC_MessageBlock *LLBC_SvcEvUtil::BuildFireEvEv(LLBC_Event *ev, LLBC_PoolArena *arena)
 {
     typedef LLBC_SvcEv_FireEv _Ev;
 
-    _Ev *wrapEv = LLBC_New(_Ev);
+    _Ev *wrapEv = __CreateEv<_Ev>(arena);
     wrapEv->ev = ev;
 
-    return __CreateEvBlock(wrapEv);
+    return __CreateEvBlock(wrapEv, arena);
 }
 
 void LLBC_SvcEvUtil::DestroyEvBlock(LLBC_MessageBlock *block)
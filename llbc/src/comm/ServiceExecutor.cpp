@@ -0,0 +1,82 @@
+/**
+ * @file    ServiceExecutor.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/IService.h"
+#include "llbc/comm/ServiceExecutor.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+/**
+ * \brief The executor task adapter, adapt executor task to service post delegate.
+ */
+class __ExecutorTask : public LLBC_NS LLBC_IDelegate1<LLBC_NS LLBC_IService *>
+{
+public:
+    explicit __ExecutorTask(LLBC_NS LLBC_IDelegate0 *task)
+    : _task(task)
+    {
+    }
+
+    virtual ~__ExecutorTask()
+    {
+        delete _task;
+    }
+
+public:
+    virtual void Invoke(LLBC_NS LLBC_IService *svc)
+    {
+        _task->Invoke();
+    }
+
+private:
+    LLBC_NS LLBC_IDelegate0 *_task;
+};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_ServiceExecutor::LLBC_ServiceExecutor()
+: _svc(NULL)
+{
+}
+
+LLBC_ServiceExecutor::~LLBC_ServiceExecutor()
+{
+}
+
+void LLBC_ServiceExecutor::SetService(LLBC_IService *svc)
+{
+    _svc = svc;
+}
+
+int LLBC_ServiceExecutor::Execute(LLBC_IDelegate0 *task)
+{
+    if (UNLIKELY(!task))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    LLBC_INL_NS __ExecutorTask *executorTask = new LLBC_INL_NS __ExecutorTask(task);
+    if (_svc->Post(executorTask) != LLBC_OK)
+    {
+        delete executorTask;
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
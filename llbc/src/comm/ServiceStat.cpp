@@ -0,0 +1,97 @@
+/**
+ * @file    ServiceStat.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/ServiceStat.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_SessionStat::LLBC_SessionStat()
+: sessionId(0)
+
+, sentBytes(0)
+, sentPackets(0)
+, sendCalls(0)
+, sendDroppedPackets(0)
+
+, recvedBytes(0)
+, recvedPackets(0)
+, recvCalls(0)
+, recvLimitedPackets(0)
+, recvDroppedPackets(0)
+
+, pendingSendBytes(0)
+{
+}
+
+void LLBC_SessionStat::Merge(const LLBC_SessionStat &other)
+{
+    sentBytes += other.sentBytes;
+    sentPackets += other.sentPackets;
+    sendCalls += other.sendCalls;
+    sendDroppedPackets += other.sendDroppedPackets;
+
+    recvedBytes += other.recvedBytes;
+    recvedPackets += other.recvedPackets;
+    recvCalls += other.recvCalls;
+    recvLimitedPackets += other.recvLimitedPackets;
+    recvDroppedPackets += other.recvDroppedPackets;
+
+    pendingSendBytes += other.pendingSendBytes;
+}
+
+LLBC_OpcodeStat::LLBC_OpcodeStat()
+: opcode(0)
+
+, sentBytes(0)
+, sentPackets(0)
+, recvedBytes(0)
+, recvedPackets(0)
+
+, handleCost()
+{
+}
+
+void LLBC_OpcodeStat::Merge(const LLBC_OpcodeStat &other)
+{
+    sentBytes += other.sentBytes;
+    sentPackets += other.sentPackets;
+    recvedBytes += other.recvedBytes;
+    recvedPackets += other.recvedPackets;
+
+    handleCost.Merge(other.handleCost);
+}
+
+LLBC_ServiceStat::LLBC_ServiceStat()
+{
+    Reset();
+}
+
+void LLBC_ServiceStat::Reset()
+{
+    svcId = 0;
+
+    total = LLBC_SessionStat();
+    sessionCount = 0;
+
+    sentBytesPerSec = 0;
+    recvedBytesPerSec = 0;
+
+    svcQueuedEvents = 0;
+    pollerQueuedEvents = 0;
+
+    opcodeStats.clear();
+    sessionStats.clear();
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -16,7 +16,9 @@
 #include "llbc/comm/Socket.h"
 #include "llbc/comm/Session.h"
 #include "llbc/comm/BasePoller.h"
+#include "llbc/comm/PollerStat.h"
 #include "llbc/comm/PollerType.h"
+#include "llbc/comm/RecvLimit.h"
 #include "llbc/comm/ServiceEvent.h"
 #include "llbc/comm/IService.h"
 
@@ -96,6 +98,18 @@ LLBC_Session::LLBC_Session()
 , _poller(NULL)
 
 , _protoStack(NULL)
+
+, _sendCorked(false)
+, _corkedSize(0)
+
+, _recvLimiter(NULL)
+, _delayedPackets()
+, _recvPaused(false)
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+, _pollerStat(NULL)
+, _stat(NULL)
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 {
 }
 
@@ -103,6 +117,9 @@ LLBC_Session::~LLBC_Session()
 {
     LLBC_XDelete(_socket);
     LLBC_XDelete(_protoStack);
+
+    LLBC_XDelete(_recvLimiter);
+    LLBC_STLHelper::DeleteContainer(_delayedPackets);
 }
 
 int LLBC_Session::GetId() const
@@ -168,8 +185,76 @@ void LLBC_Session::SetPoller(LLBC_BasePoller *poller)
     _poller = poller;
 }
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+void LLBC_Session::SetStat(LLBC_PollerStat *pollerStat, LLBC_SessionStat *stat)
+{
+    _pollerStat = pollerStat;
+    _stat = stat;
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+bool LLBC_Session::IsSendCorked() const
+{
+    return _sendCorked;
+}
+
+void LLBC_Session::SetSendCorked(bool corked)
+{
+    _sendCorked = corked;
+}
+
+size_t LLBC_Session::GetCorkedSize() const
+{
+    return _corkedSize;
+}
+
+void LLBC_Session::ResetCorkedSize()
+{
+    _corkedSize = 0;
+}
+
+void LLBC_Session::SetRecvLimitPolicy(const LLBC_RecvLimitPolicy *policy)
+{
+    LLBC_XDelete(_recvLimiter);
+    if (!policy)
+        return;
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    // Datagram session share listen socket or not stream, can't pause reading.
+    _recvLimiter = new LLBC_RecvLimiter(*policy, !_socket->IsDatagram());
+#else // !LLBC_CFG_COMM_ENABLE_UDP
+    _recvLimiter = new LLBC_RecvLimiter(*policy, true);
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+}
+
+bool LLBC_Session::IsRecvPaused() const
+{
+    return _recvPaused;
+}
+
+bool LLBC_Session::ReleaseDelayedPackets()
+{
+    while (!_delayedPackets.empty())
+    {
+        LLBC_Packet *packet = _delayedPackets.front();
+        if (!_recvLimiter->Allow(packet->GetOpcode()))
+            return false;
+
+        _delayedPackets.pop_front();
+        _svc->Push(LLBC_SvcEvUtil::BuildDataArrivalEv(packet));
+    }
+
+    _recvPaused = false;
+    return true;
+}
+
 int LLBC_Session::Send(LLBC_Packet *packet)
 {
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    const int opcode = packet->GetOpcode();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    const int priority = packet->GetSendPriority();
+
     bool removeSession;
     LLBC_MessageBlock *block;
 #if LLBC_CFG_COMM_USE_FULL_STACK
@@ -179,19 +264,62 @@ int LLBC_Session::Send(LLBC_Packet *packet)
 #endif
         return removeSession ? LLBC_FAILED : LLBC_OK;
 
-    return Send(block);
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (_stat)
+        _pollerStat->OnPacketSent(_stat, opcode, block->GetReadableSize());
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    return Send(block, LLBC_SendPriority::IsValid(priority) ? priority : LLBC_SendPriority::Normal);
 }
 
-int LLBC_Session::Send(LLBC_MessageBlock *block)
+int LLBC_Session::Send(LLBC_MessageBlock *block, int priority)
 {
-    if (_socket->AsyncSend(block) != LLBC_OK)
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    const size_t len = block->GetReadableSize();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    // Datagram session: batch send by poller, datagram lost is not a session error.
+    if (_socket->IsDatagram())
+    {
+        _poller->SendDatagram(this, block);
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        if (_stat)
+        {
+            _pollerStat->OnWillSend(_stat, len);
+            _pollerStat->OnSent(_stat, len);
+        }
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+        return LLBC_OK;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+    const size_t blockSize = block->GetReadableSize();
+    if (_socket->AsyncSend(block, priority) != LLBC_OK)
         return LLBC_FAILED;
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (_stat)
+        _pollerStat->OnWillSend(_stat, len);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    // Corked session only append data, poller will flush it.
+    if (_sendCorked)
+    {
+        _corkedSize += blockSize;
+        return LLBC_OK;
+    }
+
     // In LINUX or ANDROID platform, if use EPOLL ET mode, we must force call OnSend() one time.
 #if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
     if (_pollerType == LLBC_PollerType::EpollPoller)
         OnSend();
 #endif
+    // If use POLL poller, only wait writable when has remain data, so try send first too.
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    if (_pollerType == LLBC_PollerType::PollPoller)
+        OnSend();
+#endif
 
     return LLBC_OK;
 }
@@ -251,12 +379,27 @@ void LLBC_Session::OnClose(LLBC_SessionCloseInfo *closeInfo)
 
 void LLBC_Session::OnSent(size_t len)
 {
-    // TODO: For support sampler, do stuff here.
-    // ... ...
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (_stat)
+        _pollerStat->OnSent(_stat, len);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+}
+
+void LLBC_Session::OnSendDropped(int packets, size_t len)
+{
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (_stat)
+        _pollerStat->OnSendDropped(_stat, packets, len);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 }
 
 bool LLBC_Session::OnRecved(LLBC_MessageBlock *block)
 {
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (_stat)
+        _pollerStat->OnRecved(_stat, block->GetReadableSize());
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
     bool removeSession;
     std::vector<LLBC_Packet *> packets;
 #if LLBC_CFG_COMM_USE_FULL_STACK
@@ -279,12 +422,95 @@ bool LLBC_Session::OnRecved(LLBC_MessageBlock *block)
         packet->SetLocalAddr(_socket->GetLocalAddress());
         packet->SetPeerAddr(_socket->GetPeerAddress());
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        if (_stat)
+            _pollerStat->OnPacketRecved(_stat, packet->GetOpcode(), packet->GetLength());
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+        if (!_recvLimiter)
+        {
+            _svc->Push(LLBC_SvcEvUtil::BuildDataArrivalEv(packet));
+            continue;
+        }
+
+        if (!LimitRecv(packet))
+        {
+            for (++i; i < packets.size(); ++i)
+                LLBC_Delete(packets[i]);
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool LLBC_Session::LimitRecv(LLBC_Packet *packet)
+{
+    // If exist delayed packets, keep packets order, delay it too.
+    if (_delayedPackets.empty() && _recvLimiter->Allow(packet->GetOpcode()))
+    {
         _svc->Push(LLBC_SvcEvUtil::BuildDataArrivalEv(packet));
+        return true;
+    }
+
+    const int action = _recvLimiter->GetAction();
+    if (action == LLBC_RecvLimitAction::Delay &&
+        _delayedPackets.size() < LLBC_CFG_COMM_RECV_LIMIT_MAX_DELAYED_PACKETS)
+    {
+        _delayedPackets.push_back(packet);
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        if (_stat)
+            _pollerStat->OnRecvLimited(_stat, false);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+        // Pause reading, let peer blocked by tcp flow control, poller will resume it after delayed packets released.
+        if (!_recvPaused)
+        {
+            _recvPaused = true;
+            _poller->PauseSessionRecv(this);
+        }
+
+        return true;
+    }
+
+    LLBC_Delete(packet);
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (_stat)
+        _pollerStat->OnRecvLimited(_stat, true);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    if (action == LLBC_RecvLimitAction::Disconnect)
+    {
+#if LLBC_TARGET_PLATFORM_WIN32
+        OnClose(NULL, new LLBC_SessionCloseInfo(LLBC_ERROR_LIMIT, 0));
+#else
+        OnClose(new LLBC_SessionCloseInfo(LLBC_ERROR_LIMIT, 0));
+#endif // LLBC_TARGET_PLATFORM_WIN32
+        return false;
     }
 
     return true;
 }
 
+#if LLBC_CFG_COMM_ENABLE_UDP
+bool LLBC_Session::OnDatagramRecved(LLBC_MessageBlock *block)
+{
+    // Datagram preserve message boundary, the previous datagram's remain data never complete.
+    _protoStack->DiscardIncompleteData();
+
+    return OnRecved(block);
+}
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+void LLBC_Session::OnSysCalls(int sendCalls, int recvCalls)
+{
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (_stat)
+        _pollerStat->OnSysCalls(_stat, sendCalls, recvCalls);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
@@ -23,6 +23,13 @@ namespace
 
 __LLBC_INTERNAL_NS_BEGIN
 
+// The send flags, avoid SIGPIPE when peer closed connection(eg: session disconnected by peer receive rate limit).
+#ifdef MSG_NOSIGNAL
+static const int __sendFlags = MSG_NOSIGNAL;
+#else
+static const int __sendFlags = 0;
+#endif
+
 void __OnOverlappedDelHook(void *data)
 {
     if (data)
@@ -46,10 +53,19 @@ LLBC_Socket::LLBC_Socket(LLBC_SocketHandle handle)
 , _pollerType(_PollerType::End)
 
 , _listenSocket(false)
+, _unixSocket(false)
+#if LLBC_CFG_COMM_ENABLE_UDP
+, _datagram(false)
+, _datagramPeer(false)
+#endif // LLBC_CFG_COMM_ENABLE_UDP
 , _peerAddr()
 , _localAddr()
 
 , _willSend()
+
+, _lanePolicy(NULL)
+, _lanes(NULL)
+, _sendCongested(false)
 #if LLBC_TARGET_PLATFORM_WIN32
 , _nonBlocking(false)
 , _olGroup()
@@ -58,6 +74,8 @@ LLBC_Socket::LLBC_Socket(LLBC_SocketHandle handle)
     if (_handle == LLBC_INVALID_SOCKET_HANDLE)
         _handle = LLBC_CreateTcpSocket();
 
+    LLBC_MemSet(_laneDeficits, 0, sizeof(_laneDeficits));
+
 #if LLBC_TARGET_PLATFORM_WIN32
     _olGroup.SetDeleteDataProc(&LLBC_INL_NS __OnOverlappedDelHook);
 #endif
@@ -66,6 +84,18 @@ LLBC_Socket::LLBC_Socket(LLBC_SocketHandle handle)
 LLBC_Socket::~LLBC_Socket()
 {
     Close();
+
+    if (_lanes)
+    {
+        for (int priority = LLBC_SendPriority::Begin; priority < LLBC_SendPriority::End; ++priority)
+        {
+            _SendLane &lane = _lanes[priority];
+            for (_SendLane::iterator it = lane.begin(); it != lane.end(); ++it)
+                LLBC_Delete(it->block);
+        }
+
+        LLBC_Deletes(_lanes);
+    }
 }
 
 void LLBC_Socket::SetSession(LLBC_Session *session)
@@ -78,6 +108,19 @@ int LLBC_Socket::GetPollerType() const
     return _pollerType;
 }
 
+void LLBC_Socket::SetSendLanePolicy(const LLBC_SendLanePolicy *policy)
+{
+    // Must set before send any data, lanes not destroy until socket destroy.
+    _lanePolicy = policy;
+    if (_lanePolicy && !_lanes)
+        _lanes = new _SendLane[LLBC_SendPriority::End];
+}
+
+void LLBC_Socket::SetSendCongested(bool congested)
+{
+    _sendCongested = congested;
+}
+
 void LLBC_Socket::SetPollerType(int type)
 {
     _pollerType = type;
@@ -88,6 +131,53 @@ LLBC_SocketHandle LLBC_Socket::Handle()
     return _handle;
 }
 
+bool LLBC_Socket::IsUnixSocket() const
+{
+    return _unixSocket;
+}
+
+void LLBC_Socket::SetUnixSocket(bool unixSocket)
+{
+    _unixSocket = unixSocket;
+    if (_unixSocket)
+        _localAddr = _peerAddr = LLBC_SockAddr_IN(AF_UNIX, "0.0.0.0", 0);
+}
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+bool LLBC_Socket::IsDatagram() const
+{
+    return _datagram;
+}
+
+void LLBC_Socket::SetDatagram(bool datagram)
+{
+    _datagram = datagram;
+}
+
+bool LLBC_Socket::IsDatagramPeer() const
+{
+    return _datagramPeer;
+}
+
+LLBC_Socket *LLBC_Socket::CreateDatagramPeer(const LLBC_SockAddr_IN &peer)
+{
+    if (UNLIKELY(!_datagram || !_listenSocket))
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return NULL;
+    }
+
+    LLBC_Socket *peerSocket = LLBC_New1(LLBC_Socket, _handle);
+    peerSocket->_pollerType = _pollerType;
+    peerSocket->_datagram = true;
+    peerSocket->_datagramPeer = true;
+    peerSocket->_localAddr = _localAddr;
+    peerSocket->_peerAddr = peer;
+
+    return peerSocket;
+}
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
 int LLBC_Socket::ShutdownInput()
 {
     return LLBC_ShutdownSocketInput(_handle);
@@ -110,6 +200,13 @@ int LLBC_Socket::Close()
         LLBC_SetLastError(LLBC_ERROR_NOT_OPEN);
         return LLBC_FAILED;
     }
+#if LLBC_CFG_COMM_ENABLE_UDP
+    else if (_datagramPeer) // Datagram peer socket not own the handle.
+    {
+        _handle = LLBC_INVALID_SOCKET_HANDLE;
+        return LLBC_OK;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_UDP
     else if (LLBC_CloseSocket(_handle) != LLBC_OK)
         return LLBC_FAILED;
 
@@ -207,6 +304,14 @@ int LLBC_Socket::BindTo(const LLBC_SockAddr_IN &addr)
 
 int LLBC_Socket::Listen(int backlog)
 {
+#if LLBC_CFG_COMM_ENABLE_UDP
+    if (_datagram)
+    {
+        _listenSocket = true;
+        return LLBC_OK;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
     if (LLBC_ListenForConnection(_handle, backlog) != LLBC_OK)
         return LLBC_FAILED;
 
@@ -221,12 +326,14 @@ bool LLBC_Socket::IsListen() const
 
 LLBC_Socket *LLBC_Socket::Accept()
 {
-    LLBC_SocketHandle newHandle = LLBC_AcceptClient(_handle, &_peerAddr);
+    LLBC_SocketHandle newHandle = LLBC_AcceptClient(_handle, _unixSocket ? NULL : &_peerAddr);
     if (newHandle == LLBC_INVALID_SOCKET_HANDLE)
         return NULL;
 
     LLBC_Socket *newSocket = LLBC_New1(LLBC_Socket, newHandle);
     newSocket->_pollerType = _pollerType;
+    if (_unixSocket)
+        newSocket->SetUnixSocket(true);
 
     return newSocket;
 }
@@ -260,6 +367,18 @@ int LLBC_Socket::Connect(const LLBC_SockAddr_IN &addr)
     return LLBC_OK;
 }
 
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+int LLBC_Socket::BindTo(const char *path)
+{
+    return LLBC_BindToUnixPath(_handle, path);
+}
+
+int LLBC_Socket::Connect(const char *path)
+{
+    return LLBC_ConnectToUnixPath(_handle, path);
+}
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
 #if LLBC_TARGET_PLATFORM_WIN32
 int LLBC_Socket::ConnectEx(const LLBC_SockAddr_IN &addr, LLBC_POverlapped ol)
 {
@@ -292,8 +411,23 @@ int LLBC_Socket::AsyncSend(const char *buf, int len)
     return AsyncSend(block);
 }
 
-int LLBC_Socket::AsyncSend(LLBC_MessageBlock *block)
+int LLBC_Socket::AsyncSend(LLBC_MessageBlock *block, int priority)
 {
+    // Send lanes enabled, queue to priority lane, will schedule to send queue when send queue empty.
+    if (_lanePolicy)
+    {
+        if (!LLBC_SendPriority::IsValid(priority))
+            priority = LLBC_SendPriority::Normal;
+
+        _SendLaneEntry entry;
+        entry.block = block;
+        entry.enqueueTime = priority == LLBC_SendPriority::Low && _lanePolicy->lowStaleTimeout > 0 ?
+            LLBC_GetCoarseMonotonicMilliSeconds() : 0;
+        _lanes[priority].push_back(entry);
+
+        return LLBC_OK;
+    }
+
     if (_willSend.Append(block) != LLBC_OK)
     {
         LLBC_XDelete(block);
@@ -345,7 +479,120 @@ int LLBC_Socket::AsyncSend(LLBC_MessageBlock *block)
 
 bool LLBC_Socket::IsExistNoSendData() const
 {
-    return !!_willSend.FirstBlock();
+    if (_willSend.FirstBlock())
+        return true;
+
+    if (_lanePolicy)
+    {
+        for (int priority = LLBC_SendPriority::Begin; priority < LLBC_SendPriority::End; ++priority)
+        {
+            if (!_lanes[priority].empty())
+                return true;
+        }
+    }
+
+    return false;
+}
+
+LLBC_MessageBlock *LLBC_Socket::DetachNoSendData()
+{
+    FirstSendBlock();
+    return _willSend.MergeBuffersAndDetach();
+}
+
+LLBC_MessageBlock *LLBC_Socket::FirstSendBlock()
+{
+    LLBC_MessageBlock *block = _willSend.FirstBlock();
+    if (!block && _lanePolicy)
+    {
+        ScheduleSendLanes();
+        block = _willSend.FirstBlock();
+    }
+
+    return block;
+}
+
+void LLBC_Socket::ScheduleSendLanes()
+{
+    if (_sendCongested && _lanePolicy->lowStaleTimeout > 0)
+        DropStaleSendLaneData();
+
+    size_t scheduled = 0;
+    if (!_lanePolicy->weighted)
+    {
+        // Strict priority, always drain higher priority lane first.
+        for (int priority = LLBC_SendPriority::Begin;
+             priority < LLBC_SendPriority::End && scheduled < LLBC_CFG_COMM_SEND_LANE_ROUND_SIZE;
+             ++priority)
+        {
+            _SendLane &lane = _lanes[priority];
+            while (!lane.empty() && scheduled < LLBC_CFG_COMM_SEND_LANE_ROUND_SIZE)
+            {
+                LLBC_MessageBlock *block = lane.front().block;
+                lane.pop_front();
+
+                scheduled += block->GetReadableSize();
+                _willSend.Append(block);
+            }
+        }
+
+        return;
+    }
+
+    // Weighted, deficit round robin, lane unused deficit carry to next round until lane empty.
+    bool pending = true;
+    while (pending && scheduled < LLBC_CFG_COMM_SEND_LANE_ROUND_SIZE)
+    {
+        pending = false;
+        for (int priority = LLBC_SendPriority::Begin; priority < LLBC_SendPriority::End; ++priority)
+        {
+            _SendLane &lane = _lanes[priority];
+            if (lane.empty())
+                continue;
+
+            size_t &deficit = _laneDeficits[priority];
+            deficit += MAX(1, _lanePolicy->weights[priority]) * LLBC_CFG_COMM_SEND_LANE_QUANTUM;
+            while (!lane.empty())
+            {
+                LLBC_MessageBlock *block = lane.front().block;
+                const size_t blockSize = block->GetReadableSize();
+                if (blockSize > deficit)
+                    break;
+
+                lane.pop_front();
+
+                deficit -= blockSize;
+                scheduled += blockSize;
+                _willSend.Append(block);
+            }
+
+            if (lane.empty())
+                deficit = 0;
+            else
+                pending = true;
+        }
+    }
+}
+
+void LLBC_Socket::DropStaleSendLaneData()
+{
+    int droppedPackets = 0;
+    size_t droppedLen = 0;
+
+    _SendLane &lane = _lanes[LLBC_SendPriority::Low];
+    const sint64 expireTime = LLBC_GetCoarseMonotonicMilliSeconds() - _lanePolicy->lowStaleTimeout;
+    while (!lane.empty() && lane.front().enqueueTime <= expireTime)
+    {
+        LLBC_MessageBlock *block = lane.front().block;
+        lane.pop_front();
+
+        ++droppedPackets;
+        droppedLen += block->GetReadableSize();
+        LLBC_Delete(block);
+    }
+
+    if (droppedPackets > 0)
+        _session->OnSendDropped(droppedPackets, droppedLen);
 }
 
 int LLBC_Socket::Recv(char *buf, int len)
@@ -355,6 +602,9 @@ int LLBC_Socket::Recv(char *buf, int len)
 
 int LLBC_Socket::UpdateLocalAddress()
 {
+    if (_unixSocket)
+        return LLBC_OK;
+
     return LLBC_GetSocketName(_handle, _localAddr);
 }
 
@@ -375,6 +625,9 @@ uint16 LLBC_Socket::GetLocalPort() const
 
 int LLBC_Socket::UpdatePeerAddress()
 {
+    if (_unixSocket)
+        return LLBC_OK;
+
     return LLBC_GetPeerSocketName(_handle, _peerAddr);
 }
 
@@ -425,10 +678,38 @@ void LLBC_Socket::OnSend()
     }
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
-    int len = 0, totalLen = 0;
-    LLBC_MessageBlock *block = _willSend.FirstBlock();
+    int len = 0, totalLen = 0, sendCalls = 0;
+    LLBC_MessageBlock *block = FirstSendBlock();
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    // Gather queued blocks into one send call, if kernel buffer full(partial sent), wait writable.
+    LLBC_SockBuf bufs[LLBC_CFG_COMM_SEND_GATHER_COUNT];
     while (block)
     {
+        int bufCount = 0;
+        size_t bufsLen = 0;
+        for (; block && bufCount < LLBC_CFG_COMM_SEND_GATHER_COUNT; block = block->GetNext())
+        {
+            LLBC_SockBuf &buf = bufs[bufCount++];
+            buf.buf = reinterpret_cast<char *>(block->GetDataStartWithReadPos());
+            buf.len = static_cast<ulong>(block->GetReadableSize());
+            bufsLen += buf.len;
+        }
+
+        ++sendCalls;
+        if ((len = LLBC_SendV(_handle, bufs, bufCount, LLBC_INL_NS __sendFlags)) < 0)
+            break;
+
+        totalLen += len;
+        _willSend.Remove(len);
+        if (static_cast<size_t>(len) < bufsLen)
+            break;
+
+        block = FirstSendBlock();
+    }
+#else // LLBC_TARGET_PLATFORM_WIN32
+    while (block)
+    {
+        ++sendCalls;
         if ((len = LLBC_Send(_handle, 
                              block->GetDataStartWithReadPos(), 
                              static_cast<int>(block->GetReadableSize()), 0)) < 0)
@@ -436,8 +717,12 @@ void LLBC_Socket::OnSend()
 
         totalLen += len;
         _willSend.Remove(len);
-        block = _willSend.FirstBlock();
+        block = FirstSendBlock();
     }
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    if (sendCalls > 0)
+        _session->OnSysCalls(sendCalls, 0);
 
     if (len < 0 && LLBC_GetLastError() != LLBC_ERROR_WBLOCK
 #if LLBC_TARGET_PLATFORM_NON_WIN32
@@ -453,6 +738,9 @@ void LLBC_Socket::OnSend()
     if (totalLen > 0)
         _session->OnSent(totalLen);
 
+    // Remain not send data means would block or partial sent.
+    _sendCongested = !!_willSend.FirstBlock();
+
 #if LLBC_TARGET_PLATFORM_WIN32
     if (_pollerType != _PollerType::IocpPoller)
         return;
@@ -517,7 +805,7 @@ void LLBC_Socket::OnRecv()
     }
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
-    int len = 0;
+    int len = 0, recvCalls = 1;
     bool recvFlag = false;
     
     LLBC_MessageBlock *block = LLBC_New(LLBC_MessageBlock);
@@ -531,8 +819,11 @@ void LLBC_Socket::OnRecv()
             block->Allocate();
 
         recvFlag = true;
+        ++recvCalls;
     }
 
+    _session->OnSysCalls(0, recvCalls);
+
     // If recv failed, firstly get last error.
     int errNo = LLBC_ERROR_SUCCESS;
     int subErrNo = LLBC_ERROR_SUCCESS;
@@ -24,6 +24,10 @@ LLBC_IProtocol::~LLBC_IProtocol()
 {
 }
 
+void LLBC_IProtocol::DiscardIncompleteData()
+{
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
@@ -189,6 +189,15 @@ int LLBC_PacketProtocol::Recv(void *in, void *&out, bool &removeSession)
     return LLBC_OK;
 }
 
+void LLBC_PacketProtocol::DiscardIncompleteData()
+{
+    _headerAssembler.Reset();
+
+    LLBC_XDelete(_packet);
+    _payloadNeedRecv = 0;
+    _payloadRecved = 0;
+}
+
 int LLBC_PacketProtocol::AddCoder(int opcode, LLBC_ICoderFactory *coder)
 {
     LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
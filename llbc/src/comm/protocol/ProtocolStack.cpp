@@ -265,6 +265,12 @@ int LLBC_ProtocolStack::Recv(LLBC_MessageBlock *block, std::vector<LLBC_Packet *
     return LLBC_OK;
 }
 
+void LLBC_ProtocolStack::DiscardIncompleteData()
+{
+    if (_protos[LLBC_ProtocolLayer::PackLayer])
+        _protos[LLBC_ProtocolLayer::PackLayer]->DiscardIncompleteData();
+}
+
 void LLBC_ProtocolStack::Report(LLBC_IProtocol *proto, int level, const LLBC_String &msg)
 {
     Report(_session->GetId(), proto, level, msg);
@@ -0,0 +1,737 @@
+/**
+ * @file    PoolAllocator.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/common/OSHeader.h"
+#include "llbc/common/Macro.h"
+#include "llbc/common/BasicDataType.h"
+
+#include "llbc/common/PoolAllocator.h"
+
+/**
+ * Note: All allocator internal datas are POD type and zero initialized, pool allocator can be
+ *       used before llbc library startup(eg: in static objects constructors), and in any threads.
+ */
+__LLBC_INTERNAL_NS_BEGIN
+
+// Small blocks size class count, size classes: 16, 32, ..., 128(step 16), then each power of two
+// range split to 4 classes, 160, 192, 224, 256, 320, ..., 32768.
+static const int __sizeClassCount = 40;
+// The large blocks stat index.
+static const int __largeSizeClass = __sizeClassCount;
+// The max small block size.
+static const size_t __maxSmallSize = 32768;
+// The arena allocated blocks size class(not a real size class, arena blocks never free to pool).
+static const LLBC_NS uint16 __arenaSizeClass = 0xffff;
+
+// The max statistic tags count, tag 0 means untagged.
+static const LLBC_NS uint32 __maxTagCount = 128;
+
+// The block header magic.
+static const LLBC_NS uint32 __blockMagic = 0x4c4c4243;
+// The batch transfer bytes between thread cache and central free list.
+static const size_t __batchBytes = 64 * 1024;
+
+/**
+ * \brief The block header, place before user memory, keep 16 bytes size to align user memory.
+ */
+struct __BlockHeader
+{
+    LLBC_NS uint32 magic;
+    LLBC_NS uint16 sizeClass;
+    LLBC_NS uint16 tag;
+    LLBC_NS uint64 size;
+};
+
+/**
+ * \brief The free block, overlay on block header, min block size is 32 bytes, enough to store.
+ */
+struct __FreeBlock
+{
+    __FreeBlock *next;
+
+    // Only available in central free list chain head block.
+    __FreeBlock *nextChain;
+    LLBC_NS uint32 chainLen;
+};
+
+/**
+ * \brief The central free list, store free blocks as block chains.
+ */
+struct __CentralFreeList
+{
+    volatile long lock;
+    __FreeBlock *chains;
+};
+
+/**
+ * \brief The size class statistic info.
+ */
+struct __SizeClassStat
+{
+    LLBC_NS uint64 allocTimes;
+    LLBC_NS uint64 freeTimes;
+    LLBC_NS uint64 allocBytes;
+};
+
+/**
+ * \brief The thread cache.
+ */
+struct __ThreadCache
+{
+    __FreeBlock *freeLists[__sizeClassCount];
+    LLBC_NS uint32 freeCounts[__sizeClassCount];
+    LLBC_NS uint32 batchCounts[__sizeClassCount];
+
+    __SizeClassStat stats[__sizeClassCount + 1];
+    __SizeClassStat tagStats[__maxTagCount + 1];
+
+    __ThreadCache *prev;
+    __ThreadCache *next;
+};
+
+static __CentralFreeList __centralFreeLists[__sizeClassCount];
+
+// All thread caches registry, and exited threads statistic infos.
+static volatile long __registryLock;
+static __ThreadCache *__threadCaches;
+static __SizeClassStat __exitedThreadsStats[__sizeClassCount + 1];
+static __SizeClassStat __exitedThreadsTagStats[__maxTagCount + 1];
+
+// The registered statistic tags, protected by registry lock.
+static const char *__tagNames[__maxTagCount + 1];
+static LLBC_NS uint32 __tagCount;
+
+// Thread cache TLS, use default(global-dynamic) TLS model, library may be loaded by dlopen().
+static LLBC_THREAD_LOCAL __ThreadCache *__threadCache;
+static volatile long __tlsKeyCreated;
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+static pthread_key_t __tlsKey;
+#else
+static DWORD __tlsKey;
+#endif
+
+static inline void __Lock(volatile long &lock)
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    while (__sync_lock_test_and_set(&lock, 1) != 0)
+    {
+        while (lock != 0)
+        {
+ #if defined(__i386__) || defined(__x86_64__)
+            __builtin_ia32_pause();
+ #endif
+        }
+    }
+#else
+    while (::InterlockedExchange(&lock, 1) != 0)
+    {
+        while (lock != 0)
+            YieldProcessor();
+    }
+#endif
+}
+
+static inline void __Unlock(volatile long &lock)
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    __sync_lock_release(&lock);
+#else
+    ::InterlockedExchange(&lock, 0);
+#endif
+}
+
+static inline int __GetSizeClass(size_t size)
+{
+    if (size <= 128)
+        return size == 0 ? 0 : static_cast<int>((size + 15) / 16 - 1);
+
+    // Find highest bit of (size - 1), k >= 7.
+    const size_t s = size - 1;
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    const int k = static_cast<int>(sizeof(unsigned long) * 8 - 1) - __builtin_clzl(s);
+#else
+    unsigned long k;
+    _BitScanReverse(&k, static_cast<unsigned long>(s));
+#endif
+
+    return 8 + (static_cast<int>(k) - 7) * 4 + static_cast<int>((s >> (k - 2)) & 3);
+}
+
+static inline size_t __GetSizeClassSize(int sizeClass)
+{
+    if (sizeClass < 8)
+        return static_cast<size_t>(sizeClass + 1) * 16;
+
+    const int k = 7 + (sizeClass - 8) / 4;
+    return static_cast<size_t>(4 + (sizeClass - 8) % 4 + 1) << (k - 2);
+}
+
+static inline LLBC_NS uint32 __GetBatchCount(int sizeClass)
+{
+    const size_t count = __batchBytes / (sizeof(__BlockHeader) + __GetSizeClassSize(sizeClass));
+    return static_cast<LLBC_NS uint32>(MAX(4, MIN(count, 128)));
+}
+
+static void __MergeStats(__SizeClassStat *to, const __SizeClassStat *from, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        to[i].allocTimes += from[i].allocTimes;
+        to[i].freeTimes += from[i].freeTimes;
+        to[i].allocBytes += from[i].allocBytes;
+    }
+}
+
+static void __PushChainToCentral(int sizeClass, __FreeBlock *head, LLBC_NS uint32 chainLen)
+{
+    head->chainLen = chainLen;
+
+    __CentralFreeList &central = __centralFreeLists[sizeClass];
+    __Lock(central.lock);
+    head->nextChain = central.chains;
+    central.chains = head;
+    __Unlock(central.lock);
+}
+
+static void __FlushThreadCache(__ThreadCache *cache)
+{
+    for (int sizeClass = 0; sizeClass < __sizeClassCount; ++sizeClass)
+    {
+        if (cache->freeLists[sizeClass])
+            __PushChainToCentral(sizeClass, cache->freeLists[sizeClass], cache->freeCounts[sizeClass]);
+
+        cache->freeLists[sizeClass] = NULL;
+        cache->freeCounts[sizeClass] = 0;
+    }
+}
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+static void __DestroyThreadCache(void *arg)
+#else
+static void WINAPI __DestroyThreadCache(void *arg)
+#endif
+{
+    __ThreadCache *cache = reinterpret_cast<__ThreadCache *>(arg);
+    if (!cache)
+        return;
+
+    __FlushThreadCache(cache);
+
+    __Lock(__registryLock);
+    __MergeStats(__exitedThreadsStats, cache->stats, __sizeClassCount + 1);
+    __MergeStats(__exitedThreadsTagStats, cache->tagStats, __maxTagCount + 1);
+    if (cache->prev)
+        cache->prev->next = cache->next;
+    else
+        __threadCaches = cache->next;
+    if (cache->next)
+        cache->next->prev = cache->prev;
+    __Unlock(__registryLock);
+
+    if (__threadCache == cache)
+        __threadCache = NULL;
+
+    free(cache);
+}
+
+static __ThreadCache *__CreateThreadCache()
+{
+    __ThreadCache *cache = reinterpret_cast<__ThreadCache *>(calloc(1, sizeof(__ThreadCache)));
+    if (UNLIKELY(!cache))
+        return NULL;
+
+    for (int sizeClass = 0; sizeClass < __sizeClassCount; ++sizeClass)
+        cache->batchCounts[sizeClass] = __GetBatchCount(sizeClass);
+
+    __Lock(__registryLock);
+    // Create TLS key(used to destroy thread cache when thread exit).
+    if (!__tlsKeyCreated)
+    {
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+        __tlsKeyCreated = pthread_key_create(&__tlsKey, &__DestroyThreadCache) == 0;
+#else
+        __tlsKeyCreated = (__tlsKey = ::FlsAlloc(&__DestroyThreadCache)) != FLS_OUT_OF_INDEXES;
+#endif
+    }
+
+    cache->next = __threadCaches;
+    if (__threadCaches)
+        __threadCaches->prev = cache;
+    __threadCaches = cache;
+    __Unlock(__registryLock);
+
+    if (__tlsKeyCreated)
+    {
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+        pthread_setspecific(__tlsKey, cache);
+#else
+        ::FlsSetValue(__tlsKey, cache);
+#endif
+    }
+
+    __threadCache = cache;
+
+    return cache;
+}
+
+static inline __ThreadCache *__GetThreadCache()
+{
+    __ThreadCache *cache = __threadCache;
+    if (LIKELY(cache))
+        return cache;
+
+    return __CreateThreadCache();
+}
+
+static __FreeBlock *__FetchFromCentral(__ThreadCache *cache, int sizeClass)
+{
+    // Fetch a block chain from central free list.
+    __CentralFreeList &central = __centralFreeLists[sizeClass];
+    __Lock(central.lock);
+    __FreeBlock *chain = central.chains;
+    if (chain)
+        central.chains = chain->nextChain;
+    __Unlock(central.lock);
+
+    if (chain)
+    {
+        cache->freeLists[sizeClass] = chain;
+        cache->freeCounts[sizeClass] = chain->chainLen;
+
+        return chain;
+    }
+
+    // Central free list empty, allocate a span from system, and split it to blocks.
+    const LLBC_NS uint32 batchCount = cache->batchCounts[sizeClass];
+    const size_t blockSize = sizeof(__BlockHeader) + __GetSizeClassSize(sizeClass);
+    char *span = reinterpret_cast<char *>(malloc(blockSize * batchCount));
+    if (UNLIKELY(!span))
+        return NULL;
+
+    for (LLBC_NS uint32 i = 0; i < batchCount; ++i)
+        reinterpret_cast<__FreeBlock *>(span + i * blockSize)->next =
+            i + 1 < batchCount ? reinterpret_cast<__FreeBlock *>(span + (i + 1) * blockSize) : NULL;
+
+    cache->freeLists[sizeClass] = reinterpret_cast<__FreeBlock *>(span);
+    cache->freeCounts[sizeClass] = batchCount;
+
+    return cache->freeLists[sizeClass];
+}
+
+static void __ReleaseToCentral(__ThreadCache *cache, int sizeClass)
+{
+    // Detach batch count blocks from thread cache free list, and push to central.
+    const LLBC_NS uint32 batchCount = cache->batchCounts[sizeClass];
+
+    __FreeBlock *head = cache->freeLists[sizeClass];
+    __FreeBlock *tail = head;
+    for (LLBC_NS uint32 i = 1; i < batchCount; ++i)
+        tail = tail->next;
+
+    cache->freeLists[sizeClass] = tail->next;
+    cache->freeCounts[sizeClass] -= batchCount;
+
+    tail->next = NULL;
+    __PushChainToCentral(sizeClass, head, batchCount);
+}
+
+static void *__Malloc(size_t size, LLBC_NS uint32 tag)
+{
+    __ThreadCache *cache = __GetThreadCache();
+
+    __BlockHeader *header;
+    if (UNLIKELY(size > __maxSmallSize || !cache))
+    {
+        if (UNLIKELY(size > SIZE_MAX - sizeof(__BlockHeader)))
+            return NULL;
+
+        // Large block, directly allocate from system.
+        if (UNLIKELY(!(header = reinterpret_cast<__BlockHeader *>(malloc(sizeof(__BlockHeader) + size)))))
+            return NULL;
+
+        header->sizeClass = __largeSizeClass;
+    }
+    else
+    {
+        const int sizeClass = __GetSizeClass(size);
+        __FreeBlock *block = cache->freeLists[sizeClass];
+        if (UNLIKELY(!block))
+        {
+            if (UNLIKELY(!(block = __FetchFromCentral(cache, sizeClass))))
+                return NULL;
+        }
+
+        cache->freeLists[sizeClass] = block->next;
+        --cache->freeCounts[sizeClass];
+
+        header = reinterpret_cast<__BlockHeader *>(block);
+        header->sizeClass = static_cast<LLBC_NS uint16>(sizeClass);
+    }
+
+    header->magic = __blockMagic;
+    header->tag = static_cast<LLBC_NS uint16>(tag <= __maxTagCount ? tag : 0);
+    header->size = size;
+
+    if (LIKELY(cache))
+    {
+        __SizeClassStat &stat = cache->stats[header->sizeClass];
+        ++stat.allocTimes;
+        stat.allocBytes += size;
+
+        __SizeClassStat &tagStat = cache->tagStats[header->tag];
+        ++tagStat.allocTimes;
+        tagStat.allocBytes += size;
+    }
+
+    return header + 1;
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_PoolAllocatorStat::LLBC_PoolAllocatorStat()
+: blockSize(0)
+, allocTimes(0)
+, freeTimes(0)
+, allocBytes(0)
+{
+}
+
+LLBC_PoolAllocatorTagStat::LLBC_PoolAllocatorTagStat()
+: name(NULL)
+, allocTimes(0)
+, freeTimes(0)
+, allocBytes(0)
+{
+}
+
+void *LLBC_PoolMalloc(size_t size)
+{
+    return LLBC_INL_NS __Malloc(size, 0);
+}
+
+void *LLBC_PoolTaggedMalloc(size_t size, uint32 tag)
+{
+    return LLBC_INL_NS __Malloc(size, tag);
+}
+
+void *LLBC_PoolCalloc(size_t size)
+{
+    void *mem = LLBC_PoolMalloc(size);
+    if (LIKELY(mem))
+        memset(mem, 0, size);
+
+    return mem;
+}
+
+void *LLBC_PoolRealloc(void *memblock, size_t size)
+{
+    typedef LLBC_INL_NS __BlockHeader _Header;
+
+    if (!memblock)
+        return LLBC_PoolMalloc(size);
+
+    _Header *header = reinterpret_cast<_Header *>(memblock) - 1;
+    if (UNLIKELY(header->magic != LLBC_INL_NS __blockMagic))
+        return realloc(memblock, size); // Not pool allocated block.
+
+    if (header->sizeClass == LLBC_INL_NS __arenaSizeClass)
+    {
+        // Arena block, copy to pool allocated block.
+    }
+    else if (header->sizeClass != LLBC_INL_NS __largeSizeClass)
+    {
+        // Small block, if size class block size enough, reuse it.
+        if (size <= LLBC_INL_NS __GetSizeClassSize(static_cast<int>(header->sizeClass)))
+        {
+            header->size = size;
+            return memblock;
+        }
+    }
+    else if (size > LLBC_INL_NS __maxSmallSize)
+    {
+        // Large block still large, use system realloc.
+        if (UNLIKELY(size > SIZE_MAX - sizeof(_Header)))
+            return NULL;
+
+        _Header *newHeader = reinterpret_cast<_Header *>(realloc(header, sizeof(_Header) + size));
+        if (UNLIKELY(!newHeader))
+            return NULL;
+
+        newHeader->size = size;
+        return newHeader + 1;
+    }
+
+    void *newMemblock = LLBC_INL_NS __Malloc(size, header->tag);
+    if (UNLIKELY(!newMemblock))
+        return NULL;
+
+    memcpy(newMemblock, memblock, MIN(static_cast<size_t>(header->size), size));
+    LLBC_PoolFree(memblock);
+
+    return newMemblock;
+}
+
+void LLBC_PoolFree(void *memblock)
+{
+    typedef LLBC_INL_NS __BlockHeader _Header;
+
+    if (UNLIKELY(!memblock))
+        return;
+
+    _Header *header = reinterpret_cast<_Header *>(memblock) - 1;
+    if (UNLIKELY(header->magic != LLBC_INL_NS __blockMagic))
+    {
+        // Not pool allocated block(user/third-party buffer), release by system allocator.
+        free(memblock);
+        return;
+    }
+
+    const int sizeClass = static_cast<int>(header->sizeClass);
+    LLBC_INL_NS __ThreadCache *cache = LLBC_INL_NS __GetThreadCache();
+    if (sizeClass == LLBC_INL_NS __arenaSizeClass)
+    {
+        // Arena block, memory release when arena reset.
+        if (LIKELY(cache))
+            ++cache->tagStats[header->tag].freeTimes;
+
+        header->magic = 0;
+        return;
+    }
+
+    if (LIKELY(cache))
+    {
+        ++cache->stats[sizeClass].freeTimes;
+        ++cache->tagStats[header->tag].freeTimes;
+    }
+
+    header->magic = 0;
+    if (sizeClass == LLBC_INL_NS __largeSizeClass)
+    {
+        free(header);
+        return;
+    }
+
+    LLBC_INL_NS __FreeBlock *block = reinterpret_cast<LLBC_INL_NS __FreeBlock *>(header);
+    if (UNLIKELY(!cache))
+    {
+        LLBC_INL_NS __PushChainToCentral(sizeClass, block, 1);
+        return;
+    }
+
+    block->next = cache->freeLists[sizeClass];
+    cache->freeLists[sizeClass] = block;
+
+    // If thread cache too many free blocks, return a batch to central.
+    if (UNLIKELY(++cache->freeCounts[sizeClass] >= 2 * cache->batchCounts[sizeClass]))
+        LLBC_INL_NS __ReleaseToCentral(cache, sizeClass);
+}
+
+void LLBC_TrimPoolAllocatorThreadCache()
+{
+    LLBC_INL_NS __ThreadCache *cache = LLBC_INL_NS __threadCache;
+    if (cache)
+        LLBC_INL_NS __FlushThreadCache(cache);
+}
+
+void LLBC_GetPoolAllocatorStats(std::vector<LLBC_PoolAllocatorStat> &stats)
+{
+    LLBC_INL_NS __SizeClassStat allStats[LLBC_INL_NS __sizeClassCount + 1];
+    memset(allStats, 0, sizeof(allStats));
+
+    LLBC_INL_NS __Lock(LLBC_INL_NS __registryLock);
+    LLBC_INL_NS __MergeStats(allStats, LLBC_INL_NS __exitedThreadsStats, LLBC_INL_NS __sizeClassCount + 1);
+    for (LLBC_INL_NS __ThreadCache *cache = LLBC_INL_NS __threadCaches;
+         cache != NULL;
+         cache = cache->next)
+        LLBC_INL_NS __MergeStats(allStats, cache->stats, LLBC_INL_NS __sizeClassCount + 1);
+    LLBC_INL_NS __Unlock(LLBC_INL_NS __registryLock);
+
+    stats.resize(LLBC_INL_NS __sizeClassCount + 1);
+    for (int i = 0; i <= LLBC_INL_NS __sizeClassCount; ++i)
+    {
+        LLBC_PoolAllocatorStat &stat = stats[i];
+        stat.blockSize = i != LLBC_INL_NS __largeSizeClass ? LLBC_INL_NS __GetSizeClassSize(i) : 0;
+        stat.allocTimes = allStats[i].allocTimes;
+        stat.freeTimes = allStats[i].freeTimes;
+        stat.allocBytes = allStats[i].allocBytes;
+    }
+}
+
+uint32 LLBC_RegisterPoolAllocatorTag(const char *name)
+{
+    if (UNLIKELY(!name))
+        return 0;
+
+    uint32 tag = 0;
+    LLBC_INL_NS __Lock(LLBC_INL_NS __registryLock);
+    for (uint32 i = 1; i <= LLBC_INL_NS __tagCount; ++i)
+    {
+        if (strcmp(LLBC_INL_NS __tagNames[i], name) == 0)
+        {
+            tag = i;
+            break;
+        }
+    }
+
+    if (tag == 0 && LLBC_INL_NS __tagCount < LLBC_INL_NS __maxTagCount)
+    {
+        tag = ++LLBC_INL_NS __tagCount;
+        LLBC_INL_NS __tagNames[tag] = name;
+    }
+    LLBC_INL_NS __Unlock(LLBC_INL_NS __registryLock);
+
+    return tag;
+}
+
+void LLBC_GetPoolAllocatorTagStats(std::vector<LLBC_PoolAllocatorTagStat> &stats)
+{
+    LLBC_INL_NS __SizeClassStat allStats[LLBC_INL_NS __maxTagCount + 1];
+    memset(allStats, 0, sizeof(allStats));
+
+    LLBC_INL_NS __Lock(LLBC_INL_NS __registryLock);
+    LLBC_INL_NS __MergeStats(allStats, LLBC_INL_NS __exitedThreadsTagStats, LLBC_INL_NS __maxTagCount + 1);
+    for (LLBC_INL_NS __ThreadCache *cache = LLBC_INL_NS __threadCaches;
+         cache != NULL;
+         cache = cache->next)
+        LLBC_INL_NS __MergeStats(allStats, cache->tagStats, LLBC_INL_NS __maxTagCount + 1);
+
+    const uint32 tagCount = LLBC_INL_NS __tagCount;
+    stats.resize(tagCount);
+    for (uint32 tag = 1; tag <= tagCount; ++tag)
+    {
+        LLBC_PoolAllocatorTagStat &stat = stats[tag - 1];
+        stat.name = LLBC_INL_NS __tagNames[tag];
+        stat.allocTimes = allStats[tag].allocTimes;
+        stat.freeTimes = allStats[tag].freeTimes;
+        stat.allocBytes = allStats[tag].allocBytes;
+    }
+    LLBC_INL_NS __Unlock(LLBC_INL_NS __registryLock);
+}
+
+/**
+ * \brief The arena chunk, user blocks follow chunk head.
+ */
+struct LLBC_PoolArena::_Chunk
+{
+    _Chunk *next;
+    size_t size;
+    size_t used;
+    size_t padding; // Keep 16 bytes aligned.
+};
+
+LLBC_PoolArena::LLBC_PoolArena(size_t chunkSize)
+: _chunkSize(MAX(chunkSize, static_cast<size_t>(1024)))
+, _chunks(NULL)
+, _chunkCount(0)
+, _usedSize(0)
+{
+}
+
+LLBC_PoolArena::~LLBC_PoolArena()
+{
+    while (_chunks)
+    {
+        _Chunk *chunk = _chunks;
+        _chunks = chunk->next;
+
+        free(chunk);
+    }
+}
+
+void *LLBC_PoolArena::Alloc(size_t size, uint32 tag)
+{
+    typedef LLBC_INL_NS __BlockHeader _Header;
+
+    if (UNLIKELY(size > SIZE_MAX - sizeof(_Chunk) - sizeof(_Header) - 15))
+        return NULL;
+
+    const size_t needSize = sizeof(_Header) + ((size + 15) & ~static_cast<size_t>(15));
+    _Chunk *chunk = _chunks;
+    if (UNLIKELY(!chunk || chunk->size - chunk->used < needSize))
+    {
+        if (UNLIKELY(!(chunk = AllocChunk(MAX(_chunkSize, needSize)))))
+            return NULL;
+    }
+
+    _Header *header = reinterpret_cast<_Header *>(reinterpret_cast<char *>(chunk + 1) + chunk->used);
+    chunk->used += needSize;
+    _usedSize += needSize;
+
+    header->magic = LLBC_INL_NS __blockMagic;
+    header->sizeClass = LLBC_INL_NS __arenaSizeClass;
+    header->tag = static_cast<uint16>(tag <= LLBC_INL_NS __maxTagCount ? tag : 0);
+    header->size = size;
+
+    if (header->tag != 0)
+    {
+        LLBC_INL_NS __ThreadCache *cache = LLBC_INL_NS __GetThreadCache();
+        if (LIKELY(cache))
+        {
+            LLBC_INL_NS __SizeClassStat &tagStat = cache->tagStats[header->tag];
+            ++tagStat.allocTimes;
+            tagStat.allocBytes += size;
+        }
+    }
+
+    return header + 1;
+}
+
+void LLBC_PoolArena::Reset()
+{
+    if (!_chunks)
+        return;
+
+    // Reserve the first allocated chunk(the list tail), free others.
+    while (_chunks->next)
+    {
+        _Chunk *chunk = _chunks;
+        _chunks = chunk->next;
+
+        free(chunk);
+    }
+
+    _chunks->used = 0;
+    _chunkCount = 1;
+    _usedSize = 0;
+}
+
+size_t LLBC_PoolArena::GetUsedSize() const
+{
+    return _usedSize;
+}
+
+size_t LLBC_PoolArena::GetChunkCount() const
+{
+    return _chunkCount;
+}
+
+LLBC_PoolArena::_Chunk *LLBC_PoolArena::AllocChunk(size_t size)
+{
+    _Chunk *chunk = reinterpret_cast<_Chunk *>(malloc(sizeof(_Chunk) + size));
+    if (UNLIKELY(!chunk))
+        return NULL;
+
+    chunk->next = _chunks;
+    chunk->size = size;
+    chunk->used = 0;
+
+    _chunks = chunk;
+    ++_chunkCount;
+
+    return chunk;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
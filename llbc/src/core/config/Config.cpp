@@ -12,6 +12,7 @@
 
 #include "llbc/core/helper/STLHelper.h"
 #include "llbc/core/file/File.h"
+#include "llbc/core/file/MappedFile.h"
 #include "llbc/core/utils/Util_Text.h"
 #include "llbc/core/helper/JVHelper.h"
 
@@ -64,18 +65,17 @@ int LLBC_Config::Initialize()
     {
         const LLBC_String &fileName = iter->first;
 
-        LLBC_File file(fileName, LLBC_FileMode::BinaryRead);
+        // Map file and parse in place, avoid copy file content to string.
+        LLBC_MappedFile file(fileName);
         if (!file.IsOpened())
         {
             BuildErrMsg(fileName, LLBC_FormatLastError());
             return LLBC_FAILED;
         }
 
-        LLBC_String content = file.ReadToEnd();
-
         Json::Reader reader;
         LLBC_JsonValue *value = new LLBC_JsonValue;
-        if (!reader.parse(content, *value))
+        if (!reader.parse(file.GetData(), file.GetData() + file.GetSize(), *value))
         {
             delete value;
 
@@ -0,0 +1,352 @@
+/**
+ * @file    ConfigSnapshot.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/file/File.h"
+#include "llbc/core/variant/Variant.h"
+#include "llbc/core/config/Ini.h"
+#include "llbc/core/config/Property.h"
+#include "llbc/core/config/ConfigSnapshot.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The snapshot file magic & version.
+static const char __snapshotMagic[8] = {'L', 'L', 'B', 'C', 'S', 'N', 'A', 'P'};
+static const LLBC_NS uint32 __snapshotVersion = 1;
+static const LLBC_NS uint32 __snapshotEndianTag = 0x01020304;
+
+/**
+ * \brief The snapshot file header structure.
+ */
+struct __SnapshotHeader
+{
+    char magic[8];
+    LLBC_NS uint32 version;
+    LLBC_NS uint32 endianTag;
+    LLBC_NS uint32 entryCount;
+    LLBC_NS uint32 reserved;
+
+    LLBC_NS uint64 entriesOffset;
+    LLBC_NS uint64 strPoolOffset;
+    LLBC_NS uint64 strPoolSize;
+};
+
+/**
+ * \brief The snapshot entry structure, all offsets are string pool offsets.
+ */
+struct __SnapshotEntry
+{
+    LLBC_NS uint64 sectionOffset;
+    LLBC_NS uint64 keyOffset;
+    LLBC_NS uint64 valueOffset;
+
+    LLBC_NS uint32 sectionLen;
+    LLBC_NS uint32 keyLen;
+    LLBC_NS uint32 valueLen;
+    LLBC_NS uint32 reserved;
+};
+
+static int __CompareStr(const char *str1, size_t len1, const char *str2, size_t len2)
+{
+    const int ret = memcmp(str1, str2, MIN(len1, len2));
+    if (ret != 0)
+        return ret;
+
+    return len1 < len2 ? -1 : (len1 == len2 ? 0 : 1);
+}
+
+static bool __IsValidStr(LLBC_NS uint64 offset, LLBC_NS uint32 len, const char *strPool, LLBC_NS uint64 strPoolSize)
+{
+    return offset < strPoolSize &&
+        len < strPoolSize - offset &&
+        strPool[offset + len] == '\0';
+}
+
+static LLBC_NS uint64 __AppendStr(const LLBC_NS LLBC_String &str, LLBC_NS LLBC_String &strPool)
+{
+    const LLBC_NS uint64 offset = strPool.size();
+    strPool.append(str.data(), str.size());
+    strPool.push_back('\0');
+
+    return offset;
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_ConfigSnapshot::LLBC_ConfigSnapshot()
+: _entryCount(0)
+, _entries(NULL)
+, _strPool(NULL)
+{
+}
+
+LLBC_ConfigSnapshot::~LLBC_ConfigSnapshot()
+{
+    Close();
+}
+
+int LLBC_ConfigSnapshot::Compile(const LLBC_Ini &ini, const LLBC_String &file)
+{
+    _Triples triples;
+
+    typedef std::map<LLBC_String, LLBC_IniSection *> _Sections;
+    const _Sections &sections = ini.GetAllSections();
+    for (_Sections::const_iterator sectionIt = sections.begin();
+         sectionIt != sections.end();
+         sectionIt++)
+    {
+        typedef std::map<LLBC_String, LLBC_Variant> _Values;
+        const _Values &values = sectionIt->second->GetAllValues();
+        for (_Values::const_iterator valIt = values.begin();
+             valIt != values.end();
+             valIt++)
+            triples.push_back(std::make_pair(std::make_pair(
+                sectionIt->first, valIt->first), valIt->second.ValueToString()));
+    }
+
+    return Compile(triples, file);
+}
+
+int LLBC_ConfigSnapshot::Compile(const LLBC_Property &property, const LLBC_String &file)
+{
+    _Triples triples;
+
+    const LLBC_Strings names = property.GetPropertyNames(true);
+    for (LLBC_Strings::const_iterator it = names.begin();
+         it != names.end();
+         it++)
+        triples.push_back(std::make_pair(std::make_pair(
+            LLBC_String(), *it), property.GetValue(*it).ValueToString()));
+
+    return Compile(triples, file);
+}
+
+int LLBC_ConfigSnapshot::Compile(_Triples &triples, const LLBC_String &file)
+{
+    std::sort(triples.begin(), triples.end());
+
+    // Build entries and string pool, same section names only store once.
+    LLBC_String strPool;
+    std::map<LLBC_String, uint64> sectionOffsets;
+    std::vector<LLBC_INTERNAL_NS __SnapshotEntry> entries(triples.size());
+    for (size_t i = 0; i < triples.size(); i++)
+    {
+        const LLBC_String &section = triples[i].first.first;
+        const LLBC_String &key = triples[i].first.second;
+        const LLBC_String &value = triples[i].second;
+        if (section.size() > UINT_MAX || key.size() > UINT_MAX || value.size() > UINT_MAX)
+        {
+            LLBC_SetLastError(LLBC_ERROR_LIMIT);
+            return LLBC_FAILED;
+        }
+
+        LLBC_INTERNAL_NS __SnapshotEntry &entry = entries[i];
+        memset(&entry, 0, sizeof(entry));
+
+        std::map<LLBC_String, uint64>::iterator sectionIt = sectionOffsets.find(section);
+        if (sectionIt == sectionOffsets.end())
+            sectionIt = sectionOffsets.insert(std::make_pair(
+                section, LLBC_INTERNAL_NS __AppendStr(section, strPool))).first;
+
+        entry.sectionOffset = sectionIt->second;
+        entry.sectionLen = static_cast<uint32>(section.size());
+        entry.keyOffset = LLBC_INTERNAL_NS __AppendStr(key, strPool);
+        entry.keyLen = static_cast<uint32>(key.size());
+        entry.valueOffset = LLBC_INTERNAL_NS __AppendStr(value, strPool);
+        entry.valueLen = static_cast<uint32>(value.size());
+    }
+
+    if (entries.size() > UINT_MAX)
+    {
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_FAILED;
+    }
+
+    // Build header.
+    LLBC_INTERNAL_NS __SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, LLBC_INTERNAL_NS __snapshotMagic, sizeof(header.magic));
+    header.version = LLBC_INTERNAL_NS __snapshotVersion;
+    header.endianTag = LLBC_INTERNAL_NS __snapshotEndianTag;
+    header.entryCount = static_cast<uint32>(entries.size());
+    header.entriesOffset = sizeof(header);
+    header.strPoolOffset = header.entriesOffset + entries.size() * sizeof(LLBC_INTERNAL_NS __SnapshotEntry);
+    header.strPoolSize = strPool.size();
+
+    // Write to file.
+    LLBC_File f(file, LLBC_FileMode::BinaryWrite);
+    if (!f.IsOpened())
+        return LLBC_FAILED;
+
+    if (f.Write(&header, sizeof(header)) != static_cast<long>(sizeof(header)))
+        return LLBC_FAILED;
+
+    const size_t entriesSize = entries.size() * sizeof(LLBC_INTERNAL_NS __SnapshotEntry);
+    if (entriesSize > 0 &&
+        f.Write(&entries[0], entriesSize) != static_cast<long>(entriesSize))
+        return LLBC_FAILED;
+
+    if (!strPool.empty() &&
+        f.Write(strPool.data(), strPool.size()) != static_cast<long>(strPool.size()))
+        return LLBC_FAILED;
+
+    return LLBC_OK;
+}
+
+int LLBC_ConfigSnapshot::Open(const LLBC_String &file)
+{
+    if (_file.IsOpened())
+    {
+        LLBC_SetLastError(LLBC_ERROR_OPENED);
+        return LLBC_FAILED;
+    }
+
+    if (_file.Open(file) != LLBC_OK)
+        return LLBC_FAILED;
+
+    // Validate header.
+    typedef LLBC_INTERNAL_NS __SnapshotHeader _Header;
+    typedef LLBC_INTERNAL_NS __SnapshotEntry _Entry;
+
+    const char *data = _file.GetData();
+    const size_t size = _file.GetSize();
+    const _Header *header = reinterpret_cast<const _Header *>(data);
+    if (size < sizeof(_Header) ||
+        memcmp(header->magic, LLBC_INTERNAL_NS __snapshotMagic, sizeof(header->magic)) != 0 ||
+        header->version != LLBC_INTERNAL_NS __snapshotVersion ||
+        header->endianTag != LLBC_INTERNAL_NS __snapshotEndianTag ||
+        header->entriesOffset % sizeof(uint64) != 0 ||
+        header->entriesOffset > size ||
+        static_cast<uint64>(header->entryCount) * sizeof(_Entry) > size - header->entriesOffset ||
+        header->strPoolOffset > size ||
+        header->strPoolSize > size - header->strPoolOffset)
+    {
+        _file.Close();
+        LLBC_SetLastError(LLBC_ERROR_FORMAT);
+
+        return LLBC_FAILED;
+    }
+
+    // Validate all entries, after validated, query operations needn't check any more.
+    const _Entry *entries = reinterpret_cast<const _Entry *>(data + header->entriesOffset);
+    const char *strPool = data + header->strPoolOffset;
+    for (uint32 i = 0; i < header->entryCount; i++)
+    {
+        const _Entry &entry = entries[i];
+        if (!LLBC_INTERNAL_NS __IsValidStr(entry.sectionOffset, entry.sectionLen, strPool, header->strPoolSize) ||
+            !LLBC_INTERNAL_NS __IsValidStr(entry.keyOffset, entry.keyLen, strPool, header->strPoolSize) ||
+            !LLBC_INTERNAL_NS __IsValidStr(entry.valueOffset, entry.valueLen, strPool, header->strPoolSize))
+        {
+            _file.Close();
+            LLBC_SetLastError(LLBC_ERROR_FORMAT);
+
+            return LLBC_FAILED;
+        }
+    }
+
+    _entryCount = header->entryCount;
+    _entries = entries;
+    _strPool = strPool;
+
+    return LLBC_OK;
+}
+
+bool LLBC_ConfigSnapshot::IsOpened() const
+{
+    return _file.IsOpened();
+}
+
+void LLBC_ConfigSnapshot::Close()
+{
+    _file.Close();
+
+    _entryCount = 0;
+    _entries = NULL;
+    _strPool = NULL;
+}
+
+size_t LLBC_ConfigSnapshot::GetEntryCount() const
+{
+    return _entryCount;
+}
+
+bool LLBC_ConfigSnapshot::IsHasKey(const LLBC_String &section, const LLBC_String &key) const
+{
+    return Find(section, key) != NULL;
+}
+
+const char *LLBC_ConfigSnapshot::GetRawValue(const LLBC_String &section, const LLBC_String &key, size_t *len) const
+{
+    const LLBC_INTERNAL_NS __SnapshotEntry *entry = 
+        reinterpret_cast<const LLBC_INTERNAL_NS __SnapshotEntry *>(Find(section, key));
+    if (!entry)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+        return NULL;
+    }
+
+    if (len)
+        *len = entry->valueLen;
+
+    LLBC_SetLastError(LLBC_ERROR_SUCCESS);
+    return _strPool + entry->valueOffset;
+}
+
+LLBC_Variant LLBC_ConfigSnapshot::GetValue(const LLBC_String &section,
+                                           const LLBC_String &key,
+                                           const LLBC_Variant &dft) const
+{
+    size_t len;
+    const char *value = GetRawValue(section, key, &len);
+    if (!value)
+        return dft;
+
+    return LLBC_Variant(LLBC_String(value, len));
+}
+
+const void *LLBC_ConfigSnapshot::Find(const LLBC_String &section, const LLBC_String &key) const
+{
+    if (!_entries)
+        return NULL;
+
+    // Binary search (section, key) pair.
+    typedef LLBC_INTERNAL_NS __SnapshotEntry _Entry;
+    const _Entry *entries = reinterpret_cast<const _Entry *>(_entries);
+
+    size_t low = 0;
+    size_t high = _entryCount;
+    while (low < high)
+    {
+        const size_t mid = low + (high - low) / 2;
+        const _Entry &entry = entries[mid];
+
+        int ret = LLBC_INTERNAL_NS __CompareStr(
+            _strPool + entry.sectionOffset, entry.sectionLen, section.data(), section.size());
+        if (ret == 0)
+            ret = LLBC_INTERNAL_NS __CompareStr(
+                _strPool + entry.keyOffset, entry.keyLen, key.data(), key.size());
+
+        if (ret == 0)
+            return &entry;
+        else if (ret < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return NULL;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -11,6 +11,7 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/file/File.h"
+#include "llbc/core/file/MappedFile.h"
 #include "llbc/core/variant/Variant.h"
 #include "llbc/core/helper/STLHelper.h"
 #include "llbc/core/config/Ini.h"
@@ -122,21 +123,36 @@ LLBC_Ini::~LLBC_Ini()
 
 int LLBC_Ini::LoadFromFile(const LLBC_String &file)
 {
-    LLBC_File f(file, LLBC_FileMode::TextRead);
+    LLBC_MappedFile f(file);
     if (!f.IsOpened())
         return LLBC_FAILED;
 
-    return LoadFromContent(f.ReadToEnd());
+    return LoadFromContent(f.GetData(), f.GetSize());
 }
 
 int LLBC_Ini::LoadFromContent(const LLBC_String &content)
+{
+    return LoadFromContent(content.data(), content.size());
+}
+
+int LLBC_Ini::LoadFromContent(const char *content, size_t len)
 {
     LLBC_String sectionName;
-    const LLBC_Strings lines = content.split("\n");
-    for (size_t i = 0; i < lines.size(); i++)
+
+    size_t lineNum = 0;
+    const char *lineBeg = content;
+    const char *contentEnd = content + len;
+    while (lineBeg < contentEnd)
     {
-        if (ParseLine(lines[i], i + 1, sectionName) != LLBC_OK)
+        const char *lineEnd = reinterpret_cast<const char *>(
+            memchr(lineBeg, '\n', contentEnd - lineBeg));
+        if (!lineEnd)
+            lineEnd = contentEnd;
+
+        if (ParseLine(lineBeg, lineEnd - lineBeg, ++lineNum, sectionName) != LLBC_OK)
             return LLBC_FAILED;
+
+        lineBeg = lineEnd + 1;
     }
 
     _errMsg = "success";
@@ -325,62 +341,85 @@ LLBC_Ini &LLBC_Ini::operator =(const This &another)
     return *this;
 }
 
-int LLBC_Ini::ParseLine(const LLBC_String &line, size_t lineNum, LLBC_String &sectionName)
+int LLBC_Ini::ParseLine(const char *line, size_t len, size_t lineNum, LLBC_String &sectionName)
 {
-    if (line.empty())
+    if (len == 0)
         return LLBC_OK;
 
     // Split non-comment/comment parts.
-    LLBC_String nonComment, comment;
-    int ret = Split(line, lineNum, 0, CommentBegin, nonComment, comment);
+    size_t commentPos;
+    int ret = FindSeparator(line, len, lineNum, 0, CommentBegin, commentPos);
     if (ret != LLBC_OK)
         return LLBC_FAILED;
 
     // Strip non-comment/comment.
-    const size_t nonCommentLen = nonComment.length();
-
-    nonComment.lstrip();
-    const size_t leftStripLen = nonCommentLen - nonComment.length();
-    nonComment.rstrip();
-    if (nonComment.empty())
+    size_t nonCommentBeg = 0;
+    size_t nonCommentEnd = commentPos;
+    while (nonCommentBeg < nonCommentEnd && IsSpace(line[nonCommentBeg]))
+        ++nonCommentBeg;
+    while (nonCommentEnd > nonCommentBeg && IsSpace(line[nonCommentEnd - 1]))
+        --nonCommentEnd;
+    if (nonCommentBeg == nonCommentEnd)
         return LLBC_OK;
 
-    comment.strip();
+    const size_t leftStripLen = nonCommentBeg;
+    const char *nonComment = line + nonCommentBeg;
+    const size_t nonCommentLen = nonCommentEnd - nonCommentBeg;
+
+    LLBC_String comment;
+    if (commentPos < len)
+    {
+        size_t commentBeg = commentPos + 1;
+        size_t commentEnd = len;
+        while (commentBeg < commentEnd && IsSpace(line[commentBeg]))
+            ++commentBeg;
+        while (commentEnd > commentBeg && IsSpace(line[commentEnd - 1]))
+            --commentEnd;
+
+        comment.assign(line + commentBeg, commentEnd - commentBeg);
+    }
 
     // Try as section name config to parse.
     bool failedContinue;
-    if ((ret = TryParseSectionName(
-        nonComment, comment, lineNum, leftStripLen, sectionName, failedContinue)) == LLBC_OK ||
+    if ((ret = TryParseSectionName(nonComment, nonCommentLen,
+        comment, lineNum, leftStripLen, sectionName, failedContinue)) == LLBC_OK ||
         !failedContinue)
         return ret;
 
     // Split key/value parts.
-    LLBC_String key, value;
-    if ((ret = Split(nonComment, lineNum,
-        leftStripLen, KeyValueSeparator, key, value, true)) != LLBC_OK)
+    size_t sepPos;
+    if ((ret = FindSeparator(nonComment, nonCommentLen, lineNum,
+        leftStripLen, KeyValueSeparator, sepPos, true)) != LLBC_OK)
         return ret;
 
     // Right-Strip And UnEscape key.
-    if (key.rstrip().empty())
+    size_t keyLen = sepPos;
+    while (keyLen > 0 && IsSpace(nonComment[keyLen - 1]))
+        --keyLen;
+    if (keyLen == 0)
     {
         Err_KeyEmpty(lineNum, leftStripLen + 1);
         LLBC_SetLastError(LLBC_ERROR_FORMAT);
         return LLBC_FAILED;
     }
 
-    size_t unescapedTimes = 0;
+    LLBC_String key;
     if ((ret = UnEscape(
-        key, lineNum, leftStripLen, unescapedTimes)) != LLBC_OK)
+        nonComment, keyLen, lineNum, leftStripLen, &key)) != LLBC_OK)
         return ret;
 
     // Left-Strip And UnEscape value.
-    const size_t unLeftStripValueLen = value.length();
+    size_t valBeg = sepPos + 1;
     size_t valBeginPos = leftStripLen + key.length() + 1;
+    while (valBeg < nonCommentLen && IsSpace(nonComment[valBeg]))
+    {
+        ++valBeg;
+        ++valBeginPos;
+    }
 
-    value.lstrip();
-    valBeginPos += unLeftStripValueLen - value.length();
-    if ((ret = UnEscape(
-        value, lineNum, valBeginPos, unescapedTimes)) != LLBC_OK)
+    LLBC_String value;
+    if ((ret = UnEscape(nonComment + valBeg,
+        nonCommentLen - valBeg, lineNum, valBeginPos, &value)) != LLBC_OK)
         return ret;
 
     if (sectionName.empty())
@@ -402,20 +441,22 @@ int LLBC_Ini::ParseLine(const LLBC_String &line, size_t lineNum, LLBC_String &se
     return iniSection->SetValue(key, value, comment);
 }
 
-int LLBC_Ini::TryParseSectionName(const LLBC_String &content,
+int LLBC_Ini::TryParseSectionName(const char *content,
+                                  size_t len,
                                   const LLBC_String &comment,
                                   size_t lineNum,
                                   size_t contentBeginPos,
                                   LLBC_String &sectionName,
                                   bool &failedContinue)
 {
-    LLBC_String rawSection = content;
+    // Section config must begin with section begin char(maybe escaped),
+    // otherwise only validate the escape format, do not unescape.
+    LLBC_String rawSection;
+    LLBC_String *unescaped = 
+        (content[0] == SectionBegin || content[0] == EscapeChar) ? &rawSection : NULL;
 
     // Unescape.
-    int ret;
-    size_t unescapedTimes;
-    if ((ret = UnEscape(
-        rawSection, lineNum, contentBeginPos, unescapedTimes)) != LLBC_OK)
+    if (UnEscape(content, len, lineNum, contentBeginPos, unescaped) != LLBC_OK)
     {
         failedContinue = false;
         Err_InvalidEscapeFormat(lineNum, contentBeginPos);
@@ -425,7 +466,8 @@ int LLBC_Ini::TryParseSectionName(const LLBC_String &content,
     }
 
     // Confirm format.
-    if (rawSection.length() < 3 ||
+    if (!unescaped ||
+        rawSection.length() < 3 ||
         (rawSection[0] != SectionBegin || 
          rawSection[rawSection.length() - 1] != SectionEnd))
     {
@@ -434,7 +476,7 @@ int LLBC_Ini::TryParseSectionName(const LLBC_String &content,
     }
 
     // Store section.
-    sectionName = rawSection.substr(1, rawSection.length() - 2);
+    sectionName.assign(rawSection, 1, rawSection.length() - 2);
     std::map<LLBC_String, LLBC_IniSection *>::iterator it = _sections.find(sectionName);
     if (it == _sections.end())
     {
@@ -450,31 +492,15 @@ int LLBC_Ini::TryParseSectionName(const LLBC_String &content,
     return LLBC_OK;
 }
 
-int LLBC_Ini::Split(const LLBC_String &str,
-                    size_t lineNum,
-                    size_t beginPos,
-                    char sep,
-                    LLBC_String &left,
-                    LLBC_String &right,
-                    bool requireFoundSep)
+int LLBC_Ini::FindSeparator(const char *str,
+                            size_t len,
+                            size_t lineNum,
+                            size_t beginPos,
+                            char sep,
+                            size_t &sepPos,
+                            bool requireFoundSep)
 {
-    left.clear(), right.clear();
-    if (str.empty())
-    {
-        if (requireFoundSep)
-        {
-            Err_SeparatorNotFound(lineNum, beginPos + 1, sep);
-            LLBC_SetLastError(LLBC_ERROR_FORMAT);
-
-            return LLBC_FAILED;
-        }
-
-        return LLBC_OK;
-    }
-
-    bool foundSep = false;
-    const size_t len = str.length();
-    for (size_t pos = 0; pos < str.length(); pos++)
+    for (size_t pos = 0; pos < len; pos++)
     {
         const char ch = str[pos];
         if (ch == EscapeChar)
@@ -494,27 +520,20 @@ int LLBC_Ini::Split(const LLBC_String &str,
 
         if (ch == sep)
         {
-            foundSep = true;
-            left = str.substr(0, pos);
-            right = str.substr(pos + 1);
-
-            break;
+            sepPos = pos;
+            return LLBC_OK;
         }
     }
 
-    if (!foundSep)
+    if (requireFoundSep)
     {
-        if (requireFoundSep)
-        {
-            Err_SeparatorNotFound(lineNum, beginPos + 1 + len, sep);
-            LLBC_SetLastError(LLBC_ERROR_FORMAT);
-
-            return LLBC_FAILED;
-        }
+        Err_SeparatorNotFound(lineNum, beginPos + 1 + len, sep);
+        LLBC_SetLastError(LLBC_ERROR_FORMAT);
 
-        left = str;
+        return LLBC_FAILED;
     }
 
+    sepPos = len;
     return LLBC_OK;
 }
 
@@ -523,36 +542,51 @@ LLBC_String LLBC_Ini::Escape(const LLBC_String &str) const
     return str.escape(BeEscapedChars, EscapeChar);
 }
 
-int LLBC_Ini::UnEscape(LLBC_String &str,
+int LLBC_Ini::UnEscape(const char *str,
+                       size_t len,
                        size_t lineNum,
                        size_t beginPos,
-                       size_t &unescapedTimes)
+                       LLBC_String *unescaped)
 {
-    unescapedTimes = 0;
-    if (str.empty())
-        return LLBC_OK;
+    if (unescaped)
+        unescaped->reserve(len);
 
-    for (size_t i = 0; i < str.length(); i++)
+    size_t unescapedTimes = 0;
+    for (size_t i = 0; i < len; i++)
     {
         if (str[i] != EscapeChar)
+        {
+            if (unescaped)
+                unescaped->push_back(str[i]);
+
             continue;
+        }
 
-        if (i == str.length() - 1 ||
+        if (i == len - 1 ||
             BeEscapedChars.find(str[i + 1]) == LLBC_String::npos)
         {
-            Err_InvalidEscapeFormat(lineNum, beginPos + 1 + i + 1);
+            // Column is counted in the partially unescaped string, keep compatible with old error report.
+            Err_InvalidEscapeFormat(lineNum, beginPos + 1 + (i - unescapedTimes) + 1);
             LLBC_SetLastError(LLBC_ERROR_FORMAT);
 
             return LLBC_FAILED;
         }
 
-        str.erase(i, 1);
+        i += 1; // Keep escaped char.
+        if (unescaped)
+            unescaped->push_back(str[i]);
+
         unescapedTimes += 1;
     }
 
     return LLBC_OK;
 }
 
+bool LLBC_Ini::IsSpace(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\v' || ch == '\r' || ch == '\n' || ch == '\f';
+}
+
 void LLBC_Ini::Copy(const This &another)
 {
     _errMsg = another._errMsg;
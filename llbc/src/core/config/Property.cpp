@@ -11,6 +11,7 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/file/File.h"
+#include "llbc/core/file/MappedFile.h"
 #include "llbc/core/helper/STLHelper.h"
 #include "llbc/core/utils/Util_Text.h"
 
@@ -78,14 +79,19 @@ LLBC_Property::~LLBC_Property()
 
 int LLBC_Property::LoadFromFile(const LLBC_String &file)
 {
-    LLBC_File f(file, LLBC_FileMode::BinaryRead);
+    LLBC_MappedFile f(file);
     if (!f.IsOpened())
         return LLBC_FAILED;
 
-    return LoadFromContent(f.ReadToEnd());
+    return LoadFromContent(f.GetData(), f.GetSize());
 }
 
 int LLBC_Property::LoadFromContent(const LLBC_String &content)
+{
+    return LoadFromContent(content.data(), content.size());
+}
+
+int LLBC_Property::LoadFromContent(const char *content, size_t len)
 {
     // Backup all data members & set to NULL.
     This *backParent = _parent;
@@ -103,15 +109,28 @@ int LLBC_Property::LoadFromContent(const LLBC_String &content)
 
     // Begin parse.
     bool done = true;
-    LLBC_Strings contents = NormalizeContent(content);
-    for (size_t i = 0; i < contents.size(); i++)
-    {
-        const LLBC_String &line = contents[i];
-        if (ParseLine(line, static_cast<int>(i) + 1) != LLBC_OK)
+    int lineNo = 0;
+    LLBC_String line;
+    const char *contentEnd = content + len;
+    for (const char *lineBeg = content; lineBeg < contentEnd; )
+    {
+        const char *lineEnd;
+        const char *nextLineBeg = NextLine(lineBeg, contentEnd, lineEnd);
+
+        // Strip the line.
+        while (lineBeg < lineEnd && isspace(static_cast<unsigned char>(*lineBeg)))
+            ++lineBeg;
+        while (lineEnd > lineBeg && isspace(static_cast<unsigned char>(*(lineEnd - 1))))
+            --lineEnd;
+
+        line.assign(lineBeg, lineEnd - lineBeg);
+        if (ParseLine(line, ++lineNo) != LLBC_OK)
         {
             done = false;
             break;
         }
+
+        lineBeg = nextLineBeg;
     }
 
     // If not done, restore above backet data members.
@@ -502,31 +521,18 @@ bool LLBC_Property::CheckName(const LLBC_String &name, bool allowSeparator) cons
     return true;
 }
 
-LLBC_Strings LLBC_Property::NormalizeContent(const LLBC_String &content)
+const char *LLBC_Property::NextLine(const char *content, const char *contentEnd, const char *&lineEnd)
 {
-    // Replace WIN style line-end to UNIX style.
-    const char *unixLineEnd = "\n";
-
-    const char *winLineEnd = "\r\n";
-    size_t lineEndLen = LLBC_StrLenA(winLineEnd);
-
-    LLBC_String::size_type pos;
-    LLBC_String normalizedContent(content);
-    while ((pos = normalizedContent.find(winLineEnd)) != LLBC_String::npos)
-        normalizedContent.replace(pos, lineEndLen, unixLineEnd);
-
-    // Replace MAC style line-end to UNIX style.
-    const char *macLineEnd = "\r";
-    lineEndLen = LLBC_StrLenA(macLineEnd);
-    while ((pos = normalizedContent.find(macLineEnd)) != LLBC_String::npos)
-        normalizedContent.replace(pos, lineEndLen, unixLineEnd);
-
-    // Split lines and strip the lines.
-    LLBC_Strings normalizedContents = normalizedContent.split(unixLineEnd);
-    for (size_t i = 0; i < normalizedContents.size(); i++)
-        normalizedContents[i].strip();
+    // Support UNIX(LF), WIN(CRLF) and MAC(CR) style line-end.
+    for (lineEnd = content; lineEnd < contentEnd; lineEnd++)
+    {
+        if (*lineEnd == '\n')
+            return lineEnd + 1;
+        else if (*lineEnd == '\r')
+            return (lineEnd + 1 < contentEnd && *(lineEnd + 1) == '\n') ? lineEnd + 2 : lineEnd + 1;
+    }
 
-    return normalizedContents;
+    return contentEnd;
 }
 
 int LLBC_Property::ParseLine(const LLBC_String &line, int lineNo)
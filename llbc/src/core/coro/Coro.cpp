@@ -0,0 +1,367 @@
+/**
+ * @file    Coro.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/thread/AdaptiveLock.h"
+#include "llbc/core/thread/Guard.h"
+
+#include "llbc/core/coro/Coro.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static volatile LLBC_NS sint64 __maxCoroId = 0;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+// The default size stacks cache.
+static LLBC_NS LLBC_AdaptiveLock __stackCacheLock;
+static std::vector<void *> __stackCache;
+
+static size_t __GetPageSize()
+{
+    static const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+// Stack mapping size: stack size round up to page size, plus one guard page.
+static size_t __GetStackMapSize(size_t stackSize)
+{
+    const size_t pageSize = __GetPageSize();
+    return (stackSize + pageSize - 1) / pageSize * pageSize + pageSize;
+}
+
+static void *__MapStack(size_t stackSize)
+{
+    const size_t mapSize = __GetStackMapSize(stackSize);
+    void *stack = ::mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (UNLIKELY(stack == MAP_FAILED))
+        return NULL;
+
+    // Stack grows down, protect the lowest page, stack overflow will trigger SIGSEGV instead of silent memory corruption.
+    if (UNLIKELY(::mprotect(stack, __GetPageSize(), PROT_NONE) != 0))
+    {
+        ::munmap(stack, mapSize);
+        return NULL;
+    }
+
+    return stack;
+}
+
+static void *__AllocStack(size_t stackSize)
+{
+    if (stackSize == LLBC_CFG_CORE_CORO_DFT_STACK_SIZE)
+    {
+        LLBC_NS LLBC_LockGuard<LLBC_NS LLBC_AdaptiveLock> guard(__stackCacheLock);
+        if (!__stackCache.empty())
+        {
+            void *stack = __stackCache.back();
+            __stackCache.pop_back();
+
+            return stack;
+        }
+    }
+
+    return __MapStack(stackSize);
+}
+
+static void __FreeStack(void *stack, size_t stackSize)
+{
+    if (stackSize == LLBC_CFG_CORE_CORO_DFT_STACK_SIZE)
+    {
+        LLBC_NS LLBC_LockGuard<LLBC_NS LLBC_AdaptiveLock> guard(__stackCacheLock);
+        if (__stackCache.size() < LLBC_CFG_CORE_CORO_STACK_CACHE_COUNT)
+        {
+            __stackCache.push_back(stack);
+            return;
+        }
+    }
+
+    ::munmap(stack, __GetStackMapSize(stackSize));
+}
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+#if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+/**
+ * Switch context: save callee-saved registers, MXCSR & x87 control word to current stack,
+ * store stack pointer to *fromSp, then restore the same from toSp and return to it.
+ * Signal mask not saved/restored, no system call.
+ */
+extern "C" void __llbc_CoroSwitch(void **fromSp, void *toSp);
+
+/**
+ * New coroutine first switched in entry: r12 is coroutine, r13 is entry function.
+ */
+extern "C" void __llbc_CoroTrampoline();
+
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    ".globl __llbc_CoroSwitch\n"
+    ".hidden __llbc_CoroSwitch\n"
+    ".type __llbc_CoroSwitch, @function\n"
+    "__llbc_CoroSwitch:\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".size __llbc_CoroSwitch, .-__llbc_CoroSwitch\n"
+
+    ".p2align 4\n"
+    ".globl __llbc_CoroTrampoline\n"
+    ".hidden __llbc_CoroTrampoline\n"
+    ".type __llbc_CoroTrampoline, @function\n"
+    "__llbc_CoroTrampoline:\n"
+    "    .cfi_startproc\n"
+    "    .cfi_undefined rip\n"
+    "    movq %r12, %rdi\n"
+    "    callq *%r13\n"
+    "    ud2\n"
+    "    .cfi_endproc\n"
+    ".size __llbc_CoroTrampoline, .-__llbc_CoroTrampoline\n"
+    ".previous\n"
+);
+
+/**
+ * Build the initial switch frame on top of new coroutine stack, first switch in will return to trampoline.
+ */
+static void *__MakeSwitchFrame(void *stackTop, void (*entry)(LLBC_NS LLBC_Coro *), LLBC_NS LLBC_Coro *coro)
+{
+    // Stack top is page aligned, after trampoline returned(popped), rsp is 16 bytes aligned as call instruction required.
+    void **sp = reinterpret_cast<void **>(stackTop) - 8;
+
+    // MXCSR & x87 control word inherit from creator.
+    LLBC_NS uint32 *fpCtrl = reinterpret_cast<LLBC_NS uint32 *>(sp);
+    fpCtrl[1] = 0;
+    __asm__ __volatile__("stmxcsr %0" : "=m"(fpCtrl[0]));
+    __asm__ __volatile__("fnstcw %0" : "=m"(*reinterpret_cast<LLBC_NS uint16 *>(&fpCtrl[1])));
+
+    sp[1] = NULL; // r15
+    sp[2] = NULL; // r14
+    sp[3] = reinterpret_cast<void *>(entry); // r13
+    sp[4] = coro; // r12
+    sp[5] = NULL; // rbx
+    sp[6] = NULL; // rbp
+    sp[7] = reinterpret_cast<void *>(&__llbc_CoroTrampoline); // return address
+
+    return sp;
+}
+#endif // LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_Coro::LLBC_Coro(LLBC_IDelegate0 *entry, size_t stackSize)
+: _id(LLBC_AtomicFetchAndAdd(&LLBC_INL_NS __maxCoroId, 1) + 1)
+, _state(Ready)
+, _entry(entry)
+
+, _stackSize(stackSize > 0 ? stackSize : LLBC_CFG_CORE_CORO_DFT_STACK_SIZE)
+, _prevCoro(NULL)
+
+#if LLBC_TARGET_PLATFORM_LINUX
+, _stack(NULL)
+ #if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+, _sp(NULL)
+, _callerSp(NULL)
+ #endif // LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+#elif LLBC_TARGET_PLATFORM_WIN32
+, _fiber(NULL)
+, _callerFiber(NULL)
+#endif
+{
+}
+
+LLBC_Coro::~LLBC_Coro()
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    if (_stack)
+        LLBC_INL_NS __FreeStack(_stack, _stackSize);
+#elif LLBC_TARGET_PLATFORM_WIN32
+    if (_fiber)
+        ::DeleteFiber(_fiber);
+#endif
+
+    LLBC_XDelete(_entry);
+}
+
+sint64 LLBC_Coro::GetId() const
+{
+    return _id;
+}
+
+int LLBC_Coro::GetState() const
+{
+    return _state;
+}
+
+int LLBC_Coro::Resume()
+{
+    if (UNLIKELY(_state == Running || _state == Finished))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return LLBC_FAILED;
+    }
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    if (_state == Ready)
+    {
+        if (UNLIKELY(!(_stack = LLBC_INL_NS __AllocStack(_stackSize))))
+        {
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+            return LLBC_FAILED;
+        }
+
+        // Skip the guard page at stack mapping bottom.
+        const size_t guardSize = LLBC_INL_NS __GetPageSize();
+        const size_t usableSize = LLBC_INL_NS __GetStackMapSize(_stackSize) - guardSize;
+ #if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+        _sp = LLBC_INL_NS __MakeSwitchFrame(
+            reinterpret_cast<char *>(_stack) + guardSize + usableSize, &LLBC_Coro::Entry, this);
+ #else // !LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+        getcontext(&_ctx);
+        _ctx.uc_stack.ss_sp = reinterpret_cast<char *>(_stack) + guardSize;
+        _ctx.uc_stack.ss_size = usableSize;
+        _ctx.uc_link = &_callerCtx;
+
+        // makecontext only pass int arguments, split this pointer to high/low 32 bits.
+        const uint64 ptr = reinterpret_cast<uint64>(this);
+        makecontext(&_ctx,
+                    reinterpret_cast<void (*)()>(&LLBC_Coro::Entry),
+                    2,
+                    static_cast<uint32>(ptr >> 32),
+                    static_cast<uint32>(ptr & 0xffffffff));
+ #endif // LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+    }
+#elif LLBC_TARGET_PLATFORM_WIN32
+    if (!::IsThreadAFiber())
+        ::ConvertThreadToFiber(NULL);
+
+    if (_state == Ready &&
+        UNLIKELY(!(_fiber = ::CreateFiber(_stackSize, &LLBC_Coro::Entry, this))))
+    {
+        LLBC_SetLastError(LLBC_ERROR_OSAPI);
+        return LLBC_FAILED;
+    }
+#else
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return LLBC_FAILED;
+#endif
+
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+    _prevCoro = reinterpret_cast<LLBC_Coro *>(tls->coreTls.coro);
+    tls->coreTls.coro = this;
+
+    _state = Running;
+#if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+    LLBC_INL_NS __llbc_CoroSwitch(&_callerSp, _sp);
+#elif LLBC_TARGET_PLATFORM_LINUX
+    swapcontext(&_callerCtx, &_ctx);
+#elif LLBC_TARGET_PLATFORM_WIN32
+    _callerFiber = ::GetCurrentFiber();
+    ::SwitchToFiber(_fiber);
+#endif
+
+    // Back to resumer, coroutine yielded or finished.
+    tls->coreTls.coro = _prevCoro;
+    _prevCoro = NULL;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Finished, release stack as early as possible.
+    if (_state == Finished)
+    {
+        LLBC_INL_NS __FreeStack(_stack, _stackSize);
+        _stack = NULL;
+    }
+#endif
+
+    return LLBC_OK;
+}
+
+int LLBC_Coro::Yield()
+{
+    LLBC_Coro *coro = GetCurrent();
+    if (UNLIKELY(!coro))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return LLBC_FAILED;
+    }
+
+    coro->_state = Suspended;
+#if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+    LLBC_INL_NS __llbc_CoroSwitch(&coro->_sp, coro->_callerSp);
+#elif LLBC_TARGET_PLATFORM_LINUX
+    swapcontext(&coro->_ctx, &coro->_callerCtx);
+#elif LLBC_TARGET_PLATFORM_WIN32
+    ::SwitchToFiber(coro->_callerFiber);
+#endif
+
+    return LLBC_OK;
+}
+
+LLBC_Coro *LLBC_Coro::GetCurrent()
+{
+    return reinterpret_cast<LLBC_Coro *>(__LLBC_GetLibTls()->coreTls.coro);
+}
+
+void LLBC_Coro::Run()
+{
+    _entry->Invoke();
+    _state = Finished;
+}
+
+#if LLBC_CFG_CORE_CORO_USE_ASM_SWITCH
+void LLBC_Coro::Entry(LLBC_Coro *coro)
+{
+    coro->Run();
+
+    // No caller frame in coroutine stack, switch back to resumer forever.
+    LLBC_INL_NS __llbc_CoroSwitch(&coro->_sp, coro->_callerSp);
+}
+#elif LLBC_TARGET_PLATFORM_LINUX
+void LLBC_Coro::Entry(uint32 high, uint32 low)
+{
+    LLBC_Coro *coro = reinterpret_cast<LLBC_Coro *>((static_cast<uint64>(high) << 32) | low);
+    coro->Run();
+
+    // Return to uc_link(the resumer context).
+}
+#elif LLBC_TARGET_PLATFORM_WIN32
+void WINAPI LLBC_Coro::Entry(void *arg)
+{
+    LLBC_Coro *coro = reinterpret_cast<LLBC_Coro *>(arg);
+    coro->Run();
+
+    // Fiber entry can't return, switch back to resumer forever.
+    ::SwitchToFiber(coro->_callerFiber);
+}
+#endif
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -11,14 +11,333 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/os/OS_Time.h"
+#include "llbc/core/os/OS_Thread.h"
+#include "llbc/core/os/OS_IoUring.h"
 
 #include "llbc/core/file/File.h"
 #include "llbc/core/file/Directory.h"
+#include "llbc/core/file/MappedFile.h"
 
 #if LLBC_TARGET_PLATFORM_WIN32
 #pragma warning(disable:4996)
 #endif
 
+#if LLBC_TARGET_PLATFORM_LINUX
+__LLBC_INTERNAL_NS_BEGIN
+
+// The reflink ioctl request code, same as FICLONE in <linux/fs.h>.
+static const unsigned long __reflinkRequest = _IOW(0x94, 9, int);
+
+/**
+ * Copy file data in kernel, use copy_file_range first, if not supported, use sendfile.
+ * Note: Source file always copy from begin, use explicit offset, the source fd offset maybe
+ *       changed by stdio buffer(eg: fseek), destination file always write from current fd offset.
+ * @param[in] srcFd    - the source file descriptor.
+ * @param[in] destFd   - the destination file descriptor.
+ * @param[in] size     - the will copy size.
+ * @param[out] copied  - the actually copied size.
+ * @return int - return 0 if success(copied maybe less than size if source file truncated),
+ *               return 1 if kernel copy not supported(and nothing copied), otherwise return -1.
+ */
+static int __CopyInKernel(int srcFd, int destFd, long size, long &copied)
+{
+    copied = 0;
+
+#ifdef __NR_copy_file_range
+    while (copied < size)
+    {
+        loff_t srcOffset = copied;
+        const long ret = syscall(__NR_copy_file_range, srcFd, &srcOffset, destFd, NULL, size - copied, 0);
+        if (ret > 0)
+            copied += ret;
+        else if (ret == 0)
+            return 0;
+        else if (errno == EINTR)
+            continue;
+        else if (copied == 0 &&
+                 (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP))
+            break;
+        else
+            return -1;
+    }
+
+    if (copied == size)
+        return 0;
+#endif // __NR_copy_file_range
+
+    while (copied < size)
+    {
+        off_t srcOffset = copied;
+        const ssize_t ret = sendfile(destFd, srcFd, &srcOffset, size - copied);
+        if (ret > 0)
+            copied += ret;
+        else if (ret == 0)
+            return 0;
+        else if (errno == EINTR)
+            continue;
+        else if (copied == 0 && (errno == ENOSYS || errno == EINVAL))
+            return 1;
+        else
+            return -1;
+    }
+
+    return 0;
+}
+
+#if LLBC_CFG_CORE_FILE_BULK_IO_USE_IO_URING
+/**
+ * The bulk io in-flight block slot.
+ */
+struct __BulkIOSlot
+{
+    LLBC_NS uint64 blockOffset; // The block offset, relative to bulk io begin offset.
+    LLBC_NS uint64 blockSize;
+    LLBC_NS uint64 done;
+};
+
+/**
+ * Prepare the read/write submission queue entry of slot's remaining block data.
+ * @return bool - return true if success, return false if submission queue full.
+ */
+static bool __PrepareBulkIOSqe(LLBC_NS LLBC_IoUring &ring,
+                               int fd,
+                               bool isWrite,
+                               char *buf,
+                               LLBC_NS sint64 offset,
+                               const __BulkIOSlot &slot,
+                               LLBC_NS uint32 slotIdx)
+{
+    LLBC_NS LLBC_IoUringSqe *sqe = LLBC_NS LLBC_IoUringGetSqe(ring);
+    if (UNLIKELY(!sqe))
+        return false;
+
+    sqe->opcode = isWrite ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<LLBC_NS uint64>(buf + slot.blockOffset + slot.done);
+    sqe->len = static_cast<LLBC_NS uint32>(slot.blockSize - slot.done);
+    sqe->off = static_cast<LLBC_NS uint64>(offset) + slot.blockOffset + slot.done;
+    sqe->user_data = slotIdx;
+
+    return true;
+}
+
+/**
+ * Read/Write file data asynchronously by io_uring, data split to blocks, every slot hold one in-flight block.
+ * Note: Offset based io is idempotent, so if any io_uring operation failed, caller can redo by buffered io.
+ * @param[in] fd      - the file descriptor.
+ * @param[in] isWrite - is write or not.
+ * @param[in] buf     - the data buffer.
+ * @param[in] size    - the read/write size.
+ * @param[in] offset  - the file offset.
+ * @param[out] done   - the actually read/written size.
+ * @return int - return 0 if success(done maybe less than size if reached end of file),
+ *               return 1 if io_uring not available or any operation failed.
+ */
+static int __BulkIOByIoUring(int fd, bool isWrite, char *buf, LLBC_NS uint64 size, LLBC_NS sint64 offset, LLBC_NS uint64 &done)
+{
+    done = 0;
+
+    const LLBC_NS uint64 blockSize = LLBC_CFG_CORE_FILE_BULK_IO_BLOCK_SIZE;
+    const LLBC_NS uint64 blockCount = (size + blockSize - 1) / blockSize;
+    const LLBC_NS uint32 queueDepth = static_cast<LLBC_NS uint32>(MIN(blockCount, LLBC_CFG_CORE_FILE_BULK_IO_QUEUE_DEPTH));
+
+    LLBC_NS LLBC_IoUring ring;
+    if (LLBC_NS LLBC_IoUringQueueInit(queueDepth, queueDepth * 2, ring) != LLBC_OK)
+        return 1;
+
+    std::vector<__BulkIOSlot> slots(queueDepth);
+    std::vector<LLBC_NS uint32> freeSlots;
+    for (LLBC_NS uint32 slotIdx = queueDepth; slotIdx > 0; --slotIdx)
+        freeSlots.push_back(slotIdx - 1);
+
+    LLBC_NS uint64 nextBlock = 0;
+    LLBC_NS uint64 eofOffset = size;
+    LLBC_NS uint32 inFlight = 0;
+    bool failed = false;
+    while (true)
+    {
+        // Assign next blocks to free slots.
+        while (!failed && !freeSlots.empty() && nextBlock < blockCount)
+        {
+            __BulkIOSlot &slot = slots[freeSlots.back()];
+            slot.blockOffset = nextBlock++ * blockSize;
+            slot.blockSize = MIN(blockSize, size - slot.blockOffset);
+            slot.done = 0;
+
+            if (UNLIKELY(!__PrepareBulkIOSqe(ring, fd, isWrite, buf, offset, slot, freeSlots.back())))
+            {
+                failed = true;
+                break;
+            }
+
+            freeSlots.pop_back();
+            ++inFlight;
+        }
+
+        // Even if failed, must wait all in-flight requests completed, kernel may still access the buffer.
+        if (inFlight == 0)
+            break;
+
+        // If submit failed, stop issuing new requests but keep reaping completions until in-flight requests drained,
+        // the not consumed entries will be submitted again by next submit call.
+        if (UNLIKELY(LLBC_NS LLBC_IoUringSubmit(ring, 1, 1000) == LLBC_FAILED))
+        {
+            failed = true;
+            LLBC_NS LLBC_Sleep(1);
+        }
+
+        // Handle completions, short read/write continue in same slot.
+        LLBC_NS LLBC_IoUringCqe *cqe;
+        while ((cqe = LLBC_NS LLBC_IoUringPeekCqe(ring)) != NULL)
+        {
+            const int res = cqe->res;
+            const LLBC_NS uint32 slotIdx = static_cast<LLBC_NS uint32>(cqe->user_data);
+            LLBC_NS LLBC_IoUringCqeSeen(ring);
+            --inFlight;
+
+            __BulkIOSlot &slot = slots[slotIdx];
+            bool slotFinished = true;
+            if (res > 0)
+            {
+                slot.done += res;
+                slotFinished = slot.done == slot.blockSize;
+            }
+            else if (res == 0 && !isWrite)
+            {
+                eofOffset = MIN(eofOffset, slot.blockOffset + slot.done);
+            }
+            else if (res == -EINTR || res == -EAGAIN)
+            {
+                slotFinished = false;
+            }
+            else
+            {
+                failed = true;
+            }
+
+            if (!slotFinished && !failed)
+            {
+                if (LIKELY(__PrepareBulkIOSqe(ring, fd, isWrite, buf, offset, slot, slotIdx)))
+                {
+                    ++inFlight;
+                    continue;
+                }
+
+                failed = true;
+            }
+
+            freeSlots.push_back(slotIdx);
+        }
+    }
+
+    LLBC_NS LLBC_IoUringQueueExit(ring);
+    if (failed)
+        return 1;
+
+    done = eofOffset;
+
+    return 0;
+}
+#endif // LLBC_CFG_CORE_FILE_BULK_IO_USE_IO_URING
+
+__LLBC_INTERNAL_NS_END
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+__LLBC_INTERNAL_NS_BEGIN
+
+/**
+ * Read/Write file data by buffered io at specified offset, file position not changed.
+ * @return sint64 - actually read/written size, if failed, return -1.
+ */
+static LLBC_NS sint64 __BulkIOBuffered(LLBC_NS LLBC_FileHandle handle, bool isWrite, char *buf, LLBC_NS uint64 size, LLBC_NS sint64 offset)
+{
+    LLBC_NS uint64 done = 0;
+#if LLBC_TARGET_PLATFORM_WIN32
+    const __int64 oldPos = _ftelli64(handle);
+    if (oldPos == -1 || _fseeki64(handle, offset, SEEK_SET) != 0)
+        return -1;
+
+    while (done < size)
+    {
+        const size_t ioSize = static_cast<size_t>(MIN(size - done, LLBC_CFG_CORE_FILE_BULK_IO_BLOCK_SIZE));
+        const size_t ret = isWrite ? fwrite(buf + done, 1, ioSize, handle) : fread(buf + done, 1, ioSize, handle);
+        done += ret;
+        if (ret != ioSize)
+        {
+            if (ferror(handle) != 0)
+            {
+                _fseeki64(handle, oldPos, SEEK_SET);
+                return -1;
+            }
+
+            break;
+        }
+    }
+
+    if (_fseeki64(handle, oldPos, SEEK_SET) != 0)
+        return -1;
+#else // Non-WIN32
+    const int fd = fileno(handle);
+    while (done < size)
+    {
+        const ssize_t ret = isWrite ?
+            pwrite(fd, buf + done, static_cast<size_t>(size - done), static_cast<off_t>(offset + done)) :
+                pread(fd, buf + done, static_cast<size_t>(size - done), static_cast<off_t>(offset + done));
+        if (ret > 0)
+            done += ret;
+        else if (ret == 0)
+            break;
+        else if (errno != EINTR)
+            return -1;
+    }
+#endif // LLBC_TARGET_PLATFORM_WIN32
+
+    return static_cast<LLBC_NS sint64>(done);
+}
+
+/**
+ * Read/Write file data at specified offset, large data use io_uring in linux platform if supported.
+ * @return sint64 - actually read/written size, if failed, return -1.
+ */
+static LLBC_NS sint64 __BulkIO(LLBC_NS LLBC_FileHandle handle, int mode, bool isWrite, char *buf, size_t size, LLBC_NS sint64 offset)
+{
+    if (UNLIKELY(offset < 0))
+    {
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_ARG);
+        return -1;
+    }
+    else if (size == 0)
+    {
+        return 0;
+    }
+
+    // Flush stdio buffered written data first, make bulk io and stdio io see same file content.
+    if ((mode & (LLBC_NS LLBC_FileMode::Write | LLBC_NS LLBC_FileMode::AppendWrite)) && fflush(handle) != 0)
+    {
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return -1;
+    }
+
+#if LLBC_CFG_CORE_FILE_BULK_IO_USE_IO_URING
+    // Append write can't write blocks out of order, always use buffered write.
+    if (size > LLBC_CFG_CORE_FILE_BULK_IO_BLOCK_SIZE &&
+        !(isWrite && (mode & LLBC_NS LLBC_FileMode::AppendWrite)))
+    {
+        LLBC_NS uint64 done;
+        if (__BulkIOByIoUring(fileno(handle), isWrite, buf, size, offset, done) == 0)
+            return static_cast<LLBC_NS sint64>(done);
+    }
+#endif // LLBC_CFG_CORE_FILE_BULK_IO_USE_IO_URING
+
+    const LLBC_NS sint64 ret = __BulkIOBuffered(handle, isWrite, buf, size, offset);
+    if (ret == -1)
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+    return ret;
+}
+
+__LLBC_INTERNAL_NS_END
+
 __LLBC_NS_BEGIN
 
 LLBC_String LLBC_FileMode::GetFileModeDesc(int fileMode)
@@ -366,9 +685,39 @@ LLBC_String LLBC_File::ReadToEnd()
      if (!file.IsOpened())
          return "";
 
-     return file.ReadToEnd();
+     // Read whole file by bulk read, large file will read asynchronously.
+     LLBC_String str;
+     const long fileSize = file.GetFileSize();
+     if (UNLIKELY(fileSize < 0))
+         return str;
+
+     str.resize(static_cast<size_t>(fileSize));
+     const sint64 actuallyRead = file.BulkRead(const_cast<char *>(str.data()), str.size(), 0);
+     if (UNLIKELY(actuallyRead == -1))
+     {
+         str.resize(0);
+         return str;
+     }
+     else if (actuallyRead < fileSize)
+     {
+         str.resize(static_cast<size_t>(actuallyRead));
+     }
+
+     LLBC_SetLastError(LLBC_ERROR_SUCCESS);
+     return str;
  }
 
+sint64 LLBC_File::BulkRead(void *buf, size_t size, sint64 offset)
+{
+    if (!IsOpened())
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_OPEN);
+        return -1;
+    }
+
+    return LLBC_INL_NS __BulkIO(_handle, _mode, false, reinterpret_cast<char *>(buf), size, offset);
+}
+
 long LLBC_File::Read(void *buf, size_t size)
 {
     if (!IsOpened())
@@ -405,6 +754,17 @@ long LLBC_File::Write(const void *buf, size_t size)
     return static_cast<long>(actuallyWrote);
 }
 
+sint64 LLBC_File::BulkWrite(const void *buf, size_t size, sint64 offset)
+{
+    if (!IsOpened())
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_OPEN);
+        return -1;
+    }
+
+    return LLBC_INL_NS __BulkIO(_handle, _mode, true, reinterpret_cast<char *>(const_cast<void *>(buf)), size, offset);
+}
+
 int LLBC_File::Flush()
 {
     if (!IsOpened())
@@ -711,8 +1071,40 @@ int LLBC_File::CopyFile(const LLBC_String &srcFilePath, const LLBC_String &destF
         return LLBC_FAILED;
 
     long srcFileSize = srcFile.GetFileSize();
-    if (srcFileSize == 0)
+    if (srcFileSize == -1)
+        return LLBC_FAILED;
+    else if (srcFileSize == 0)
+        return LLBC_OK;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    const int srcFd = srcFile.GetFileNo();
+    const int destFd = destFile.GetFileNo();
+    if (srcFd == -1 || destFd == -1)
+        return LLBC_FAILED;
+
+    // Try reflink first, if file system support, share data blocks with source file, nothing need copy.
+    if (ioctl(destFd, LLBC_INL_NS __reflinkRequest, srcFd) == 0)
+        return LLBC_OK;
+
+    // Then try copy in kernel, avoid copying data between kernel and user space.
+    long kernelCopied;
+    const int kernelCopyRet = LLBC_INL_NS __CopyInKernel(srcFd, destFd, srcFileSize, kernelCopied);
+    if (kernelCopyRet == 0)
+    {
+        if (UNLIKELY(kernelCopied != srcFileSize))
+        {
+            LLBC_SetLastError(LLBC_ERROR_TRUNCATED);
+            return LLBC_FAILED;
+        }
+
         return LLBC_OK;
+    }
+    else if (kernelCopyRet == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+#endif // LLBC_TARGET_PLATFORM_LINUX
 
     long copyBufSize = MIN(LLBC_CFG_CORE_FILE_COPY_BUF_SIZE, srcFileSize);
     sint8 *copyBuf = LLBC_Malloc(sint8, copyBufSize);
@@ -735,6 +1127,12 @@ int LLBC_File::CopyFile(const LLBC_String &srcFilePath, const LLBC_String &destF
             return LLBC_FAILED;
         }
 
+        if (UNLIKELY(destFile.Write(copyBuf, actuallyCopy) != actuallyCopy))
+        {
+            LLBC_Free(copyBuf);
+            return LLBC_FAILED;
+        }
+
         copiedSize += actuallyCopy;
     }
 
@@ -820,6 +1218,25 @@ int LLBC_File::DeleteFile(const LLBC_String &filePath)
 #endif
 }
 
+int LLBC_File::Map(LLBC_MappedFile &mappedFile)
+{
+    if (!IsOpened())
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_OPEN);
+        return LLBC_FAILED;
+    }
+
+    if (Flush() != LLBC_OK)
+        return LLBC_FAILED;
+
+    return Map(_path, mappedFile);
+}
+
+int LLBC_File::Map(const LLBC_String &filePath, LLBC_MappedFile &mappedFile)
+{
+    return mappedFile.Open(filePath);
+}
+
 const char *LLBC_File::ParseFileMode(int mode)
 {
     bool openAsText = (mode & LLBC_FileMode::Text) == LLBC_FileMode::Text;
@@ -0,0 +1,165 @@
+/**
+ * @file    MappedFile.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/file/MappedFile.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_MappedFile::LLBC_MappedFile()
+: _opened(false)
+, _data(NULL)
+, _size(0)
+#if LLBC_TARGET_PLATFORM_WIN32
+, _mapping(NULL)
+#endif // LLBC_TARGET_PLATFORM_WIN32
+{
+}
+
+LLBC_MappedFile::LLBC_MappedFile(const LLBC_String &path)
+: _opened(false)
+, _data(NULL)
+, _size(0)
+#if LLBC_TARGET_PLATFORM_WIN32
+, _mapping(NULL)
+#endif // LLBC_TARGET_PLATFORM_WIN32
+{
+    Open(path);
+}
+
+LLBC_MappedFile::~LLBC_MappedFile()
+{
+    Close();
+}
+
+int LLBC_MappedFile::Open(const LLBC_String &path)
+{
+    if (_opened)
+    {
+        LLBC_SetLastError(LLBC_ERROR_OPENED);
+        return LLBC_FAILED;
+    }
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) != 0)
+    {
+        ::close(fd);
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    // Empty file can not be mapped, treat as mapped success.
+    const size_t size = static_cast<size_t>(fileStat.st_size);
+    if (size > 0)
+    {
+        void *addr = ::mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED)
+        {
+            ::close(fd);
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+            return LLBC_FAILED;
+        }
+
+        _data = reinterpret_cast<const char *>(addr);
+    }
+
+    // Mapping keep valid after file descriptor closed.
+    ::close(fd);
+#else // WIN32
+    HANDLE file = ::CreateFileA(path.c_str(),
+                                GENERIC_READ,
+                                FILE_SHARE_READ,
+                                NULL,
+                                OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL,
+                                NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        LLBC_SetLastError(LLBC_ERROR_OSAPI);
+        return LLBC_FAILED;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!::GetFileSizeEx(file, &fileSize))
+    {
+        ::CloseHandle(file);
+        LLBC_SetLastError(LLBC_ERROR_OSAPI);
+        return LLBC_FAILED;
+    }
+
+    const size_t size = static_cast<size_t>(fileSize.QuadPart);
+    if (size > 0)
+    {
+        _mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (_mapping == NULL)
+        {
+            ::CloseHandle(file);
+            LLBC_SetLastError(LLBC_ERROR_OSAPI);
+            return LLBC_FAILED;
+        }
+
+        _data = reinterpret_cast<const char *>(::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (_data == NULL)
+        {
+            ::CloseHandle(_mapping);
+            _mapping = NULL;
+            ::CloseHandle(file);
+
+            LLBC_SetLastError(LLBC_ERROR_OSAPI);
+            return LLBC_FAILED;
+        }
+    }
+
+    ::CloseHandle(file);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    _path = path;
+    _size = size;
+    _opened = true;
+
+    return LLBC_OK;
+}
+
+void LLBC_MappedFile::Close()
+{
+    if (!_opened)
+        return;
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    if (_data)
+        ::munmap(const_cast<char *>(_data), _size);
+#else // WIN32
+    if (_data)
+        ::UnmapViewOfFile(_data);
+    if (_mapping)
+        ::CloseHandle(_mapping);
+
+    _mapping = NULL;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    _data = NULL;
+    _size = 0;
+    _path.clear();
+
+    _opened = false;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -0,0 +1,1860 @@
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/json/document.h"
+#include "llbc/core/json/value.h"
+#include "json_tool.h"
+
+#include <cstdlib>
+#include <cstring>
+
+__LLBC_NS_BEGIN
+
+namespace Json {
+
+// Parse stage 1 helpers
+// ////////////////////////////////
+
+namespace {
+
+/// Characters classification bit masks of a 64 bytes block, bit i for block[i].
+struct BlockMasks
+{
+   ULongLong quote;
+   ULongLong backslash;
+   ULongLong op;        // '{', '}', '[', ']', ':', ','
+   ULongLong space;     // ' ', '\t', '\r', '\n'
+   ULongLong control;   // [0x00, 0x1F]
+   ULongLong high;      // [0x80, 0xFF]
+};
+
+static inline void classifyBlock( const char *block, BlockMasks &masks )
+{
+# ifdef JSON_USE_SSE2
+   const __m128i quote = _mm_set1_epi8( '"' );
+   const __m128i backslash = _mm_set1_epi8( '\\' );
+   const __m128i lowerBit = _mm_set1_epi8( 0x20 );
+   const __m128i openBrace = _mm_set1_epi8( '{' );   // '[' | 0x20 == '{'
+   const __m128i closeBrace = _mm_set1_epi8( '}' );  // ']' | 0x20 == '}'
+   const __m128i colon = _mm_set1_epi8( ':' );
+   const __m128i comma = _mm_set1_epi8( ',' );
+   const __m128i blank = _mm_set1_epi8( ' ' );
+   const __m128i tab = _mm_set1_epi8( '\t' );
+   const __m128i cr = _mm_set1_epi8( '\r' );
+   const __m128i lf = _mm_set1_epi8( '\n' );
+   const __m128i maxControl = _mm_set1_epi8( 0x1F );
+
+   masks.quote = masks.backslash = masks.op = masks.space = masks.control = masks.high = 0;
+   for ( int i = 0; i < 4; ++i )
+   {
+      const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i *>( block + i * 16 ) );
+      const __m128i lower = _mm_or_si128( chunk, lowerBit );
+      const __m128i op = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( lower, openBrace ),
+                                                     _mm_cmpeq_epi8( lower, closeBrace ) ),
+                                       _mm_or_si128( _mm_cmpeq_epi8( chunk, colon ),
+                                                     _mm_cmpeq_epi8( chunk, comma ) ) );
+      const __m128i space = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( chunk, blank ),
+                                                        _mm_cmpeq_epi8( chunk, tab ) ),
+                                          _mm_or_si128( _mm_cmpeq_epi8( chunk, cr ),
+                                                        _mm_cmpeq_epi8( chunk, lf ) ) );
+      // unsigned chunk <= 0x1F  <==>  max(chunk, 0x1F) == 0x1F
+      const __m128i control = _mm_cmpeq_epi8( _mm_max_epu8( chunk, maxControl ), maxControl );
+
+      const int shift = i * 16;
+      masks.quote |= static_cast<ULongLong>( static_cast<unsigned int>(
+         _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, quote ) ) ) ) << shift;
+      masks.backslash |= static_cast<ULongLong>( static_cast<unsigned int>(
+         _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, backslash ) ) ) ) << shift;
+      masks.op |= static_cast<ULongLong>( static_cast<unsigned int>( _mm_movemask_epi8( op ) ) ) << shift;
+      masks.space |= static_cast<ULongLong>( static_cast<unsigned int>( _mm_movemask_epi8( space ) ) ) << shift;
+      masks.control |= static_cast<ULongLong>( static_cast<unsigned int>( _mm_movemask_epi8( control ) ) ) << shift;
+      masks.high |= static_cast<ULongLong>( static_cast<unsigned int>( _mm_movemask_epi8( chunk ) ) ) << shift;
+   }
+# else // !JSON_USE_SSE2
+   masks.quote = masks.backslash = masks.op = masks.space = masks.control = masks.high = 0;
+   for ( int i = 0; i < 64; ++i )
+   {
+      const unsigned char c = static_cast<unsigned char>( block[i] );
+      const ULongLong bit = 1ULL << i;
+      switch ( c )
+      {
+      case '"': masks.quote |= bit; break;
+      case '\\': masks.backslash |= bit; break;
+      case '{': case '}': case '[': case ']': case ':': case ',': masks.op |= bit; break;
+      case ' ': masks.space |= bit; break;
+      case '\t': case '\r': case '\n': masks.space |= bit; masks.control |= bit; break;
+      default:
+         if ( c <= 0x1F )
+            masks.control |= bit;
+         else if ( c >= 0x80 )
+            masks.high |= bit;
+         break;
+      }
+   }
+# endif // JSON_USE_SSE2
+}
+
+/// Get the mask of characters escaped by an odd length backslash sequence.
+/// prevEndsOddBackslash carries whether previous block ends with an odd length backslash sequence(0 or 1).
+static inline ULongLong findEscapedChars( ULongLong backslash, ULongLong &prevEndsOddBackslash )
+{
+   const ULongLong evenBits = 0x5555555555555555ULL;
+   const ULongLong oddBits = ~evenBits;
+
+   const ULongLong startEdges = backslash & ~( backslash << 1 );
+   const ULongLong evenStartMask = evenBits ^ prevEndsOddBackslash;
+   const ULongLong evenStarts = startEdges & evenStartMask;
+   const ULongLong oddStarts = startEdges & ~evenStartMask;
+
+   // Add sequence start to sequence, carry out at the sequence end, an even start
+   // sequence ends at odd position means odd length, and vice versa.
+   const ULongLong evenCarries = backslash + evenStarts;
+   ULongLong oddCarries = backslash + oddStarts;
+   const bool endsOddBackslash = oddCarries < backslash;
+   oddCarries |= prevEndsOddBackslash;
+   prevEndsOddBackslash = endsOddBackslash ? 1ULL : 0ULL;
+
+   const ULongLong evenCarryEnds = evenCarries & ~backslash;
+   const ULongLong oddCarryEnds = oddCarries & ~backslash;
+   return ( evenCarryEnds & oddBits ) | ( oddCarryEnds & evenBits );
+}
+
+/// Get the prefix xor of mask, bit i = mask bit 0 ^ ... ^ mask bit i.
+static inline ULongLong prefixXor( ULongLong mask )
+{
+   mask ^= mask << 1;
+   mask ^= mask << 2;
+   mask ^= mask << 4;
+   mask ^= mask << 8;
+   mask ^= mask << 16;
+   mask ^= mask << 32;
+   return mask;
+}
+
+/// Validate UTF-8 sequences start from current, stop at the first sequence start at or after limit.
+/// Return true if valid, current is updated to validated end, or the invalid sequence start if invalid.
+static bool validateUtf8( const unsigned char *&current,
+                          const unsigned char *limit,
+                          const unsigned char *end )
+{
+   while ( current < limit )
+   {
+      const unsigned char c = *current;
+      if ( c < 0x80 )
+      {
+         ++current;
+         continue;
+      }
+
+      int length;
+      unsigned char minSecond = 0x80, maxSecond = 0xBF;
+      if ( c >= 0xC2  &&  c <= 0xDF )
+         length = 2;
+      else if ( c >= 0xE0  &&  c <= 0xEF )
+      {
+         length = 3;
+         if ( c == 0xE0 )
+            minSecond = 0xA0;
+         else if ( c == 0xED ) // surrogates
+            maxSecond = 0x9F;
+      }
+      else if ( c >= 0xF0  &&  c <= 0xF4 )
+      {
+         length = 4;
+         if ( c == 0xF0 )
+            minSecond = 0x90;
+         else if ( c == 0xF4 )
+            maxSecond = 0x8F;
+      }
+      else
+         return false;
+
+      if ( end - current < length )
+         return false;
+      if ( current[1] < minSecond  ||  current[1] > maxSecond )
+         return false;
+      for ( int i = 2; i < length; ++i )
+      {
+         if ( ( current[i] & 0xC0 ) != 0x80 )
+            return false;
+      }
+
+      current += length;
+   }
+
+   return true;
+}
+
+static inline bool isTerminator( char c )
+{
+   switch ( c )
+   {
+   case ' ': case '\t': case '\r': case '\n':
+   case ',': case ':': case '}': case ']': case '{': case '[':
+      return true;
+   default:
+      return false;
+   }
+}
+
+static inline bool isDigit( char c )
+{
+   return c >= '0'  &&  c <= '9';
+}
+
+/// Decoded number.
+struct Number
+{
+   Document::NodeType type;
+   LongLong int64_;
+   ULongLong uint64_;
+   double double_;
+};
+
+/// Decode a number start at begin, number must end at terminator or document end.
+/// Return error message if failed, otherwise return 0.
+static const char *decodeNumber( const char *begin, const char *end, Number &number )
+{
+   const char *current = begin;
+   const bool negative = *current == '-';
+   if ( negative )
+      ++current;
+
+   const char *digitsBegin = current;
+   if ( current == end  ||  !isDigit( *current ) )
+      return "Bad number, digit expected.";
+   if ( *current == '0' )
+   {
+      if ( ++current != end  &&  isDigit( *current ) )
+         return "Bad number, leading zero not allowed.";
+   }
+   else
+   {
+      while ( current != end  &&  isDigit( *current ) )
+         ++current;
+   }
+   const char *digitsEnd = current;
+
+   bool isIntegral = true;
+   if ( current != end  &&  *current == '.' )
+   {
+      isIntegral = false;
+      if ( ++current == end  ||  !isDigit( *current ) )
+         return "Bad number, digit expected after decimal point.";
+      while ( current != end  &&  isDigit( *current ) )
+         ++current;
+   }
+   if ( current != end  &&  ( *current == 'e'  ||  *current == 'E' ) )
+   {
+      isIntegral = false;
+      if ( ++current != end  &&  ( *current == '+'  ||  *current == '-' ) )
+         ++current;
+      if ( current == end  ||  !isDigit( *current ) )
+         return "Bad number, digit expected in exponent.";
+      while ( current != end  &&  isDigit( *current ) )
+         ++current;
+   }
+   if ( current != end  &&  !isTerminator( *current ) )
+      return "Bad number, unexpected character.";
+
+   if ( isIntegral  &&  digitsEnd - digitsBegin <= 20 )
+   {
+      // 19 digits never overflow, the 20th digit need check.
+      ULongLong magnitude = 0;
+      bool overflow = false;
+      for ( const char *digit = digitsBegin; digit != digitsEnd; ++digit )
+      {
+         const ULongLong prev = magnitude;
+         magnitude = magnitude * 10 + static_cast<ULongLong>( *digit - '0' );
+         if ( magnitude / 10 != prev )
+         {
+            overflow = true;
+            break;
+         }
+      }
+
+      if ( !overflow )
+      {
+         if ( !negative )
+         {
+            if ( magnitude <= static_cast<ULongLong>( Value::maxLong ) )
+            {
+               number.type = Document::int64Node;
+               number.int64_ = static_cast<LongLong>( magnitude );
+            }
+            else
+            {
+               number.type = Document::uint64Node;
+               number.uint64_ = magnitude;
+            }
+
+            return 0;
+         }
+         else if ( magnitude <= static_cast<ULongLong>( Value::maxLong ) + 1 )
+         {
+            number.type = Document::int64Node;
+            number.int64_ = static_cast<LongLong>( 0 - magnitude );
+            return 0;
+         }
+      }
+   }
+
+   // Fraction/exponent or integer out of 64 bits range.
+   const int bufferSize = 64;
+   const int length = int( current - begin );
+   if ( length < bufferSize )
+   {
+      char buffer[bufferSize];
+      memcpy( buffer, begin, length );
+      buffer[length] = 0;
+      number.double_ = strtod( buffer, 0 );
+   }
+   else
+   {
+      std::string buffer( begin, current );
+      number.double_ = strtod( buffer.c_str(), 0 );
+   }
+   number.type = Document::doubleNode;
+
+   return 0;
+}
+
+/// Match literal start at begin, literal must end at terminator or document end.
+static inline bool matchLiteral( const char *begin, const char *end, const char *literal, int length )
+{
+   if ( end - begin < length  ||  memcmp( begin, literal, length ) != 0 )
+      return false;
+   return begin + length == end  ||  isTerminator( begin[length] );
+}
+
+static inline int hexValue( char c )
+{
+   if ( c >= '0'  &&  c <= '9' )
+      return c - '0';
+   else if ( c >= 'a'  &&  c <= 'f' )
+      return c - 'a' + 10;
+   else if ( c >= 'A'  &&  c <= 'F' )
+      return c - 'A' + 10;
+   return -1;
+}
+
+static inline bool decodeHex4( const char *current, const char *end, unsigned int &unicode )
+{
+   if ( end - current < 4 )
+      return false;
+
+   unicode = 0;
+   for ( int i = 0; i < 4; ++i )
+   {
+      const int digit = hexValue( current[i] );
+      if ( digit < 0 )
+         return false;
+      unicode = unicode * 16 + digit;
+   }
+
+   return true;
+}
+
+template <typename Buffer>
+static inline void appendUtf8( Buffer &buffer, unsigned int cp )
+{
+   if ( cp <= 0x7F )
+   {
+      buffer.push_back( static_cast<char>( cp ) );
+   }
+   else if ( cp <= 0x7FF )
+   {
+      buffer.push_back( static_cast<char>( 0xC0 | ( 0x1F & ( cp >> 6 ) ) ) );
+      buffer.push_back( static_cast<char>( 0x80 | ( 0x3F & cp ) ) );
+   }
+   else if ( cp <= 0xFFFF )
+   {
+      buffer.push_back( static_cast<char>( 0xE0 | ( 0xF & ( cp >> 12 ) ) ) );
+      buffer.push_back( static_cast<char>( 0x80 | ( 0x3F & ( cp >> 6 ) ) ) );
+      buffer.push_back( static_cast<char>( 0x80 | ( 0x3F & cp ) ) );
+   }
+   else
+   {
+      buffer.push_back( static_cast<char>( 0xF0 | ( 0x7 & ( cp >> 18 ) ) ) );
+      buffer.push_back( static_cast<char>( 0x80 | ( 0x3F & ( cp >> 12 ) ) ) );
+      buffer.push_back( static_cast<char>( 0x80 | ( 0x3F & ( cp >> 6 ) ) ) );
+      buffer.push_back( static_cast<char>( 0x80 | ( 0x3F & cp ) ) );
+   }
+}
+
+/// Decode string start at begin(the open quote) and append to buffer, the closing quote & string
+/// content already validated by stage 1. Return error message if failed, otherwise return 0.
+template <typename Buffer>
+static const char *decodeString( const char *begin, const char *end, Buffer &buffer )
+{
+   const char *current = begin + 1;
+   while ( true )
+   {
+      // Copy the chars which no need decode as a whole.
+      const char *special = findQuoteOrBackslash( current, end );
+      buffer.insert( buffer.end(), current, special );
+      if ( special == end )
+         return "Missing '\"'.";
+
+      current = special + 1;
+      if ( *special == '"' )
+         return 0;
+
+      if ( current == end )
+         return "Empty escape sequence in string.";
+      switch ( *current++ )
+      {
+      case '"': buffer.push_back( '"' ); break;
+      case '/': buffer.push_back( '/' ); break;
+      case '\\': buffer.push_back( '\\' ); break;
+      case 'b': buffer.push_back( '\b' ); break;
+      case 'f': buffer.push_back( '\f' ); break;
+      case 'n': buffer.push_back( '\n' ); break;
+      case 'r': buffer.push_back( '\r' ); break;
+      case 't': buffer.push_back( '\t' ); break;
+      case 'u':
+         {
+            unsigned int unicode;
+            if ( !decodeHex4( current, end, unicode ) )
+               return "Bad unicode escape sequence in string: four hexadecimal digits expected.";
+            current += 4;
+
+            if ( unicode >= 0xD800  &&  unicode <= 0xDBFF )
+            {
+               unsigned int surrogatePair;
+               if ( end - current < 6  ||  current[0] != '\\'  ||  current[1] != 'u'  ||
+                    !decodeHex4( current + 2, end, surrogatePair )  ||
+                    surrogatePair < 0xDC00  ||  surrogatePair > 0xDFFF )
+                  return "Bad unicode surrogate pair in string.";
+               current += 6;
+
+               unicode = 0x10000 + ( ( unicode & 0x3FF ) << 10 ) + ( surrogatePair & 0x3FF );
+            }
+            else if ( unicode >= 0xDC00  &&  unicode <= 0xDFFF )
+            {
+               return "Bad unicode surrogate pair in string.";
+            }
+
+            appendUtf8( buffer, unicode );
+         }
+         break;
+      default:
+         return "Bad escape sequence in string.";
+      }
+   }
+}
+
+/// Convert integer to Value, value type same as Reader::decodeNumber().
+static void integerToValue( bool negative, ULongLong magnitude, Value &value )
+{
+   const Value::UInt intThreshold = ( negative ? Value::UInt( -Value::minInt )
+                                               : Value::maxUInt ) / 10;
+   const Value::ULongLong longThreshold = ( negative ? Value::ULongLong( -Value::minLong )
+                                                     : Value::maxULong ) / 10;
+   // Reader checks threshold before accumulating each digit, the max checked prefix is magnitude / 10.
+   const ULongLong prefix = magnitude / 10;
+   if ( prefix >= longThreshold )
+   {
+      const double real = static_cast<double>( magnitude );
+      value = negative ? -real : real;
+   }
+   else if ( prefix >= intThreshold )
+   {
+      if ( negative )
+         value = -Value::LongLong( magnitude );
+      else if ( magnitude <= Value::ULongLong( Value::maxLong ) )
+         value = Value::LongLong( magnitude );
+      else
+         value = magnitude;
+   }
+   else
+   {
+      if ( negative )
+         value = -Value::Int( magnitude );
+      else if ( magnitude <= Value::UInt( Value::maxInt ) )
+         value = Value::Int( magnitude );
+      else
+         value = Value::UInt( magnitude );
+   }
+}
+
+/// Convert decoded number to Value, value type same as Reader::decodeNumber().
+static void numberToValue( const Number &number, Value &value )
+{
+   if ( number.type == Document::int64Node )
+      integerToValue( number.int64_ < 0,
+                      number.int64_ < 0 ? 0 - static_cast<ULongLong>( number.int64_ ) :
+                                          static_cast<ULongLong>( number.int64_ ),
+                      value );
+   else if ( number.type == Document::uint64Node )
+      integerToValue( false, number.uint64_, value );
+   else
+      value = number.double_;
+}
+
+/// Walk structurals by JSON grammar(parse stage 2) and feed visitor, visitor requirements:
+///   char currentContainer() const;  '{', '[' or 0 if no container opened.
+///   void onOpen( bool isObject );
+///   void onClose();
+///   void onElement();               the current container element/member value finished.
+///   const char *onMemberName( const char *begin, const char *end );
+///   const char *onString( const char *begin, const char *end );
+///   const char *onNumber( const char *begin, const char *end );
+///   const char *onLiteral( const char *begin, const char *end );
+/// The value callbacks return error message if failed, otherwise return 0.
+/// Return error message if failed, otherwise return 0.
+template <typename Visitor>
+static const char *walkStructurals( const StructuralIndex &index, Visitor &visitor, unsigned int &errorOffset )
+{
+   enum State
+   {
+      parseValue,
+      parseMemberName,
+      parseAfterValue
+   };
+
+   const char *doc = index.begin();
+   const char *docEnd = index.end();
+   const unsigned int docLength = static_cast<unsigned int>( docEnd - doc );
+   const unsigned int count = index.size();
+
+   State state = parseValue;
+   unsigned int i = 0;
+   const char *error;
+   while ( true )
+   {
+      if ( state == parseValue )
+      {
+         if ( i == count )
+         {
+            errorOffset = docLength;
+            return "Syntax error: value, object or array expected.";
+         }
+
+         errorOffset = index[i++];
+         const char *begin = doc + errorOffset;
+         const char c = *begin;
+         if ( c == '{'  ||  c == '[' )
+         {
+            const bool isObject = c == '{';
+            visitor.onOpen( isObject );
+            if ( i != count  &&  index.charAt( i ) == ( isObject ? '}' : ']' ) )
+            {
+               ++i;
+               visitor.onClose();
+               state = parseAfterValue;
+            }
+            else
+            {
+               state = isObject ? parseMemberName : parseValue;
+            }
+
+            continue;
+         }
+
+         if ( c == '"' )
+            error = visitor.onString( begin, docEnd );
+         else if ( c == '-'  ||  isDigit( c ) )
+            error = visitor.onNumber( begin, docEnd );
+         else if ( c == 't'  ||  c == 'f'  ||  c == 'n' )
+            error = visitor.onLiteral( begin, docEnd );
+         else
+            error = "Syntax error: value, object or array expected.";
+         if ( error )
+            return error;
+
+         state = parseAfterValue;
+      }
+      else if ( state == parseMemberName )
+      {
+         if ( i == count  ||  index.charAt( i ) != '"' )
+         {
+            errorOffset = i == count ? docLength : index[i];
+            return "Missing '}' or object member name.";
+         }
+
+         errorOffset = index[i++];
+         if ( ( error = visitor.onMemberName( doc + errorOffset, docEnd ) ) != 0 )
+            return error;
+
+         if ( i == count  ||  index.charAt( i ) != ':' )
+         {
+            errorOffset = i == count ? docLength : index[i];
+            return "Missing ':' after object member name.";
+         }
+
+         ++i;
+         state = parseValue;
+      }
+      else // parseAfterValue
+      {
+         const char container = visitor.currentContainer();
+         if ( !container )
+            break;
+
+         visitor.onElement();
+
+         const bool isObject = container == '{';
+         const char c = i == count ? 0 : index.charAt( i );
+         if ( c == ',' )
+         {
+            ++i;
+            state = isObject ? parseMemberName : parseValue;
+         }
+         else if ( c == ( isObject ? '}' : ']' ) )
+         {
+            ++i;
+            visitor.onClose();
+         }
+         else
+         {
+            errorOffset = i == count ? docLength : index[i];
+            return isObject ? "Missing ',' or '}' in object declaration." :
+                              "Missing ',' or ']' in array declaration.";
+         }
+      }
+   }
+
+   if ( i != count )
+   {
+      errorOffset = index[i];
+      return "Extra content after root value.";
+   }
+
+   return 0;
+}
+
+/// Structurals visitor which builds Value directly.
+class ValueBuilder
+{
+public:
+   explicit ValueBuilder( Value &root )
+   : root_( root )
+   , member_( 0 )
+   {
+   }
+
+public:
+   char currentContainer() const
+   {
+      return containers_.empty() ? 0 : ( containers_.back().isObject ? '{' : '[' );
+   }
+
+   void onOpen( bool isObject )
+   {
+      Value &slot = nextSlot();
+      Value container( isObject ? objectValue : arrayValue );
+      slot.swap( container );
+
+      Container opened;
+      opened.value = &slot;
+      opened.isObject = isObject;
+      opened.nextIndex = 0;
+      containers_.push_back( opened );
+   }
+
+   void onClose()
+   {
+      containers_.pop_back();
+   }
+
+   void onElement()
+   {
+   }
+
+   const char *onMemberName( const char *begin, const char *end )
+   {
+      buffer_.clear();
+      const char *error = decodeString( begin, end, buffer_ );
+      if ( error )
+         return error;
+
+      member_ = &( *containers_.back().value )[buffer_.c_str()];
+      return 0;
+   }
+
+   const char *onString( const char *begin, const char *end )
+   {
+      buffer_.clear();
+      const char *error = decodeString( begin, end, buffer_ );
+      if ( error )
+         return error;
+
+      Value string( buffer_.data(), buffer_.data() + buffer_.length() );
+      nextSlot().swap( string );
+      return 0;
+   }
+
+   const char *onNumber( const char *begin, const char *end )
+   {
+      Number number;
+      const char *error = decodeNumber( begin, end, number );
+      if ( error )
+         return error;
+
+      numberToValue( number, nextSlot() );
+      return 0;
+   }
+
+   const char *onLiteral( const char *begin, const char *end )
+   {
+      if ( matchLiteral( begin, end, "true", 4 ) )
+         nextSlot() = true;
+      else if ( matchLiteral( begin, end, "false", 5 ) )
+         nextSlot() = false;
+      else if ( matchLiteral( begin, end, "null", 4 ) )
+         nextSlot() = Value();
+      else
+         return "Syntax error: value, object or array expected.";
+
+      return 0;
+   }
+
+private:
+   /// Get the Value to hold the next parsed value.
+   Value &nextSlot()
+   {
+      if ( containers_.empty() )
+         return root_;
+
+      Container &container = containers_.back();
+      if ( container.isObject )
+         return *member_;
+
+      return ( *container.value )[container.nextIndex++];
+   }
+
+private:
+   struct Container
+   {
+      Value *value;
+      bool isObject;
+      Value::UInt nextIndex;
+   };
+
+   Value &root_;
+   std::vector<Container> containers_;
+   Value *member_;
+   std::string buffer_;
+};
+
+} // namespace
+
+
+/// Structurals visitor which builds DOM.
+class Document::Builder
+{
+public:
+   explicit Builder( Document &document )
+   : entries_( document.entries_ )
+   , strings_( document.strings_ )
+   , openContainers_( document.openContainers_ )
+   {
+   }
+
+public:
+   char currentContainer() const
+   {
+      if ( openContainers_.empty() )
+         return 0;
+
+      return entries_[openContainers_.back()].type == objectNode ? '{' : '[';
+   }
+
+   void onOpen( bool isObject )
+   {
+      openContainers_.push_back( static_cast<unsigned int>( entries_.size() ) );
+      push( isObject ? objectNode : arrayNode );
+   }
+
+   void onClose()
+   {
+      entries_[openContainers_.back()].next = static_cast<unsigned int>( entries_.size() );
+      openContainers_.pop_back();
+   }
+
+   void onElement()
+   {
+      ++entries_[openContainers_.back()].size;
+   }
+
+   const char *onMemberName( const char *begin, const char *end )
+   {
+      return onString( begin, end );
+   }
+
+   const char *onString( const char *begin, const char *end )
+   {
+      const size_t stringOffset = strings_.size();
+      const char *error = decodeString( begin, end, strings_ );
+      if ( error )
+         return error;
+
+      Entry &entry = push( stringNode );
+      entry.size = static_cast<unsigned int>( strings_.size() - stringOffset );
+      entry.value_.string_ = static_cast<unsigned int>( stringOffset );
+      strings_.push_back( '\0' );
+
+      return 0;
+   }
+
+   const char *onNumber( const char *begin, const char *end )
+   {
+      Number number;
+      const char *error = decodeNumber( begin, end, number );
+      if ( error )
+         return error;
+
+      Entry &entry = push( number.type );
+      if ( number.type == int64Node )
+         entry.value_.int64_ = number.int64_;
+      else if ( number.type == uint64Node )
+         entry.value_.uint64_ = number.uint64_;
+      else
+         entry.value_.double_ = number.double_;
+
+      return 0;
+   }
+
+   const char *onLiteral( const char *begin, const char *end )
+   {
+      if ( matchLiteral( begin, end, "true", 4 ) )
+         push( trueNode );
+      else if ( matchLiteral( begin, end, "false", 5 ) )
+         push( falseNode );
+      else if ( matchLiteral( begin, end, "null", 4 ) )
+         push( nullNode );
+      else
+         return "Syntax error: value, object or array expected.";
+
+      return 0;
+   }
+
+private:
+   Entry &push( NodeType type )
+   {
+      Entry entry;
+      entry.type = type;
+      entry.next = static_cast<unsigned int>( entries_.size() + 1 );
+      entry.size = 0;
+      entry.value_.uint64_ = 0;
+      entries_.push_back( entry );
+
+      return entries_.back();
+   }
+
+private:
+   std::vector<Entry> &entries_;
+   std::vector<char> &strings_;
+   std::vector<unsigned int> &openContainers_;
+};
+
+
+// Class StructuralIndex
+// //////////////////////////////////////////////////////////////////
+
+StructuralIndex::StructuralIndex()
+   : begin_( 0 )
+   , end_( 0 )
+   , errorOffset_( 0 )
+{
+}
+
+
+bool
+StructuralIndex::build( const char *begin, const char *end )
+{
+   begin_ = begin;
+   end_ = end;
+   positions_.clear();
+   errorMessage_.clear();
+   errorOffset_ = 0;
+
+   const size_t length = end - begin;
+   if ( length >= 0xFFFFFFFFu )
+      return fail( "Document too large.", 0 );
+
+   // At most one structural per byte, grow geometric.
+   unsigned int count = 0;
+   if ( positions_.capacity() < length / 4 + 64 )
+      positions_.reserve( length / 4 + 64 );
+   positions_.resize( positions_.capacity() );
+
+   ULongLong prevEndsOddBackslash = 0;
+   ULongLong prevInString = 0;
+   ULongLong prevScalar = 0;
+   const unsigned char *utf8Validated = reinterpret_cast<const unsigned char *>( begin );
+
+   char lastBlock[64];
+   BlockMasks masks;
+   for ( size_t offset = 0; offset < length; offset += 64 )
+   {
+      const char *block = begin + offset;
+      const size_t blockLength = length - offset;
+      if ( blockLength < 64 )
+      {
+         // Pad the last block with spaces.
+         memset( lastBlock, ' ', sizeof( lastBlock ) );
+         memcpy( lastBlock, block, blockLength );
+         classifyBlock( lastBlock, masks );
+      }
+      else
+      {
+         classifyBlock( block, masks );
+      }
+
+      if ( masks.high )
+      {
+         const unsigned char *blockBegin = reinterpret_cast<const unsigned char *>( block );
+         const unsigned char *blockEnd = blockBegin + ( blockLength < 64 ? blockLength : 64 );
+         if ( utf8Validated < blockBegin )
+            utf8Validated = blockBegin;
+         if ( !validateUtf8( utf8Validated, blockEnd, reinterpret_cast<const unsigned char *>( end ) ) )
+            return fail( "Invalid UTF-8 sequence.",
+                         static_cast<unsigned int>( utf8Validated - reinterpret_cast<const unsigned char *>( begin ) ) );
+      }
+
+      // Find real quotes and string regions, inString includes open quote but excludes close quote.
+      const ULongLong escaped = findEscapedChars( masks.backslash, prevEndsOddBackslash );
+      const ULongLong quote = masks.quote & ~escaped;
+      const ULongLong inString = prefixXor( quote ) ^ prevInString;
+      prevInString = static_cast<ULongLong>( static_cast<LongLong>( inString ) >> 63 );
+      if ( masks.control & inString )
+         return fail( "Control character in string.",
+                      static_cast<unsigned int>( offset + firstSetBit64( masks.control & inString ) ) );
+
+      // Scalar start: not operator, not space, and not follow other non-quote scalar character.
+      const ULongLong scalar = ~( masks.op | masks.space );
+      const ULongLong nonQuoteScalar = scalar & ~quote;
+      const ULongLong followsNonQuoteScalar = ( nonQuoteScalar << 1 ) | prevScalar;
+      prevScalar = nonQuoteScalar >> 63;
+
+      const ULongLong stringTail = inString ^ quote;
+      ULongLong structurals = ( masks.op | ( scalar & ~followsNonQuoteScalar ) ) & ~stringTail;
+      if ( structurals )
+      {
+         if ( positions_.size() - count < 64 )
+            positions_.resize( positions_.size() * 2 );
+
+         unsigned int *positions = &positions_[0] + count;
+         const unsigned int base = static_cast<unsigned int>( offset );
+         do
+         {
+            *positions++ = base + firstSetBit64( structurals );
+            structurals &= structurals - 1;
+         } while ( structurals );
+
+         count = static_cast<unsigned int>( positions - &positions_[0] );
+      }
+   }
+
+   positions_.resize( count );
+   if ( prevInString )
+      return fail( "Missing '\"'.", count > 0 ? positions_[count - 1] : 0 );
+
+   return true;
+}
+
+
+const char *
+StructuralIndex::begin() const
+{
+   return begin_;
+}
+
+
+const char *
+StructuralIndex::end() const
+{
+   return end_;
+}
+
+
+unsigned int
+StructuralIndex::size() const
+{
+   return static_cast<unsigned int>( positions_.size() );
+}
+
+
+unsigned int
+StructuralIndex::operator[]( unsigned int index ) const
+{
+   return positions_[index];
+}
+
+
+char
+StructuralIndex::charAt( unsigned int index ) const
+{
+   return begin_[positions_[index]];
+}
+
+
+const std::string &
+StructuralIndex::getErrorMessage() const
+{
+   return errorMessage_;
+}
+
+
+unsigned int
+StructuralIndex::getErrorOffset() const
+{
+   return errorOffset_;
+}
+
+
+bool
+StructuralIndex::fail( const char *message, unsigned int offset )
+{
+   positions_.clear();
+   errorMessage_ = message;
+   errorOffset_ = offset;
+   return false;
+}
+
+
+// Class Document
+// //////////////////////////////////////////////////////////////////
+
+Document::Document()
+   : errorOffset_( 0 )
+   , parsed_( false )
+{
+}
+
+
+bool
+Document::parse( const char *begin, const char *end )
+{
+   parsed_ = false;
+   if ( !index_.build( begin, end ) )
+      return fail( index_.getErrorMessage().c_str(), index_.getErrorOffset() );
+
+   return parse( index_ );
+}
+
+
+bool
+Document::parse( const std::string &document )
+{
+   const char *begin = document.data();
+   return parse( begin, begin + document.length() );
+}
+
+
+bool
+Document::parse( const StructuralIndex &index )
+{
+   parsed_ = false;
+   entries_.clear();
+   strings_.clear();
+   openContainers_.clear();
+   errorMessage_.clear();
+   errorOffset_ = 0;
+
+   const unsigned int count = index.size();
+   entries_.reserve( count + 1 );
+   strings_.reserve( ( index.end() - index.begin() ) + count + 1 );
+
+   Builder builder( *this );
+   unsigned int errorOffset = 0;
+   const char *error = walkStructurals( index, builder, errorOffset );
+   if ( error )
+      return fail( error, errorOffset );
+
+   parsed_ = true;
+   return true;
+}
+
+
+Document::Node
+Document::root() const
+{
+   return parsed_ ? Node( this, 0 ) : Node();
+}
+
+
+void
+Document::toValue( const Node &node, Value &value )
+{
+   switch ( node.type() )
+   {
+   case nullNode:
+      value = Value();
+      break;
+   case falseNode:
+      value = false;
+      break;
+   case trueNode:
+      value = true;
+      break;
+   case int64Node:
+   case uint64Node:
+   case doubleNode:
+      {
+         Number number;
+         number.type = node.type();
+         number.int64_ = node.asInt64();
+         number.uint64_ = node.asUInt64();
+         number.double_ = node.asDouble();
+         numberToValue( number, value );
+      }
+      break;
+   // Swap in containers & strings, avoid the copy of assignment.
+   case stringNode:
+      {
+         const char *str = node.asCString();
+         Value stringVal( str, str + node.stringLength() );
+         value.swap( stringVal );
+      }
+      break;
+   case arrayNode:
+      {
+         Value arrayVal( arrayValue );
+         value.swap( arrayVal );
+         value.resize( node.size() );
+
+         Value::UInt index = 0;
+         for ( Iterator it = node.begin(); it != node.end(); ++it )
+            toValue( it.value(), value[index++] );
+      }
+      break;
+   case objectNode:
+      {
+         Value objectVal( objectValue );
+         value.swap( objectVal );
+         for ( Iterator it = node.begin(); it != node.end(); ++it )
+            toValue( it.value(), value[it.key().asCString()] );
+      }
+      break;
+   }
+}
+
+
+bool
+Document::toValue( const StructuralIndex &index, Value &root )
+{
+   ValueBuilder builder( root );
+   unsigned int errorOffset;
+   return walkStructurals( index, builder, errorOffset ) == 0;
+}
+
+
+const std::string &
+Document::getErrorMessage() const
+{
+   return errorMessage_;
+}
+
+
+unsigned int
+Document::getErrorOffset() const
+{
+   return errorOffset_;
+}
+
+
+bool
+Document::fail( const char *message, unsigned int offset )
+{
+   parsed_ = false;
+   errorMessage_ = message;
+   errorOffset_ = offset;
+   return false;
+}
+
+
+// Class Document::Node
+// //////////////////////////////////////////////////////////////////
+
+Document::Node::Node()
+   : document_( 0 )
+   , index_( 0 )
+{
+}
+
+
+Document::Node::Node( const Document *document, unsigned int index )
+   : document_( document )
+   , index_( index )
+{
+}
+
+
+const Document::Entry &
+Document::Node::entry() const
+{
+   return document_->entries_[index_];
+}
+
+
+bool
+Document::Node::isValid() const
+{
+   return document_ != 0;
+}
+
+
+Document::NodeType
+Document::Node::type() const
+{
+   return isValid() ? static_cast<NodeType>( entry().type ) : nullNode;
+}
+
+
+bool
+Document::Node::isNull() const
+{
+   return isValid()  &&  entry().type == nullNode;
+}
+
+
+bool
+Document::Node::isBool() const
+{
+   const NodeType nodeType = type();
+   return nodeType == falseNode  ||  nodeType == trueNode;
+}
+
+
+bool
+Document::Node::isNumber() const
+{
+   const NodeType nodeType = type();
+   return nodeType == int64Node  ||  nodeType == uint64Node  ||  nodeType == doubleNode;
+}
+
+
+bool
+Document::Node::isIntegral() const
+{
+   const NodeType nodeType = type();
+   return nodeType == int64Node  ||  nodeType == uint64Node;
+}
+
+
+bool
+Document::Node::isString() const
+{
+   return isValid()  &&  entry().type == stringNode;
+}
+
+
+bool
+Document::Node::isArray() const
+{
+   return isValid()  &&  entry().type == arrayNode;
+}
+
+
+bool
+Document::Node::isObject() const
+{
+   return isValid()  &&  entry().type == objectNode;
+}
+
+
+bool
+Document::Node::asBool() const
+{
+   switch ( type() )
+   {
+   case trueNode:
+      return true;
+   case int64Node:
+      return entry().value_.int64_ != 0;
+   case uint64Node:
+      return entry().value_.uint64_ != 0;
+   case doubleNode:
+      return entry().value_.double_ != 0.0;
+   default:
+      return false;
+   }
+}
+
+
+LongLong
+Document::Node::asInt64() const
+{
+   switch ( type() )
+   {
+   case trueNode:
+      return 1;
+   case int64Node:
+      return entry().value_.int64_;
+   case uint64Node:
+      return static_cast<LongLong>( entry().value_.uint64_ );
+   case doubleNode:
+      return static_cast<LongLong>( entry().value_.double_ );
+   default:
+      return 0;
+   }
+}
+
+
+ULongLong
+Document::Node::asUInt64() const
+{
+   switch ( type() )
+   {
+   case trueNode:
+      return 1;
+   case int64Node:
+      return static_cast<ULongLong>( entry().value_.int64_ );
+   case uint64Node:
+      return entry().value_.uint64_;
+   case doubleNode:
+      return static_cast<ULongLong>( entry().value_.double_ );
+   default:
+      return 0;
+   }
+}
+
+
+double
+Document::Node::asDouble() const
+{
+   switch ( type() )
+   {
+   case trueNode:
+      return 1.0;
+   case int64Node:
+      return static_cast<double>( entry().value_.int64_ );
+   case uint64Node:
+      return static_cast<double>( entry().value_.uint64_ );
+   case doubleNode:
+      return entry().value_.double_;
+   default:
+      return 0.0;
+   }
+}
+
+
+const char *
+Document::Node::asCString() const
+{
+   return isString() ? &document_->strings_[entry().value_.string_] : "";
+}
+
+
+unsigned int
+Document::Node::stringLength() const
+{
+   return isString() ? entry().size : 0;
+}
+
+
+std::string
+Document::Node::asString() const
+{
+   return std::string( asCString(), stringLength() );
+}
+
+
+unsigned int
+Document::Node::size() const
+{
+   return isArray()  ||  isObject() ? entry().size : 0;
+}
+
+
+Document::Node
+Document::Node::operator[]( unsigned int index ) const
+{
+   if ( !isArray()  ||  index >= entry().size )
+      return Node();
+
+   unsigned int child = index_ + 1;
+   while ( index-- )
+      child = document_->entries_[child].next;
+
+   return Node( document_, child );
+}
+
+
+Document::Node
+Document::Node::operator[]( const char *key ) const
+{
+   return findMember( key, static_cast<unsigned int>( strlen( key ) ) );
+}
+
+
+Document::Node
+Document::Node::operator[]( const std::string &key ) const
+{
+   return findMember( key.data(), static_cast<unsigned int>( key.length() ) );
+}
+
+
+Document::Node
+Document::Node::findMember( const char *key, unsigned int keyLength ) const
+{
+   if ( !isObject() )
+      return Node();
+
+   // Last one wins if duplicated, same as Reader.
+   Node found;
+   const std::vector<Entry> &entries = document_->entries_;
+   const unsigned int end = entry().next;
+   for ( unsigned int member = index_ + 1; member != end; member = entries[member + 1].next )
+   {
+      const Entry &name = entries[member];
+      if ( name.size == keyLength  &&
+           memcmp( &document_->strings_[name.value_.string_], key, keyLength ) == 0 )
+         found = Node( document_, member + 1 );
+   }
+
+   return found;
+}
+
+
+Document::Iterator
+Document::Node::begin() const
+{
+   if ( !isArray()  &&  !isObject() )
+      return Iterator();
+
+   return Iterator( document_, index_ + 1, isObject() );
+}
+
+
+Document::Iterator
+Document::Node::end() const
+{
+   if ( !isArray()  &&  !isObject() )
+      return Iterator();
+
+   return Iterator( document_, entry().next, isObject() );
+}
+
+
+// Class Document::Iterator
+// //////////////////////////////////////////////////////////////////
+
+Document::Iterator::Iterator()
+   : document_( 0 )
+   , index_( 0 )
+   , isObject_( false )
+{
+}
+
+
+Document::Iterator::Iterator( const Document *document, unsigned int index, bool isObject )
+   : document_( document )
+   , index_( index )
+   , isObject_( isObject )
+{
+}
+
+
+Document::Node
+Document::Iterator::key() const
+{
+   return isObject_ ? Node( document_, index_ ) : Node();
+}
+
+
+Document::Node
+Document::Iterator::value() const
+{
+   return Node( document_, isObject_ ? index_ + 1 : index_ );
+}
+
+
+Document::Iterator &
+Document::Iterator::operator++()
+{
+   index_ = document_->entries_[isObject_ ? index_ + 1 : index_].next;
+   return *this;
+}
+
+
+bool
+Document::Iterator::operator ==( const Iterator &other ) const
+{
+   return document_ == other.document_  &&  index_ == other.index_;
+}
+
+
+bool
+Document::Iterator::operator !=( const Iterator &other ) const
+{
+   return !( *this == other );
+}
+
+
+// Class Cursor
+// //////////////////////////////////////////////////////////////////
+
+Cursor::Cursor()
+   : errorOffset_( 0 )
+   , ready_( false )
+{
+}
+
+
+bool
+Cursor::reset( const char *begin, const char *end )
+{
+   ready_ = false;
+   errorMessage_.clear();
+   errorOffset_ = 0;
+   if ( !index_.build( begin, end ) )
+   {
+      errorMessage_ = index_.getErrorMessage();
+      errorOffset_ = index_.getErrorOffset();
+      return false;
+   }
+
+   // Match brackets, then any subtree can be skipped in O(1).
+   const unsigned int count = index_.size();
+   matches_.resize( count );
+   openBrackets_.clear();
+   for ( unsigned int i = 0; i < count; ++i )
+   {
+      const char c = index_.charAt( i );
+      if ( c == '{'  ||  c == '[' )
+      {
+         openBrackets_.push_back( i );
+      }
+      else if ( c == '}'  ||  c == ']' )
+      {
+         if ( openBrackets_.empty()  ||
+              index_.charAt( openBrackets_.back() ) != ( c == '}' ? '{' : '[' ) )
+         {
+            errorMessage_ = "Mismatched bracket.";
+            errorOffset_ = index_[i];
+            return false;
+         }
+
+         matches_[openBrackets_.back()] = i;
+         openBrackets_.pop_back();
+      }
+   }
+
+   if ( !openBrackets_.empty() )
+   {
+      errorMessage_ = "Missing close bracket.";
+      errorOffset_ = index_[openBrackets_.back()];
+      return false;
+   }
+
+   ready_ = count > 0;
+   if ( !ready_ )
+      errorMessage_ = "Syntax error: value, object or array expected.";
+
+   return ready_;
+}
+
+
+bool
+Cursor::reset( const std::string &document )
+{
+   const char *begin = document.data();
+   return reset( begin, begin + document.length() );
+}
+
+
+Cursor::Element
+Cursor::root() const
+{
+   return ready_ ? Element( this, 0 ) : Element();
+}
+
+
+const std::string &
+Cursor::getErrorMessage() const
+{
+   return errorMessage_;
+}
+
+
+unsigned int
+Cursor::getErrorOffset() const
+{
+   return errorOffset_;
+}
+
+
+// Class Cursor::Element
+// //////////////////////////////////////////////////////////////////
+
+Cursor::Element::Element()
+   : cursor_( 0 )
+   , index_( 0 )
+{
+}
+
+
+Cursor::Element::Element( const Cursor *cursor, unsigned int index )
+   : cursor_( cursor )
+   , index_( index )
+{
+}
+
+
+bool
+Cursor::Element::isValid() const
+{
+   return cursor_ != 0;
+}
+
+
+char
+Cursor::Element::firstChar() const
+{
+   return isValid() ? cursor_->index_.charAt( index_ ) : 0;
+}
+
+
+unsigned int
+Cursor::Element::skip( unsigned int index ) const
+{
+   const char c = cursor_->index_.charAt( index );
+   return ( c == '{'  ||  c == '[' ) ? cursor_->matches_[index] + 1 : index + 1;
+}
+
+
+Document::NodeType
+Cursor::Element::type() const
+{
+   switch ( firstChar() )
+   {
+   case 't':
+      return Document::trueNode;
+   case 'f':
+      return Document::falseNode;
+   case '"':
+      return Document::stringNode;
+   case '[':
+      return Document::arrayNode;
+   case '{':
+      return Document::objectNode;
+   case '-': case '0': case '1': case '2': case '3': case '4':
+   case '5': case '6': case '7': case '8': case '9':
+      {
+         Number number;
+         const StructuralIndex &index = cursor_->index_;
+         if ( decodeNumber( index.begin() + index[index_], index.end(), number ) == 0 )
+            return number.type;
+      }
+      return Document::nullNode;
+   default:
+      return Document::nullNode;
+   }
+}
+
+
+bool
+Cursor::Element::isNull() const
+{
+   if ( firstChar() != 'n' )
+      return false;
+
+   const StructuralIndex &index = cursor_->index_;
+   return matchLiteral( index.begin() + index[index_], index.end(), "null", 4 );
+}
+
+
+bool
+Cursor::Element::getBool( bool &value ) const
+{
+   const char c = firstChar();
+   if ( c != 't'  &&  c != 'f' )
+      return false;
+
+   const StructuralIndex &index = cursor_->index_;
+   value = c == 't';
+   return value ? matchLiteral( index.begin() + index[index_], index.end(), "true", 4 ) :
+                  matchLiteral( index.begin() + index[index_], index.end(), "false", 5 );
+}
+
+
+bool
+Cursor::Element::getInt64( LongLong &value ) const
+{
+   const char c = firstChar();
+   if ( c != '-'  &&  !isDigit( c ) )
+      return false;
+
+   Number number;
+   const StructuralIndex &index = cursor_->index_;
+   if ( decodeNumber( index.begin() + index[index_], index.end(), number ) != 0  ||
+        number.type != Document::int64Node )
+      return false;
+
+   value = number.int64_;
+   return true;
+}
+
+
+bool
+Cursor::Element::getUInt64( ULongLong &value ) const
+{
+   const char c = firstChar();
+   if ( !isDigit( c ) )
+      return false;
+
+   Number number;
+   const StructuralIndex &index = cursor_->index_;
+   if ( decodeNumber( index.begin() + index[index_], index.end(), number ) != 0 )
+      return false;
+
+   if ( number.type == Document::int64Node )
+      value = static_cast<ULongLong>( number.int64_ );
+   else if ( number.type == Document::uint64Node )
+      value = number.uint64_;
+   else
+      return false;
+
+   return true;
+}
+
+
+bool
+Cursor::Element::getDouble( double &value ) const
+{
+   const char c = firstChar();
+   if ( c != '-'  &&  !isDigit( c ) )
+      return false;
+
+   Number number;
+   const StructuralIndex &index = cursor_->index_;
+   if ( decodeNumber( index.begin() + index[index_], index.end(), number ) != 0 )
+      return false;
+
+   if ( number.type == Document::int64Node )
+      value = static_cast<double>( number.int64_ );
+   else if ( number.type == Document::uint64Node )
+      value = static_cast<double>( number.uint64_ );
+   else
+      value = number.double_;
+
+   return true;
+}
+
+
+bool
+Cursor::Element::getString( std::string &value ) const
+{
+   if ( firstChar() != '"' )
+      return false;
+
+   const StructuralIndex &index = cursor_->index_;
+   value.clear();
+   return decodeString( index.begin() + index[index_], index.end(), value ) == 0;
+}
+
+
+unsigned int
+Cursor::Element::size() const
+{
+   const char c = firstChar();
+   if ( c != '['  &&  c != '{' )
+      return 0;
+
+   const StructuralIndex &index = cursor_->index_;
+   const unsigned int end = cursor_->matches_[index_];
+   const unsigned int step = c == '{' ? 2 : 0; // Skip member name & ':'.
+
+   unsigned int count = 0;
+   unsigned int i = index_ + 1;
+   while ( i + step < end )
+   {
+      ++count;
+      i = skip( i + step );
+      if ( i >= end  ||  index.charAt( i ) != ',' )
+         break;
+      ++i;
+   }
+
+   return count;
+}
+
+
+Cursor::Element
+Cursor::Element::operator[]( unsigned int index ) const
+{
+   if ( firstChar() != '[' )
+      return Element();
+
+   const unsigned int end = cursor_->matches_[index_];
+   unsigned int i = index_ + 1;
+   for ( ; index > 0  &&  i < end; --index )
+   {
+      i = skip( i );
+      if ( i >= end  ||  cursor_->index_.charAt( i ) != ',' )
+         return Element();
+      ++i;
+   }
+
+   return i < end ? Element( cursor_, i ) : Element();
+}
+
+
+Cursor::Element
+Cursor::Element::operator[]( const char *key ) const
+{
+   return findMember( key, static_cast<unsigned int>( strlen( key ) ) );
+}
+
+
+Cursor::Element
+Cursor::Element::operator[]( const std::string &key ) const
+{
+   return findMember( key.data(), static_cast<unsigned int>( key.length() ) );
+}
+
+
+bool
+Cursor::Element::keyEquals( unsigned int index, const char *key, unsigned int keyLength ) const
+{
+   const StructuralIndex &structurals = cursor_->index_;
+   const char *begin = structurals.begin() + structurals[index] + 1;
+   const char *end = structurals.end();
+
+   // Compare raw name first, only decode name if it has escapes.
+   const char *special = findQuoteOrBackslash( begin, end );
+   if ( special != end  &&  *special == '"' )
+      return static_cast<unsigned int>( special - begin ) == keyLength  &&
+             memcmp( begin, key, keyLength ) == 0;
+
+   std::string name;
+   return decodeString( begin - 1, end, name ) == 0  &&
+          name.length() == keyLength  &&
+          memcmp( name.data(), key, keyLength ) == 0;
+}
+
+
+Cursor::Element
+Cursor::Element::findMember( const char *key, unsigned int keyLength ) const
+{
+   if ( firstChar() != '{' )
+      return Element();
+
+   const StructuralIndex &index = cursor_->index_;
+   const unsigned int end = cursor_->matches_[index_];
+   for ( unsigned int i = index_ + 1; i + 2 < end; )
+   {
+      if ( index.charAt( i ) != '"'  ||  index.charAt( i + 1 ) != ':' )
+         return Element();
+
+      if ( keyEquals( i, key, keyLength ) )
+         return Element( cursor_, i + 2 );
+
+      i = skip( i + 2 );
+      if ( i >= end  ||  index.charAt( i ) != ',' )
+         break;
+      ++i;
+   }
+
+   return Element();
+}
+
+} // namespace Json
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -3,9 +3,11 @@
 
 #include "llbc/core/json/reader.h"
 #include "llbc/core/json/value.h"
+#include "json_tool.h"
 
 #include <utility>
 #include <cstdio>
+#include <cstdlib>
 #include <cassert>
 #include <cstring>
 #include <iostream>
@@ -173,6 +175,10 @@ Reader::parse( const char *beginDoc, const char *endDoc,
    errors_.clear();
    while ( !nodes_.empty() )
       nodes_.pop();
+
+   if ( fastParse( beginDoc, endDoc, root ) )
+      return true;
+
    nodes_.push( &root );
    
    bool successful = readValue();
@@ -197,6 +203,17 @@ Reader::parse( const char *beginDoc, const char *endDoc,
 }
 
 
+bool
+Reader::fastParse( const char *beginDoc, const char *endDoc, Value &root )
+{
+   // Strict documents only, comments & non strict syntax leave to scalar parser.
+   if ( !fastIndex_.build( beginDoc, endDoc )  ||  !Document::toValue( fastIndex_, root ) )
+      return false;
+
+   return !features_.strictRoot_  ||  root.isArray()  ||  root.isObject();
+}
+
+
 bool
 Reader::readValue()
 {
@@ -469,16 +486,19 @@ Reader::readNumber()
 bool
 Reader::readString()
 {
-   Char c = 0;
    while ( current_ != end_ )
    {
-      c = getNextChar();
-      if ( c == '\\' )
-         getNextChar();
-      else if ( c == '"' )
+      current_ = findQuoteOrBackslash( current_, end_ );
+      if ( current_ == end_ )
          break;
+
+      Char c = *current_++;
+      if ( c == '"' )
+         return true;
+      if ( current_ != end_ ) // skip escaped char
+         ++current_;
    }
-   return c == '"';
+   return false;
 }
 
 
@@ -663,22 +683,26 @@ Reader::decodeDouble( Token &token )
 {
    double value = 0;
    const int bufferSize = 32;
-   int count;
+   bool converted;
    int length = int(token.end_ - token.start_);
-   if ( length <= bufferSize )
+   if ( length < bufferSize )
    {
       Char buffer[bufferSize];
       memcpy( buffer, token.start_, length );
       buffer[length] = 0;
-      count = sscanf( buffer, "%lf", &value );
+      char *convertEnd;
+      value = strtod( buffer, &convertEnd );
+      converted = convertEnd != buffer;
    }
    else
    {
       std::string buffer( token.start_, token.end_ );
-      count = sscanf( buffer.c_str(), "%lf", &value );
+      char *convertEnd;
+      value = strtod( buffer.c_str(), &convertEnd );
+      converted = convertEnd != buffer.c_str();
    }
 
-   if ( count != 1 )
+   if ( !converted )
       return addError( "'" + std::string( token.start_, token.end_ ) + "' is not a number.", token );
    currentValue() = value;
    return true;
@@ -704,10 +728,17 @@ Reader::decodeString( Token &token, std::string &decoded )
    Location end = token.end_ - 1;      // do not include '"'
    while ( current != end )
    {
+      // Copy the chars which no need decode as a whole.
+      Location special = findQuoteOrBackslash( current, end );
+      decoded.append( current, special );
+      current = special;
+      if ( current == end )
+         break;
+
       Char c = *current++;
       if ( c == '"' )
          break;
-      else if ( c == '\\' )
+      else
       {
          if ( current == end )
             return addError( "Empty escape sequence in string", token, current );
@@ -734,10 +765,6 @@ Reader::decodeString( Token &token, std::string &decoded )
             return addError( "Bad escape sequence in string", token, current );
          }
       }
-      else
-      {
-         decoded += c;
-      }
    }
    return true;
 }
@@ -0,0 +1,115 @@
+#ifndef LIB_JSONCPP_JSON_TOOL_H_INCLUDED
+# define LIB_JSONCPP_JSON_TOOL_H_INCLUDED
+
+#include "llbc/common/Common.h"
+
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define JSON_USE_SSE2 1
+#  include <emmintrin.h>
+# endif
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+
+/* This header provides some string scanning helpers for reader & writer.
+ *
+ * When SSE2 available, scan 16 bytes per step, otherwise fallback to scalar loop.
+ * All helpers only access the memory in [begin, end).
+ */
+
+__LLBC_NS_BEGIN
+
+namespace Json {
+
+# ifdef JSON_USE_SSE2
+static inline int firstSetBit( unsigned int mask )
+{
+#  ifdef _MSC_VER
+   unsigned long index;
+   _BitScanForward( &index, mask );
+   return static_cast<int>( index );
+#  else
+   return __builtin_ctz( mask );
+#  endif
+}
+# endif // JSON_USE_SSE2
+
+/// Get the index of lowest set bit, mask must not be 0.
+static inline int firstSetBit64( unsigned long long mask )
+{
+# if defined(_MSC_VER) && defined(_M_X64)
+   unsigned long index;
+   _BitScanForward64( &index, mask );
+   return static_cast<int>( index );
+# elif defined(_MSC_VER)
+   unsigned long index;
+   if ( _BitScanForward( &index, static_cast<unsigned long>( mask ) ) )
+      return static_cast<int>( index );
+   _BitScanForward( &index, static_cast<unsigned long>( mask >> 32 ) );
+   return static_cast<int>( index ) + 32;
+# else
+   return __builtin_ctzll( mask );
+# endif
+}
+
+/// Find first '"' or '\\' character in [begin, end), if not found, return end.
+static inline const char *findQuoteOrBackslash( const char *begin, const char *end )
+{
+# ifdef JSON_USE_SSE2
+   const __m128i quote = _mm_set1_epi8( '"' );
+   const __m128i backslash = _mm_set1_epi8( '\\' );
+   for ( ; end - begin >= 16; begin += 16 )
+   {
+      const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i *>( begin ) );
+      const int mask = _mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( chunk, quote ),
+                                                        _mm_cmpeq_epi8( chunk, backslash ) ) );
+      if ( mask != 0 )
+         return begin + firstSetBit( static_cast<unsigned int>( mask ) );
+   }
+# endif // JSON_USE_SSE2
+
+   for ( ; begin != end; ++begin )
+   {
+      if ( *begin == '"'  ||  *begin == '\\' )
+         return begin;
+   }
+
+   return end;
+}
+
+/// Find first character which need escape when writing(control characters, '"' and '\\') in [begin, end).
+/// If not found, return end.
+static inline const char *findNeedEscapeChar( const char *begin, const char *end )
+{
+# ifdef JSON_USE_SSE2
+   const __m128i quote = _mm_set1_epi8( '"' );
+   const __m128i backslash = _mm_set1_epi8( '\\' );
+   const __m128i maxControl = _mm_set1_epi8( 0x1F );
+   for ( ; end - begin >= 16; begin += 16 )
+   {
+      const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i *>( begin ) );
+      // unsigned chunk <= 0x1F  <==>  max(chunk, 0x1F) == 0x1F
+      const __m128i isControl = _mm_cmpeq_epi8( _mm_max_epu8( chunk, maxControl ), maxControl );
+      const int mask = _mm_movemask_epi8( _mm_or_si128( isControl,
+                                              _mm_or_si128( _mm_cmpeq_epi8( chunk, quote ),
+                                                            _mm_cmpeq_epi8( chunk, backslash ) ) ) );
+      if ( mask != 0 )
+         return begin + firstSetBit( static_cast<unsigned int>( mask ) );
+   }
+# endif // JSON_USE_SSE2
+
+   for ( ; begin != end; ++begin )
+   {
+      const unsigned char c = static_cast<unsigned char>( *begin );
+      if ( c <= 0x1F  ||  c == '"'  ||  c == '\\' )
+         return begin;
+   }
+
+   return end;
+}
+
+} // namespace Json
+
+__LLBC_NS_END
+
+#endif // LIB_JSONCPP_JSON_TOOL_H_INCLUDED
@@ -2,6 +2,7 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/json/writer.h"
+#include "json_tool.h"
 
 #include <utility>
 #include <assert.h>
@@ -19,20 +20,6 @@ __LLBC_NS_BEGIN
 
 namespace Json {
 
-static bool isControlCharacter(char ch)
-{
-   return ch > 0 && ch <= 0x1F;
-}
-
-static bool containsControlCharacter( const char* str )
-{
-   while ( *str ) 
-   {
-      if ( isControlCharacter( *(str++) ) )
-         return true;
-   }
-   return false;
-}
 static void ulongToString( unsigned long long value, 
                           char *&current )
 {
@@ -137,66 +124,92 @@ std::string valueToString( bool value )
    return value ? "true" : "false";
 }
 
-std::string valueToQuotedString( const char *value )
+static void appendQuotedString( std::string &document, const char *value )
 {
-   // Not sure how to handle unicode...
-   if (strpbrk(value, "\"\\\b\f\n\r\t") == NULL && !containsControlCharacter( value ))
-      return std::string("\"") + value + "\"";
-   // We have to walk value and escape any special characters.
-   // Appending to std::string is not efficient, but this should be rare.
-   // (Note: forward slashes are *not* rare, but I am not escaping them.)
-   unsigned maxsize = static_cast<unsigned>(strlen(value)*2 + 3); // allescaped+quotes+NULL
-   std::string result;
-   result.reserve(maxsize); // to avoid lots of mallocs
-   result += "\"";
-   for (const char* c=value; *c != 0; ++c)
+   static const char hexDigits[] = "0123456789ABCDEF";
+
+   const char *end = value + strlen( value );
+   document += '"';
+   while ( true )
    {
-      switch(*c)
+      // Append the chars which no need escape as a whole.
+      const char *special = findNeedEscapeChar( value, end );
+      document.append( value, special );
+      if ( special == end )
+         break;
+
+      const char c = *special;
+      value = special + 1;
+      switch ( c )
       {
-         case '\"':
-            result += "\\\"";
-            break;
-         case '\\':
-            result += "\\\\";
-            break;
-         case '\b':
-            result += "\\b";
-            break;
-         case '\f':
-            result += "\\f";
-            break;
-         case '\n':
-            result += "\\n";
-            break;
-         case '\r':
-            result += "\\r";
-            break;
-         case '\t':
-            result += "\\t";
-            break;
-         //case '/':
-            // Even though \/ is considered a legal escape in JSON, a bare
-            // slash is also legal, so I see no reason to escape it.
-            // (I hope I am not misunderstanding something.
-            // blep notes: actually escaping \/ may be useful in javascript to avoid </ 
-            // sequence.
-            // Should add a flag to allow this compatibility mode and prevent this 
-            // sequence from occurring.
-         default:
-            if ( isControlCharacter( *c ) )
-            {
-               std::ostringstream oss;
-               oss << "\\u" << std::hex << std::uppercase << std::setfill('0') << std::setw(4) << static_cast<int>(*c);
-               result += oss.str();
-            }
-            else
-            {
-               result += *c;
-            }
-            break;
+      case '\"':
+         document += "\\\"";
+         break;
+      case '\\':
+         document += "\\\\";
+         break;
+      case '\b':
+         document += "\\b";
+         break;
+      case '\f':
+         document += "\\f";
+         break;
+      case '\n':
+         document += "\\n";
+         break;
+      case '\r':
+         document += "\\r";
+         break;
+      case '\t':
+         document += "\\t";
+         break;
+      //case '/':
+         // Even though \/ is considered a legal escape in JSON, a bare
+         // slash is also legal, so I see no reason to escape it.
+         // (I hope I am not misunderstanding something.
+         // blep notes: actually escaping \/ may be useful in javascript to avoid </ 
+         // sequence.
+         // Should add a flag to allow this compatibility mode and prevent this 
+         // sequence from occurring.
+      default: // control character
+         {
+            const char escaped[6] = { '\\', 'u', '0', '0', 
+                                      hexDigits[(c >> 4) & 0xF], hexDigits[c & 0xF] };
+            document.append( escaped, sizeof(escaped) );
+         }
+         break;
       }
    }
-   result += "\"";
+   document += '"';
+}
+
+static void appendValue( std::string &document, LongLong value )
+{
+   char buffer[64];
+   char *current = buffer + sizeof(buffer);
+   bool isNegative = value < 0;
+   if ( isNegative )
+      value = -value;
+   ulongToString( ULongLong(value), current );
+   if ( isNegative )
+      *--current = '-';
+   document.append( current, buffer + sizeof(buffer) - 1 );
+}
+
+static void appendValue( std::string &document, ULongLong value )
+{
+   char buffer[64];
+   char *current = buffer + sizeof(buffer);
+   ulongToString( value, current );
+   document.append( current, buffer + sizeof(buffer) - 1 );
+}
+
+std::string valueToQuotedString( const char *value )
+{
+   // Not sure how to handle unicode...
+   std::string result;
+   result.reserve( strlen( value ) + 2 );
+   appendQuotedString( result, value );
    return result;
 }
 
@@ -226,7 +239,7 @@ FastWriter::enableYAMLCompatibility()
 std::string 
 FastWriter::write( const Value &root )
 {
-   document_ = "";
+   document_.clear();
    writeValue( root );
    document_ += "\n";
    return document_;
@@ -242,22 +255,22 @@ FastWriter::writeValue( const Value &value )
       document_ += "null";
       break;
    case intValue:
-      document_ += valueToString( value.asInt() );
+      appendValue( document_, LongLong( value.asInt() ) );
       break;
    case uintValue:
-      document_ += valueToString( value.asUInt() );
+      appendValue( document_, ULongLong( value.asUInt() ) );
       break;
    case longValue:
-       document_ += valueToString( value.asLong() );
+       appendValue( document_, value.asLong() );
        break;
    case ulongValue:
-       document_ += valueToString( value.asULong() );
+       appendValue( document_, value.asULong() );
        break;
    case realValue:
       document_ += valueToString( value.asDouble() );
       break;
    case stringValue:
-      document_ += valueToQuotedString( value.asCString() );
+      appendQuotedString( document_, value.asCString() );
       break;
    case booleanValue:
       document_ += valueToString( value.asBool() );
@@ -277,19 +290,18 @@ FastWriter::writeValue( const Value &value )
       break;
    case objectValue:
       {
-         Value::Members members( value.getMemberNames() );
+         // Iterate members directly, avoid copying member names and looking up each member again.
          document_ += "{";
-         for ( Value::Members::iterator it = members.begin(); 
-               it != members.end(); 
+         for ( Value::const_iterator it = value.begin(); 
+               it != value.end(); 
                ++it )
          {
-            const std::string &name = *it;
-            if ( it != members.begin() )
+            if ( it != value.begin() )
                document_ += ",";
-            document_ += valueToQuotedString( name.c_str() );
+            appendQuotedString( document_, it.memberName() );
             document_ += yamlCompatiblityEnabled_ ? ": " 
                                                   : ":";
-            writeValue( value[name] );
+            writeValue( *it );
          }
          document_ += "}";
       }
@@ -356,23 +368,22 @@ StyledWriter::writeValue( const Value &value )
       break;
    case objectValue:
       {
-         Value::Members members( value.getMemberNames() );
-         if ( members.empty() )
+         if ( value.size() == 0 )
             pushValue( "{}" );
          else
          {
             writeWithIndent( "{" );
             indent();
-            Value::Members::iterator it = members.begin();
+            Value::const_iterator it = value.begin();
             while ( true )
             {
-               const std::string &name = *it;
-               const Value &childValue = value[name];
+               const Value &childValue = *it;
                writeCommentBeforeValue( childValue );
-               writeWithIndent( valueToQuotedString( name.c_str() ) );
+               writeIndent();
+               appendQuotedString( document_, it.memberName() );
                document_ += " : ";
                writeValue( childValue );
-               if ( ++it == members.end() )
+               if ( ++it == value.end() )
                {
                   writeCommentAfterValueOnSameLine( childValue );
                   break;
@@ -638,23 +649,21 @@ StyledStreamWriter::writeValue( const Value &value )
       break;
    case objectValue:
       {
-         Value::Members members( value.getMemberNames() );
-         if ( members.empty() )
+         if ( value.size() == 0 )
             pushValue( "{}" );
          else
          {
             writeWithIndent( "{" );
             indent();
-            Value::Members::iterator it = members.begin();
+            Value::const_iterator it = value.begin();
             while ( true )
             {
-               const std::string &name = *it;
-               const Value &childValue = value[name];
+               const Value &childValue = *it;
                writeCommentBeforeValue( childValue );
-               writeWithIndent( valueToQuotedString( name.c_str() ) );
+               writeWithIndent( valueToQuotedString( it.memberName() ) );
                *document_ << " : ";
                writeValue( childValue );
-               if ( ++it == members.end() )
+               if ( ++it == value.end() )
                {
                   writeCommentAfterValueOnSameLine( childValue );
                   break;
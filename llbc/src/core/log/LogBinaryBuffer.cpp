@@ -0,0 +1,161 @@
+/**
+ * @file    LogBinaryBuffer.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/os/OS_Thread.h"
+
+#include "llbc/core/log/LogBinaryBuffer.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+/**
+ * \brief The record head, record space always 8 bytes aligned.
+ */
+struct __RecordHead
+{
+    volatile LLBC_NS sint32 state;
+    LLBC_NS uint32 size;
+};
+
+// The record states.
+static const LLBC_NS sint32 __recordFree = 0;
+static const LLBC_NS sint32 __recordCommitted = 1;
+static const LLBC_NS sint32 __recordPadding = 2;
+
+// The min buffer capacity.
+static const size_t __minCapacity = 4096;
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_LogBinaryBuffer::LLBC_LogBinaryBuffer(size_t capacity)
+: _buf(NULL)
+, _cap(0)
+, _mask(0)
+
+, _writePos(0)
+, _dropped(0)
+, _readPos(0)
+{
+    size_t cap = LLBC_INL_NS __minCapacity;
+    while (cap < capacity)
+        cap <<= 1;
+
+    // All not in use space always keep zero, see Release().
+    _buf = LLBC_Calloc(char, cap);
+    _cap = static_cast<sint64>(cap);
+    _mask = _cap - 1;
+}
+
+LLBC_LogBinaryBuffer::~LLBC_LogBinaryBuffer()
+{
+    LLBC_XFree(_buf);
+}
+
+void *LLBC_LogBinaryBuffer::Reserve(uint32 size)
+{
+    typedef LLBC_INL_NS __RecordHead _Head;
+
+    const sint64 need = static_cast<sint64>((sizeof(_Head) + size + 7) & ~static_cast<size_t>(7));
+    if (UNLIKELY(need > _cap / 2))
+    {
+        LLBC_AtomicFetchAndAdd(&_dropped, 1);
+        return NULL;
+    }
+
+    sint64 writePos, pad;
+    while (true)
+    {
+        writePos = LLBC_AtomicGet(&_writePos);
+        const sint64 readPos = LLBC_AtomicGet(&_readPos);
+
+        // Record never wrap around, if tail space not enough, padding it.
+        const sint64 tail = _cap - (writePos & _mask);
+        pad = (tail < need ? tail : 0);
+        if (writePos + pad + need - readPos > _cap)
+        {
+            LLBC_AtomicFetchAndAdd(&_dropped, 1);
+            return NULL;
+        }
+
+        if (LLBC_AtomicCompareAndExchange(&_writePos, writePos + pad + need, writePos) == writePos)
+            break;
+
+        LLBC_CPURelax();
+    }
+
+    if (pad > 0)
+    {
+        _Head *padHead = reinterpret_cast<_Head *>(_buf + (writePos & _mask));
+        padHead->size = static_cast<uint32>(pad);
+        LLBC_AtomicSet(&padHead->state, LLBC_INL_NS __recordPadding);
+    }
+
+    _Head *head = reinterpret_cast<_Head *>(_buf + ((writePos + pad) & _mask));
+    head->size = static_cast<uint32>(need);
+
+    return head + 1;
+}
+
+void LLBC_LogBinaryBuffer::Commit(void *record)
+{
+    LLBC_INL_NS __RecordHead *head = reinterpret_cast<LLBC_INL_NS __RecordHead *>(record) - 1;
+    LLBC_AtomicSet(&head->state, LLBC_INL_NS __recordCommitted);
+}
+
+const void *LLBC_LogBinaryBuffer::Peek(uint32 &size)
+{
+    typedef LLBC_INL_NS __RecordHead _Head;
+
+    while (true)
+    {
+        const sint64 readPos = _readPos;
+        if (readPos == LLBC_AtomicGet(&_writePos))
+            return NULL;
+
+        _Head *head = reinterpret_cast<_Head *>(_buf + (readPos & _mask));
+        const sint32 state = LLBC_AtomicGet(&head->state);
+        if (state == LLBC_INL_NS __recordFree)
+            return NULL; // Reserved, but not commit yet.
+        else if (state == LLBC_INL_NS __recordCommitted)
+        {
+            size = head->size - static_cast<uint32>(sizeof(_Head));
+            return head + 1;
+        }
+
+        // Skip padding.
+        Release();
+    }
+}
+
+void LLBC_LogBinaryBuffer::Release()
+{
+    typedef LLBC_INL_NS __RecordHead _Head;
+
+    const sint64 readPos = _readPos;
+    _Head *head = reinterpret_cast<_Head *>(_buf + (readPos & _mask));
+    const uint32 size = head->size;
+
+    // Zero whole record space, record head maybe reserved on any 8 bytes aligned position later.
+    memset(head, 0, size);
+    LLBC_AtomicSet(&_readPos, readPos + size);
+}
+
+sint64 LLBC_LogBinaryBuffer::GetDroppedCount() const
+{
+    return _dropped;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -0,0 +1,148 @@
+/**
+ * @file    LogBinaryFile.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/file/Directory.h"
+
+#include "llbc/core/log/LogBinaryBuffer.h"
+#include "llbc/core/log/LogFormatRegistry.h"
+#include "llbc/core/log/LogBinaryFile.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The binary log file magic and version.
+static const char __fileMagic[8] = {'L', 'L', 'B', 'C', 'B', 'L', 'O', 'G'};
+static const LLBC_NS uint32 __fileVersion = 1;
+
+// The binary log file entry types.
+static const LLBC_NS uint8 __formatEntry = 'F';
+static const LLBC_NS uint8 __recordEntry = 'R';
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_LogBinaryFile::LLBC_LogBinaryFile()
+: _file()
+, _writtenFmts()
+{
+}
+
+LLBC_LogBinaryFile::~LLBC_LogBinaryFile()
+{
+    Close();
+}
+
+int LLBC_LogBinaryFile::Open(const LLBC_String &path, const LLBC_String &loggerName)
+{
+    if (_file.IsOpened())
+    {
+        LLBC_SetLastError(LLBC_ERROR_OPENED);
+        return LLBC_FAILED;
+    }
+
+    const LLBC_String dir = LLBC_Directory::DirName(path);
+    if (!dir.empty() && !LLBC_Directory::Exists(dir))
+    {
+        if (LLBC_Directory::Create(dir) != LLBC_OK)
+            return LLBC_FAILED;
+    }
+
+    if (_file.Open(path, LLBC_FileMode::BinaryWrite) != LLBC_OK)
+        return LLBC_FAILED;
+
+    _file.Write(LLBC_INL_NS __fileMagic, sizeof(LLBC_INL_NS __fileMagic));
+    _file.Write(LLBC_INL_NS __fileVersion);
+    WriteString(loggerName);
+
+    _writtenFmts.clear();
+
+    return LLBC_OK;
+}
+
+void LLBC_LogBinaryFile::Close()
+{
+    if (!_file.IsOpened())
+        return;
+
+    _file.Flush();
+    _file.Close();
+
+    _writtenFmts.clear();
+}
+
+bool LLBC_LogBinaryFile::IsOpened() const
+{
+    return _file.IsOpened();
+}
+
+int LLBC_LogBinaryFile::Write(const LLBC_LogFormatInfo &info, const LLBC_LogBinaryRecord &record)
+{
+    if (UNLIKELY(!_file.IsOpened()))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_OPEN);
+        return LLBC_FAILED;
+    }
+
+    if (static_cast<size_t>(info.id) >= _writtenFmts.size() || !_writtenFmts[info.id])
+    {
+        if (WriteFormat(info) != LLBC_OK)
+            return LLBC_FAILED;
+    }
+
+    _file.Write(LLBC_INL_NS __recordEntry);
+    if (_file.Write(&record, sizeof(LLBC_LogBinaryRecord) + record.argsLen) < 0)
+        return LLBC_FAILED;
+
+    return LLBC_OK;
+}
+
+void LLBC_LogBinaryFile::Flush()
+{
+    if (_file.IsOpened())
+        _file.Flush();
+}
+
+int LLBC_LogBinaryFile::WriteFormat(const LLBC_LogFormatInfo &info)
+{
+    _file.Write(LLBC_INL_NS __formatEntry);
+    _file.Write(info.id);
+    _file.Write(static_cast<sint32>(info.level));
+    _file.Write(static_cast<sint32>(info.line));
+
+    WriteString(info.tag);
+    WriteString(info.file);
+    WriteString(info.fmt);
+
+    _file.Write(static_cast<uint32>(info.argTypes.size()));
+    if (!info.argTypes.empty())
+    {
+        if (_file.Write(&info.argTypes[0], info.argTypes.size()) < 0)
+            return LLBC_FAILED;
+    }
+
+    if (static_cast<size_t>(info.id) >= _writtenFmts.size())
+        _writtenFmts.resize(info.id + 1, false);
+    _writtenFmts[info.id] = true;
+
+    return LLBC_OK;
+}
+
+void LLBC_LogBinaryFile::WriteString(const LLBC_String &str)
+{
+    _file.Write(static_cast<uint32>(str.size()));
+    if (!str.empty())
+        _file.Write(str.data(), str.size());
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
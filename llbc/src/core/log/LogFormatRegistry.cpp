@@ -0,0 +1,478 @@
+/**
+ * @file    LogFormatRegistry.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/thread/Guard.h"
+
+#include "llbc/core/log/LogFormatRegistry.h"
+
+#if LLBC_TARGET_PLATFORM_WIN32
+#pragma warning(disable:4996)
+#endif
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The single conversion spec formatted buffer size, if not enough, will use heap buffer.
+static const int __specFmtBufSize = 256;
+
+/**
+ * Get integer argument type by length modifier.
+ */
+static int __GetIntArgType(const char *lenMod)
+{
+    if (lenMod[0] == '\0' || lenMod[0] == 'h')
+        return LLBC_NS LLBC_LogArgType::Int32;
+    else if (strcmp(lenMod, "l") == 0)
+        return sizeof(long) == 8 ? LLBC_NS LLBC_LogArgType::Int64 : LLBC_NS LLBC_LogArgType::Int32;
+    else if (strcmp(lenMod, "z") == 0 || strcmp(lenMod, "t") == 0 || strcmp(lenMod, "I") == 0)
+        return sizeof(size_t) == 8 ? LLBC_NS LLBC_LogArgType::Int64 : LLBC_NS LLBC_LogArgType::Int32;
+    else if (strcmp(lenMod, "I32") == 0)
+        return LLBC_NS LLBC_LogArgType::Int32;
+
+    // ll, q, j, I64.
+    return LLBC_NS LLBC_LogArgType::Int64;
+}
+
+/**
+ * Format single conversion spec and append to formatted message.
+ */
+static void __AppendSpec(LLBC_NS LLBC_String &formatted, const char *spec, int starCount, const int *stars, ...)
+{
+    // Replace '*' to actually width/precision, only support at most one value argument.
+    LLBC_NS LLBC_String actualSpec;
+    if (starCount > 0)
+    {
+        for (int starIdx = 0; *spec != '\0'; ++spec)
+        {
+            if (*spec == '*' && starIdx < starCount)
+                actualSpec.append_format("%d", stars[starIdx++]);
+            else
+                actualSpec.append(1, *spec);
+        }
+
+        spec = actualSpec.c_str();
+    }
+
+    char buf[__specFmtBufSize];
+
+    va_list ap;
+    va_start(ap, stars);
+    const int len = ::vsnprintf(buf, sizeof(buf), spec, ap);
+    va_end(ap);
+
+    if (len < 0)
+        return;
+    else if (len < static_cast<int>(sizeof(buf)))
+    {
+        formatted.append(buf, len);
+        return;
+    }
+
+    // Buffer not enough, use heap buffer format again.
+    char *heapBuf = LLBC_Malloc(char, len + 1);
+
+    va_start(ap, stars);
+    ::vsnprintf(heapBuf, len + 1, spec, ap);
+    va_end(ap);
+
+    formatted.append(heapBuf, len);
+    LLBC_Free(heapBuf);
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_LogFormatRegistry::LLBC_LogFormatRegistry()
+: _lock()
+, _siteIds()
+
+, _count(0)
+, _infos(NULL)
+{
+    _infos = new LLBC_LogFormatInfo *[LLBC_CFG_LOG_MAX_BINARY_FORMAT_COUNT];
+    LLBC_MemSet(const_cast<LLBC_LogFormatInfo **>(_infos), 0, sizeof(LLBC_LogFormatInfo *) * LLBC_CFG_LOG_MAX_BINARY_FORMAT_COUNT);
+}
+
+LLBC_LogFormatRegistry::~LLBC_LogFormatRegistry()
+{
+    for (sint32 i = 0; i < _count; ++i)
+        delete _infos[i];
+
+    delete [] _infos;
+}
+
+sint32 LLBC_LogFormatRegistry::Register(int level, const char *tag, const char *file, int line, const char *fmt)
+{
+    if (UNLIKELY(!fmt))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return -1;
+    }
+
+    LLBC_Guard guard(_lock);
+
+    const _SiteKey siteKey(_SiteKey0(file, fmt), line);
+    std::map<_SiteKey, sint32>::const_iterator it = _siteIds.find(siteKey);
+    if (it != _siteIds.end())
+        return it->second;
+
+    if (_count >= LLBC_CFG_LOG_MAX_BINARY_FORMAT_COUNT)
+    {
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return -1;
+    }
+
+    LLBC_LogFormatInfo *info = new LLBC_LogFormatInfo;
+    info->id = _count + 1;
+    info->level = level;
+    if (tag)
+        info->tag.append(tag);
+    if (file)
+        info->file.append(file);
+    info->line = line;
+    info->fmt.append(fmt);
+
+    if (ParseFormat(*info) != LLBC_OK)
+    {
+        delete info;
+
+        // Unsupported format also cache the result, avoid parse again.
+        _siteIds.insert(std::make_pair(siteKey, -1));
+        return -1;
+    }
+
+    // Publish format info(full barrier) before format Id return to call site.
+    LLBC_AtomicSetPtr(reinterpret_cast<void * volatile *>(&_infos[_count]), info);
+    ++_count;
+
+    _siteIds.insert(std::make_pair(siteKey, info->id));
+
+    return info->id;
+}
+
+int LLBC_LogFormatRegistry::EncodeArgs(const LLBC_LogFormatInfo &info, va_list ap, char *buf, uint32 bufSize)
+{
+    uint32 pos = 0;
+    const size_t argCount = info.argTypes.size();
+    for (size_t argIdx = 0; argIdx < argCount; ++argIdx)
+    {
+        const int argType = info.argTypes[argIdx];
+        if (argType == LLBC_LogArgType::String)
+        {
+            const char *str = va_arg(ap, const char *);
+            if (UNLIKELY(!str))
+                str = "(null)";
+
+            if (UNLIKELY(pos + sizeof(uint32) > bufSize))
+            {
+                LLBC_SetLastError(LLBC_ERROR_LIMIT);
+                return -1;
+            }
+
+            // Truncate string if buffer not enough.
+            uint32 strLen = static_cast<uint32>(strlen(str));
+            strLen = MIN(strLen, bufSize - pos - static_cast<uint32>(sizeof(uint32)));
+
+            memcpy(buf + pos, &strLen, sizeof(uint32));
+            memcpy(buf + pos + sizeof(uint32), str, strLen);
+            pos += static_cast<uint32>(sizeof(uint32)) + strLen;
+
+            continue;
+        }
+
+        const uint32 valSize = (argType == LLBC_LogArgType::Int32 ? sizeof(sint32) : sizeof(sint64));
+        if (UNLIKELY(pos + valSize > bufSize))
+        {
+            LLBC_SetLastError(LLBC_ERROR_LIMIT);
+            return -1;
+        }
+
+        if (argType == LLBC_LogArgType::Int32)
+        {
+            const sint32 val = va_arg(ap, int);
+            memcpy(buf + pos, &val, sizeof(sint32));
+        }
+        else if (argType == LLBC_LogArgType::Int64)
+        {
+            const sint64 val = va_arg(ap, sint64);
+            memcpy(buf + pos, &val, sizeof(sint64));
+        }
+        else if (argType == LLBC_LogArgType::Double)
+        {
+            const double val = va_arg(ap, double);
+            memcpy(buf + pos, &val, sizeof(double));
+        }
+        else if (argType == LLBC_LogArgType::LongDouble)
+        {
+            const double val = static_cast<double>(va_arg(ap, ldouble));
+            memcpy(buf + pos, &val, sizeof(double));
+        }
+        else // Pointer
+        {
+            const uint64 val = static_cast<uint64>(reinterpret_cast<size_t>(va_arg(ap, void *)));
+            memcpy(buf + pos, &val, sizeof(uint64));
+        }
+
+        pos += valSize;
+    }
+
+    return static_cast<int>(pos);
+}
+
+int LLBC_LogFormatRegistry::FormatArgs(const LLBC_LogFormatInfo &info, const char *args, uint32 argsLen, LLBC_String &formatted)
+{
+    uint32 pos = 0;
+    const size_t segCount = info.segments.size();
+    for (size_t segIdx = 0; segIdx < segCount; ++segIdx)
+    {
+        const LLBC_LogFormatInfo::Segment &seg = info.segments[segIdx];
+        formatted.append(seg.literal);
+        if (seg.spec.empty())
+            continue;
+
+        int stars[2] = {0, 0};
+        for (int starIdx = 0; starIdx < seg.starCount; ++starIdx)
+        {
+            if (UNLIKELY(pos + sizeof(sint32) > argsLen))
+            {
+                LLBC_SetLastError(LLBC_ERROR_FORMAT);
+                return LLBC_FAILED;
+            }
+
+            memcpy(&stars[starIdx], args + pos, sizeof(sint32));
+            pos += sizeof(sint32);
+        }
+
+        if (seg.argType == LLBC_LogArgType::String)
+        {
+            uint32 strLen;
+            if (UNLIKELY(pos + sizeof(uint32) > argsLen))
+            {
+                LLBC_SetLastError(LLBC_ERROR_FORMAT);
+                return LLBC_FAILED;
+            }
+
+            memcpy(&strLen, args + pos, sizeof(uint32));
+            pos += sizeof(uint32);
+            if (UNLIKELY(pos + strLen > argsLen))
+            {
+                LLBC_SetLastError(LLBC_ERROR_FORMAT);
+                return LLBC_FAILED;
+            }
+
+            // Plain %s, append directly.
+            const LLBC_String str(args + pos, strLen);
+            if (seg.starCount == 0 && seg.spec.size() == 2)
+                formatted.append(str);
+            else
+                LLBC_INL_NS __AppendSpec(formatted, seg.spec.c_str(), seg.starCount, stars, str.c_str());
+
+            pos += strLen;
+
+            continue;
+        }
+
+        const uint32 valSize = (seg.argType == LLBC_LogArgType::Int32 ? sizeof(sint32) : sizeof(sint64));
+        if (UNLIKELY(pos + valSize > argsLen))
+        {
+            LLBC_SetLastError(LLBC_ERROR_FORMAT);
+            return LLBC_FAILED;
+        }
+
+        if (seg.argType == LLBC_LogArgType::Int32)
+        {
+            sint32 val;
+            memcpy(&val, args + pos, sizeof(sint32));
+            LLBC_INL_NS __AppendSpec(formatted, seg.spec.c_str(), seg.starCount, stars, val);
+        }
+        else if (seg.argType == LLBC_LogArgType::Int64)
+        {
+            sint64 val;
+            memcpy(&val, args + pos, sizeof(sint64));
+            LLBC_INL_NS __AppendSpec(formatted, seg.spec.c_str(), seg.starCount, stars, val);
+        }
+        else if (seg.argType == LLBC_LogArgType::Double ||
+                 seg.argType == LLBC_LogArgType::LongDouble)
+        {
+            double val;
+            memcpy(&val, args + pos, sizeof(double));
+            LLBC_INL_NS __AppendSpec(formatted, seg.spec.c_str(), seg.starCount, stars, val);
+        }
+        else // Pointer
+        {
+            uint64 val;
+            memcpy(&val, args + pos, sizeof(uint64));
+            LLBC_INL_NS __AppendSpec(formatted, seg.spec.c_str(), seg.starCount, stars,
+                reinterpret_cast<void *>(static_cast<size_t>(val)));
+        }
+
+        pos += valSize;
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_LogFormatRegistry::ParseFormat(LLBC_LogFormatInfo &info)
+{
+    LLBC_LogFormatInfo::Segment seg;
+    seg.starCount = 0;
+    seg.argType = 0;
+
+    const char *p = info.fmt.c_str();
+    while (*p != '\0')
+    {
+        if (*p != '%')
+        {
+            seg.literal.append(1, *p++);
+            continue;
+        }
+        else if (*(p + 1) == '%')
+        {
+            seg.literal.append(1, '%');
+            p += 2;
+
+            continue;
+        }
+
+        // Parse conversion spec: %[flags][width][.precision][length]conversion.
+        LLBC_String spec("%");
+        ++p;
+
+        while (*p != '\0' && strchr("-+ #0'", *p))
+            spec.append(1, *p++);
+
+        if (*p == '*')
+        {
+            spec.append(1, *p++);
+            ++seg.starCount;
+            info.argTypes.push_back(LLBC_LogArgType::Int32);
+        }
+        else
+        {
+            while (*p >= '0' && *p <= '9')
+                spec.append(1, *p++);
+        }
+
+        if (*p == '.')
+        {
+            spec.append(1, *p++);
+            if (*p == '*')
+            {
+                spec.append(1, *p++);
+                ++seg.starCount;
+                info.argTypes.push_back(LLBC_LogArgType::Int32);
+            }
+            else
+            {
+                while (*p >= '0' && *p <= '9')
+                    spec.append(1, *p++);
+            }
+        }
+
+        char lenMod[4] = {'\0', '\0', '\0', '\0'};
+        if ((*p == 'h' && *(p + 1) == 'h') || (*p == 'l' && *(p + 1) == 'l'))
+        {
+            lenMod[0] = *p; lenMod[1] = *(p + 1);
+            p += 2;
+        }
+        else if ((*p == 'I' && *(p + 1) == '6' && *(p + 2) == '4') ||
+                 (*p == 'I' && *(p + 1) == '3' && *(p + 2) == '2'))
+        {
+            memcpy(lenMod, p, 3);
+            p += 3;
+        }
+        else if (*p != '\0' && strchr("hlLqjztI", *p))
+        {
+            lenMod[0] = *p++;
+        }
+
+        const char conv = *p;
+        if (conv == '\0')
+        {
+            LLBC_SetLastError(LLBC_ERROR_FORMAT);
+            return LLBC_FAILED;
+        }
+
+        ++p;
+
+        if (strchr("diouxX", conv))
+        {
+            seg.argType = LLBC_INL_NS __GetIntArgType(lenMod);
+
+            // Normalize length modifier, keep h/hh(value truncate semantic), 64bit integer use ll.
+            if (lenMod[0] == 'h')
+                spec.append(lenMod);
+            else if (seg.argType == LLBC_LogArgType::Int64)
+                spec.append("ll");
+        }
+        else if (conv == 'c')
+        {
+            if (lenMod[0] != '\0')
+            {
+                LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+                return LLBC_FAILED;
+            }
+
+            seg.argType = LLBC_LogArgType::Int32;
+        }
+        else if (strchr("eEfFgGaA", conv))
+        {
+            seg.argType = (lenMod[0] == 'L' ? LLBC_LogArgType::LongDouble : LLBC_LogArgType::Double);
+        }
+        else if (conv == 's')
+        {
+            // Wide string not support.
+            if (lenMod[0] != '\0')
+            {
+                LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+                return LLBC_FAILED;
+            }
+
+            seg.argType = LLBC_LogArgType::String;
+        }
+        else if (conv == 'p')
+        {
+            seg.argType = LLBC_LogArgType::Pointer;
+        }
+        else
+        {
+            // %n and other unknown conversions not support.
+            LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+            return LLBC_FAILED;
+        }
+
+        spec.append(1, conv);
+
+        seg.spec.swap(spec);
+        info.argTypes.push_back(static_cast<uint8>(seg.argType));
+        info.segments.push_back(seg);
+
+        seg.literal.clear();
+        seg.spec.clear();
+        seg.starCount = 0;
+        seg.argType = 0;
+    }
+
+    if (!seg.literal.empty())
+        info.segments.push_back(seg);
+
+    return LLBC_OK;
+}
+
+__LLBC_NS_END
+
+#if LLBC_TARGET_PLATFORM_WIN32
+#pragma warning(default:4996)
+#endif
+
+#include "llbc/common/AfterIncl.h"
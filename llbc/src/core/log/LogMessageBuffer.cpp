@@ -10,41 +10,85 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/utils/Util_Text.h"
+
 #include "llbc/core/log/LogMessageBuffer.h"
 
 #if LLBC_CFG_LOG_USING_WITH_STREAM
 
+__LLBC_INTERNAL_NS_BEGIN
+
+// The message buffer initialize capacity.
+static const int __initBufCap = 256;
+// The built-in type value max formatted length.
+static const int __maxValueFmtLen = 64;
+
+__LLBC_INTERNAL_NS_END
+
 __LLBC_NS_BEGIN
 
+/**
+ * \brief The stream buffer, all stream output append to the message buffer.
+ */
+class LLBC_LogMessageBuffer::_StreamBuf : public std::basic_streambuf<char>
+{
+public:
+    explicit _StreamBuf(LLBC_LogMessageBuffer *owner)
+    : _owner(owner)
+    {
+    }
+
+protected:
+    virtual int_type overflow(int_type c)
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            const char ch = traits_type::to_char_type(c);
+            _owner->Append(&ch, 1);
+        }
+
+        return traits_type::not_eof(c);
+    }
+
+    virtual std::streamsize xsputn(const char *s, std::streamsize n)
+    {
+        _owner->Append(s, static_cast<size_t>(n));
+        return n;
+    }
+
+private:
+    LLBC_LogMessageBuffer *_owner;
+};
+
 LLBC_LogMessageBuffer::LLBC_LogMessageBuffer()
+: _buf(NULL)
+, _len(0)
+, _cap(0)
+
+, _streamBuf(NULL)
+, _stream(NULL)
+
+, _str()
 {
-    _stream = NULL;
 }
 
 LLBC_LogMessageBuffer::~LLBC_LogMessageBuffer()
 {
     LLBC_XDelete(_stream);
+    LLBC_XDelete(_streamBuf);
+
+    LLBC_XFree(_buf);
 }
 
 LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(const LLBC_String &msg)
 {
-    _buf.append(msg);
-    if (_stream)
-    {
-        *_stream <<static_cast<const std::basic_string<char> &>(msg);
-    }
-
+    Append(msg.data(), msg.size());
     return *this;
 }
 
 LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(const std::basic_string<char> &msg)
 {
-    _buf.append(msg.c_str(), msg.length());
-    if (_stream)
-    {
-        *_stream <<msg;
-    }
-
+    Append(msg.data(), msg.size());
     return *this;
 }
 
@@ -61,89 +105,146 @@ LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(const char *msg)
         actualMsg = "null";
     }
 
-    _buf.append(actualMsg);
-    if (_stream)
-    {
-        *_stream <<actualMsg;
-    }
+    Append(actualMsg, LLBC_StrLenA(actualMsg));
 
     return *this;
 }
 
 LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(char msg)
 {
-    _buf.append(1, msg);
-    if (_stream)
-    {
-        *_stream <<msg;
-    }
-
+    Append(&msg, 1);
     return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(bool val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(bool val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    // Stream created, maybe stream flags changed(eg: std::boolalpha), output to stream.
+    if (_stream)
+        *_stream <<val;
+    else
+        Append(val ? "1" : "0", 1);
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(uint8 val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(uint8 val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<static_cast<uint32>(val);
+    else
+        AppendFormat("%u", static_cast<uint32>(val));
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(sint16 val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(sint16 val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%d", static_cast<sint32>(val));
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(uint16 val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(uint16 val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%u", static_cast<uint32>(val));
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(sint32 val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(sint32 val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%d", val);
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(uint32 val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(uint32 val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%u", val);
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(sint64 val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(sint64 val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%lld", static_cast<long long>(val));
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(uint64 val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(uint64 val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%llu", static_cast<unsigned long long>(val));
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(long val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(long val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%ld", val);
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(ulong val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(ulong val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%lu", val);
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(float val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(float val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%g", static_cast<double>(val));
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(double val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(double val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%g", val);
+
+    return *this;
 }
 
-std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(ldouble val)
+LLBC_LogMessageBuffer &LLBC_LogMessageBuffer::operator <<(ldouble val)
 {
-    return static_cast<std::basic_ostream<char> &>(*this).operator <<(val);
+    if (_stream)
+        *_stream <<val;
+    else
+        AppendFormat("%Lg", val);
+
+    return *this;
 }
 
 std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(void *val)
@@ -159,15 +260,18 @@ std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(ios_base_manip mani
     return s;
 }
 
+std::basic_ostream<char> &LLBC_LogMessageBuffer::operator <<(ostream_manip manip)
+{
+    std::basic_ostream<char> &s = *this;
+    return (*manip)(s);
+}
+
 LLBC_LogMessageBuffer::operator std::basic_ostream<char> &()
 {
     if (!_stream)
     {
-        _stream = new std::basic_ostringstream<char>(std::ios_base::ate);
-        if (!_buf.empty())
-        {
-            *_stream <<_buf;
-        }
+        _streamBuf = new _StreamBuf(this);
+        _stream = new std::basic_ostream<char>(_streamBuf);
     }
 
     return *_stream;
@@ -175,13 +279,74 @@ LLBC_LogMessageBuffer::operator std::basic_ostream<char> &()
 
 const LLBC_String &LLBC_LogMessageBuffer::str(LLBC_LogMessageBuffer &)
 {
-    return _buf;
+    _str.assign(_buf ? _buf : "", _len);
+    return _str;
 }
 
 const LLBC_String &LLBC_LogMessageBuffer::str(std::basic_ostream<char> &)
 {
-    static_cast<std::basic_string<char> &>(_buf) = _stream->str();
-    return _buf;
+    _str.assign(_buf ? _buf : "", _len);
+    return _str;
+}
+
+int LLBC_LogMessageBuffer::GetLength() const
+{
+    return _len;
+}
+
+char *LLBC_LogMessageBuffer::Detach(int &len)
+{
+    if (UNLIKELY(!_buf))
+    {
+        _buf = LLBC_Malloc(char, 1);
+        _buf[0] = '\0';
+    }
+
+    char *buf = _buf;
+    len = _len;
+
+    _buf = NULL;
+    _len = _cap = 0;
+
+    return buf;
+}
+
+void LLBC_LogMessageBuffer::Append(const char *data, size_t len)
+{
+    // Always reserve one byte to store tailing character.
+    const int needCap = _len + static_cast<int>(len) + 1;
+    if (needCap > _cap)
+    {
+        int newCap = MAX(_cap, LLBC_INL_NS __initBufCap);
+        while (newCap < needCap)
+            newCap <<= 1;
+
+        _buf = LLBC_Realloc(char, _buf, newCap);
+        _cap = newCap;
+    }
+
+    memcpy(_buf + _len, data, len);
+    _len += static_cast<int>(len);
+    _buf[_len] = '\0';
+}
+
+void LLBC_LogMessageBuffer::AppendFormat(const char *fmt, ...)
+{
+    char valBuf[LLBC_INL_NS __maxValueFmtLen];
+
+    va_list ap;
+    va_start(ap, fmt);
+#if LLBC_TARGET_PLATFORM_WIN32
+    int valLen = ::vsnprintf_s(valBuf, sizeof(valBuf), _TRUNCATE, fmt, ap);
+#else
+    int valLen = ::vsnprintf(valBuf, sizeof(valBuf), fmt, ap);
+#endif
+    va_end(ap);
+
+    if (UNLIKELY(valLen < 0))
+        return;
+
+    Append(valBuf, MIN(valLen, static_cast<int>(sizeof(valBuf)) - 1));
 }
 
 __LLBC_NS_END
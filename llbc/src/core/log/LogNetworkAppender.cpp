@@ -10,13 +10,65 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/os/OS_Time.h"
+#include "llbc/core/os/OS_Poll.h"
+#include "llbc/core/os/OS_Socket.h"
+#include "llbc/core/os/OS_Thread.h"
+#include "llbc/core/thread/MessageBlock.h"
+
+#include "llbc/core/log/LogData.h"
+#include "llbc/core/log/LogTokenChain.h"
 #include "llbc/core/log/LogNetworkAppender.h"
 
+__LLBC_INTERNAL_NS_BEGIN
+
+// The frame head size, frame length(uint32) + records count(uint32).
+static const size_t __frameHeadSize = sizeof(LLBC_NS uint32) * 2;
+
+// The udp frame max size.
+static const size_t __maxUdpFrameSize = 65000;
+
+// The send flags, avoid SIGPIPE when collector closed connection.
+#ifdef MSG_NOSIGNAL
+static const int __sendFlags = MSG_NOSIGNAL;
+#else
+static const int __sendFlags = 0;
+#endif
+
+__LLBC_INTERNAL_NS_END
+
 __LLBC_NS_BEGIN
 
 LLBC_LogNetworkAppender::LLBC_LogNetworkAppender()
 : _ip("127.0.0.1")
 , _port(0)
+, _udp(false)
+
+, _frameSize(LLBC_CFG_LOG_DEFAULT_NETWORK_FRAME_SIZE)
+, _spillBufferSize(LLBC_CFG_LOG_DEFAULT_NETWORK_SPILL_BUFFER_SIZE)
+, _flushInterval(0)
+, _reconnectInterval(LLBC_CFG_LOG_DEFAULT_NETWORK_RECONNECT_INTERVAL)
+, _maxReconnectInterval(LLBC_CFG_LOG_DEFAULT_NETWORK_MAX_RECONNECT_INTERVAL)
+
+, _sock(LLBC_INVALID_SOCKET_HANDLE)
+, _connState(_Disconnected)
+, _connectTime(0)
+, _nextConnectTime(0)
+, _curReconnectInterval(0)
+
+, _frame()
+, _frameRecords(0)
+, _frameBeginTime(0)
+, _frameNoticeDropped(0)
+
+, _frames()
+, _framesRecords()
+, _framesNoticeDropped()
+, _spillSize(0)
+
+, _droppedCount(0)
+, _reportedDroppedCount(0)
+, _sentCount(0)
 {
 }
 
@@ -32,22 +84,360 @@ int LLBC_LogNetworkAppender::GetType() const
 
 int LLBC_LogNetworkAppender::Initialize(const LLBC_LogAppenderInitInfo &initInfo)
 {
-    _ip = "127.0.0.1";
-    _port = 0;
+    if (initInfo.ip.empty() || initInfo.port == 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    if (_Base::Initialize(initInfo) != LLBC_OK)
+        return LLBC_FAILED;
 
-    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
-    return LLBC_FAILED;
+    _ip = initInfo.ip;
+    _port = initInfo.port;
+    _udp = initInfo.networkUdp;
+
+    _frameSize = MAX(LLBC_INL_NS __frameHeadSize + 1, static_cast<size_t>(MAX(0, initInfo.frameSize)));
+    if (_udp)
+        _frameSize = MIN(_frameSize, LLBC_INL_NS __maxUdpFrameSize);
+    _spillBufferSize = static_cast<size_t>(MAX(0, initInfo.spillBufferSize));
+    _flushInterval = MAX(0, initInfo.flushInterval);
+    _reconnectInterval = MAX(1, initInfo.reconnectInterval);
+    _maxReconnectInterval = MAX(_reconnectInterval, static_cast<sint64>(initInfo.maxReconnectInterval));
+
+    _connState = _Disconnected;
+    _nextConnectTime = 0;
+    _curReconnectInterval = _reconnectInterval;
+
+    _frame.reserve(_frameSize);
+    _frameRecords = 0;
+
+    _droppedCount = 0;
+    _reportedDroppedCount = 0;
+    _sentCount = 0;
+
+    // Start connect at once, connect result will check in next pump.
+    Pump(LLBC_GetCoarseMonotonicMilliSeconds());
+
+    return LLBC_OK;
 }
 
 void LLBC_LogNetworkAppender::Finalize()
 {
+    if (!GetTokenChain())
+        return;
+
+    // Best effort send all pending frames, wait at most LLBC_CFG_LOG_NETWORK_FINALIZE_FLUSH_TIMEOUT.
+    SealFrame();
+
+    sint64 now = LLBC_GetCoarseMonotonicMilliSeconds();
+    const sint64 deadline = now + LLBC_CFG_LOG_NETWORK_FINALIZE_FLUSH_TIMEOUT;
+    while (!_frames.empty() && now < deadline)
+    {
+        if (_connState == _Disconnected && _nextConnectTime >= deadline)
+            break;
+
+        Pump(now);
+        if (_frames.empty())
+            break;
+
+        LLBC_Sleep(1);
+        now = LLBC_GetCoarseMonotonicMilliSeconds();
+    }
+
+    while (!_frames.empty())
+        DropFrame();
+
+    if (_sock != LLBC_INVALID_SOCKET_HANDLE)
+    {
+        LLBC_CloseSocket(_sock);
+        _sock = LLBC_INVALID_SOCKET_HANDLE;
+    }
+
+    _connState = _Disconnected;
+
+    _frame.clear();
+    _frameRecords = 0;
+    _frameNoticeDropped = 0;
+
     _Base::Finalize();
 }
 
 int LLBC_LogNetworkAppender::Output(const LLBC_LogData &data)
 {
-    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
-    return LLBC_FAILED;
+    LLBC_LogTokenChain *chain = NULL;
+    if (UNLIKELY(!(chain = GetTokenChain())))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return LLBC_FAILED;
+    }
+
+    if (data.level < GetLogLevel())
+        return LLBC_OK;
+
+    LLBC_String formattedData;
+    chain->Format(data, formattedData);
+
+    // Record too large, truncate it(udp datagram size limited, and large record will block pipeline).
+    const size_t maxRecordSize = _frameSize - LLBC_INL_NS __frameHeadSize;
+    if (formattedData.size() > maxRecordSize)
+        formattedData.resize(maxRecordSize);
+
+    if (_frame.size() + formattedData.size() > _frameSize)
+        SealFrame();
+
+    // Flush interval and reconnect backoff use monotonic clock, unaffected by wall clock adjust.
+    const sint64 now = LLBC_GetCoarseMonotonicMilliSeconds();
+
+    if (_frameRecords == 0)
+    {
+        // Reserve frame head, fill it when seal frame.
+        _frame.append(LLBC_INL_NS __frameHeadSize, '\0');
+        _frameBeginTime = now;
+
+        // Report dropped records in-band, reported only if this frame not dropped.
+        const sint64 unreported = _droppedCount - _reportedDroppedCount;
+        if (unreported > 0 && _frameSize - _frame.size() >= formattedData.size() + 64)
+        {
+            _frame.append_format("LLBC_LogNetworkAppender: %lld log records dropped\n", unreported);
+            _frameNoticeDropped = unreported;
+            _reportedDroppedCount += unreported;
+            _frameRecords += 1;
+        }
+    }
+
+    _frame.append(formattedData);
+    _frameRecords += 1;
+
+    // Frame full or frame records waited enough time, seal it and send.
+    if (_frame.size() >= _frameSize ||
+        now - _frameBeginTime >= _flushInterval)
+    {
+        SealFrame();
+        Pump(now);
+    }
+
+    return LLBC_OK;
+}
+
+sint64 LLBC_LogNetworkAppender::GetDroppedCount() const
+{
+    return _droppedCount;
+}
+
+sint64 LLBC_LogNetworkAppender::GetSentCount() const
+{
+    return _sentCount;
+}
+
+void LLBC_LogNetworkAppender::Flush()
+{
+    if (!GetTokenChain())
+        return;
+
+    SealFrame();
+    Pump(LLBC_GetCoarseMonotonicMilliSeconds());
+}
+
+void LLBC_LogNetworkAppender::SealFrame()
+{
+    if (_frameRecords == 0)
+        return;
+
+    // Frame records count not include the dropped records report record.
+    const uint32 records = _frameRecords - (_frameNoticeDropped > 0 ? 1 : 0);
+    if (_spillSize + _frame.size() > _spillBufferSize)
+    {
+        // Spill buffer full, drop frame, the dropped records report again in later frame.
+        _droppedCount += records;
+        _reportedDroppedCount -= _frameNoticeDropped;
+    }
+    else
+    {
+        uint32 frameHead[2];
+        frameHead[0] = LLBC_Host2Net2(static_cast<uint32>(_frame.size()));
+        frameHead[1] = LLBC_Host2Net2(_frameRecords);
+        memcpy(const_cast<char *>(_frame.data()), frameHead, sizeof(frameHead));
+
+        LLBC_MessageBlock *block = new LLBC_MessageBlock(_frame.size());
+        block->Write(_frame.data(), _frame.size());
+
+        _frames.push_back(block);
+        _framesRecords.push_back(records);
+        _framesNoticeDropped.push_back(_frameNoticeDropped);
+        _spillSize += _frame.size();
+    }
+
+    _frame.clear();
+    _frameRecords = 0;
+    _frameNoticeDropped = 0;
+}
+
+void LLBC_LogNetworkAppender::Pump(sint64 now)
+{
+    if (_connState == _Disconnected)
+    {
+        if (now < _nextConnectTime)
+            return;
+
+        Connect(now);
+    }
+
+    if (_connState == _Connecting)
+        CheckConnect(now);
+
+    if (_connState == _Connected)
+        SendFrames(now);
+}
+
+void LLBC_LogNetworkAppender::Connect(sint64 now)
+{
+    _sock = _udp ? LLBC_CreateUdpSocket() : LLBC_CreateTcpSocket();
+    if (_sock == LLBC_INVALID_SOCKET_HANDLE)
+    {
+        Disconnect(now);
+        return;
+    }
+
+    if (LLBC_SetNonBlocking(_sock) != LLBC_OK)
+    {
+        Disconnect(now);
+        return;
+    }
+
+    // Udp socket connect only set default peer address, always finish immediately.
+    if (LLBC_ConnectToPeer(_sock, LLBC_SockAddr_IN(_ip.c_str(), _port)) == LLBC_OK)
+    {
+        _connState = _Connected;
+        _curReconnectInterval = _reconnectInterval;
+    }
+    else if (LLBC_GetLastError() == LLBC_ERROR_WBLOCK)
+    {
+        _connState = _Connecting;
+        _connectTime = now;
+    }
+    else
+    {
+        Disconnect(now);
+    }
+}
+
+void LLBC_LogNetworkAppender::CheckConnect(sint64 now)
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    LLBC_PollFd pollFd;
+    pollFd.fd = _sock;
+    pollFd.events = POLLOUT;
+    pollFd.revents = 0;
+    const int ready = LLBC_Poll(&pollFd, 1, 0);
+#else // LLBC_TARGET_PLATFORM_WIN32
+    fd_set writeFds, exceptFds;
+    FD_ZERO(&writeFds);
+    FD_ZERO(&exceptFds);
+    FD_SET(_sock, &writeFds);
+    FD_SET(_sock, &exceptFds);
+
+    struct timeval timeout = {0, 0};
+    const int ready = ::select(0, NULL, &writeFds, &exceptFds, &timeout);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    if (ready < 0)
+    {
+        Disconnect(now);
+        return;
+    }
+    else if (ready == 0)
+    {
+        // Connect timeout, treat as connect failed.
+        if (now - _connectTime >= _maxReconnectInterval)
+            Disconnect(now);
+
+        return;
+    }
+
+    int sockErr = 0;
+    LLBC_SocketLen optLen = sizeof(sockErr);
+    if (LLBC_GetSocketOption(_sock, SOL_SOCKET, SO_ERROR, &sockErr, &optLen) != LLBC_OK || sockErr != 0)
+    {
+        Disconnect(now);
+        return;
+    }
+
+    _connState = _Connected;
+    _curReconnectInterval = _reconnectInterval;
+}
+
+void LLBC_LogNetworkAppender::Disconnect(sint64 now)
+{
+    if (_sock != LLBC_INVALID_SOCKET_HANDLE)
+    {
+        LLBC_CloseSocket(_sock);
+        _sock = LLBC_INVALID_SOCKET_HANDLE;
+    }
+
+    _connState = _Disconnected;
+
+    // Partial sent frame must resend from frame begin on new connection.
+    if (!_frames.empty())
+        _frames.front()->SetReadPos(0);
+
+    _nextConnectTime = now + _curReconnectInterval;
+    _curReconnectInterval = MIN(_curReconnectInterval * 2, _maxReconnectInterval);
+}
+
+void LLBC_LogNetworkAppender::SendFrames(sint64 now)
+{
+    while (!_frames.empty())
+    {
+        LLBC_MessageBlock *block = _frames.front();
+        const int len = static_cast<int>(block->GetReadableSize());
+        const int sent = LLBC_Send(_sock, block->GetDataStartWithReadPos(), len, LLBC_INL_NS __sendFlags);
+        if (sent < 0)
+        {
+            const int errNo = LLBC_GetLastError();
+            if (errNo == LLBC_ERROR_WBLOCK || errNo == LLBC_ERROR_AGAIN)
+                return;
+
+            if (_udp)
+            {
+                // Udp send failed(eg: collector not listening), drop the frame, keep socket.
+                DropFrame();
+
+                continue;
+            }
+
+            Disconnect(now);
+            return;
+        }
+
+        if (sent < len)
+        {
+            block->ShiftReadPos(sent);
+            return;
+        }
+
+        _sentCount += _framesRecords.front();
+        PopFrame();
+    }
+}
+
+void LLBC_LogNetworkAppender::PopFrame()
+{
+    LLBC_MessageBlock *block = _frames.front();
+    _spillSize -= block->GetWritePos();
+
+    delete block;
+    _frames.pop_front();
+    _framesRecords.pop_front();
+    _framesNoticeDropped.pop_front();
+}
+
+void LLBC_LogNetworkAppender::DropFrame()
+{
+    _droppedCount += _framesRecords.front();
+    _reportedDroppedCount -= _framesNoticeDropped.front();
+
+    PopFrame();
 }
 
 __LLBC_NS_END
@@ -14,6 +14,10 @@
 #include "llbc/core/thread/MessageBlock.h"
 
 #include "llbc/core/log/LogData.h"
+#include "llbc/core/log/LogLevel.h"
+#include "llbc/core/log/LogBinaryFile.h"
+#include "llbc/core/log/LogBinaryBuffer.h"
+#include "llbc/core/log/LogFormatRegistry.h"
 #include "llbc/core/log/ILogAppender.h"
 #include "llbc/core/log/LogAppenderBuilder.h"
 #include "llbc/core/log/LogRunnable.h"
@@ -26,6 +30,11 @@ LLBC_LogRunnable::LLBC_LogRunnable()
 
 , _lastFlushTime(0)
 , _flushInterval(LLBC_CFG_LOG_DEFAULT_LOG_FLUSH_INTERVAL)
+
+, _loggerName()
+, _binBuffer(NULL)
+, _binFile(NULL)
+, _reportedBinDropped(0)
 {
 }
 
@@ -43,12 +52,22 @@ void LLBC_LogRunnable::Cleanup()
     {
         block->Read(&logData, sizeof(LLBC_LogData *));
 
+        // Output binary records logged before this log message first, keep log order.
+        if (_binBuffer)
+            DrainBinaryRecords();
+
         Output(logData);
         FreeLogData(logData);
 
         delete block;
     }
 
+    // Drain all not process's binary log records.
+    if (_binBuffer)
+        DrainBinaryRecords();
+    if (_binFile)
+        _binFile->Flush();
+
     // Delete all appender.
     while (_head)
     {
@@ -77,15 +96,26 @@ void LLBC_LogRunnable::Svc()
                 appender = appender->GetAppenderNext();
             }
 
+            if (_binFile)
+                _binFile->Flush();
+
             _lastFlushTime = now;
         }
 
+        // Binary log records not notify log thread, drain it periodically.
+        if (_binBuffer)
+            DrainBinaryRecords();
+
         // Try pop log message to output.
-        if (TimedPop(block, 50) != LLBC_OK)
+        if (TimedPop(block, _binBuffer ? LLBC_CFG_LOG_BINARY_DRAIN_INTERVAL : 50) != LLBC_OK)
             continue;
 
         block->Read(&logData, sizeof(LLBC_LogData *));
 
+        // Output binary records logged before this log message first, keep log order.
+        if (_binBuffer)
+            DrainBinaryRecords();
+
         Output(logData);
         FreeLogData(logData);
 
@@ -99,6 +129,16 @@ void LLBC_LogRunnable::SetFlushInterval(sint64 flushInterval)
     _flushInterval = flushInterval;
 }
 
+void LLBC_LogRunnable::SetBinaryInput(const LLBC_String &loggerName,
+                                      LLBC_LogBinaryBuffer *buffer,
+                                      LLBC_LogBinaryFile *binaryFile)
+{
+    _loggerName = loggerName;
+    _binBuffer = buffer;
+    _binFile = binaryFile;
+    _reportedBinDropped = 0;
+}
+
 void LLBC_LogRunnable::AddAppender(LLBC_ILogAppender *appender)
 {
     appender->SetAppenderNext(NULL);
@@ -143,6 +183,105 @@ void LLBC_LogRunnable::Stop()
     _stoped = true;
 }
 
+void LLBC_LogRunnable::DrainBinaryRecords()
+{
+    uint32 size;
+    const void *record;
+    while ((record = _binBuffer->Peek(size)) != NULL)
+    {
+        OutputBinaryRecord(record);
+        _binBuffer->Release();
+    }
+
+    // Report dropped records(binary buffer full).
+    const sint64 dropped = _binBuffer->GetDroppedCount();
+    if (dropped != _reportedBinDropped)
+    {
+        LLBC_String msg;
+        msg.format("binary log buffer full, %lld records dropped(total: %lld)",
+                   dropped - _reportedBinDropped, dropped);
+        _reportedBinDropped = dropped;
+
+        OutputText(LLBC_LogLevel::Warn,
+                   LLBC_String(),
+                   LLBC_String(),
+                   0,
+                   LLBC_GetMilliSeconds(),
+                   __LLBC_GetLibTls()->coreTls.nativeThreadHandle,
+                   msg);
+    }
+}
+
+void LLBC_LogRunnable::OutputBinaryRecord(const void *record)
+{
+    const LLBC_LogBinaryRecord &binRecord = *reinterpret_cast<const LLBC_LogBinaryRecord *>(record);
+    const LLBC_LogFormatInfo *info = LLBC_LogFormatRegistrySingleton->GetFormatInfo(binRecord.fmtId);
+    if (UNLIKELY(!info))
+        return;
+
+    if (_binFile)
+    {
+        _binFile->Write(*info, binRecord);
+        return;
+    }
+
+    LLBC_String msg;
+    const char *args = reinterpret_cast<const char *>(&binRecord + 1);
+    LLBC_LogFormatRegistry::FormatArgs(*info, args, binRecord.argsLen, msg);
+
+    OutputText(info->level,
+               info->tag,
+               info->file,
+               info->line,
+               binRecord.logTime,
+               (LLBC_NativeThreadHandle)(size_t)(binRecord.threadHandle),
+               msg);
+}
+
+void LLBC_LogRunnable::OutputText(int level,
+                                  const LLBC_String &tag,
+                                  const LLBC_String &file,
+                                  int line,
+                                  sint64 logTime,
+                                  LLBC_NativeThreadHandle threadHandle,
+                                  const LLBC_String &msg)
+{
+    LLBC_LogData *data = new LLBC_LogData;
+
+    data->level = level;
+    data->loggerName = _loggerName.c_str();
+
+    data->tagBeg = 0;
+    data->tagLen = static_cast<uint32>(tag.size());
+    data->fileBeg = data->tagLen;
+    data->fileLen = static_cast<uint32>(file.size());
+
+    const uint32 othersSize = data->tagLen + data->fileLen;
+    if (othersSize == 0)
+    {
+        data->others = NULL;
+    }
+    else
+    {
+        data->others = LLBC_Malloc(char, othersSize);
+        memcpy(data->others + data->tagBeg, tag.data(), data->tagLen);
+        memcpy(data->others + data->fileBeg, file.data(), data->fileLen);
+    }
+
+    data->logTime = logTime;
+    data->line = line;
+
+    data->msgLen = static_cast<uint32>(msg.size());
+    data->msg = LLBC_Malloc(char, data->msgLen + 1);
+    memcpy(data->msg, msg.data(), data->msgLen);
+    data->msg[data->msgLen] = '\0';
+
+    data->threadHandle = threadHandle;
+
+    Output(data);
+    FreeLogData(data);
+}
+
 void LLBC_LogRunnable::FreeLogData(LLBC_LogData *data)
 {
     LLBC_XFree(data->msg);
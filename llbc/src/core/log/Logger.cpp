@@ -23,6 +23,9 @@
 #include "llbc/core/log/ILogAppender.h"
 #include "llbc/core/log/LogAppenderBuilder.h"
 #include "llbc/core/log/LogRunnable.h"
+#include "llbc/core/log/LogBinaryFile.h"
+#include "llbc/core/log/LogBinaryBuffer.h"
+#include "llbc/core/log/LogFormatRegistry.h"
 #include "llbc/core/log/Logger.h"
 
 #if LLBC_TARGET_PLATFORM_WIN32
@@ -33,6 +36,21 @@ __LLBC_INTERNAL_NS_BEGIN
 
 static const LLBC_NS LLBC_String __g_invalidLoggerName;
 
+/**
+ * Get the log time, in milli-seconds.
+ * If enabled LLBC_CFG_LOG_USING_CACHED_TIME, service threads use the frame begin cached time,
+ * same as service's timers, other threads(no cached time refresher) use system time.
+ */
+static inline LLBC_NS sint64 __GetLogTime()
+{
+#if LLBC_CFG_LOG_USING_CACHED_TIME
+    if (LLBC_NS __LLBC_GetLibTls()->commTls.services[0])
+        return LLBC_NS LLBC_GetCachedMilliSeconds();
+#endif // LLBC_CFG_LOG_USING_CACHED_TIME
+
+    return LLBC_NS LLBC_GetMilliSeconds();
+}
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
@@ -43,6 +61,9 @@ LLBC_Logger::LLBC_Logger()
 , _logLevel(LLBC_LogLevel::Debug)
 , _config(NULL)
 , _logRunnable(NULL)
+
+, _binBuffer(NULL)
+, _binFile(NULL)
 {
 }
 
@@ -70,6 +91,8 @@ int LLBC_Logger::Initialize(const LLBC_String &name, const LLBC_LoggerConfigInfo
     _config = config;
 
     _logLevel = MIN(_config->GetConsoleLogLevel(), _config->GetFileLogLevel());
+    if (_config->IsLogToNetwork())
+        _logLevel = MIN(_logLevel, _config->GetNetworkLogLevel());
 
     _logRunnable = new LLBC_LogRunnable;
     _logRunnable->SetFlushInterval(_config->GetFlushInterval());
@@ -119,8 +142,57 @@ int LLBC_Logger::Initialize(const LLBC_String &name, const LLBC_LoggerConfigInfo
         _logRunnable->AddAppender(appender);
     }
 
+    if (_config->IsLogToNetwork())
+    {
+        LLBC_LogAppenderInitInfo appenderInitInfo;
+        appenderInitInfo.level = _config->GetNetworkLogLevel();
+        appenderInitInfo.pattern = _config->GetNetworkPattern();
+        appenderInitInfo.ip = _config->GetNetworkIp();
+        appenderInitInfo.port = _config->GetNetworkPort();
+        appenderInitInfo.networkUdp = _config->IsNetworkUdp();
+        appenderInitInfo.frameSize = _config->GetNetworkFrameSize();
+        appenderInitInfo.spillBufferSize = _config->GetNetworkSpillBufferSize();
+        appenderInitInfo.reconnectInterval = _config->GetNetworkReconnectInterval();
+        appenderInitInfo.maxReconnectInterval = _config->GetNetworkMaxReconnectInterval();
+
+        // Synchronous mode no log thread flush appender, send frame at once.
+        if (!_config->IsAsyncMode())
+            appenderInitInfo.flushInterval = 0;
+        else
+            appenderInitInfo.flushInterval = _config->GetFlushInterval();
+
+        LLBC_ILogAppender *appender =
+            LLBC_LogAppenderBuilderSingleton->BuildAppender(LLBC_LogAppenderType::Network);
+        if (appender->Initialize(appenderInitInfo) != LLBC_OK)
+        {
+            LLBC_XDelete(appender);
+            return LLBC_FAILED;
+        }
+
+        _logRunnable->AddAppender(appender);
+    }
+
+    if (_config->IsBinaryMode())
+    {
+        if (!_config->GetBinaryLogFile().empty())
+        {
+            _binFile = new LLBC_LogBinaryFile;
+            if (_binFile->Open(_config->GetBinaryLogFile(), _name) != LLBC_OK)
+            {
+                LLBC_XDelete(_binFile);
+                return LLBC_FAILED;
+            }
+        }
+
+        _binBuffer = new LLBC_LogBinaryBuffer(_config->GetBinaryBufferSize());
+        _logRunnable->SetBinaryInput(_name, _binBuffer, _binFile);
+    }
+
     if (_config->IsAsyncMode())
+    {
+        _logRunnable->SetCPUAffinity(_config->GetThreadAffinity());
         _logRunnable->Activate(1);
+    }
 
     return LLBC_OK;
 }
@@ -149,6 +221,9 @@ void LLBC_Logger::Finalize()
 
     LLBC_XDelete(_logRunnable);
 
+    LLBC_XDelete(_binBuffer);
+    LLBC_XDelete(_binFile);
+
     _name.clear();
     _config = NULL;
 }
@@ -192,6 +267,11 @@ bool LLBC_Logger::IsTakeOver() const
     return _config->IsTakeOver();
 }
 
+sint64 LLBC_Logger::GetBinaryDroppedCount() const
+{
+    return _binBuffer ? _binBuffer->GetDroppedCount() : 0;
+}
+
 int LLBC_Logger::Debug(const char *tag, const char *file, int line, const char *message, ...)
 {
     if (LLBC_LogLevel::Debug < _logLevel)
@@ -276,6 +356,58 @@ int LLBC_Logger::OutputNonFormat(int level, const char *tag, const char *file, i
     return DirectOutput(level, tag, file, line, copyMessage, static_cast<int>(messageLen));
 }
 
+int LLBC_Logger::OutputNonFormatOwned(int level, const char *tag, const char *file, int line, char *message, int messageLen)
+{
+    if (UNLIKELY(!_logRunnable))
+    {
+        LLBC_XFree(message);
+
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return LLBC_FAILED;
+    }
+
+    return DirectOutput(level, tag, file, line, message, messageLen);
+}
+
+int LLBC_Logger::OutputBinary(sint32 fmtId, ...)
+{
+    const LLBC_LogFormatInfo *info = LLBC_LogFormatRegistrySingleton->GetFormatInfo(fmtId);
+    if (UNLIKELY(!info || !_binBuffer))
+    {
+        LLBC_SetLastError(info ? LLBC_ERROR_NOT_INIT : LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    // Encode to stack buffer first, string arguments length unknown before encode.
+    char args[LLBC_CFG_LOG_BINARY_MAX_ARGS_SIZE];
+
+    va_list ap;
+    va_start(ap, fmtId);
+    const int argsLen = LLBC_LogFormatRegistry::EncodeArgs(*info, ap, args, sizeof(args));
+    va_end(ap);
+
+    if (UNLIKELY(argsLen < 0))
+        return LLBC_FAILED;
+
+    LLBC_LogBinaryRecord *record = reinterpret_cast<LLBC_LogBinaryRecord *>(
+        _binBuffer->Reserve(static_cast<uint32>(sizeof(LLBC_LogBinaryRecord) + argsLen)));
+    if (UNLIKELY(!record))
+    {
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_FAILED;
+    }
+
+    record->fmtId = fmtId;
+    record->argsLen = static_cast<uint32>(argsLen);
+    record->logTime = LLBC_INTERNAL_NS __GetLogTime();
+    record->threadHandle = (uint64)(size_t)(__LLBC_GetLibTls()->coreTls.nativeThreadHandle);
+    memcpy(record + 1, args, argsLen);
+
+    _binBuffer->Commit(record);
+
+    return LLBC_OK;
+}
+
 int LLBC_Logger::DirectOutput(int level, const char *tag, const char *file, int line, char *message, int len) 
 {
     LLBC_LogData *data = BuildLogData(level, tag, file, line, message, len);
@@ -327,7 +459,7 @@ LLBC_LogData *LLBC_Logger::BuildLogData(int level,
             memcpy(data->others + data->fileBeg, file, data->fileLen);
     }
 
-    data->logTime = LLBC_GetMilliSeconds();
+    data->logTime = LLBC_INTERNAL_NS __GetLogTime();
 
     data->line = line;
 
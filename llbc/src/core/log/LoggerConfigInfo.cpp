@@ -11,6 +11,7 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/os/OS_Process.h"
+#include "llbc/core/os/OS_Thread.h"
 #include "llbc/core/utils/Util_Text.h"
 #include  "llbc/core/file/Directory.h"
 #include "llbc/core/config/Property.h"
@@ -24,6 +25,7 @@ LLBC_LoggerConfigInfo::LLBC_LoggerConfigInfo()
 : _logLevel(LLBC_LogLevel::End)
 , _asyncMode(false)
 , _flushInterval(0)
+, _threadAffinity()
 
 , _logToConsole(true)
 , _consoleLogLevel(LLBC_LogLevel::End)
@@ -40,6 +42,21 @@ LLBC_LoggerConfigInfo::LLBC_LoggerConfigInfo()
 , _maxBackupIndex(0)
 , _fileBufferSize(0)
 
+, _binaryMode(false)
+, _binaryLogFile()
+, _binaryBufferSize(0)
+
+, _logToNetwork(false)
+, _networkLogLevel(LLBC_LogLevel::End)
+, _networkPattern()
+, _networkIp()
+, _networkPort(0)
+, _networkUdp(false)
+, _networkFrameSize(0)
+, _networkSpillBufferSize(0)
+, _networkReconnectInterval(0)
+, _networkMaxReconnectInterval(0)
+
 , _takeOver(false)
 {
 }
@@ -54,6 +71,18 @@ int LLBC_LoggerConfigInfo::Initialize(const LLBC_Property &cfg)
     _logLevel = (cfg.HasProperty("level") ? LLBC_LogLevel::Str2Level(cfg.GetValue("level").AsCStr()) : LLBC_CFG_LOG_DEFAULT_LEVEL);
     _asyncMode = (cfg.HasProperty("asynchronous") ? cfg.GetValue("asynchronous").AsBool() : LLBC_CFG_LOG_DEFAULT_ASYNC_MODE);
     _flushInterval= (cfg.HasProperty("flushInterval") ? cfg.GetValue("flushInterval").AsInt32() : LLBC_CFG_LOG_DEFAULT_LOG_FLUSH_INTERVAL);
+    if (cfg.HasProperty("threadAffinity"))
+    {
+        // CPU list format: cpuNo[,cpuNo...], invalid CPU numbers will be ignored.
+        const int cpuCount = LLBC_GetCPUCount();
+        const std::vector<LLBC_String> cpuNos = cfg.GetValue("threadAffinity").AsStr().split(',');
+        for (size_t i = 0; i < cpuNos.size(); ++i)
+        {
+            LLBC_String cpuNo = cpuNos[i];
+            if (!cpuNo.strip().empty() && cpuNo.isdigit() && LLBC_Str2Int32(cpuNo.c_str()) < cpuCount)
+                _threadAffinity.push_back(LLBC_Str2Int32(cpuNo.c_str()));
+        }
+    }
 
     // Console log configs.
     _logToConsole = (cfg.HasProperty("logToConsole") ? cfg.GetValue("logToConsole").AsBool() : LLBC_CFG_LOG_DEFAULT_LOG_TO_CONSOLE);
@@ -71,6 +100,28 @@ int LLBC_LoggerConfigInfo::Initialize(const LLBC_Property &cfg)
     _maxFileSize = (cfg.HasProperty("maxFileSize") ? cfg.GetValue("maxFileSize").AsLong() : LLBC_CFG_LOG_MAX_FILE_SIZE);
     _maxBackupIndex = (cfg.HasProperty("maxBackupIndex") ? cfg.GetValue("maxBackupIndex").AsInt32() : LLBC_CFG_LOG_MAX_BACKUP_INDEX);
 
+    // Binary log configs.
+    _binaryMode = (cfg.HasProperty("binaryMode") ? cfg.GetValue("binaryMode").AsBool() : false);
+    _binaryLogFile = (cfg.HasProperty("binaryLogFile") ? cfg.GetValue("binaryLogFile").AsStr() : "");
+    _binaryBufferSize = (cfg.HasProperty("binaryBufferSize") ? 
+            cfg.GetValue("binaryBufferSize").AsInt32() : LLBC_CFG_LOG_DEFAULT_BINARY_BUFFER_SIZE);
+
+    // Network log configs.
+    _logToNetwork = (cfg.HasProperty("logToNetwork") ? cfg.GetValue("logToNetwork").AsBool() : false);
+    _networkLogLevel = (cfg.HasProperty("networkLogLevel") ? LLBC_LogLevel::Str2Level(cfg.GetValue("networkLogLevel").AsCStr()) : _logLevel);
+    _networkPattern = (cfg.HasProperty("networkPattern") ? cfg.GetValue("networkPattern").AsStr() : LLBC_CFG_LOG_DEFAULT_NETWORK_LOG_PATTERN);
+    _networkIp = (cfg.HasProperty("networkIp") ? cfg.GetValue("networkIp").AsStr() : "127.0.0.1");
+    _networkPort = (cfg.HasProperty("networkPort") ? cfg.GetValue("networkPort").AsUInt16() : 0);
+    _networkUdp = (cfg.HasProperty("networkProtocol") ? cfg.GetValue("networkProtocol").AsStr().tolower() == "udp" : false);
+    _networkFrameSize = (cfg.HasProperty("networkFrameSize") ?
+            cfg.GetValue("networkFrameSize").AsInt32() : LLBC_CFG_LOG_DEFAULT_NETWORK_FRAME_SIZE);
+    _networkSpillBufferSize = (cfg.HasProperty("networkSpillBufferSize") ?
+            cfg.GetValue("networkSpillBufferSize").AsInt32() : LLBC_CFG_LOG_DEFAULT_NETWORK_SPILL_BUFFER_SIZE);
+    _networkReconnectInterval = (cfg.HasProperty("networkReconnectInterval") ?
+            cfg.GetValue("networkReconnectInterval").AsInt32() : LLBC_CFG_LOG_DEFAULT_NETWORK_RECONNECT_INTERVAL);
+    _networkMaxReconnectInterval = (cfg.HasProperty("networkMaxReconnectInterval") ?
+            cfg.GetValue("networkMaxReconnectInterval").AsInt32() : LLBC_CFG_LOG_DEFAULT_NETWORK_MAX_RECONNECT_INTERVAL);
+
     // Misc configs.
     _takeOver = (cfg.HasProperty("takeOver") ? cfg.GetValue("takeOver").AsBool() : LLBC_CFG_LOG_ROOT_LOGGER_TAKE_OVER_UNCONFIGED);
 
@@ -87,11 +138,22 @@ int LLBC_LoggerConfigInfo::Initialize(const LLBC_Property &cfg)
         _consoleLogLevel = _logLevel;
     if (!LLBC_LogLevel::IsLegal(_fileLogLevel))
         _fileLogLevel = _logLevel;
+    if (!LLBC_LogLevel::IsLegal(_networkLogLevel))
+        _networkLogLevel = _logLevel;
 
     _maxFileSize = MAX(1, _maxFileSize);
     _maxBackupIndex = MAX(0, _maxBackupIndex);
     _flushInterval = MIN(MAX(0, _flushInterval), LLBC_CFG_LOG_MAX_LOG_FLUSH_INTERVAL);
 
+    // Binary mode deferred formatting to log thread, only available in asynchronous mode.
+    _binaryMode = _binaryMode && _asyncMode;
+    _binaryBufferSize = MAX(0, _binaryBufferSize);
+
+    _networkFrameSize = MAX(1, _networkFrameSize);
+    _networkSpillBufferSize = MAX(0, _networkSpillBufferSize);
+    _networkReconnectInterval = MAX(1, _networkReconnectInterval);
+    _networkMaxReconnectInterval = MAX(_networkReconnectInterval, _networkMaxReconnectInterval);
+
     // Normallize log file name.
     NormalizeLogFileName();
 
@@ -113,6 +175,11 @@ int LLBC_LoggerConfigInfo::GetFlushInterval() const
     return _flushInterval;
 }
 
+const std::vector<int> &LLBC_LoggerConfigInfo::GetThreadAffinity() const
+{
+    return _threadAffinity;
+}
+
 bool LLBC_LoggerConfigInfo::IsLogToConsole() const
 {
     return _logToConsole;
@@ -178,6 +245,71 @@ int LLBC_LoggerConfigInfo::GetFileBufferSize() const
     return _fileBufferSize;
 }
 
+bool LLBC_LoggerConfigInfo::IsBinaryMode() const
+{
+    return _binaryMode;
+}
+
+const LLBC_String &LLBC_LoggerConfigInfo::GetBinaryLogFile() const
+{
+    return _binaryLogFile;
+}
+
+int LLBC_LoggerConfigInfo::GetBinaryBufferSize() const
+{
+    return _binaryBufferSize;
+}
+
+bool LLBC_LoggerConfigInfo::IsLogToNetwork() const
+{
+    return _logToNetwork;
+}
+
+int LLBC_LoggerConfigInfo::GetNetworkLogLevel() const
+{
+    return _networkLogLevel;
+}
+
+const LLBC_String &LLBC_LoggerConfigInfo::GetNetworkPattern() const
+{
+    return _networkPattern;
+}
+
+const LLBC_String &LLBC_LoggerConfigInfo::GetNetworkIp() const
+{
+    return _networkIp;
+}
+
+uint16 LLBC_LoggerConfigInfo::GetNetworkPort() const
+{
+    return _networkPort;
+}
+
+bool LLBC_LoggerConfigInfo::IsNetworkUdp() const
+{
+    return _networkUdp;
+}
+
+int LLBC_LoggerConfigInfo::GetNetworkFrameSize() const
+{
+    return _networkFrameSize;
+}
+
+int LLBC_LoggerConfigInfo::GetNetworkSpillBufferSize() const
+{
+    return _networkSpillBufferSize;
+}
+
+int LLBC_LoggerConfigInfo::GetNetworkReconnectInterval() const
+{
+    return _networkReconnectInterval;
+}
+
+int LLBC_LoggerConfigInfo::GetNetworkMaxReconnectInterval() const
+{
+    return _networkMaxReconnectInterval;
+}
+
 bool LLBC_LoggerConfigInfo::IsTakeOver() const
 {
     return _takeOver;
@@ -188,10 +320,12 @@ void LLBC_LoggerConfigInfo::NormalizeLogFileName()
     const LLBC_String curProcId = 
         LLBC_Num2Str(LLBC_GetCurrentProcessId());
     _logFile.findreplace("%p", curProcId); 
+    _binaryLogFile.findreplace("%p", curProcId);
 
     const LLBC_String modFileName = 
         LLBC_Directory::BaseName(LLBC_Directory::ModuleFileName());
     _logFile.findreplace("%m", modFileName);
+    _binaryLogFile.findreplace("%m", modFileName);
 
 #if LLBC_TARGET_PLATFORM_IPHONE
     if (_logToFile &&
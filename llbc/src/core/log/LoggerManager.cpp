@@ -10,6 +10,7 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/os/OS_Console.h"
 #include "llbc/core/helper/STLHelper.h"
 
 #include "llbc/core/thread/Guard.h"
@@ -146,6 +147,32 @@ LLBC_Logger *LLBC_LoggerManager::GetLogger(const LLBC_String &name) const
     return iter->second;
 }
 
+void __LLBC_LibWarnLog(const char *file, int line, const char *fmt, ...)
+{
+    char *msg; int msgLen;
+    LLBC_FormatArg(fmt, msg, msgLen);
+    if (UNLIKELY(!msg))
+        return;
+
+    LLBC_LoggerManager *loggerMgr = LLBC_LoggerManagerSingleton;
+    LLBC_Logger *rootLogger = loggerMgr->IsInited() ? loggerMgr->GetRootLogger() : NULL;
+    if (rootLogger)
+    {
+        // Logger take over the message.
+        if (rootLogger->IsLevelEnabled(LLBC_LogLevel::Warn))
+        {
+            rootLogger->OutputNonFormatOwned(LLBC_LogLevel::Warn, NULL, file, line, msg, msgLen);
+            return;
+        }
+    }
+    else
+    {
+        LLBC_FilePrintLine(stderr, "%s", msg);
+    }
+
+    LLBC_Free(msg);
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
@@ -0,0 +1,336 @@
+/**
+ * @file    OS_IoUring.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_IoUring.h"
+
+#if LLBC_CFG_OS_ENABLE_IO_URING
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static int __IoUringSetup(LLBC_NS uint32 entries, struct io_uring_params *params)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int __IoUringEnter(int fd, LLBC_NS uint32 toSubmit, LLBC_NS uint32 minComplete, LLBC_NS uint32 flags, void *arg, size_t argSize)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+}
+
+static int __IoUringRegister(int fd, LLBC_NS uint32 opcode, void *arg, LLBC_NS uint32 nrArgs)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs));
+}
+
+static LLBC_NS uint32 *__RingPtr(void *ring, LLBC_NS uint32 offset)
+{
+    return reinterpret_cast<LLBC_NS uint32 *>(reinterpret_cast<char *>(ring) + offset);
+}
+
+// The ops must supported, IORING_OP_SEND_ZC introduced with multishot recv in linux 6.0.
+static const int __requiredOps[] =
+{
+    IORING_OP_POLL_ADD,
+    IORING_OP_ASYNC_CANCEL,
+    IORING_OP_ACCEPT,
+    IORING_OP_SEND,
+    IORING_OP_RECV,
+    IORING_OP_SEND_ZC
+};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+bool LLBC_IoUringIsSupported()
+{
+    LLBC_IoUring ring;
+    if (LLBC_IoUringQueueInit(8, 16, ring) != LLBC_OK)
+        return false;
+
+    bool supported = (ring.features & IORING_FEAT_NODROP) && (ring.features & IORING_FEAT_EXT_ARG);
+
+    // Probe required ops.
+    if (supported)
+    {
+        const size_t probeSize = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+        struct io_uring_probe *probe = reinterpret_cast<struct io_uring_probe *>(LLBC_Calloc(char, probeSize));
+        if (LLBC_INL_NS __IoUringRegister(ring.fd, IORING_REGISTER_PROBE, probe, 256) != 0)
+        {
+            supported = false;
+        }
+        else
+        {
+            for (size_t i = 0; i < sizeof(LLBC_INL_NS __requiredOps) / sizeof(LLBC_INL_NS __requiredOps[0]); ++i)
+            {
+                const int op = LLBC_INL_NS __requiredOps[i];
+                if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+                {
+                    supported = false;
+                    break;
+                }
+            }
+        }
+
+        LLBC_Free(probe);
+    }
+
+    // Probe provided buffer ring.
+    if (supported)
+    {
+        void *bufRing = NULL;
+        const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        if (::posix_memalign(&bufRing, pageSize, pageSize) != 0)
+        {
+            supported = false;
+        }
+        else
+        {
+            LLBC_MemSet(bufRing, 0, pageSize);
+            if (LLBC_IoUringRegisterBufRing(ring,
+                                            reinterpret_cast<struct io_uring_buf_ring *>(bufRing),
+                                            8,
+                                            0) != LLBC_OK)
+                supported = false;
+            else
+                LLBC_IoUringUnregisterBufRing(ring, 0);
+
+            ::free(bufRing);
+        }
+    }
+
+    LLBC_IoUringQueueExit(ring);
+
+    return supported;
+}
+
+int LLBC_IoUringQueueInit(uint32 entries, uint32 cqEntries, LLBC_IoUring &ring)
+{
+    LLBC_MemSet(&ring, 0, sizeof(LLBC_IoUring));
+    ring.fd = LLBC_INVALID_HANDLE;
+
+    struct io_uring_params params;
+    LLBC_MemSet(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+    params.cq_entries = cqEntries;
+
+    int fd = LLBC_INL_NS __IoUringSetup(entries, &params);
+    if (fd < 0 && errno == EINVAL)
+    {
+        // Old kernel not support some setup flags, only keep completion queue size.
+        LLBC_MemSet(&params, 0, sizeof(params));
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = cqEntries;
+
+        fd = LLBC_INL_NS __IoUringSetup(entries, &params);
+    }
+
+    if (fd < 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    ring.fd = fd;
+    ring.features = params.features;
+
+    // Map submission/completion queue rings, if kernel support single mmap, share one mapping.
+    ring.sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+    ring.cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(LLBC_IoUringCqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        ring.sqRingSize = ring.cqRingSize = MAX(ring.sqRingSize, ring.cqRingSize);
+
+    ring.sqRing = ::mmap(NULL, ring.sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ring.sqRing == MAP_FAILED)
+    {
+        ring.sqRing = NULL;
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        LLBC_IoUringQueueExit(ring);
+
+        return LLBC_FAILED;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring.cqRing = ring.sqRing;
+    }
+    else
+    {
+        ring.cqRing = ::mmap(NULL, ring.cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (ring.cqRing == MAP_FAILED)
+        {
+            ring.cqRing = NULL;
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+            LLBC_IoUringQueueExit(ring);
+
+            return LLBC_FAILED;
+        }
+    }
+
+    ring.sqesSize = params.sq_entries * sizeof(LLBC_IoUringSqe);
+    void *sqes = ::mmap(NULL, ring.sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        LLBC_IoUringQueueExit(ring);
+
+        return LLBC_FAILED;
+    }
+
+    ring.sqes = reinterpret_cast<LLBC_IoUringSqe *>(sqes);
+
+    ring.sqHead = LLBC_INL_NS __RingPtr(ring.sqRing, params.sq_off.head);
+    ring.sqTail = LLBC_INL_NS __RingPtr(ring.sqRing, params.sq_off.tail);
+    ring.sqMask = *LLBC_INL_NS __RingPtr(ring.sqRing, params.sq_off.ring_mask);
+    ring.sqEntries = params.sq_entries;
+    ring.sqeTail = *ring.sqTail;
+
+    ring.cqHead = LLBC_INL_NS __RingPtr(ring.cqRing, params.cq_off.head);
+    ring.cqTail = LLBC_INL_NS __RingPtr(ring.cqRing, params.cq_off.tail);
+    ring.cqMask = *LLBC_INL_NS __RingPtr(ring.cqRing, params.cq_off.ring_mask);
+    ring.cqes = reinterpret_cast<LLBC_IoUringCqe *>(
+        reinterpret_cast<char *>(ring.cqRing) + params.cq_off.cqes);
+
+    // Submission queue entries always submit in order, so the index array is identity mapping.
+    uint32 *sqArray = LLBC_INL_NS __RingPtr(ring.sqRing, params.sq_off.array);
+    for (uint32 i = 0; i < params.sq_entries; ++i)
+        sqArray[i] = i;
+
+    return LLBC_OK;
+}
+
+void LLBC_IoUringQueueExit(LLBC_IoUring &ring)
+{
+    if (ring.sqes)
+        ::munmap(ring.sqes, ring.sqesSize);
+    if (ring.cqRing && ring.cqRing != ring.sqRing)
+        ::munmap(ring.cqRing, ring.cqRingSize);
+    if (ring.sqRing)
+        ::munmap(ring.sqRing, ring.sqRingSize);
+    if (ring.fd != LLBC_INVALID_HANDLE)
+        ::close(ring.fd);
+
+    LLBC_MemSet(&ring, 0, sizeof(LLBC_IoUring));
+    ring.fd = LLBC_INVALID_HANDLE;
+}
+
+LLBC_IoUringSqe *LLBC_IoUringGetSqe(LLBC_IoUring &ring)
+{
+    const uint32 head = __atomic_load_n(ring.sqHead, __ATOMIC_ACQUIRE);
+    if (ring.sqeTail - head >= ring.sqEntries)
+        return NULL;
+
+    LLBC_IoUringSqe *sqe = &ring.sqes[ring.sqeTail & ring.sqMask];
+    ++ring.sqeTail;
+
+    LLBC_MemSet(sqe, 0, sizeof(LLBC_IoUringSqe));
+
+    return sqe;
+}
+
+int LLBC_IoUringSubmit(LLBC_IoUring &ring, uint32 waitNr, int timeout)
+{
+    // Flush got entries to kernel, the entries flushed but not consumed by kernel(previous enter failed) submit again.
+    if (ring.sqeTail != *ring.sqTail)
+        __atomic_store_n(ring.sqTail, ring.sqeTail, __ATOMIC_RELEASE);
+
+    const uint32 toSubmit = ring.sqeTail - __atomic_load_n(ring.sqHead, __ATOMIC_ACQUIRE);
+    if (toSubmit == 0 && waitNr == 0)
+        return 0;
+
+    uint32 flags = 0;
+    void *arg = NULL;
+    size_t argSize = 0;
+
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg evArg;
+    if (waitNr > 0)
+    {
+        ts.tv_sec = timeout / 1000;
+        ts.tv_nsec = (timeout % 1000) * 1000000LL;
+
+        LLBC_MemSet(&evArg, 0, sizeof(evArg));
+        evArg.ts = reinterpret_cast<uint64>(&ts);
+
+        flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+        arg = &evArg;
+        argSize = sizeof(evArg);
+    }
+
+    const int ret = LLBC_INL_NS __IoUringEnter(ring.fd, toSubmit, waitNr, flags, arg, argSize);
+    if (ret < 0)
+    {
+        // Wait timeout/interrupted, or completion queue overflow(completions will handle by caller), not error.
+        if (errno == ETIME || errno == EINTR || errno == EBUSY || errno == EAGAIN)
+            return 0;
+
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return ret;
+}
+
+LLBC_IoUringCqe *LLBC_IoUringPeekCqe(LLBC_IoUring &ring)
+{
+    const uint32 head = *ring.cqHead;
+    if (head == __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE))
+        return NULL;
+
+    return &ring.cqes[head & ring.cqMask];
+}
+
+void LLBC_IoUringCqeSeen(LLBC_IoUring &ring)
+{
+    __atomic_store_n(ring.cqHead, *ring.cqHead + 1, __ATOMIC_RELEASE);
+}
+
+int LLBC_IoUringRegisterBufRing(LLBC_IoUring &ring,
+                                struct io_uring_buf_ring *bufRing,
+                                uint32 entries,
+                                uint16 groupId)
+{
+    struct io_uring_buf_reg reg;
+    LLBC_MemSet(&reg, 0, sizeof(reg));
+    reg.ring_addr = reinterpret_cast<uint64>(bufRing);
+    reg.ring_entries = entries;
+    reg.bgid = groupId;
+
+    if (LLBC_INL_NS __IoUringRegister(ring.fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_IoUringUnregisterBufRing(LLBC_IoUring &ring, uint16 groupId)
+{
+    struct io_uring_buf_reg reg;
+    LLBC_MemSet(&reg, 0, sizeof(reg));
+    reg.bgid = groupId;
+
+    if (LLBC_INL_NS __IoUringRegister(ring.fd, IORING_UNREGISTER_PBUF_RING, &reg, 1) != 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+__LLBC_NS_END
+
+#endif // LLBC_CFG_OS_ENABLE_IO_URING
+
+#include "llbc/common/AfterIncl.h"
@@ -0,0 +1,98 @@
+/**
+ * @file    OS_Poll.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Poll.h"
+
+__LLBC_NS_BEGIN
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+
+int LLBC_Poll(LLBC_PollFd *fds, uint32 count, int timeout)
+{
+    int ret = 0;
+    while ((ret = ::poll(fds, static_cast<nfds_t>(count), timeout)) < 0 && errno == EINTR);
+
+    if (ret < 0)
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+    return ret;
+}
+
+int LLBC_CreatePollWakeupPipe(LLBC_Handle handles[2])
+{
+    if (::pipe(handles) != 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    for (int i = 0; i < 2; ++i)
+    {
+        const int flags = ::fcntl(handles[i], F_GETFL);
+        if (flags == -1 || ::fcntl(handles[i], F_SETFL, flags | O_NONBLOCK) == -1)
+        {
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+            LLBC_ClosePollWakeupPipe(handles);
+
+            return LLBC_FAILED;
+        }
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_WakeupPoll(LLBC_Handle writeHandle)
+{
+    const char signal = 0;
+    ssize_t ret;
+    while ((ret = ::write(writeHandle, &signal, sizeof(signal))) < 0 && errno == EINTR);
+
+    // Pipe full means poll already wakeup.
+    if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+void LLBC_DrainPollWakeupPipe(LLBC_Handle readHandle)
+{
+    char signals[64];
+    for (; ;)
+    {
+        const ssize_t ret = ::read(readHandle, signals, sizeof(signals));
+        if (ret > 0 || (ret < 0 && errno == EINTR))
+            continue;
+
+        break;
+    }
+}
+
+void LLBC_ClosePollWakeupPipe(LLBC_Handle handles[2])
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        if (handles[i] != LLBC_INVALID_HANDLE)
+        {
+            ::close(handles[i]);
+            handles[i] = LLBC_INVALID_HANDLE;
+        }
+    }
+}
+
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
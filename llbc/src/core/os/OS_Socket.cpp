@@ -20,6 +20,99 @@ static LPFN_CONNECTEX __g_ConnectExProc = NULL;
 static LPFN_GETACCEPTEXSOCKADDRS __g_GetAcceptExSockAddrs = NULL;
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+static int __BuildUnixAddr(const char *path, struct sockaddr_un &addr, LLBC_NS LLBC_SocketLen &len)
+{
+    const size_t pathLen = path ? ::strlen(path) : 0;
+    if (pathLen == 0 || pathLen >= sizeof(addr.sun_path))
+    {
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    ::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    ::memcpy(addr.sun_path, path, pathLen);
+
+    // '@' prefix path, use linux abstract namespace, address length not include the tail '\0'.
+    if (path[0] == '@')
+    {
+#if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+        addr.sun_path[0] = '\0';
+        len = static_cast<LLBC_NS LLBC_SocketLen>(offsetof(struct sockaddr_un, sun_path) + pathLen);
+#else // Non-Linux platform
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+        return LLBC_FAILED;
+#endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+    }
+    else
+    {
+        len = static_cast<LLBC_NS LLBC_SocketLen>(sizeof(struct sockaddr_un));
+    }
+
+    return LLBC_OK;
+}
+
+/**
+ * Remove the stale socket file(left by crashed process) before bind.
+ * Only remove socket file and nobody listening on it(connect refused), otherwise return EADDRINUSE error.
+ */
+static int __RemoveStaleUnixSocketFile(LLBC_NS LLBC_SocketHandle handle,
+                                       const char *path,
+                                       const struct sockaddr_un &addr,
+                                       LLBC_NS LLBC_SocketLen len)
+{
+    struct stat st;
+    if (::lstat(path, &st) == -1)
+    {
+        if (errno == ENOENT)
+            return LLBC_OK;
+
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    if (!S_ISSOCK(st.st_mode))
+    {
+        errno = EADDRINUSE;
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    // Probe the socket file by same type socket, connect refused means no process listening on it.
+    int sockType = SOCK_STREAM;
+    socklen_t optLen = sizeof(sockType);
+    ::getsockopt(handle, SOL_SOCKET, SO_TYPE, &sockType, &optLen);
+
+    const LLBC_NS LLBC_SocketHandle probe = ::socket(AF_UNIX, sockType, 0);
+    if (probe == -1)
+    {
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    int ret;
+    while ((ret = ::connect(probe, reinterpret_cast<const struct sockaddr *>(&addr), len)) == -1 && errno == EINTR);
+    const bool refused = ret == -1 && errno == ECONNREFUSED;
+    ::close(probe);
+
+    if (!refused)
+    {
+        errno = EADDRINUSE;
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    if (::unlink(path) == -1 && errno != ENOENT)
+    {
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
@@ -314,6 +407,59 @@ int LLBC_Send(LLBC_SocketHandle handle, const void *buf, int len, int flags)
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+int LLBC_SendV(LLBC_SocketHandle handle, const LLBC_SockBuf *buffers, int bufferCount, int flags)
+{
+    bufferCount = MIN(bufferCount, LLBC_CFG_COMM_SEND_GATHER_COUNT);
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    struct iovec iovs[LLBC_CFG_COMM_SEND_GATHER_COUNT];
+    for (int i = 0; i < bufferCount; ++i)
+    {
+        iovs[i].iov_base = buffers[i].buf;
+        iovs[i].iov_len = buffers[i].len;
+    }
+
+    struct msghdr msg;
+    LLBC_MemSet(&msg, 0, sizeof(msg));
+    msg.msg_iov = iovs;
+    msg.msg_iovlen = bufferCount;
+
+    ssize_t ret = 0;
+    while ((ret = ::sendmsg(handle, &msg, flags)) < 0 && errno == EINTR);
+    if (ret == -1)
+    {
+        if (errno == EWOULDBLOCK)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else if (errno == EAGAIN)
+            LLBC_SetLastError(LLBC_ERROR_AGAIN);
+        else
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+        return LLBC_FAILED;
+    }
+
+    return static_cast<int>(ret);
+#else // LLBC_TARGET_PLATFORM_WIN32
+    DWORD bytesSent = 0;
+    if (::WSASend(handle,
+                  const_cast<LLBC_SockBuf *>(buffers),
+                  static_cast<DWORD>(bufferCount),
+                  &bytesSent,
+                  static_cast<DWORD>(flags),
+                  NULL,
+                  NULL) == SOCKET_ERROR)
+    {
+        if (::WSAGetLastError() == WSAEWOULDBLOCK)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else
+            LLBC_SetLastError(LLBC_ERROR_NETAPI);
+
+        return LLBC_FAILED;
+    }
+
+    return static_cast<int>(bytesSent);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
 int LLBC_SendEx(LLBC_SocketHandle handle,
                 LLBC_SockBuf *buffers,
                 ulong bufferCount,
@@ -942,6 +1088,136 @@ int LLBC_SetSocketOption(LLBC_SocketHandle handle, int level, int optname, const
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+int LLBC_GetSocketAddressFamily(LLBC_SocketHandle handle)
+{
+    struct sockaddr_storage addr;
+    LLBC_SocketLen len = sizeof(struct sockaddr_storage);
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    if (::getsockname(handle, reinterpret_cast<struct sockaddr *>(&addr), &len) == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return -1;
+    }
+#else // LLBC_TARGET_PLATFORM_WIN32
+    if (::getsockname(handle, reinterpret_cast<struct sockaddr *>(&addr), &len) == SOCKET_ERROR)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NETAPI);
+        return -1;
+    }
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    return addr.ss_family;
+}
+
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+LLBC_SocketHandle LLBC_CreateUnixSocket()
+{
+    LLBC_SocketHandle handle = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (handle == -1)
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+    return handle;
+}
+
+int LLBC_CreateUnixSocketPair(LLBC_SocketHandle handles[2])
+{
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, handles) == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_BindToUnixPath(LLBC_SocketHandle handle, const char *path)
+{
+    struct sockaddr_un addr;
+    LLBC_SocketLen len;
+    if (LLBC_INL_NS __BuildUnixAddr(path, addr, len) != LLBC_OK)
+        return LLBC_FAILED;
+
+    // Remove stale socket file(left by crashed process), abstract namespace has no file.
+    if (path[0] != '@' &&
+        LLBC_INL_NS __RemoveStaleUnixSocketFile(handle, path, addr, len) != LLBC_OK)
+        return LLBC_FAILED;
+
+    if (::bind(handle, reinterpret_cast<struct sockaddr *>(&addr), len) == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_ConnectToUnixPath(LLBC_SocketHandle handle, const char *path)
+{
+    struct sockaddr_un addr;
+    LLBC_SocketLen len;
+    if (LLBC_INL_NS __BuildUnixAddr(path, addr, len) != LLBC_OK)
+        return LLBC_FAILED;
+
+    if (::connect(handle, reinterpret_cast<struct sockaddr *>(&addr), len) == -1)
+    {
+        if (errno == EINPROGRESS || errno == EAGAIN)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+LLBC_SocketHandle LLBC_CreateUdpSocket()
+{
+    LLBC_SocketHandle handle = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (handle == -1)
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+    return handle;
+}
+
+int LLBC_RecvMultiMsgs(LLBC_SocketHandle handle, struct mmsghdr *msgs, uint32 count)
+{
+    int ret;
+    while ((ret = ::recvmmsg(handle, msgs, count, MSG_DONTWAIT, NULL)) < 0 && errno == EINTR);
+    if (ret == -1)
+    {
+        if (errno == EWOULDBLOCK)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else if (errno == EAGAIN)
+            LLBC_SetLastError(LLBC_ERROR_AGAIN);
+        else
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+    }
+
+    return ret;
+}
+
+int LLBC_SendMultiMsgs(LLBC_SocketHandle handle, struct mmsghdr *msgs, uint32 count)
+{
+    int ret;
+    while ((ret = ::sendmmsg(handle, msgs, count, MSG_DONTWAIT)) < 0 && errno == EINTR);
+    if (ret == -1)
+    {
+        if (errno == EWOULDBLOCK)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else if (errno == EAGAIN)
+            LLBC_SetLastError(LLBC_ERROR_AGAIN);
+        else
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+    }
+
+    return ret;
+}
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
@@ -42,6 +42,40 @@ static unsigned int WINAPI __ThreadEntry(void *arg)
 #endif
 }
 
+#if LLBC_TARGET_PLATFORM_LINUX
+// The mbind() MPOL_PREFERRED memory policy mode, not include <numaif.h>/<linux/mempolicy.h> to avoid libnuma dependency.
+static const int __mpolPreferred = 1;
+// The maximum supported NUMA nodes count.
+static const int __maxNUMANodes = 1024;
+
+// Parse linux cpu list format string, eg: 0-3,8,10-11.
+static void __ParseCPUList(const char *str, std::vector<int> &cpuNos)
+{
+    cpuNos.clear();
+    while (*str)
+    {
+        char *end;
+        const long first = ::strtol(str, &end, 10);
+        if (end == str)
+            break;
+
+        long last = first;
+        if (*end == '-')
+        {
+            str = end + 1;
+            last = ::strtol(str, &end, 10);
+            if (end == str)
+                break;
+        }
+
+        for (long cpuNo = first; cpuNo <= last; ++cpuNo)
+            cpuNos.push_back(static_cast<int>(cpuNo));
+
+        str = (*end == ',') ? end + 1 : "";
+    }
+}
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_INTERNAL_NS_BEGIN
@@ -464,6 +498,270 @@ int LLBC_SetThreadPriority(LLBC_NativeThreadHandle handle, int priority)
 #endif
 }
 
+int LLBC_GetCPUCount()
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    const long cpuCount = ::sysconf(_SC_NPROCESSORS_ONLN);
+    return cpuCount > 0 ? static_cast<int>(cpuCount) : 1;
+#else
+    SYSTEM_INFO sysInfo;
+    ::GetSystemInfo(&sysInfo);
+    return sysInfo.dwNumberOfProcessors > 0 ? static_cast<int>(sysInfo.dwNumberOfProcessors) : 1;
+#endif
+}
+
+int LLBC_SetThreadAffinity(LLBC_NativeThreadHandle handle, int cpuNo)
+{
+    if (handle == LLBC_INVALID_NATIVE_THREAD_HANDLE ||
+        cpuNo < 0 || cpuNo >= LLBC_GetCPUCount())
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuNo, &cpuSet);
+
+    int status;
+    if ((status = pthread_setaffinity_np(handle, sizeof(cpuSet), &cpuSet)) != 0)
+    {
+        errno = status;
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+#elif LLBC_TARGET_PLATFORM_WIN32
+    if (cpuNo >= static_cast<int>(sizeof(DWORD_PTR) * 8))
+    {
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_FAILED;
+    }
+
+    if (::SetThreadAffinityMask(handle, static_cast<DWORD_PTR>(1) << cpuNo) == 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_OSAPI);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+#else
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return LLBC_FAILED;
+#endif
+}
+
+int LLBC_SetThreadAffinity(LLBC_NativeThreadHandle handle, const std::vector<int> &cpuNos)
+{
+    const int cpuCount = LLBC_GetCPUCount();
+    if (handle == LLBC_INVALID_NATIVE_THREAD_HANDLE || cpuNos.empty())
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    for (size_t i = 0; i < cpuNos.size(); ++i)
+    {
+        if (cpuNos[i] < 0 || cpuNos[i] >= cpuCount)
+        {
+            LLBC_SetLastError(LLBC_ERROR_ARG);
+            return LLBC_FAILED;
+        }
+    }
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (size_t i = 0; i < cpuNos.size(); ++i)
+    {
+        if (cpuNos[i] >= CPU_SETSIZE)
+        {
+            LLBC_SetLastError(LLBC_ERROR_LIMIT);
+            return LLBC_FAILED;
+        }
+
+        CPU_SET(cpuNos[i], &cpuSet);
+    }
+
+    int status;
+    if ((status = pthread_setaffinity_np(handle, sizeof(cpuSet), &cpuSet)) != 0)
+    {
+        errno = status;
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+#elif LLBC_TARGET_PLATFORM_WIN32
+    DWORD_PTR mask = 0;
+    for (size_t i = 0; i < cpuNos.size(); ++i)
+    {
+        if (cpuNos[i] >= static_cast<int>(sizeof(DWORD_PTR) * 8))
+        {
+            LLBC_SetLastError(LLBC_ERROR_LIMIT);
+            return LLBC_FAILED;
+        }
+
+        mask |= static_cast<DWORD_PTR>(1) << cpuNos[i];
+    }
+
+    if (::SetThreadAffinityMask(handle, mask) == 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_OSAPI);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+#else
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return LLBC_FAILED;
+#endif
+}
+
+int LLBC_GetNUMANodeCount()
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Node directories named as nodeN, if kernel not support NUMA, directory not exist.
+    DIR *dir = ::opendir("/sys/devices/system/node");
+    if (!dir)
+        return 1;
+
+    int nodeCount = 0;
+    struct dirent *entry;
+    while ((entry = ::readdir(dir)) != NULL)
+    {
+        if (::strncmp(entry->d_name, "node", 4) == 0 &&
+            entry->d_name[4] >= '0' && entry->d_name[4] <= '9')
+            nodeCount = MAX(nodeCount, ::atoi(entry->d_name + 4) + 1);
+    }
+
+    ::closedir(dir);
+
+    return MIN(MAX(nodeCount, 1), LLBC_INL_NS __maxNUMANodes);
+#elif LLBC_TARGET_PLATFORM_WIN32
+    ULONG highestNode;
+    if (!::GetNumaHighestNodeNumber(&highestNode))
+        return 1;
+
+    return static_cast<int>(highestNode) + 1;
+#else
+    return 1;
+#endif
+}
+
+int LLBC_GetNUMANodeCPUs(int node, std::vector<int> &cpuNos)
+{
+    cpuNos.clear();
+    if (node < 0 || node >= LLBC_GetNUMANodeCount())
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    char path[64];
+    ::snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+
+    FILE *file = ::fopen(path, "r");
+    if (file)
+    {
+        char cpuList[4096];
+        if (::fgets(cpuList, sizeof(cpuList), file))
+            LLBC_INL_NS __ParseCPUList(cpuList, cpuNos);
+
+        ::fclose(file);
+    }
+#elif LLBC_TARGET_PLATFORM_WIN32
+    ULONGLONG mask;
+    if (::GetNumaNodeProcessorMask(static_cast<UCHAR>(node), &mask))
+    {
+        for (int cpuNo = 0; cpuNo < static_cast<int>(sizeof(mask) * 8); ++cpuNo)
+        {
+            if (mask & (static_cast<ULONGLONG>(1) << cpuNo))
+                cpuNos.push_back(cpuNo);
+        }
+    }
+#endif
+
+    // Not support NUMA, the only node own all CPUs.
+    if (cpuNos.empty() && node == 0)
+    {
+        const int cpuCount = LLBC_GetCPUCount();
+        for (int cpuNo = 0; cpuNo < cpuCount; ++cpuNo)
+            cpuNos.push_back(cpuNo);
+    }
+
+    if (cpuNos.empty())
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+void *LLBC_NUMAAlloc(size_t size, int node)
+{
+    if (size == 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return NULL;
+    }
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    void *mem = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return NULL;
+    }
+
+ #if LLBC_TARGET_PLATFORM_LINUX
+    // Pages not populated yet, set preferred policy before first touch, if failed, memory still usable.
+    if (node >= 0 && node < LLBC_INL_NS __maxNUMANodes && LLBC_GetNUMANodeCount() > 1)
+    {
+        unsigned long nodeMask[LLBC_INL_NS __maxNUMANodes / (sizeof(unsigned long) * 8)];
+        LLBC_MemSet(nodeMask, 0, sizeof(nodeMask));
+        nodeMask[node / (sizeof(unsigned long) * 8)] |= 1UL << (node % (sizeof(unsigned long) * 8));
+
+        ::syscall(SYS_mbind, mem, size, LLBC_INL_NS __mpolPreferred, nodeMask, LLBC_INL_NS __maxNUMANodes, 0);
+    }
+ #endif // LLBC_TARGET_PLATFORM_LINUX
+
+    return mem;
+#else // LLBC_TARGET_PLATFORM_WIN32
+    void *mem;
+    if (node >= 0)
+        mem = ::VirtualAllocExNuma(::GetCurrentProcess(),
+                                   NULL,
+                                   size,
+                                   MEM_RESERVE | MEM_COMMIT,
+                                   PAGE_READWRITE,
+                                   static_cast<DWORD>(node));
+    else
+        mem = ::VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+    if (!mem)
+        LLBC_SetLastError(LLBC_ERROR_OSAPI);
+
+    return mem;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
+void LLBC_NUMAFree(void *mem, size_t size)
+{
+    if (!mem)
+        return;
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    ::munmap(mem, size);
+#else
+    ::VirtualFree(mem, 0, MEM_RELEASE);
+#endif
+}
+
 int LLBC_SuspendThread(LLBC_NativeThreadHandle handle)
 {
     if (handle == LLBC_INVALID_NATIVE_THREAD_HANDLE)
@@ -633,6 +931,49 @@ void LLBC_CPURelax()
 #endif // Non-WIN32 platform
 }
 
+#if LLBC_SUPPORT_FUTEX
+int LLBC_FutexWait(volatile sint32 *addr, sint32 expect, int milliSeconds)
+{
+    struct timespec ts;
+    struct timespec *timeout = NULL;
+    if (milliSeconds != static_cast<int>(LLBC_INFINITE))
+    {
+        ts.tv_sec = milliSeconds / 1000;
+        ts.tv_nsec = (milliSeconds % 1000) * 1000 * 1000;
+        timeout = &ts;
+    }
+
+    // Relative timeout, EAGAIN(value changed) & EINTR treat as spurious wake up.
+    if (syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expect, timeout, NULL, 0) == 0)
+        return LLBC_OK;
+
+    if (errno == ETIMEDOUT)
+    {
+        LLBC_SetLastError(LLBC_ERROR_TIMEOUT);
+        return LLBC_FAILED;
+    }
+    else if (errno != EAGAIN && errno != EINTR)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_FutexWake(volatile sint32 *addr, int count)
+{
+    const long waked = syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+    if (waked == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return static_cast<int>(waked);
+}
+#endif // LLBC_SUPPORT_FUTEX
+
 int LLBC_TlsAlloc(LLBC_TlsHandle *handle)
 {
     if (!handle)
@@ -10,6 +10,7 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/os/OS_Atomic.h"
 #include "llbc/core/os/OS_Time.h"
 
 #if LLBC_TARGET_PLATFORM_WIN32
@@ -18,6 +19,17 @@
 
 __LLBC_INTERNAL_NS_BEGIN
 static int __g_timezone;
+
+// The process-wide cached time, padding to avoid false sharing with other hot data.
+static struct
+{
+    char padBefore[64];
+    volatile LLBC_NS sint64 now;
+    char padAfter[64 - sizeof(LLBC_NS sint64)];
+} __g_cachedTime;
+
+// The cached time step back threshold, in milli-seconds, system time step back larger than it will be followed.
+static const LLBC_NS sint64 __cachedTimeStepBackThreshold = 1000;
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
@@ -78,6 +90,36 @@ uint64 LLBC_GetTickCount()
 #endif
 }
 
+sint64 LLBC_GetCachedMilliSeconds()
+{
+    // Aligned 64bit load is atomic in 64bit processors, 32bit processors use atomic API.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__)
+    const sint64 now = LLBC_INTERNAL_NS __g_cachedTime.now;
+#else
+    const sint64 now = LLBC_AtomicGet(&LLBC_INTERNAL_NS __g_cachedTime.now);
+#endif
+    if (UNLIKELY(now == 0))
+        return LLBC_UpdateCachedMilliSeconds();
+
+    return now;
+}
+
+sint64 LLBC_UpdateCachedMilliSeconds()
+{
+    // Multi services refresh concurrently, the refresh which read older time but store later must not
+    // make cached time go back, so only move cached time forward(except system time step back).
+    const sint64 now = LLBC_GetMilliSeconds();
+    while (true)
+    {
+        const sint64 cached = LLBC_AtomicGet(&LLBC_INTERNAL_NS __g_cachedTime.now);
+        if (now <= cached && cached - now < LLBC_INTERNAL_NS __cachedTimeStepBackThreshold)
+            return cached;
+
+        if (LLBC_AtomicCompareAndExchange(&LLBC_INTERNAL_NS __g_cachedTime.now, now, cached) == cached)
+            return now;
+    }
+}
+
 #if LLBC_TARGET_PLATFORM_NON_WIN32
 int LLBC_GetTimeOfDay(struct timeval *tv, struct timezone *tz)
 #else
@@ -0,0 +1,119 @@
+/**
+ * @file    CostStat.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/profiler/CostStat.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static const LLBC_NS sint64 __histogramUpperBounds[LLBC_NS LLBC_CostStat::HistogramBucketCount] =
+{
+    10, 100, 1000, 10000, 100000, -1
+};
+
+static inline LLBC_NS sint64 __Get(const void *field)
+{
+    return LLBC_NS LLBC_AtomicRelaxedGet(reinterpret_cast<const volatile LLBC_NS sint64 *>(field));
+}
+
+static inline void __Set(void *field, LLBC_NS sint64 value)
+{
+    LLBC_NS LLBC_AtomicRelaxedSet(reinterpret_cast<volatile LLBC_NS sint64 *>(field), value);
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_CostStat::LLBC_CostStat()
+{
+    Reset();
+}
+
+void LLBC_CostStat::Add(sint64 cost)
+{
+    ++times;
+    totalCost += cost;
+    if (cost > maxCost)
+        maxCost = cost;
+
+    int bucket = 0;
+    while (bucket < HistogramBucketCount - 1 &&
+           cost >= LLBC_INL_NS __histogramUpperBounds[bucket])
+        ++bucket;
+
+    ++histogram[bucket];
+}
+
+void LLBC_CostStat::AtomicAdd(sint64 cost)
+{
+    LLBC_INL_NS __Set(&times, static_cast<sint64>(times + 1));
+    LLBC_INL_NS __Set(&totalCost, totalCost + cost);
+    if (cost > maxCost)
+        LLBC_INL_NS __Set(&maxCost, cost);
+
+    int bucket = 0;
+    while (bucket < HistogramBucketCount - 1 &&
+           cost >= LLBC_INL_NS __histogramUpperBounds[bucket])
+        ++bucket;
+
+    LLBC_INL_NS __Set(&histogram[bucket], static_cast<sint64>(histogram[bucket] + 1));
+}
+
+void LLBC_CostStat::AtomicCopyTo(LLBC_CostStat &to) const
+{
+    to.times = static_cast<uint64>(LLBC_INL_NS __Get(&times));
+    to.totalCost = LLBC_INL_NS __Get(&totalCost);
+    to.maxCost = LLBC_INL_NS __Get(&maxCost);
+    for (int i = 0; i < HistogramBucketCount; ++i)
+        to.histogram[i] = static_cast<uint64>(LLBC_INL_NS __Get(&histogram[i]));
+}
+
+void LLBC_CostStat::Merge(const LLBC_CostStat &other)
+{
+    times += other.times;
+    totalCost += other.totalCost;
+    maxCost = MAX(maxCost, other.maxCost);
+    for (int i = 0; i < HistogramBucketCount; ++i)
+        histogram[i] += other.histogram[i];
+}
+
+void LLBC_CostStat::Reset()
+{
+    times = 0;
+    totalCost = 0;
+    maxCost = 0;
+    ::memset(histogram, 0, sizeof(histogram));
+}
+
+double LLBC_CostStat::GetAverageCost() const
+{
+    if (times == 0)
+        return 0.0;
+
+    return static_cast<double>(totalCost) / times;
+}
+
+sint64 LLBC_CostStat::GetHistogramBucketUpperBound(int bucket)
+{
+    if (bucket < 0 || bucket >= HistogramBucketCount)
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return 0;
+    }
+
+    return LLBC_INL_NS __histogramUpperBounds[bucket];
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
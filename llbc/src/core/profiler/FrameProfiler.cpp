@@ -0,0 +1,292 @@
+/**
+ * @file    FrameProfiler.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Time.h"
+#include "llbc/core/thread/Guard.h"
+#include "llbc/core/log/LoggerManager.h"
+
+#include "llbc/core/profiler/FrameProfiler.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+/**
+ * \brief The slow frame offender, aggregate same type & Id costs in one frame.
+ */
+struct __Offender
+{
+    int type;
+    LLBC_NS sint64 id;
+    LLBC_NS sint64 cost;
+    int times;
+
+    bool operator <(const __Offender &other) const
+    {
+        return cost > other.cost;
+    }
+};
+
+static const char *__costTypeDescs[] = {"opcode", "timer"};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_FrameProfile::LLBC_FrameProfile()
+: beginTime(0)
+, endTime(0)
+
+, frameCost()
+, slowFrames(0)
+{
+}
+
+void LLBC_FrameProfile::Reset()
+{
+    beginTime = 0;
+    endTime = 0;
+
+    frameCost.Reset();
+    slowFrames = 0;
+
+    for (size_t i = 0; i < phaseCosts.size(); ++i)
+        phaseCosts[i].Reset();
+
+    opcodeCosts.clear();
+    timerCosts.clear();
+}
+
+LLBC_FrameProfiler::LLBC_FrameProfiler(const LLBC_String &name, const char * const phaseNames[], int phaseCount)
+: _name(name)
+, _slowFrameThreshold(0)
+
+, _frameBegTime(0)
+, _phaseBegTime(0)
+, _phaseCosts(MAX(phaseCount, 0), -1)
+, _entries()
+
+, _lock()
+, _windowBegTime(0)
+, _curProfile()
+, _lastProfile()
+, _lastSlowFrameReport()
+{
+    for (int i = 0; i < phaseCount; ++i)
+        _curProfile.phaseNames.push_back(phaseNames[i]);
+
+    _curProfile.phaseCosts.resize(_curProfile.phaseNames.size());
+    _lastProfile = _curProfile;
+}
+
+LLBC_FrameProfiler::~LLBC_FrameProfiler()
+{
+}
+
+sint64 LLBC_FrameProfiler::GetSlowFrameThreshold() const
+{
+    return _slowFrameThreshold;
+}
+
+void LLBC_FrameProfiler::SetSlowFrameThreshold(sint64 threshold)
+{
+    _slowFrameThreshold = MAX(threshold, 0);
+}
+
+void LLBC_FrameProfiler::BeginFrame()
+{
+    _frameBegTime = LLBC_GetMonotonicMicroSeconds();
+    _phaseBegTime = _frameBegTime;
+
+    std::fill(_phaseCosts.begin(), _phaseCosts.end(), -1);
+    _entries.clear();
+}
+
+void LLBC_FrameProfiler::EndPhase(int phase)
+{
+    const sint64 now = LLBC_GetMonotonicMicroSeconds();
+    if (LIKELY(phase >= 0 && phase < static_cast<int>(_phaseCosts.size())))
+    {
+        if (_phaseCosts[phase] < 0)
+            _phaseCosts[phase] = now - _phaseBegTime;
+        else
+            _phaseCosts[phase] += now - _phaseBegTime;
+    }
+
+    _phaseBegTime = now;
+}
+
+void LLBC_FrameProfiler::AddCost(int type, sint64 id, sint64 cost)
+{
+    if (UNLIKELY(type != Opcode && type != Timer))
+        return;
+
+    _Entry entry;
+    entry.type = type;
+    entry.id = id;
+    entry.cost = cost;
+
+    _entries.push_back(entry);
+}
+
+bool LLBC_FrameProfiler::EndFrame()
+{
+    if (UNLIKELY(_frameBegTime == 0))
+        return false;
+
+    const sint64 now = LLBC_GetMonotonicMicroSeconds();
+    const sint64 frameCost = now - _frameBegTime;
+    const bool slow = _slowFrameThreshold > 0 && frameCost >= _slowFrameThreshold * 1000;
+
+    // Costs measured by monotonic clock, window begin/end time still use wall clock, for display.
+    const sint64 wallNow = LLBC_GetMilliSeconds();
+    const sint64 wallFrameBegTime = wallNow - frameCost / 1000;
+
+    LLBC_String report;
+    if (slow)
+        report = BuildSlowFrameReport(frameCost);
+
+    {
+        LLBC_LockGuard<LLBC_SpinLock> guard(_lock);
+
+        if (_curProfile.beginTime == 0)
+        {
+            _windowBegTime = _frameBegTime;
+            _curProfile.beginTime = wallFrameBegTime;
+        }
+        else if (now - _windowBegTime >= LLBC_CFG_CORE_PROFILER_ROLLING_WINDOW_SECS * 1000000LL)
+        {
+            // Rolling window: when current window expired, current window become last window.
+            _lastProfile = _curProfile;
+            _curProfile.Reset();
+
+            _windowBegTime = _frameBegTime;
+            _curProfile.beginTime = wallFrameBegTime;
+        }
+
+        _curProfile.endTime = wallNow;
+        _curProfile.frameCost.Add(frameCost);
+        for (size_t i = 0; i < _phaseCosts.size(); ++i)
+        {
+            if (_phaseCosts[i] >= 0)
+                _curProfile.phaseCosts[i].Add(_phaseCosts[i]);
+        }
+
+        for (size_t i = 0; i < _entries.size(); ++i)
+        {
+            const _Entry &entry = _entries[i];
+            if (entry.type == Opcode)
+                _curProfile.opcodeCosts[static_cast<int>(entry.id)].Add(entry.cost);
+            else
+                _curProfile.timerCosts[static_cast<LLBC_TimerId>(entry.id)].Add(entry.cost);
+        }
+
+        if (slow)
+        {
+            ++_curProfile.slowFrames;
+            _lastSlowFrameReport = report;
+        }
+    }
+
+    _frameBegTime = 0;
+
+    // Report in release build too, if logger not initialized, report to stderr.
+    if (slow)
+        LLBC_LIB_WARN_LOG("%s", report.c_str());
+
+    return slow;
+}
+
+void LLBC_FrameProfiler::GetProfile(LLBC_FrameProfile &profile, bool lastWindow)
+{
+    LLBC_Guard guard(_lock);
+    profile = lastWindow ? _lastProfile : _curProfile;
+}
+
+LLBC_String LLBC_FrameProfiler::GetLastSlowFrameReport()
+{
+    LLBC_Guard guard(_lock);
+    return _lastSlowFrameReport;
+}
+
+void LLBC_FrameProfiler::Reset()
+{
+    LLBC_Guard guard(_lock);
+
+    _curProfile.Reset();
+    _lastProfile.Reset();
+    _lastSlowFrameReport.clear();
+}
+
+LLBC_String LLBC_FrameProfiler::BuildSlowFrameReport(sint64 frameCost) const
+{
+    LLBC_String report;
+    report.format("%s slow frame, cost: %.3f ms, threshold: %lld ms",
+                  _name.c_str(), frameCost / 1000.0, _slowFrameThreshold);
+
+    // Phases.
+    report.append(", phases:");
+    const std::vector<LLBC_String> &phaseNames = _curProfile.phaseNames;
+    for (size_t i = 0; i < _phaseCosts.size(); ++i)
+    {
+        if (_phaseCosts[i] >= 0)
+            report.append_format(" %s=%.3fms", phaseNames[i].c_str(), _phaseCosts[i] / 1000.0);
+    }
+
+    if (_entries.empty())
+        return report;
+
+    // Top offenders, aggregate by type & Id, sort by cost.
+    std::vector<LLBC_INL_NS __Offender> offenders;
+    std::map<std::pair<int, sint64>, size_t> offenderIdxs;
+    for (size_t i = 0; i < _entries.size(); ++i)
+    {
+        const _Entry &entry = _entries[i];
+        const std::pair<int, sint64> key(entry.type, entry.id);
+        std::map<std::pair<int, sint64>, size_t>::iterator it = offenderIdxs.find(key);
+        if (it == offenderIdxs.end())
+        {
+            LLBC_INL_NS __Offender offender;
+            offender.type = entry.type;
+            offender.id = entry.id;
+            offender.cost = entry.cost;
+            offender.times = 1;
+
+            offenderIdxs.insert(std::make_pair(key, offenders.size()));
+            offenders.push_back(offender);
+        }
+        else
+        {
+            LLBC_INL_NS __Offender &offender = offenders[it->second];
+            offender.cost += entry.cost;
+            ++offender.times;
+        }
+    }
+
+    std::sort(offenders.begin(), offenders.end());
+
+    report.append(", top offenders:");
+    const size_t topCount = MIN(offenders.size(), static_cast<size_t>(LLBC_CFG_CORE_PROFILER_TOP_OFFENDERS_COUNT));
+    for (size_t i = 0; i < topCount; ++i)
+    {
+        const LLBC_INL_NS __Offender &offender = offenders[i];
+        report.append_format(" %s[%lld]=%.3fms(%d times)",
+                             LLBC_INL_NS __costTypeDescs[offender.type],
+                             offender.id,
+                             offender.cost / 1000.0,
+                             offender.times);
+    }
+
+    return report;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -16,6 +16,7 @@
 #include "llbc/core/sampler/CountSampler.h"
 #include "llbc/core/sampler/LimitSampler.h"
 #include "llbc/core/sampler/IntervalSampler.h"
+#include "llbc/core/sampler/TokenBucketSampler.h"
 
 #include "llbc/core/sampler/SamplerGroup.h"
 
@@ -61,6 +62,10 @@ int LLBC_SamplerGroup::AddSampler(int type, const LLBC_String &name)
         sampler = new LLBC_IntervalSampler;
         break;
 
+    case LLBC_SamplerType::TokenBucketSampler:
+        sampler = new LLBC_TokenBucketSampler;
+        break;
+
     default:
         ASSERT(false && "llbc library internal error, unknown sampler type!");
         break;
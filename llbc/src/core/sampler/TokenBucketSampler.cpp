@@ -0,0 +1,138 @@
+/**
+ * @file    TokenBucketSampler.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Time.h"
+
+#include "llbc/core/sampler/SamplerType.h"
+#include "llbc/core/sampler/TokenBucketSampler.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_TokenBucketSampler::LLBC_TokenBucketSampler()
+: _rate(0)
+, _burst(0)
+
+, _milliTokens(0)
+, _lastRefillTime(0)
+
+, _limitedTimes(0)
+{
+}
+
+LLBC_TokenBucketSampler::~LLBC_TokenBucketSampler()
+{
+}
+
+int LLBC_TokenBucketSampler::GetType() const
+{
+    return LLBC_SamplerType::TokenBucketSampler;
+}
+
+void LLBC_TokenBucketSampler::Reset()
+{
+    _milliTokens = _burst * 1000;
+    _lastRefillTime = GetNowTime();
+
+    _limitedTimes = 0;
+
+    _Base::Reset();
+}
+
+void LLBC_TokenBucketSampler::SetRate(sint64 rate, sint64 burst)
+{
+    _rate = MAX(0, rate);
+    _burst = burst > 0 ? burst : _rate;
+
+    _milliTokens = _burst * 1000;
+    _lastRefillTime = GetNowTime();
+}
+
+sint64 LLBC_TokenBucketSampler::GetRate() const
+{
+    return _rate;
+}
+
+sint64 LLBC_TokenBucketSampler::GetBurst() const
+{
+    return _burst;
+}
+
+int LLBC_TokenBucketSampler::Sampling(sint64 value, void *appData)
+{
+    if (!IsAvailable(value))
+    {
+        ++_limitedTimes;
+
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_FAILED;
+    }
+
+    if (_rate > 0)
+        _milliTokens -= value * 1000;
+
+    return _Base::Sampling(value, appData);
+}
+
+bool LLBC_TokenBucketSampler::IsAvailable(sint64 value)
+{
+    if (_rate == 0)
+        return true;
+
+    Refill();
+    return _milliTokens >= value * 1000;
+}
+
+sint64 LLBC_TokenBucketSampler::GetTokens()
+{
+    if (_rate == 0)
+        return -1;
+
+    Refill();
+    return _milliTokens / 1000;
+}
+
+uint64 LLBC_TokenBucketSampler::GetLimitedTimes() const
+{
+    return _limitedTimes;
+}
+
+sint64 LLBC_TokenBucketSampler::GetNowTime() const
+{
+    return LLBC_GetCoarseMonotonicMilliSeconds();
+}
+
+void LLBC_TokenBucketSampler::Refill()
+{
+    const sint64 now = GetNowTime();
+    const sint64 elapsed = now - _lastRefillTime;
+    if (elapsed <= 0)
+    {
+        // Clock moved backward(only possible with overridden clock), re-anchor, not stall refill until caught up.
+        if (elapsed < 0)
+            _lastRefillTime = now;
+
+        return;
+    }
+
+    _lastRefillTime = now;
+
+    // Clamp elapsed time first, avoid refill tokens overflow after long time idle.
+    const sint64 capacity = _burst * 1000;
+    if (elapsed >= capacity / _rate + 1)
+        _milliTokens = capacity;
+    else
+        _milliTokens = MIN(capacity, _milliTokens + elapsed * _rate);
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
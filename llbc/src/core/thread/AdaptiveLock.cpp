@@ -0,0 +1,120 @@
+/**
+ * @file    AdaptiveLock.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/thread/AdaptiveLock.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_AdaptiveLock::LLBC_AdaptiveLock()
+{
+#if LLBC_SUPPORT_FUTEX
+    _state = 0;
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
+    pthread_mutex_init(&_handle, NULL);
+#else
+    ::InitializeCriticalSectionAndSpinCount(&_handle, LLBC_CFG_THREAD_ADAPTIVE_LOCK_SPIN_COUNT);
+#endif
+}
+
+LLBC_AdaptiveLock::~LLBC_AdaptiveLock()
+{
+#if LLBC_SUPPORT_FUTEX
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
+    pthread_mutex_destroy(&_handle);
+#else
+    ::DeleteCriticalSection(&_handle);
+#endif
+}
+
+#if !LLBC_SUPPORT_FUTEX
+void LLBC_AdaptiveLock::Lock()
+{
+    LockSlow();
+}
+
+bool LLBC_AdaptiveLock::TryLock()
+{
+ #if LLBC_TARGET_PLATFORM_NON_WIN32
+    return pthread_mutex_trylock(&_handle) == 0;
+ #else
+    return ::TryEnterCriticalSection(&_handle) != 0;
+ #endif
+}
+
+void LLBC_AdaptiveLock::Unlock()
+{
+ #if LLBC_TARGET_PLATFORM_NON_WIN32
+    pthread_mutex_unlock(&_handle);
+ #else
+    ::LeaveCriticalSection(&_handle);
+ #endif
+}
+#endif // !LLBC_SUPPORT_FUTEX
+
+void LLBC_AdaptiveLock::LockSlow()
+{
+#if LLBC_SUPPORT_FUTEX
+    // Spin phase, only try CAS when lock looks free, avoid cache line ping-pong.
+    for (int i = 0; i < LLBC_CFG_THREAD_ADAPTIVE_LOCK_SPIN_COUNT; ++i)
+    {
+        if (_state == 0 && LLBC_AtomicCompareAndExchange(&_state, 1, 0) == 0)
+            return;
+
+        LLBC_CPURelax();
+    }
+
+    // Park phase, mark lock contended(2), then wait until we exchange 0 -> 2.
+    sint32 state = LLBC_AtomicSet(&_state, 2);
+    while (state != 0)
+    {
+        LLBC_FutexWait(&_state, 2, LLBC_INFINITE);
+        state = LLBC_AtomicSet(&_state, 2);
+    }
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
+    for (int i = 0; i < LLBC_CFG_THREAD_ADAPTIVE_LOCK_SPIN_COUNT; ++i)
+    {
+        if (pthread_mutex_trylock(&_handle) == 0)
+            return;
+
+        LLBC_CPURelax();
+    }
+
+    pthread_mutex_lock(&_handle);
+#else
+    // Critical section already spin specific count before wait.
+    ::EnterCriticalSection(&_handle);
+#endif
+}
+
+#if LLBC_SUPPORT_FUTEX
+void LLBC_AdaptiveLock::UnlockSlow()
+{
+    // Lock state is 2(has waiters), release lock and wake up one waiter.
+    LLBC_AtomicSet(&_state, 0);
+    LLBC_FutexWake(&_state, 1);
+}
+#endif // LLBC_SUPPORT_FUTEX
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+void *LLBC_AdaptiveLock::Handle()
+{
+ #if LLBC_SUPPORT_FUTEX
+    return NULL;
+ #else
+    return &_handle;
+ #endif
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
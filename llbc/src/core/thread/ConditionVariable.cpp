@@ -10,6 +10,7 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/os/OS_Atomic.h"
 #include "llbc/core/thread/ILock.h"
 #include "llbc/core/thread/ConditionVariable.h"
 
@@ -17,7 +18,10 @@ __LLBC_NS_BEGIN
 
 LLBC_ConditionVariable::LLBC_ConditionVariable()
 {
-#if LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_SUPPORT_FUTEX
+    _seq = 0;
+    _waiters = 0;
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
     pthread_cond_init(&m_handle, NULL);
 #else // LLBC_TARGET_PLATFORM_WIN32
     _cond.waitersBlocked = 0;
@@ -34,7 +38,8 @@ LLBC_ConditionVariable::LLBC_ConditionVariable()
 
 LLBC_ConditionVariable::~LLBC_ConditionVariable()
 {
-#if LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_SUPPORT_FUTEX
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
     pthread_cond_destroy(&m_handle);
 #else
     ::CloseHandle(_cond.blockQueue);
@@ -48,7 +53,12 @@ LLBC_ConditionVariable::~LLBC_ConditionVariable()
 
 void LLBC_ConditionVariable::Notify()
 {
-#if LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_SUPPORT_FUTEX
+    // Increase sequence(full barrier) before check waiters, pair with TimedWait().
+    LLBC_AtomicFetchAndAdd(&_seq, 1);
+    if (LLBC_AtomicGet(&_waiters) > 0)
+        LLBC_FutexWake(&_seq, 1);
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
     pthread_cond_signal(&m_handle);
 #else
     Notify(false);
@@ -57,7 +67,11 @@ void LLBC_ConditionVariable::Notify()
 
 void LLBC_ConditionVariable::Broadcast()
 {
-#if LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_SUPPORT_FUTEX
+    LLBC_AtomicFetchAndAdd(&_seq, 1);
+    if (LLBC_AtomicGet(&_waiters) > 0)
+        LLBC_FutexWake(&_seq, INT_MAX);
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
     pthread_cond_broadcast(&m_handle);
 #else
     Notify(true);
@@ -77,7 +91,20 @@ int LLBC_ConditionVariable::TimedWait(LLBC_ILock &lock, int milliSeconds)
         return LLBC_FAILED;
     }
 
-#if LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_SUPPORT_FUTEX
+    // Increase waiters & read sequence in locked state, notifier change condition in locked state
+    // and increase sequence after that, so notify can't lost.
+    LLBC_AtomicFetchAndAdd(&_waiters, 1);
+    const sint32 seq = LLBC_AtomicGet(&_seq);
+
+    lock.Unlock();
+    const int ret = LLBC_FutexWait(&_seq, seq, milliSeconds);
+    lock.Lock();
+
+    LLBC_AtomicFetchAndSub(&_waiters, 1);
+
+    return ret;
+#elif LLBC_TARGET_PLATFORM_NON_WIN32
     pthread_mutex_t *mtx = reinterpret_cast<pthread_mutex_t *>(lock.Handle());
     ASSERT(mtx);
 
@@ -0,0 +1,239 @@
+/**
+ * @file    Future.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/os/OS_Thread.h"
+#include "llbc/core/os/OS_Time.h"
+#include "llbc/core/thread/SimpleLock.h"
+#include "llbc/core/thread/Guard.h"
+#include "llbc/core/thread/ConditionVariable.h"
+#include "llbc/core/thread/ThreadPool.h"
+
+#include "llbc/core/thread/Future.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The future shared state.
+ */
+class LLBC_HIDDEN LLBC_FutureState
+{
+public:
+    explicit LLBC_FutureState(LLBC_ThreadPool *pool)
+    : refs(1)
+    , done(false)
+    , pool(pool)
+    {
+    }
+
+public:
+    volatile sint32 refs;
+    volatile bool done;
+    LLBC_ThreadPool *pool;
+
+    LLBC_SimpleLock lock;
+    LLBC_ConditionVariable cond;
+
+    typedef std::vector<std::pair<LLBC_IDelegate0 *, LLBC_IExecutor *> > Continuations;
+    Continuations continuations;
+};
+
+__LLBC_NS_END
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static void __RunContinuation(LLBC_NS LLBC_IDelegate0 *continuation, LLBC_NS LLBC_IExecutor *executor)
+{
+    if (executor)
+    {
+        executor->Execute(continuation);
+        return;
+    }
+
+    continuation->Invoke();
+    delete continuation;
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_Future::LLBC_Future()
+: _state(NULL)
+{
+}
+
+LLBC_Future::LLBC_Future(const LLBC_Future &other)
+: _state(other._state)
+{
+    if (_state)
+        RetainState(_state);
+}
+
+LLBC_Future::~LLBC_Future()
+{
+    if (_state)
+        ReleaseState(_state);
+}
+
+bool LLBC_Future::IsValid() const
+{
+    return _state != NULL;
+}
+
+bool LLBC_Future::IsDone() const
+{
+    return _state && _state->done;
+}
+
+int LLBC_Future::Wait(int milliSeconds) const
+{
+    if (UNLIKELY(!_state))
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_FAILED;
+    }
+
+    if (_state->done)
+        return LLBC_OK;
+
+    const sint64 begTime = LLBC_GetMilliSeconds();
+
+    // In worker thread, help to run other tasks, avoid all workers blocked in waiting.
+    if (_state->pool && _state->pool->IsInWorkerThread())
+    {
+        while (!_state->done)
+        {
+            if (milliSeconds != LLBC_INFINITE &&
+                LLBC_GetMilliSeconds() - begTime >= milliSeconds)
+            {
+                LLBC_SetLastError(LLBC_ERROR_TIMEOUT);
+                return LLBC_FAILED;
+            }
+
+            if (!_state->pool->RunOneTask())
+                LLBC_CPURelax();
+        }
+
+        return LLBC_OK;
+    }
+
+    LLBC_Guard guard(_state->lock);
+    while (!_state->done)
+    {
+        if (milliSeconds == LLBC_INFINITE)
+        {
+            _state->cond.Wait(_state->lock);
+            continue;
+        }
+
+        const sint64 remain = milliSeconds - (LLBC_GetMilliSeconds() - begTime);
+        if (remain <= 0)
+        {
+            LLBC_SetLastError(LLBC_ERROR_TIMEOUT);
+            return LLBC_FAILED;
+        }
+
+        _state->cond.TimedWait(_state->lock, static_cast<int>(remain));
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_Future::Then(LLBC_IDelegate0 *continuation, LLBC_IExecutor *executor)
+{
+    if (UNLIKELY(!continuation))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+    else if (UNLIKELY(!_state))
+    {
+        delete continuation;
+
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_FAILED;
+    }
+
+    _state->lock.Lock();
+    if (!_state->done)
+    {
+        _state->continuations.push_back(std::make_pair(continuation, executor));
+        _state->lock.Unlock();
+
+        return LLBC_OK;
+    }
+
+    _state->lock.Unlock();
+
+    // Already done, run continuation immediately.
+    LLBC_INL_NS __RunContinuation(continuation, executor);
+
+    return LLBC_OK;
+}
+
+LLBC_Future &LLBC_Future::operator =(const LLBC_Future &other)
+{
+    if (_state == other._state)
+        return *this;
+
+    if (other._state)
+        RetainState(other._state);
+    if (_state)
+        ReleaseState(_state);
+
+    _state = other._state;
+
+    return *this;
+}
+
+LLBC_Future LLBC_Future::Create(LLBC_ThreadPool *pool)
+{
+    LLBC_Future future;
+    future._state = new LLBC_FutureState(pool);
+
+    return future;
+}
+
+LLBC_FutureState *LLBC_Future::GetState() const
+{
+    return _state;
+}
+
+void LLBC_Future::SetDone(LLBC_FutureState *state)
+{
+    LLBC_FutureState::Continuations continuations;
+
+    state->lock.Lock();
+    state->done = true;
+    continuations.swap(state->continuations);
+    state->cond.Broadcast();
+    state->lock.Unlock();
+
+    for (size_t i = 0; i < continuations.size(); ++i)
+        LLBC_INL_NS __RunContinuation(continuations[i].first, continuations[i].second);
+}
+
+void LLBC_Future::RetainState(LLBC_FutureState *state)
+{
+    LLBC_AtomicFetchAndAdd(&state->refs, 1);
+}
+
+void LLBC_Future::ReleaseState(LLBC_FutureState *state)
+{
+    if (LLBC_AtomicFetchAndSub(&state->refs, 1) == 1)
+        delete state;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
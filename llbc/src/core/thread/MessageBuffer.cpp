@@ -17,6 +17,7 @@ __LLBC_NS_BEGIN
 
 LLBC_MessageBuffer::LLBC_MessageBuffer()
 : _head(NULL)
+, _tail(NULL)
 {
 }
 
@@ -143,16 +144,11 @@ int LLBC_MessageBuffer::Append(LLBC_MessageBlock *block)
     block->SetNext(NULL);
 
     if (!_head)
-    {
         _head = block;
-        return LLBC_OK;
-    }
-
-    LLBC_MessageBlock *curBlock = _head;
-    while (curBlock->GetNext())
-        curBlock = curBlock->GetNext();
+    else
+        _tail->SetNext(block);
 
-    curBlock->SetNext(block);
+    _tail = block;
 
     return LLBC_OK;
 }
@@ -208,6 +204,8 @@ void LLBC_MessageBuffer::Cleanup()
         _head = _head->GetNext();
         delete block;
     }
+
+    _tail = NULL;
 }
 
 __LLBC_NS_END
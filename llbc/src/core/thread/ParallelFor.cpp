@@ -0,0 +1,115 @@
+/**
+ * @file    ParallelFor.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/os/OS_Thread.h"
+
+#include "llbc/core/thread/ParallelFor.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The auto grain size chunks count per worker(include caller thread).
+static const int __autoChunksPerWorker = 4;
+// The join spin rounds before yield.
+static const int __joinSpinRounds = 256;
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_ParallelJob::LLBC_ParallelJob(int chunkCount)
+: _chunkCount(chunkCount)
+
+, _refs(1)
+, _nextChunk(0)
+, _finishedChunks(0)
+{
+}
+
+LLBC_ParallelJob::~LLBC_ParallelJob()
+{
+}
+
+void LLBC_ParallelJob::Run(LLBC_ThreadPool &pool)
+{
+    // Submit helpers, caller thread run chunks too, so at most (chunks - 1) helpers required.
+    if (pool.IsStarted())
+    {
+        const int helperCount = MIN(pool.GetThreadCount(), _chunkCount - 1);
+        for (int i = 0; i < helperCount; ++i)
+        {
+            LLBC_AtomicFetchAndAdd(&_refs, 1);
+            if (pool.Execute(new LLBC_Delegate0<LLBC_ParallelJob>(this, &LLBC_ParallelJob::Help)) != LLBC_OK)
+            {
+                LLBC_AtomicFetchAndSub(&_refs, 1);
+                break;
+            }
+        }
+    }
+
+    RunChunks();
+
+    // Wait in-flight chunks(claimed by helpers) finished, claimed chunk always running, no dead lock.
+    int spinRounds = 0;
+    while (LLBC_AtomicGet(&_finishedChunks) != _chunkCount)
+    {
+        if (++spinRounds < LLBC_INL_NS __joinSpinRounds)
+        {
+            LLBC_CPURelax();
+        }
+        else
+        {
+            spinRounds = 0;
+            LLBC_Sleep(0);
+        }
+    }
+}
+
+void LLBC_ParallelJob::Release()
+{
+    if (LLBC_AtomicFetchAndSub(&_refs, 1) == 1)
+        delete this;
+}
+
+void LLBC_ParallelJob::RunChunks()
+{
+    while (true)
+    {
+        const sint32 chunk = LLBC_AtomicFetchAndAdd(&_nextChunk, 1);
+        if (chunk >= _chunkCount)
+            break;
+
+        RunChunk(chunk);
+        LLBC_AtomicFetchAndAdd(&_finishedChunks, 1);
+    }
+}
+
+void LLBC_ParallelJob::Help()
+{
+    RunChunks();
+    Release();
+}
+
+int LLBC_CalcParallelGrainSize(const LLBC_ThreadPool &pool, int count, int grainSize)
+{
+    if (grainSize > 0)
+        return grainSize;
+
+    const int workers = (pool.IsStarted() ? pool.GetThreadCount() : 0) + 1;
+    grainSize = count / (workers * LLBC_INL_NS __autoChunksPerWorker);
+
+    return MAX(grainSize, 1);
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
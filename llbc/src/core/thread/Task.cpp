@@ -11,6 +11,8 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/utils/Util_Debug.h"
+#include "llbc/core/log/LoggerManager.h"
 
 #include "llbc/core/timer/TimerScheduler.h"
 
@@ -52,6 +54,7 @@ LLBC_BaseTask::LLBC_BaseTask(LLBC_ThreadManager *threadMgr)
     , _curThreadNum(0)
     , _startCompleted(false)
     , _threadManager(threadMgr ? threadMgr : LLBC_ThreadManagerSingleton)
+    , _cpuAffinity()
 {
 }
 
@@ -103,6 +106,16 @@ int LLBC_BaseTask::GetThreadCount() const
     return _threadNum;
 }
 
+void LLBC_BaseTask::SetCPUAffinity(const std::vector<int> &cpuNos)
+{
+    _cpuAffinity = cpuNos;
+}
+
+const std::vector<int> &LLBC_BaseTask::GetCPUAffinity() const
+{
+    return _cpuAffinity;
+}
+
 int LLBC_BaseTask::Wait()
 {
     return _threadManager->WaitTask(this);
@@ -156,8 +169,25 @@ int LLBC_BaseTask::TimedPop(LLBC_MessageBlock *&block, int interval)
     return LLBC_FAILED;
 }
 
+ulong LLBC_BaseTask::GetMessageSize() const
+{
+    return _msgQueue.GetSize();
+}
+
 void LLBC_BaseTask::OnTaskThreadStart()
 {
+    // Bind failure not prevent task thread running, but report it(logger not initialized, report to stderr).
+    if (!_cpuAffinity.empty() &&
+        LLBC_SetThreadAffinity(LLBC_GetCurrentThread(), _cpuAffinity) != LLBC_OK)
+    {
+        LLBC_String cpuNos;
+        for (size_t i = 0; i < _cpuAffinity.size(); ++i)
+            cpuNos.append_format(i == 0 ? "%d" : ",%d", _cpuAffinity[i]);
+
+        LLBC_LIB_WARN_LOG("Task thread bind CPU affinity[%s] failed, error: %s",
+                          cpuNos.c_str(), LLBC_FormatLastError());
+    }
+
     LLBC_Guard guard(_lock);
     if (++_curThreadNum == _threadNum)
         _startCompleted = true;
@@ -0,0 +1,418 @@
+/**
+ * @file    ThreadPool.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+#include "llbc/core/os/OS_Thread.h"
+#include "llbc/core/helper/STLHelper.h"
+#include "llbc/core/thread/AdaptiveLock.h"
+#include "llbc/core/thread/ThreadManager.h"
+
+#include "llbc/core/thread/ThreadPool.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The worker sleep timed wait interval, use to avoid lost wakeup forever.
+static const int __workerSleepInterval = 100;
+// The worker steal spin rounds before sleep.
+static const int __workerSpinRounds = 64;
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The thread pool task.
+ */
+struct LLBC_ThreadPool::_Task
+{
+    LLBC_IDelegate0 *deleg;
+    LLBC_FutureState *future;
+};
+
+/**
+ * \brief The thread pool worker.
+ */
+struct LLBC_ThreadPool::_Worker
+{
+    LLBC_ThreadPool *pool;
+    int index;
+
+    LLBC_AdaptiveLock lock;
+    std::deque<_Task *> tasks;
+};
+
+LLBC_ThreadPool::LLBC_ThreadPool()
+: _started(false)
+, _stopping(0)
+, _pushingTasks(0)
+, _bindCPU(false)
+
+, _groupHandle(LLBC_INVALID_HANDLE)
+, _curWorker(LLBC_INVALID_TLS_HANDLE)
+
+, _workers()
+, _startedWorkers(0)
+, _nextWorker(0)
+
+, _pendingTasks(0)
+, _sleepingWorkers(0)
+, _sleepLock()
+, _sleepCond()
+
+, _stoppedSem(0)
+{
+    LLBC_TlsAlloc(&_curWorker);
+}
+
+LLBC_ThreadPool::~LLBC_ThreadPool()
+{
+    Stop();
+    LLBC_TlsFree(_curWorker);
+}
+
+int LLBC_ThreadPool::Start(int threadNum, bool bindCPU)
+{
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_FAILED;
+    }
+
+    if (threadNum < 0 || threadNum > LLBC_CFG_THREAD_MAX_THREAD_NUM)
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+    else if (threadNum == 0)
+    {
+        threadNum = MIN(LLBC_GetCPUCount(), LLBC_CFG_THREAD_MAX_THREAD_NUM);
+    }
+
+    _bindCPU = bindCPU;
+    _stopping = 0;
+    _pushingTasks = 0;
+    _startedWorkers = 0;
+    _nextWorker = 0;
+
+    for (int i = 0; i < threadNum; ++i)
+    {
+        _Worker *worker = new _Worker;
+        worker->pool = this;
+        worker->index = i;
+
+        _workers.push_back(worker);
+    }
+
+    _groupHandle = LLBC_ThreadManagerSingleton->CreateThreads(threadNum, &LLBC_ThreadPool::WorkerEntry, this);
+    if (_groupHandle == LLBC_INVALID_HANDLE)
+    {
+        LLBC_STLHelper::DeleteContainer(_workers);
+        return LLBC_FAILED;
+    }
+
+    _started = true;
+
+    return LLBC_OK;
+}
+
+int LLBC_ThreadPool::Stop()
+{
+    if (!_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return LLBC_FAILED;
+    }
+    else if (IsInWorkerThread())
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return LLBC_FAILED;
+    }
+
+    // Set stopping flag(full barrier) before check pushing tasks, pair with PushTask(),
+    // after all pushing calls returned, no more tasks can be pushed to worker deques.
+    LLBC_AtomicSet(&_stopping, 1);
+    while (LLBC_AtomicGet(&_pushingTasks) > 0)
+        LLBC_Sleep(0);
+
+    _sleepLock.Lock();
+    _sleepCond.Broadcast();
+    _sleepLock.Unlock();
+
+    // Wait all workers exit worker loop, then join the threads.
+    for (size_t i = 0; i < _workers.size(); ++i)
+        _stoppedSem.Wait();
+    LLBC_ThreadManagerSingleton->WaitGroup(_groupHandle);
+
+    // Execute the remaining tasks(if exist) in stopping thread, make sure every task future done.
+    for (size_t i = 0; i < _workers.size(); ++i)
+    {
+        std::deque<_Task *> &tasks = _workers[i]->tasks;
+        while (!tasks.empty())
+        {
+            _Task *task = tasks.front();
+            tasks.pop_front();
+
+            RunTask(task);
+        }
+    }
+
+    LLBC_STLHelper::DeleteContainer(_workers);
+    _groupHandle = LLBC_INVALID_HANDLE;
+
+    _started = false;
+    _stopping = 0;
+
+    return LLBC_OK;
+}
+
+bool LLBC_ThreadPool::IsStarted() const
+{
+    return _started;
+}
+
+int LLBC_ThreadPool::GetThreadCount() const
+{
+    return static_cast<int>(_workers.size());
+}
+
+bool LLBC_ThreadPool::IsInWorkerThread() const
+{
+    const _Worker *worker = reinterpret_cast<_Worker *>(LLBC_TlsGetValue(_curWorker));
+    return worker && worker->pool == this;
+}
+
+int LLBC_ThreadPool::GetPendingTaskCount() const
+{
+    return _pendingTasks;
+}
+
+LLBC_Future LLBC_ThreadPool::Submit(LLBC_IDelegate0 *task)
+{
+    if (UNLIKELY(!task))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_Future();
+    }
+
+    LLBC_Future future = LLBC_Future::Create(this);
+
+    _Task *poolTask = new _Task;
+    poolTask->deleg = task;
+    poolTask->future = future.GetState();
+    LLBC_Future::RetainState(poolTask->future);
+
+    if (PushTask(poolTask) != LLBC_OK)
+    {
+        LLBC_Future::ReleaseState(poolTask->future);
+        delete poolTask->deleg;
+        delete poolTask;
+
+        return LLBC_Future();
+    }
+
+    return future;
+}
+
+int LLBC_ThreadPool::Execute(LLBC_IDelegate0 *task)
+{
+    if (UNLIKELY(!task))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+    _Task *poolTask = new _Task;
+    poolTask->deleg = task;
+    poolTask->future = NULL;
+
+    if (PushTask(poolTask) != LLBC_OK)
+    {
+        delete poolTask->deleg;
+        delete poolTask;
+
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+int LLBC_ThreadPool::PushTask(_Task *task)
+{
+    // Increase pushing tasks count(full barrier) before check stopping/started flags, pair with Stop().
+    LLBC_AtomicFetchAndAdd(&_pushingTasks, 1);
+    if (UNLIKELY(LLBC_AtomicGet(&_stopping)))
+    {
+        LLBC_AtomicFetchAndSub(&_pushingTasks, 1);
+
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return LLBC_FAILED;
+    }
+    else if (UNLIKELY(!_started || _workers.empty()))
+    {
+        LLBC_AtomicFetchAndSub(&_pushingTasks, 1);
+
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return LLBC_FAILED;
+    }
+
+    // Worker thread submit: push to self deque, keep the task locality.
+    _Worker *worker = reinterpret_cast<_Worker *>(LLBC_TlsGetValue(_curWorker));
+    if (!worker || worker->pool != this)
+    {
+        const sint32 next = LLBC_AtomicFetchAndAdd(&_nextWorker, 1);
+        worker = _workers[static_cast<uint32>(next) % _workers.size()];
+    }
+
+    // Increase pending tasks count(full barrier) before check sleeping workers, pair with WorkerLoop().
+    LLBC_AtomicFetchAndAdd(&_pendingTasks, 1);
+
+    worker->lock.Lock();
+    worker->tasks.push_back(task);
+    worker->lock.Unlock();
+
+    if (LLBC_AtomicGet(&_sleepingWorkers) > 0)
+    {
+        _sleepLock.Lock();
+        _sleepCond.Notify();
+        _sleepLock.Unlock();
+    }
+
+    LLBC_AtomicFetchAndSub(&_pushingTasks, 1);
+
+    return LLBC_OK;
+}
+
+LLBC_ThreadPool::_Task *LLBC_ThreadPool::PopTask(_Worker *worker)
+{
+    _Task *task = NULL;
+
+    // Pop self deque back(LIFO, cache hot).
+    worker->lock.Lock();
+    if (!worker->tasks.empty())
+    {
+        task = worker->tasks.back();
+        worker->tasks.pop_back();
+    }
+    worker->lock.Unlock();
+
+    if (task)
+        return task;
+
+    // Steal other workers deque front(FIFO, oldest task).
+    const size_t workerCount = _workers.size();
+    for (size_t i = 1; i < workerCount; ++i)
+    {
+        _Worker *victim = _workers[(worker->index + i) % workerCount];
+        victim->lock.Lock();
+        if (!victim->tasks.empty())
+        {
+            task = victim->tasks.front();
+            victim->tasks.pop_front();
+        }
+        victim->lock.Unlock();
+
+        if (task)
+            return task;
+    }
+
+    return NULL;
+}
+
+bool LLBC_ThreadPool::RunOneTask()
+{
+    _Worker *worker = reinterpret_cast<_Worker *>(LLBC_TlsGetValue(_curWorker));
+    if (!worker || worker->pool != this)
+        return false;
+
+    _Task *task = PopTask(worker);
+    if (!task)
+        return false;
+
+    RunTask(task);
+
+    return true;
+}
+
+void LLBC_ThreadPool::RunTask(_Task *task)
+{
+    LLBC_AtomicFetchAndSub(&_pendingTasks, 1);
+
+    task->deleg->Invoke();
+    delete task->deleg;
+
+    if (task->future)
+    {
+        LLBC_Future::SetDone(task->future);
+        LLBC_Future::ReleaseState(task->future);
+    }
+
+    delete task;
+}
+
+int LLBC_ThreadPool::WorkerEntry(void *arg)
+{
+    LLBC_ThreadPool *pool = reinterpret_cast<LLBC_ThreadPool *>(arg);
+
+    const sint32 index = LLBC_AtomicFetchAndAdd(&pool->_startedWorkers, 1);
+    _Worker *worker = pool->_workers[index];
+
+    if (pool->_bindCPU)
+        LLBC_SetThreadAffinity(LLBC_GetCurrentThread(), index % LLBC_GetCPUCount());
+
+    LLBC_TlsSetValue(pool->_curWorker, worker);
+    pool->WorkerLoop(worker);
+    LLBC_TlsSetValue(pool->_curWorker, NULL);
+
+    pool->_stoppedSem.Post();
+
+    return 0;
+}
+
+void LLBC_ThreadPool::WorkerLoop(_Worker *worker)
+{
+    int idleRounds = 0;
+    while (true)
+    {
+        _Task *task = PopTask(worker);
+        if (task)
+        {
+            RunTask(task);
+            idleRounds = 0;
+
+            continue;
+        }
+
+        // When stopping, exit after all queued tasks executed.
+        if (_stopping && LLBC_AtomicGet(&_pendingTasks) == 0)
+            break;
+
+        if (++idleRounds < LLBC_INL_NS __workerSpinRounds)
+        {
+            LLBC_CPURelax();
+            continue;
+        }
+
+        idleRounds = 0;
+
+        // Increase sleeping workers count(full barrier) before check pending tasks, pair with PushTask().
+        _sleepLock.Lock();
+        LLBC_AtomicFetchAndAdd(&_sleepingWorkers, 1);
+        if (LLBC_AtomicGet(&_pendingTasks) == 0 && !_stopping)
+            _sleepCond.TimedWait(_sleepLock, LLBC_INL_NS __workerSleepInterval);
+        LLBC_AtomicFetchAndSub(&_sleepingWorkers, 1);
+        _sleepLock.Unlock();
+    }
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -11,6 +11,7 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/os/OS_Time.h"
+#include "llbc/core/profiler/FrameProfiler.h"
 
 #include "llbc/core/timer/BaseTimer.h"
 #include "llbc/core/timer/TimerData.h"
@@ -29,6 +30,7 @@ LLBC_TimerScheduler::LLBC_TimerScheduler()
 : _maxTimerId(0)
 , _enabled(true)
 , _destroyed(false)
+, _profiler(NULL)
 {
 }
 
@@ -83,12 +85,16 @@ LLBC_TimerScheduler::_This *LLBC_TimerScheduler::GetCurrentThreadScheduler()
 }
 
 void LLBC_TimerScheduler::Update()
+{
+    Update(LLBC_GetMilliSeconds());
+}
+
+void LLBC_TimerScheduler::Update(uint64 now)
 {
     if (!_enabled)
         return;
 
     LLBC_TimerData *data;
-    uint64 now = LLBC_GetMilliSeconds();
 
     while (_heap.FindTop(data) == LLBC_OK)
     {
@@ -114,7 +120,18 @@ void LLBC_TimerScheduler::Update()
 #endif // LLBC_CFG_CORE_TIMER_STRICT_SCHEDULE
         {
             ++ data->repeatTimes;
-            reSchedule = data->timer->OnTimeout();
+            if (_profiler)
+            {
+                const sint64 begTime = LLBC_GetMonotonicMicroSeconds();
+                reSchedule = data->timer->OnTimeout();
+                _profiler->AddCost(LLBC_FrameProfiler::Timer,
+                                   static_cast<sint64>(data->timerId),
+                                   LLBC_GetMonotonicMicroSeconds() - begTime);
+            }
+            else
+            {
+                reSchedule = data->timer->OnTimeout();
+            }
 #if LLBC_CFG_CORE_TIMER_STRICT_SCHEDULE
             if (!reSchedule)
                 break;
@@ -167,6 +184,11 @@ void LLBC_TimerScheduler::SetEnabled(bool enabled)
     _enabled = enabled;
 }
 
+void LLBC_TimerScheduler::SetProfiler(LLBC_FrameProfiler *profiler)
+{
+    _profiler = profiler;
+}
+
 bool LLBC_TimerScheduler::IsDstroyed() const
 {
     return _destroyed;
@@ -491,7 +491,7 @@ void LLBC_Array::Recapacity(size_type cap)
         return;
     }
 
-    _objs = reinterpret_cast<Obj **>(realloc(_objs, cap * sizeof(Obj *)));
+    _objs = LLBC_Realloc(Obj *, _objs, cap * sizeof(Obj *));
     LLBC_MemSet(_objs + _capacity, 0, (cap - _capacity) * sizeof(Obj *));
 
     _capacity = cap;
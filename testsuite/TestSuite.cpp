@@ -22,6 +22,7 @@ int TestSuite_Main(int argc, char *argv[])
     // test = new TestCase_Com_Stream;
     // test = new TestCase_Com_Error;
     // test = new TestCase_Com_Compiler;
+    // test = new TestCase_Com_PoolAllocator;
 
     /* Core module testcases. */
     // test = new TestCase_Core_OS_Thread;
@@ -42,19 +43,25 @@ int TestSuite_Main(int argc, char *argv[])
     // test = new TestCase_Core_Config_Ini;
     // test = new TestCase_Core_Config_Config;
     // test = new TestCase_Core_Time_Time;
+    // test = new TestCase_Core_Sampler_TokenBucket;
     // test = new TestCase_Core_Config_Property;
     // test = new TestCase_Core_Thread_Lock;
+    // test = new TestCase_Core_Thread_LockBench;
     // test = new TestCase_Core_Thread_CV;
     // test = new TestCase_Core_Thread_RWLock;
     // test = new TestCase_Core_Thread_Semaphore;
     // test = new TestCase_Core_Thread_Tls;
     // test = new TestCase_Core_Thread_ThreadMgr;
     // test = new TestCase_Core_Thread_Task;
+    // test = new TestCase_Core_Thread_ThreadPool;
+    // test = new TestCase_Core_Thread_ParallelFor;
     // test = new TestCase_Core_Random;
     // test = new TestCase_Core_Log;
+    // test = new TestCase_Core_Log_NetworkAppender;
     // test = new TestCase_Core_Entity;
     // test = new TestCase_Core_Transcoder;
     // test = new TestCase_Core_Library;
+    // test = new TestCase_Core_Json;
 
     /* ObjBase module testcases. */
 #if LLBC_CFG_OBJBASE_ENABLED
@@ -81,6 +88,19 @@ int TestSuite_Main(int argc, char *argv[])
     // test = new TestCase_Comm_ExternalDriveSvc;
     // test = new TestCase_Comm_LazyTask;
     // test = new TestCase_Comm_CustomHeaderSvc;
+    // test = new TestCase_Comm_SvcStat;
+    // test = new TestCase_Comm_FrameProfiler;
+    // test = new TestCase_Comm_Coro;
+    // test = new TestCase_Comm_LocalSession;
+    // test = new TestCase_Comm_UnixSocket;
+    // test = new TestCase_Comm_Udp;
+    // test = new TestCase_Comm_PollPoller;
+    // test = new TestCase_Comm_BusyPoll;
+    // test = new TestCase_Comm_SendCork;
+    // test = new TestCase_Comm_SendLanes;
+    // test = new TestCase_Comm_RecvLimit;
+    // test = new TestCase_Comm_EchoBench;
+    // test = new TestCase_Comm_IoUringPoller;
 
     int ret = LLBC_FAILED;
     if (test)
@@ -15,6 +15,7 @@
 #include "common/TestCase_Com_Error.h"
 #include "common/TestCase_Com_Version.h"
 #include "common/TestCase_Com_Compiler.h"
+#include "common/TestCase_Com_PoolAllocator.h"
 
 #include "core/os/TestCase_Core_OS_Thread.h"
 #include "core/os/TestCase_Core_OS_Console.h"
@@ -35,18 +36,24 @@
 #include "core/config/TestCase_Core_Config_Config.h"
 #include "core/config/TestCase_Core_Config_Property.h"
 #include "core/time/TestCase_Core_Time_Time.h"
+#include "core/sampler/TestCase_Core_Sampler_TokenBucket.h"
 #include "core/thread/TestCase_Core_Thread_Lock.h"
+#include "core/thread/TestCase_Core_Thread_LockBench.h"
 #include "core/thread/TestCase_Core_Thread_RWLock.h"
 #include "core/thread/TestCase_Core_Thread_CV.h"
 #include "core/thread/TestCase_Core_Thread_Semaphore.h"
 #include "core/thread/TestCase_Core_Thread_Tls.h"
 #include "core/thread/TestCase_Core_Thread_ThreadMgr.h"
 #include "core/thread/TestCase_Core_Thread_Task.h"
+#include "core/thread/TestCase_Core_Thread_ThreadPool.h"
+#include "core/thread/TestCase_Core_Thread_ParallelFor.h"
 #include "core/random/TestCase_Core_Random.h"
 #include "core/log/TestCase_Core_Log.h"
+#include "core/log/TestCase_Core_Log_NetworkAppender.h"
 #include "core/entity/TestCase_Core_Entity.h"
 #include "core/transcoder/TestCase_Core_Transcoder.h"
 #include "core/library/TestCase_Core_Library.h"
+#include "core/json/TestCase_Core_Json.h"
 
 #include "objbase/TestCase_ObjBase_Object.h"
 #include "objbase/TestCase_ObjBase_Array.h"
@@ -67,6 +74,19 @@
 #include "comm/TestCase_Comm_ExternalDriveSvc.h"
 #include "comm/TestCase_Comm_LazyTask.h"
 #include "comm/TestCase_Comm_CustomHeaderSvc.h"
+#include "comm/TestCase_Comm_SvcStat.h"
+#include "comm/TestCase_Comm_FrameProfiler.h"
+#include "comm/TestCase_Comm_Coro.h"
+#include "comm/TestCase_Comm_LocalSession.h"
+#include "comm/TestCase_Comm_UnixSocket.h"
+#include "comm/TestCase_Comm_Udp.h"
+#include "comm/TestCase_Comm_PollPoller.h"
+#include "comm/TestCase_Comm_BusyPoll.h"
+#include "comm/TestCase_Comm_SendCork.h"
+#include "comm/TestCase_Comm_SendLanes.h"
+#include "comm/TestCase_Comm_RecvLimit.h"
+#include "comm/TestCase_Comm_EchoBench.h"
+#include "comm/TestCase_Comm_IoUringPoller.h"
 
 extern int TestSuite_Main(int argc, char *argv[]);
 
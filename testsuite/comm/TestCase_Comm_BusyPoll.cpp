@@ -0,0 +1,184 @@
+/**
+ * @file    TestCase_Comm_BusyPoll.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_BusyPoll.h"
+
+namespace
+{
+
+const int PingOpcode = 1;
+const int PongOpcode = 2;
+
+const int WarmupCount = 500;
+const int PingCount = 5000;
+const int PayloadSize = 64;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7795;
+
+class PingPongFacade : public LLBC_IFacade
+{
+public:
+    PingPongFacade()
+    : pongs(0)
+    {
+        latencies.reserve(PingCount);
+    }
+
+public:
+    void Ping(int sessionId)
+    {
+        char payload[PayloadSize];
+        LLBC_MemSet(payload, 'P', sizeof(payload));
+
+        const sint64 now = LLBC_GetMicroSeconds();
+        LLBC_MemCpy(payload, &now, sizeof(now));
+
+        GetService()->Send(sessionId, PingOpcode, payload, sizeof(payload), 0);
+    }
+
+    void OnPing(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(),
+                           PongOpcode,
+                           packet.GetPayload(),
+                           packet.GetPayloadLength(),
+                           0);
+    }
+
+    void OnPong(LLBC_Packet &packet)
+    {
+        sint64 sendTime;
+        LLBC_MemCpy(&sendTime, packet.GetPayload(), sizeof(sendTime));
+        if (pongs >= WarmupCount)
+            latencies.push_back(LLBC_GetMicroSeconds() - sendTime);
+
+        // Only one ping in flight, next ping send after pong received.
+        if (++pongs < WarmupCount + PingCount)
+            Ping(packet.GetSessionId());
+    }
+
+public:
+    volatile int pongs;
+    std::vector<sint64> latencies;
+};
+
+sint64 Percentile(const std::vector<sint64> &sorted, double percent)
+{
+    if (sorted.empty())
+        return 0;
+
+    const size_t idx = static_cast<size_t>(sorted.size() * percent / 100.0);
+    return sorted[MIN(idx, sorted.size() - 1)];
+}
+
+}
+
+TestCase_Comm_BusyPoll::TestCase_Comm_BusyPoll()
+{
+}
+
+TestCase_Comm_BusyPoll::~TestCase_Comm_BusyPoll()
+{
+}
+
+int TestCase_Comm_BusyPoll::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service busy poll test:");
+    if (LLBC_GetCPUCount() < 4)
+        LLBC_PrintLine("  Note: CPU count less than 4, busy polling threads compete cores, latency will be distorted");
+
+    int ret = RunBenchmark(false);
+    if (ret == LLBC_OK)
+        ret = RunBenchmark(true);
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_BusyPoll::RunBenchmark(bool busyPoll)
+{
+    LLBC_PrintLine("%s ping-pong latency benchmark, pings: %d, payload size: %d:",
+                   busyPoll ? "Busy poll" : "Blocking", PingCount, PayloadSize);
+
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "BusyPollClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "BusyPollServer");
+    if (clientSvc->SetBusyPoll(busyPoll) != LLBC_OK ||
+        serverSvc->SetBusyPoll(busyPoll) != LLBC_OK)
+    {
+        LLBC_PrintLine("Set busy poll failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    PingPongFacade *clientFacade = LLBC_New(PingPongFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(PongOpcode, clientFacade, &PingPongFacade::OnPong);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    PingPongFacade *serverFacade = LLBC_New(PingPongFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(PingOpcode, serverFacade, &PingPongFacade::OnPing);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    int sessionId = 0;
+    if (serverSvc->Listen(ListenIp, ListenPort) != 0)
+        sessionId = clientSvc->Connect(ListenIp, ListenPort);
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Create session failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    clientFacade->Ping(sessionId);
+    for (int i = 0; i < 120000 && clientFacade->pongs < WarmupCount + PingCount; ++i)
+        LLBC_Sleep(1);
+    const sint64 cost = LLBC_GetMicroSeconds() - begTime;
+
+    clientSvc->Stop();
+    serverSvc->Stop();
+
+    std::vector<sint64> &latencies = clientFacade->latencies;
+    std::sort(latencies.begin(), latencies.end());
+
+    LLBC_PrintLine("  recved pongs: %d/%d, cost: %lld us",
+                   clientFacade->pongs, WarmupCount + PingCount, cost);
+    LLBC_PrintLine("  round trip latency(us), p50: %lld, p90: %lld, p99: %lld, p99.9: %lld, max: %lld",
+                   Percentile(latencies, 50),
+                   Percentile(latencies, 90),
+                   Percentile(latencies, 99),
+                   Percentile(latencies, 99.9),
+                   latencies.empty() ? 0 : latencies.back());
+
+    const bool succeed = clientFacade->pongs == WarmupCount + PingCount;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("%s test failed", busyPoll ? "Busy poll" : "Blocking");
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_BusyPoll.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service busy poll test case(ping-pong latency benchmark).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_BUSY_POLL_H__
+#define __LLBC_TEST_CASE_COMM_BUSY_POLL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_BusyPoll : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_BusyPoll();
+    virtual ~TestCase_Comm_BusyPoll();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBenchmark(bool busyPoll);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_BUSY_POLL_H__
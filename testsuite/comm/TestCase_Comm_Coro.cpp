@@ -0,0 +1,271 @@
+/**
+ * @file    TestCase_Comm_Coro.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_Coro.h"
+
+namespace
+{
+
+const int ReqOpcode = 1;
+const int PingOpcode = 2;
+const int PongOpcode = 3;
+const int DoneOpcode = 4;
+const int TimeoutReqOpcode = 5;
+const int TimeoutOpcode = 6;
+
+const int ReqCount = 2000;
+const char Payload[] = "coro";
+
+class CoroCounter
+{
+public:
+    CoroCounter()
+    : steps(0)
+    {
+    }
+
+    void Step()
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            ++steps;
+            LLBC_Coro::Yield();
+        }
+    }
+
+public:
+    int steps;
+};
+
+class ComputeJob
+{
+public:
+    ComputeJob()
+    : result(0)
+    {
+    }
+
+    void Compute()
+    {
+        for (int i = 1; i <= 1000; ++i)
+            result += i;
+    }
+
+public:
+    volatile sint64 result;
+};
+
+class TestFacade : public LLBC_IFacade
+{
+public:
+    TestFacade(LLBC_ThreadPool &pool)
+    : doneCount(0)
+    , failedCount(0)
+    , timeoutCount(0)
+    , _pool(pool)
+    {
+    }
+
+public:
+    // Coroutine handler: ping peer and await pong, sleep, then await thread pool job.
+    void OnReq(LLBC_Packet &packet)
+    {
+        LLBC_IService *svc = GetService();
+        const int sessionId = packet.GetSessionId();
+
+        svc->Send(sessionId, PingOpcode, Payload, sizeof(Payload), 0);
+        LLBC_Packet *pong = svc->AwaitReply(sessionId, PongOpcode, 5000);
+        if (!pong)
+        {
+            LLBC_PrintLine("Await pong failed, error: %s", LLBC_FormatLastError());
+            ++failedCount;
+            return;
+        }
+
+        if (svc->CoroSleep(10) != LLBC_OK)
+        {
+            ++failedCount;
+            return;
+        }
+
+        ComputeJob job;
+        LLBC_Future future = _pool.Submit(new LLBC_Delegate0<ComputeJob>(&job, &ComputeJob::Compute));
+        if (svc->AwaitFuture(future, 5000) != LLBC_OK || job.result != 500500)
+        {
+            ++failedCount;
+            return;
+        }
+
+        svc->Send(sessionId, DoneOpcode, Payload, sizeof(Payload), 0);
+    }
+
+    // Coroutine handler: await never arrive packet, must timeout.
+    void OnTimeoutReq(LLBC_Packet &packet)
+    {
+        LLBC_Packet *reply = GetService()->AwaitReply(packet.GetSessionId(), TimeoutOpcode, 100);
+        if (!reply && LLBC_GetLastError() == LLBC_ERROR_TIMEOUT)
+            ++timeoutCount;
+        else
+            ++failedCount;
+    }
+
+    void OnPing(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(), PongOpcode, Payload, sizeof(Payload), 0);
+    }
+
+    void OnDone(LLBC_Packet &packet)
+    {
+        ++doneCount;
+    }
+
+public:
+    volatile int doneCount;
+    volatile int failedCount;
+    volatile int timeoutCount;
+
+private:
+    LLBC_ThreadPool &_pool;
+};
+
+}
+
+TestCase_Comm_Coro::TestCase_Comm_Coro()
+{
+}
+
+TestCase_Comm_Coro::~TestCase_Comm_Coro()
+{
+}
+
+int TestCase_Comm_Coro::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service coroutine handler test:");
+
+    int ret = TestCoro();
+    if (ret == LLBC_OK)
+        ret = TestSvcCoro();
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_Coro::TestCoro()
+{
+    LLBC_PrintLine("Coroutine resume/yield test:");
+
+    CoroCounter counter;
+    LLBC_Coro coro(new LLBC_Delegate0<CoroCounter>(&counter, &CoroCounter::Step));
+
+    int resumeTimes = 0;
+    while (coro.GetState() != LLBC_Coro::Finished)
+    {
+        if (coro.Resume() != LLBC_OK)
+        {
+            LLBC_PrintLine("Resume coroutine failed, error: %s", LLBC_FormatLastError());
+            return LLBC_FAILED;
+        }
+
+        ++resumeTimes;
+        if (counter.steps != MIN(resumeTimes, 3))
+        {
+            LLBC_PrintLine("Coroutine step mismatch, steps: %d, resume times: %d", counter.steps, resumeTimes);
+            return LLBC_FAILED;
+        }
+    }
+
+    LLBC_PrintLine("Coroutine finished, resume times: %d, yield outside coroutine: %d",
+                   resumeTimes, LLBC_Coro::Yield());
+
+    return resumeTimes == 4 ? LLBC_OK : LLBC_FAILED;
+}
+
+int TestCase_Comm_Coro::TestSvcCoro()
+{
+    LLBC_PrintLine("Service coroutine handler test:");
+
+#if LLBC_CFG_COMM_ENABLE_CORO
+    LLBC_ThreadPool pool;
+    pool.Start(2);
+
+    LLBC_IService *svc = LLBC_IService::Create(LLBC_IService::Normal, "CoroTest");
+    svc->SuppressCoderNotFoundWarning();
+
+    TestFacade *facade = LLBC_New1(TestFacade, pool);
+    svc->RegisterFacade(facade);
+    svc->SubscribeCoro(ReqOpcode, facade, &TestFacade::OnReq);
+    svc->SubscribeCoro(TimeoutReqOpcode, facade, &TestFacade::OnTimeoutReq);
+    svc->Subscribe(PingOpcode, facade, &TestFacade::OnPing);
+    svc->Subscribe(DoneOpcode, facade, &TestFacade::OnDone);
+    if (svc->Subscribe(ReqOpcode, facade, &TestFacade::OnDone) == LLBC_OK)
+    {
+        LLBC_PrintLine("Subscribe normal handler to coroutine handler opcode success, test failed");
+        LLBC_Delete(svc);
+
+        return LLBC_FAILED;
+    }
+
+    svc->Start();
+
+    const int port = 7790;
+    if (svc->Listen("127.0.0.1", port) == 0)
+    {
+        LLBC_PrintLine("Listen on 127.0.0.1:%d failed, error: %s", port, LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_FAILED;
+    }
+
+    const int sessionId = svc->Connect("127.0.0.1", port);
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Connect to 127.0.0.1:%d failed, error: %s", port, LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_FAILED;
+    }
+
+    // Send requests, every request handled in a coroutine.
+    const sint64 begTime = LLBC_GetMilliSeconds();
+    for (int i = 0; i < ReqCount; ++i)
+        svc->Send(sessionId, ReqOpcode, Payload, sizeof(Payload), 0);
+    svc->Send(sessionId, TimeoutReqOpcode, Payload, sizeof(Payload), 0);
+
+    int maxCoroCount = 0;
+    for (int i = 0; i < 500 && facade->doneCount + facade->failedCount < ReqCount; ++i)
+    {
+        maxCoroCount = MAX(maxCoroCount, svc->GetCoroCount());
+        LLBC_Sleep(10);
+    }
+
+    LLBC_Sleep(200);
+    LLBC_PrintLine("Requests: %d, done: %d, failed: %d, timeout: %d, max alive coroutines: %d, cost: %lld ms",
+                   ReqCount, facade->doneCount, facade->failedCount, facade->timeoutCount,
+                   maxCoroCount, LLBC_GetMilliSeconds() - begTime);
+
+    const bool succeed = facade->doneCount == ReqCount &&
+                         facade->failedCount == 0 &&
+                         facade->timeoutCount == 1;
+
+    LLBC_Delete(svc);
+    pool.Stop();
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Service coroutine handler test failed");
+        return LLBC_FAILED;
+    }
+#else // !LLBC_CFG_COMM_ENABLE_CORO
+    LLBC_PrintLine("LLBC_CFG_COMM_ENABLE_CORO disabled, skip test");
+#endif // LLBC_CFG_COMM_ENABLE_CORO
+
+    return LLBC_OK;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file    TestCase_Comm_Coro.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service coroutine handler test case.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_CORO_H__
+#define __LLBC_TEST_CASE_COMM_CORO_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_Coro : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_Coro();
+    virtual ~TestCase_Comm_Coro();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int TestCoro();
+    int TestSvcCoro();
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_CORO_H__
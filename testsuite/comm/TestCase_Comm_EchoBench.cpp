@@ -0,0 +1,228 @@
+/**
+ * @file    TestCase_Comm_EchoBench.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_EchoBench.h"
+
+namespace
+{
+
+const int EchoOpcode = 1;
+const int BroadcastOpcode = 2;
+const int BroadcastEventId = 1;
+
+const int ClientCount = 16;
+const int RequestsPerClient = 5000;
+// Every BroadcastInterval echo requests, server broadcast once, and fire a service event.
+const int BroadcastInterval = 100;
+const int PayloadSize = 64;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7797;
+
+class EchoServerFacade : public LLBC_IFacade
+{
+public:
+    EchoServerFacade()
+    : recvedReqs(0)
+    , firedEvents(0)
+    {
+    }
+
+public:
+    virtual void OnInitialize()
+    {
+        GetService()->SubscribeEvent(BroadcastEventId, this, &EchoServerFacade::OnBroadcastEvent);
+    }
+
+    void OnEcho(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(),
+                           EchoOpcode,
+                           packet.GetPayload(),
+                           packet.GetPayloadLength(),
+                           0);
+
+        if (++recvedReqs % BroadcastInterval == 0)
+        {
+            // Fired in service thread, service event allocate from service frame arena.
+            GetService()->FireEvent(LLBC_New1(LLBC_Event, BroadcastEventId));
+            GetService()->Broadcast(BroadcastOpcode, packet.GetPayload(), packet.GetPayloadLength(), 0);
+        }
+    }
+
+    void OnBroadcastEvent(LLBC_Event *ev)
+    {
+        ++firedEvents;
+    }
+
+public:
+    int recvedReqs;
+    int firedEvents;
+};
+
+class EchoClientFacade : public LLBC_IFacade
+{
+public:
+    EchoClientFacade()
+    : recvedEchos(0)
+    , recvedBroadcasts(0)
+    {
+    }
+
+public:
+    void OnEcho(LLBC_Packet &packet)
+    {
+        ++recvedEchos;
+    }
+
+    void OnBroadcast(LLBC_Packet &packet)
+    {
+        ++recvedBroadcasts;
+    }
+
+public:
+    volatile int recvedEchos;
+    volatile int recvedBroadcasts;
+};
+
+}
+
+TestCase_Comm_EchoBench::TestCase_Comm_EchoBench()
+{
+}
+
+TestCase_Comm_EchoBench::~TestCase_Comm_EchoBench()
+{
+}
+
+int TestCase_Comm_EchoBench::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service echo/broadcast benchmark test:");
+    LLBC_PrintLine("LLBC_CFG_COM_USE_POOL_ALLOCATOR: %d", LLBC_CFG_COM_USE_POOL_ALLOCATOR);
+
+    const int ret = RunBench();
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_EchoBench::RunBench()
+{
+    LLBC_PrintLine("clients: %d, requests per client: %d, broadcast interval: %d, payload size: %d",
+                   ClientCount, RequestsPerClient, BroadcastInterval, PayloadSize);
+
+    std::vector<LLBC_PoolAllocatorTagStat> begTagStats;
+    LLBC_GetPoolAllocatorTagStats(begTagStats);
+
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "EchoBenchClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "EchoBenchServer");
+
+    EchoClientFacade *clientFacade = LLBC_New(EchoClientFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(EchoOpcode, clientFacade, &EchoClientFacade::OnEcho);
+    clientSvc->Subscribe(BroadcastOpcode, clientFacade, &EchoClientFacade::OnBroadcast);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    EchoServerFacade *serverFacade = LLBC_New(EchoServerFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(EchoOpcode, serverFacade, &EchoServerFacade::OnEcho);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    std::vector<int> sessionIds;
+    if (serverSvc->Listen(ListenIp, ListenPort) != 0)
+    {
+        for (int i = 0; i < ClientCount; ++i)
+        {
+            const int sessionId = clientSvc->Connect(ListenIp, ListenPort);
+            if (sessionId == 0)
+                break;
+
+            sessionIds.push_back(sessionId);
+        }
+    }
+
+    if (sessionIds.size() != static_cast<size_t>(ClientCount))
+    {
+        LLBC_PrintLine("Create sessions failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'E', sizeof(payload));
+
+    const int reqCount = ClientCount * RequestsPerClient;
+    const int broadcastCount = (reqCount / BroadcastInterval) * ClientCount;
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < RequestsPerClient; ++i)
+    {
+        for (int j = 0; j < ClientCount; ++j)
+            clientSvc->Send(sessionIds[j], EchoOpcode, payload, sizeof(payload), 0);
+    }
+
+    for (int i = 0; i < 20000 &&
+         (clientFacade->recvedEchos < reqCount || clientFacade->recvedBroadcasts < broadcastCount); ++i)
+        LLBC_Sleep(1);
+    const sint64 cost = MAX(LLBC_GetMicroSeconds() - begTime, static_cast<sint64>(1));
+
+    const int packets = reqCount + clientFacade->recvedEchos + clientFacade->recvedBroadcasts;
+    LLBC_PrintLine("  recved echos: %d/%d, broadcasts: %d/%d, cost: %lld us, throughput: %lld packets/s",
+                   clientFacade->recvedEchos, reqCount,
+                   clientFacade->recvedBroadcasts, broadcastCount,
+                   cost, static_cast<sint64>(packets) * 1000000 / cost);
+
+    const bool succeed = clientFacade->recvedEchos == reqCount &&
+        clientFacade->recvedBroadcasts == broadcastCount;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    PrintTagStats(begTagStats);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Echo/broadcast benchmark failed");
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+void TestCase_Comm_EchoBench::PrintTagStats(const std::vector<LLBC_PoolAllocatorTagStat> &begStats)
+{
+    std::vector<LLBC_PoolAllocatorTagStat> stats;
+    LLBC_GetPoolAllocatorTagStats(stats);
+
+    LLBC_PrintLine("Pool allocator tag stats(during benchmark):");
+    for (size_t i = 0; i < stats.size(); ++i)
+    {
+        LLBC_PoolAllocatorTagStat stat = stats[i];
+        if (i < begStats.size())
+        {
+            stat.allocTimes -= begStats[i].allocTimes;
+            stat.freeTimes -= begStats[i].freeTimes;
+            stat.allocBytes -= begStats[i].allocBytes;
+        }
+
+        if (stat.allocTimes == 0 && stat.freeTimes == 0)
+            continue;
+
+        LLBC_PrintLine("    %-28s alloc times: %llu, free times: %llu, alloc bytes: %llu",
+                       stat.name, stat.allocTimes, stat.freeTimes, stat.allocBytes);
+    }
+}
@@ -0,0 +1,29 @@
+/**
+ * @file    TestCase_Comm_EchoBench.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service echo/broadcast benchmark test case(report pool allocator stats).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_ECHO_BENCH_H__
+#define __LLBC_TEST_CASE_COMM_ECHO_BENCH_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_EchoBench : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_EchoBench();
+    virtual ~TestCase_Comm_EchoBench();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBench();
+    void PrintTagStats(const std::vector<LLBC_PoolAllocatorTagStat> &begStats);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_ECHO_BENCH_H__
@@ -0,0 +1,160 @@
+/**
+ * @file    TestCase_Comm_FrameProfiler.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_FrameProfiler.h"
+
+namespace
+{
+
+const int SlowOpcode = 1;
+
+class SlowTimer : public LLBC_BaseTimer
+{
+public:
+    virtual bool OnTimeout()
+    {
+        // Simulate slow timer callback.
+        LLBC_Sleep(30);
+        return true;
+    }
+
+    virtual void OnCancel()
+    {
+    }
+};
+
+class TestFacade : public LLBC_IFacade
+{
+public:
+    TestFacade()
+    : _timer(NULL)
+    {
+    }
+
+public:
+    virtual void OnStart()
+    {
+        _timer = LLBC_New(SlowTimer);
+        _timer->Schedule(200, 200);
+    }
+
+    virtual void OnStop()
+    {
+        _timer->Cancel();
+        LLBC_XDelete(_timer);
+    }
+
+public:
+    void OnSlowPacket(LLBC_Packet &packet)
+    {
+        // Simulate slow packet handler.
+        LLBC_Sleep(20);
+    }
+
+private:
+    SlowTimer *_timer;
+};
+
+}
+
+TestCase_Comm_FrameProfiler::TestCase_Comm_FrameProfiler()
+{
+}
+
+TestCase_Comm_FrameProfiler::~TestCase_Comm_FrameProfiler()
+{
+}
+
+int TestCase_Comm_FrameProfiler::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service frame profiler test:");
+
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    LLBC_IService *svc = LLBC_IService::Create(LLBC_IService::Normal, "FrameProfilerTest");
+    svc->SuppressCoderNotFoundWarning();
+    svc->SetSlowFrameThreshold(25);
+
+    TestFacade *facade = LLBC_New(TestFacade);
+    svc->RegisterFacade(facade);
+    svc->Subscribe(SlowOpcode, facade, &TestFacade::OnSlowPacket);
+
+    svc->Start();
+
+    const int port = 7789;
+    if (svc->Listen("127.0.0.1", port) == 0)
+    {
+        LLBC_PrintLine("Listen on 127.0.0.1:%d failed, error: %s", port, LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_FAILED;
+    }
+
+    const int sessionId = svc->Connect("127.0.0.1", port);
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Connect to 127.0.0.1:%d failed, error: %s", port, LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_FAILED;
+    }
+
+    const char data[] = "Slow packet";
+    for (int i = 0; i < 5; ++i)
+    {
+        svc->Send(sessionId, SlowOpcode, data, sizeof(data), 0);
+        LLBC_Sleep(200);
+    }
+
+    LLBC_Sleep(500);
+    PrintProfile(svc);
+
+    LLBC_Delete(svc);
+#else // !LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    LLBC_PrintLine("LLBC_CFG_COMM_ENABLE_FRAME_PROFILER disabled, skip test");
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return LLBC_OK;
+}
+
+void TestCase_Comm_FrameProfiler::PrintProfile(LLBC_IService *svc)
+{
+#if LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+    LLBC_FrameProfile profile;
+    svc->GetFrameProfile(profile);
+
+    LLBC_PrintLine("Frame profile[%lld, %lld], frames: %llu, slow frames: %llu, avg cost: %.2f us, max cost: %lld us",
+                   profile.beginTime, profile.endTime,
+                   profile.frameCost.times, profile.slowFrames,
+                   profile.frameCost.GetAverageCost(), profile.frameCost.maxCost);
+
+    for (size_t i = 0; i < profile.phaseCosts.size(); ++i)
+    {
+        const LLBC_CostStat &phaseCost = profile.phaseCosts[i];
+        LLBC_PrintLine("  phase %s: avg cost: %.2f us, max cost: %lld us",
+                       profile.phaseNames[i].c_str(), phaseCost.GetAverageCost(), phaseCost.maxCost);
+    }
+
+    for (LLBC_FrameProfile::OpcodeCosts::const_iterator it = profile.opcodeCosts.begin();
+         it != profile.opcodeCosts.end();
+         it++)
+        LLBC_PrintLine("  opcode %d: %llu times, avg cost: %.2f us, max cost: %lld us",
+                       it->first, it->second.times, it->second.GetAverageCost(), it->second.maxCost);
+
+    for (LLBC_FrameProfile::TimerCosts::const_iterator it = profile.timerCosts.begin();
+         it != profile.timerCosts.end();
+         it++)
+        LLBC_PrintLine("  timer %llu: %llu times, avg cost: %.2f us, max cost: %lld us",
+                       it->first, it->second.times, it->second.GetAverageCost(), it->second.maxCost);
+
+    LLBC_PrintLine("Last slow frame report: %s", svc->GetLastSlowFrameReport().c_str());
+#endif // LLBC_CFG_COMM_ENABLE_FRAME_PROFILER
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_FrameProfiler.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service frame profiler test case.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_FRAME_PROFILER_H__
+#define __LLBC_TEST_CASE_COMM_FRAME_PROFILER_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_FrameProfiler : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_FrameProfiler();
+    virtual ~TestCase_Comm_FrameProfiler();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    void PrintProfile(LLBC_IService *svc);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_FRAME_PROFILER_H__
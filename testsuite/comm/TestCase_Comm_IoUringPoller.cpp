@@ -0,0 +1,302 @@
+/**
+ * @file    TestCase_Comm_IoUringPoller.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_IoUringPoller.h"
+
+namespace
+{
+
+const int EchoReqOpcode = 1;
+const int EchoRspOpcode = 2;
+const int TokenOpcode = 3;
+
+const int RoundCount = 20;
+const int ClientCount = 50;
+const int PacketsPerClient = 20;
+const int PayloadSize = 256;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7799;
+
+class TestFacade : public LLBC_IFacade
+{
+public:
+    TestFacade()
+    : createdSessions(0)
+    , destroyedSessions(0)
+    , recvedRsps(0)
+    , recvedTokens(0)
+    , mismatchTokens(0)
+    {
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        ++createdSessions;
+    }
+
+    virtual void OnSessionDestroy(const LLBC_SessionDestroyInfo &destroyInfo)
+    {
+        ++destroyedSessions;
+    }
+
+public:
+    void OnEchoReq(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(),
+                           EchoRspOpcode,
+                           packet.GetPayload(),
+                           packet.GetPayloadLength(),
+                           0);
+    }
+
+    void OnEchoRsp(LLBC_Packet &packet)
+    {
+        ++recvedRsps;
+    }
+
+    // Every session's packets carry the same token, the first packet record session token and remove session
+    // immediately(multishot recv in flight), the socket handle reused by next accepted sessions, if stale
+    // completions not discarded, removed session's data will be delivered to new session.
+    void OnToken(LLBC_Packet &packet)
+    {
+        ++recvedTokens;
+
+        const int token = *reinterpret_cast<const int *>(packet.GetPayload());
+        std::map<int, int>::iterator it = _tokens.find(packet.GetSessionId());
+        if (it == _tokens.end())
+        {
+            _tokens.insert(std::make_pair(packet.GetSessionId(), token));
+            GetService()->RemoveSession(packet.GetSessionId(), "Stale completion test");
+        }
+        else if (it->second != token)
+        {
+            ++mismatchTokens;
+        }
+    }
+
+public:
+    volatile int createdSessions;
+    volatile int destroyedSessions;
+    volatile int recvedRsps;
+    volatile int recvedTokens;
+    volatile int mismatchTokens;
+
+private:
+    std::map<int, int> _tokens;
+};
+
+bool CreateServices(const char *pollerModel,
+                    const char *clientPollerModel,
+                    LLBC_IService *&clientSvc,
+                    TestFacade *&clientFacade,
+                    LLBC_IService *&serverSvc,
+                    TestFacade *&serverFacade)
+{
+    clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "IoUringPollerClient");
+    serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "IoUringPollerServer");
+    if (clientSvc->SetPollerModel(clientPollerModel) != LLBC_OK ||
+        serverSvc->SetPollerModel(pollerModel) != LLBC_OK)
+    {
+        LLBC_PrintLine("Set poller model failed, error: %s", LLBC_FormatLastError());
+        LLBC_XDelete(clientSvc);
+        LLBC_XDelete(serverSvc);
+
+        return false;
+    }
+
+    clientFacade = LLBC_New(TestFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(EchoRspOpcode, clientFacade, &TestFacade::OnEchoRsp);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    serverFacade = LLBC_New(TestFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(EchoReqOpcode, serverFacade, &TestFacade::OnEchoReq);
+    serverSvc->Subscribe(TokenOpcode, serverFacade, &TestFacade::OnToken);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    if (serverSvc->Listen(ListenIp, ListenPort) == 0)
+    {
+        LLBC_PrintLine("Listen failed, error: %s", LLBC_FormatLastError());
+        LLBC_XDelete(clientSvc);
+        LLBC_XDelete(serverSvc);
+
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+TestCase_Comm_IoUringPoller::TestCase_Comm_IoUringPoller()
+{
+}
+
+TestCase_Comm_IoUringPoller::~TestCase_Comm_IoUringPoller()
+{
+}
+
+int TestCase_Comm_IoUringPoller::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service io_uring poller test:");
+
+    int ret = LLBC_OK;
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    LLBC_PrintLine("io_uring supported: %s", LLBC_IoUringIsSupported() ? "true" : "false");
+    if ((ret = FallbackTest()) == LLBC_OK)
+        ret = StaleCompletionTest();
+#else // !LLBC_CFG_COMM_ENABLE_IO_URING
+    LLBC_PrintLine("io_uring poller not enabled, skip test");
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_IoUringPoller::FallbackTest()
+{
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    LLBC_PrintLine("Epoll fallback test(LLBC_DISABLE_IO_URING=1):");
+
+    // Force fallback, io_uring poller selected, but service must started with EpollPoller and work.
+    ::setenv("LLBC_DISABLE_IO_URING", "1", 1);
+
+    LLBC_IService *clientSvc;
+    LLBC_IService *serverSvc;
+    TestFacade *clientFacade;
+    TestFacade *serverFacade;
+    const bool created = CreateServices("IoUringPoller", "IoUringPoller",
+                                        clientSvc, clientFacade, serverSvc, serverFacade);
+    ::unsetenv("LLBC_DISABLE_IO_URING");
+    if (!created)
+        return LLBC_FAILED;
+
+    LLBC_PrintLine("  poller model after started, client: %s, server: %s",
+                   clientSvc->GetPollerModel().c_str(), serverSvc->GetPollerModel().c_str());
+
+    int recvedRsps = 0;
+    const int sessionId = clientSvc->Connect(ListenIp, ListenPort);
+    if (sessionId != 0)
+    {
+        char payload[PayloadSize];
+        LLBC_MemSet(payload, 'F', sizeof(payload));
+        for (int i = 0; i < PacketsPerClient; ++i)
+            clientSvc->Send(sessionId, EchoReqOpcode, payload, sizeof(payload), 0);
+
+        for (int i = 0; i < 1000 && clientFacade->recvedRsps < PacketsPerClient; ++i)
+            LLBC_Sleep(5);
+
+        recvedRsps = clientFacade->recvedRsps;
+    }
+
+    LLBC_PrintLine("  recved echo responses: %d/%d", recvedRsps, PacketsPerClient);
+
+    const bool succeed = clientSvc->GetPollerModel() == "EpollPoller" &&
+                         serverSvc->GetPollerModel() == "EpollPoller" &&
+                         recvedRsps == PacketsPerClient;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Epoll fallback test failed");
+        return LLBC_FAILED;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+
+    return LLBC_OK;
+}
+
+int TestCase_Comm_IoUringPoller::StaleCompletionTest()
+{
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    LLBC_PrintLine("Stale completion test, rounds: %d, clients: %d, packets per client: %d:",
+                   RoundCount, ClientCount, PacketsPerClient);
+
+    // Client use EpollPoller, only test server side io_uring poller.
+    LLBC_IService *clientSvc;
+    LLBC_IService *serverSvc;
+    TestFacade *clientFacade;
+    TestFacade *serverFacade;
+    if (!CreateServices("IoUringPoller", "EpollPoller",
+                        clientSvc, clientFacade, serverSvc, serverFacade))
+        return LLBC_FAILED;
+
+    LLBC_PrintLine("  server poller model: %s", serverSvc->GetPollerModel().c_str());
+
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'S', sizeof(payload));
+
+    int connected = 0;
+    const int sessionCount = RoundCount * ClientCount;
+    for (int round = 0; round < RoundCount; ++round)
+    {
+        int sessionIds[ClientCount] = {0};
+        for (int i = 0; i < ClientCount; ++i)
+        {
+            if ((sessionIds[i] = clientSvc->Connect(ListenIp, ListenPort)) != 0)
+                ++connected;
+        }
+
+        // Keep sending after server removing sessions, let recv completions race with session remove.
+        for (int j = 0; j < PacketsPerClient; ++j)
+        {
+            for (int i = 0; i < ClientCount; ++i)
+            {
+                if (sessionIds[i] == 0)
+                    continue;
+
+                const int token = round * ClientCount + i + 1;
+                LLBC_MemCpy(payload, &token, sizeof(token));
+                clientSvc->Send(sessionIds[i], TokenOpcode, payload, sizeof(payload), 0);
+            }
+        }
+
+        // Wait server remove all sessions of this round, next round sessions reuse the socket handles.
+        for (int i = 0; i < 2000 && clientFacade->destroyedSessions < connected; ++i)
+            LLBC_Sleep(5);
+    }
+
+    for (int i = 0; i < 1000 && serverFacade->destroyedSessions < connected; ++i)
+        LLBC_Sleep(5);
+
+    LLBC_PrintLine("  connected: %d/%d, session destroy, client: %d, server: %d",
+                   connected, sessionCount, clientFacade->destroyedSessions, serverFacade->destroyedSessions);
+    LLBC_PrintLine("  server recved token packets: %d, mismatch token packets: %d",
+                   serverFacade->recvedTokens, serverFacade->mismatchTokens);
+
+    const bool succeed = connected == sessionCount &&
+                         clientFacade->destroyedSessions == sessionCount &&
+                         serverFacade->destroyedSessions == sessionCount &&
+                         serverFacade->recvedTokens >= sessionCount &&
+                         serverFacade->mismatchTokens == 0;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Stale completion test failed");
+        return LLBC_FAILED;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+
+    return LLBC_OK;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file    TestCase_Comm_IoUringPoller.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library io_uring poller test case(epoll fallback & stale completions discard).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_IO_URING_POLLER_H__
+#define __LLBC_TEST_CASE_COMM_IO_URING_POLLER_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_IoUringPoller : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_IoUringPoller();
+    virtual ~TestCase_Comm_IoUringPoller();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int FallbackTest();
+    int StaleCompletionTest();
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_IO_URING_POLLER_H__
@@ -0,0 +1,172 @@
+/**
+ * @file    TestCase_Comm_LocalSession.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_LocalSession.h"
+
+namespace
+{
+
+const int EchoReqOpcode = 1;
+const int EchoRspOpcode = 2;
+
+const int EchoCount = 100000;
+const int PayloadSize = 64;
+
+class EchoFacade : public LLBC_IFacade
+{
+public:
+    EchoFacade()
+    : createdSessions(0)
+    , destroyedSessions(0)
+    , recvedRsps(0)
+    {
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        ++createdSessions;
+    }
+
+    virtual void OnSessionDestroy(const LLBC_SessionDestroyInfo &destroyInfo)
+    {
+        ++destroyedSessions;
+    }
+
+public:
+    void OnEchoReq(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(),
+                           EchoRspOpcode,
+                           packet.GetPayload(),
+                           packet.GetPayloadLength(),
+                           0);
+    }
+
+    void OnEchoRsp(LLBC_Packet &packet)
+    {
+        ++recvedRsps;
+    }
+
+public:
+    volatile int createdSessions;
+    volatile int destroyedSessions;
+    volatile int recvedRsps;
+};
+
+}
+
+TestCase_Comm_LocalSession::TestCase_Comm_LocalSession()
+{
+}
+
+TestCase_Comm_LocalSession::~TestCase_Comm_LocalSession()
+{
+}
+
+int TestCase_Comm_LocalSession::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service local session test:");
+
+    int ret = RunBenchmark(true);
+    if (ret == LLBC_OK)
+        ret = RunBenchmark(false);
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_LocalSession::RunBenchmark(bool local)
+{
+    LLBC_PrintLine("%s echo benchmark, echo count: %d, payload size: %d:",
+                   local ? "Local session" : "Loopback TCP session", EchoCount, PayloadSize);
+
+    LLBC_IService *gateSvc = LLBC_IService::Create(LLBC_IService::Normal, "LocalSessionGate");
+    LLBC_IService *logicSvc = LLBC_IService::Create(LLBC_IService::Normal, "LocalSessionLogic");
+
+    EchoFacade *gateFacade = LLBC_New(EchoFacade);
+    gateSvc->RegisterFacade(gateFacade);
+    gateSvc->Subscribe(EchoRspOpcode, gateFacade, &EchoFacade::OnEchoRsp);
+    gateSvc->SuppressCoderNotFoundWarning();
+
+    EchoFacade *logicFacade = LLBC_New(EchoFacade);
+    logicSvc->RegisterFacade(logicFacade);
+    logicSvc->Subscribe(EchoReqOpcode, logicFacade, &EchoFacade::OnEchoReq);
+    logicSvc->SuppressCoderNotFoundWarning();
+
+    gateSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    logicSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    gateSvc->Start();
+    logicSvc->Start();
+
+    int sessionId = 0;
+    if (local)
+    {
+        sessionId = gateSvc->ConnectLocal(logicSvc);
+    }
+    else
+    {
+        const int port = 7791;
+        if (logicSvc->Listen("127.0.0.1", port) != 0)
+            sessionId = gateSvc->Connect("127.0.0.1", port);
+    }
+
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Create session failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(gateSvc);
+        LLBC_Delete(logicSvc);
+
+        return LLBC_FAILED;
+    }
+
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'L', sizeof(payload));
+
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < EchoCount; ++i)
+        gateSvc->Send(sessionId, EchoReqOpcode, payload, sizeof(payload), 0);
+
+    for (int i = 0; i < 3000 && gateFacade->recvedRsps < EchoCount; ++i)
+        LLBC_Sleep(5);
+    const sint64 cost = LLBC_GetMicroSeconds() - begTime;
+
+    LLBC_PrintLine("  recved echo responses: %d, cost: %lld us, %.0f echos/s",
+                   gateFacade->recvedRsps, cost, gateFacade->recvedRsps * 1000000.0 / MAX(cost, 1));
+
+    bool succeed = gateFacade->recvedRsps == EchoCount;
+    if (local)
+    {
+        // Remove local session, both sides will receive session destroy event.
+        gateSvc->RemoveSession(sessionId, "Test finished");
+        LLBC_Sleep(100);
+
+        LLBC_PrintLine("  session create/destroy, gate: %d/%d, logic: %d/%d, send after remove: %d",
+                       gateFacade->createdSessions, gateFacade->destroyedSessions,
+                       logicFacade->createdSessions, logicFacade->destroyedSessions,
+                       gateSvc->Send(sessionId, EchoReqOpcode, payload, sizeof(payload), 0));
+
+        succeed = succeed &&
+                  gateFacade->createdSessions == 1 && gateFacade->destroyedSessions == 1 &&
+                  logicFacade->createdSessions == 1 && logicFacade->destroyedSessions == 1;
+    }
+
+    LLBC_Delete(gateSvc);
+    LLBC_Delete(logicSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Local session test failed");
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
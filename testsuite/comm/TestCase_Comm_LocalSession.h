@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_LocalSession.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library in-process local session test case(include benchmark against loopback).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_LOCAL_SESSION_H__
+#define __LLBC_TEST_CASE_COMM_LOCAL_SESSION_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_LocalSession : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_LocalSession();
+    virtual ~TestCase_Comm_LocalSession();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBenchmark(bool local);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_LOCAL_SESSION_H__
@@ -0,0 +1,209 @@
+/**
+ * @file    TestCase_Comm_PollPoller.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_PollPoller.h"
+
+namespace
+{
+
+const int EchoReqOpcode = 1;
+const int EchoRspOpcode = 2;
+
+const int ClientCount = 200;
+const int RoundCount = 100;
+const int PayloadSize = 64;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7794;
+
+const char *PollerModels[] =
+{
+    "SelectPoller",
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    "PollPoller",
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+    "EpollPoller",
+#endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    "IoUringPoller",
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+};
+
+class EchoFacade : public LLBC_IFacade
+{
+public:
+    EchoFacade()
+    : createdSessions(0)
+    , destroyedSessions(0)
+    , recvedRsps(0)
+    {
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        ++createdSessions;
+    }
+
+    virtual void OnSessionDestroy(const LLBC_SessionDestroyInfo &destroyInfo)
+    {
+        ++destroyedSessions;
+    }
+
+public:
+    void OnEchoReq(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(),
+                           EchoRspOpcode,
+                           packet.GetPayload(),
+                           packet.GetPayloadLength(),
+                           0);
+    }
+
+    void OnEchoRsp(LLBC_Packet &packet)
+    {
+        ++recvedRsps;
+    }
+
+public:
+    volatile int createdSessions;
+    volatile int destroyedSessions;
+    volatile int recvedRsps;
+};
+
+}
+
+TestCase_Comm_PollPoller::TestCase_Comm_PollPoller()
+{
+}
+
+TestCase_Comm_PollPoller::~TestCase_Comm_PollPoller()
+{
+}
+
+int TestCase_Comm_PollPoller::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service poll poller test:");
+
+    int ret = LLBC_OK;
+    for (size_t i = 0; i < sizeof(PollerModels) / sizeof(PollerModels[0]); ++i)
+    {
+        if ((ret = RunBenchmark(PollerModels[i])) != LLBC_OK)
+            break;
+    }
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_PollPoller::RunBenchmark(const char *pollerModel)
+{
+    LLBC_PrintLine("%s echo benchmark, clients: %d, rounds: %d, payload size: %d:",
+                   pollerModel, ClientCount, RoundCount, PayloadSize);
+
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "PollPollerClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "PollPollerServer");
+    if (clientSvc->SetPollerModel(pollerModel) != LLBC_OK ||
+        serverSvc->SetPollerModel(pollerModel) != LLBC_OK)
+    {
+        LLBC_PrintLine("Set poller model failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    EchoFacade *clientFacade = LLBC_New(EchoFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(EchoRspOpcode, clientFacade, &EchoFacade::OnEchoRsp);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    EchoFacade *serverFacade = LLBC_New(EchoFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(EchoReqOpcode, serverFacade, &EchoFacade::OnEchoReq);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    std::vector<int> sessionIds;
+    if (serverSvc->Listen(ListenIp, ListenPort) != 0)
+    {
+        for (int i = 0; i < ClientCount; ++i)
+        {
+            const int sessionId = clientSvc->Connect(ListenIp, ListenPort);
+            if (sessionId == 0)
+                break;
+
+            sessionIds.push_back(sessionId);
+        }
+    }
+
+    if (sessionIds.size() != ClientCount)
+    {
+        LLBC_PrintLine("Create sessions failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'P', sizeof(payload));
+
+    // Ping-pong rounds, every round all clients send one echo request, measure the poller round trip latency.
+    const int echoCount = ClientCount * RoundCount;
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int round = 0; round < RoundCount; ++round)
+    {
+        for (int i = 0; i < ClientCount; ++i)
+            clientSvc->Send(sessionIds[i], EchoReqOpcode, payload, sizeof(payload), 0);
+
+        const int expectRsps = (round + 1) * ClientCount;
+        for (int i = 0; i < 5000 && clientFacade->recvedRsps < expectRsps; ++i)
+            LLBC_Sleep(1);
+    }
+    const sint64 cost = LLBC_GetMicroSeconds() - begTime;
+
+    LLBC_PrintLine("  recved echo responses: %d/%d, cost: %lld us, %.0f echos/s, avg round: %lld us",
+                   clientFacade->recvedRsps, echoCount, cost,
+                   clientFacade->recvedRsps * 1000000.0 / MAX(cost, 1), cost / RoundCount);
+
+    for (size_t i = 0; i < sessionIds.size(); ++i)
+        clientSvc->RemoveSession(sessionIds[i], "Test finished");
+    for (int i = 0; i < 1000 && serverFacade->destroyedSessions < ClientCount; ++i)
+        LLBC_Sleep(5);
+
+    LLBC_PrintLine("  session create/destroy, client: %d/%d, server: %d/%d",
+                   clientFacade->createdSessions, clientFacade->destroyedSessions,
+                   serverFacade->createdSessions, serverFacade->destroyedSessions);
+
+    // Server create/destroy include listen session, listen session destroy when service delete.
+    const bool succeed = clientFacade->recvedRsps == echoCount &&
+                         clientFacade->createdSessions == ClientCount &&
+                         clientFacade->destroyedSessions == ClientCount &&
+                         serverFacade->createdSessions == ClientCount + 1 &&
+                         serverFacade->destroyedSessions == ClientCount;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("%s test failed", pollerModel);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_PollPoller.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library poll poller test case(side by side benchmark with other pollers).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_POLL_POLLER_H__
+#define __LLBC_TEST_CASE_COMM_POLL_POLLER_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_PollPoller : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_PollPoller();
+    virtual ~TestCase_Comm_PollPoller();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBenchmark(const char *pollerModel);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_POLL_POLLER_H__
@@ -0,0 +1,210 @@
+/**
+ * @file    TestCase_Comm_RecvLimit.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_RecvLimit.h"
+
+namespace
+{
+
+const int MoveOpcode = 1;
+const int ChatOpcode = 2;
+
+const int MoveCount = 2000;
+const int ChatCount = 200;
+const int PayloadSize = 32;
+
+const int SessionRate = 1000;
+const int SessionBurst = 100;
+const int ChatRate = 50;
+const int ChatBurst = 20;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7798;
+
+const char *PollerModels[] =
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    "PollPoller",
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+    "EpollPoller",
+#endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    "IoUringPoller",
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+};
+
+class FloodFacade : public LLBC_IFacade
+{
+public:
+    FloodFacade()
+    : recvedMoves(0)
+    , recvedChats(0)
+    , destroyedSessions(0)
+    {
+    }
+
+public:
+    void OnMove(LLBC_Packet &packet)
+    {
+        ++recvedMoves;
+    }
+
+    void OnChat(LLBC_Packet &packet)
+    {
+        ++recvedChats;
+    }
+
+    virtual void OnSessionDestroy(const LLBC_SessionDestroyInfo &destroyInfo)
+    {
+        ++destroyedSessions;
+    }
+
+public:
+    volatile int recvedMoves;
+    volatile int recvedChats;
+    volatile int destroyedSessions;
+};
+
+}
+
+TestCase_Comm_RecvLimit::TestCase_Comm_RecvLimit()
+{
+}
+
+TestCase_Comm_RecvLimit::~TestCase_Comm_RecvLimit()
+{
+}
+
+int TestCase_Comm_RecvLimit::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service receive rate limit test:");
+
+    int ret = LLBC_OK;
+    for (size_t i = 0; i < sizeof(PollerModels) / sizeof(PollerModels[0]) && ret == LLBC_OK; ++i)
+    {
+        for (int action = LLBC_RecvLimitAction::Begin; action < LLBC_RecvLimitAction::End && ret == LLBC_OK; ++action)
+            ret = RunTest(PollerModels[i], action);
+    }
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_RecvLimit::RunTest(const char *pollerModel, int action)
+{
+    LLBC_PrintLine("%s receive limit action %s, session rate: %d/s(burst %d), chat rate: %d/s(burst %d), "
+                   "flood moves: %d, chats: %d:",
+                   pollerModel, LLBC_RecvLimitAction::Action2Str(action).c_str(),
+                   SessionRate, SessionBurst, ChatRate, ChatBurst, MoveCount, ChatCount);
+
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "RecvLimitClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "RecvLimitServer");
+    clientSvc->SetPollerModel(pollerModel);
+    serverSvc->SetPollerModel(pollerModel);
+
+    LLBC_RecvLimitPolicy policy;
+    policy.action = action;
+    policy.sessionRate = LLBC_RecvLimitPolicy::Rate(SessionRate, SessionBurst);
+    policy.opcodeRates[ChatOpcode] = LLBC_RecvLimitPolicy::Rate(ChatRate, ChatBurst);
+    if (serverSvc->SetRecvLimitPolicy(&policy) != LLBC_OK)
+    {
+        LLBC_PrintLine("Set receive limit policy failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    FloodFacade *clientFacade = LLBC_New(FloodFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    FloodFacade *serverFacade = LLBC_New(FloodFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(MoveOpcode, serverFacade, &FloodFacade::OnMove);
+    serverSvc->Subscribe(ChatOpcode, serverFacade, &FloodFacade::OnChat);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->Start();
+    serverSvc->Start();
+
+    int sessionId = 0;
+    if (serverSvc->Listen(ListenIp, ListenPort) != 0)
+        sessionId = clientSvc->Connect(ListenIp, ListenPort);
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Create session failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    // Flood server, every 10 moves follow one chat.
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'F', sizeof(payload));
+
+    const sint64 begTime = LLBC_GetMilliSeconds();
+    for (int i = 0; i < MoveCount; ++i)
+    {
+        clientSvc->Send(sessionId, MoveOpcode, payload, sizeof(payload), 0);
+        if (i % (MoveCount / ChatCount) == 0)
+            clientSvc->Send(sessionId, ChatOpcode, payload, sizeof(payload), 0);
+    }
+
+    // Wait all flood packets handled(received or limited) or session disconnected.
+    LLBC_ServiceStat stat;
+    for (int i = 0; i < 10000; ++i)
+    {
+        serverSvc->GetStat(stat);
+        if (clientFacade->destroyedSessions > 0 ||
+            serverFacade->recvedMoves + serverFacade->recvedChats +
+                static_cast<int>(stat.total.recvDroppedPackets) >= MoveCount + ChatCount)
+            break;
+
+        LLBC_Sleep(1);
+    }
+    const sint64 cost = LLBC_GetMilliSeconds() - begTime;
+
+    clientSvc->Stop();
+    serverSvc->Stop();
+    serverSvc->GetStat(stat);
+
+    LLBC_PrintLine("  recved moves: %d/%d, chats: %d/%d, limited: %llu, dropped: %llu, disconnected: %s, cost: %lld ms",
+                   serverFacade->recvedMoves, MoveCount, serverFacade->recvedChats, ChatCount,
+                   stat.total.recvLimitedPackets, stat.total.recvDroppedPackets,
+                   clientFacade->destroyedSessions > 0 ? "true" : "false", cost);
+
+    bool succeed;
+    if (action == LLBC_RecvLimitAction::Drop)
+        succeed = stat.total.recvDroppedPackets > 0 &&
+                  serverFacade->recvedMoves + serverFacade->recvedChats +
+                      static_cast<int>(stat.total.recvDroppedPackets) == MoveCount + ChatCount;
+    else if (action == LLBC_RecvLimitAction::Delay)
+        succeed = stat.total.recvDroppedPackets == 0 &&
+                  serverFacade->recvedMoves == MoveCount &&
+                  serverFacade->recvedChats == ChatCount;
+    else
+        succeed = clientFacade->destroyedSessions > 0;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("%s receive limit action %s test failed",
+                       pollerModel, LLBC_RecvLimitAction::Action2Str(action).c_str());
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_RecvLimit.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service receive rate limit test case.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_RECV_LIMIT_H__
+#define __LLBC_TEST_CASE_COMM_RECV_LIMIT_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_RecvLimit : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_RecvLimit();
+    virtual ~TestCase_Comm_RecvLimit();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunTest(const char *pollerModel, int action);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_RECV_LIMIT_H__
@@ -0,0 +1,167 @@
+/**
+ * @file    TestCase_Comm_SendCork.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_SendCork.h"
+
+namespace
+{
+
+const int ReqOpcode = 1;
+const int RspOpcode = 2;
+
+const int RequestCount = 1000;
+const int RspsPerRequest = 10;
+const int PayloadSize = 32;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7796;
+
+const char *PollerModels[] =
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    "PollPoller",
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+    "EpollPoller",
+#endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    "IoUringPoller",
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+};
+
+class CorkFacade : public LLBC_IFacade
+{
+public:
+    CorkFacade()
+    : recvedRsps(0)
+    {
+    }
+
+public:
+    void OnReq(LLBC_Packet &packet)
+    {
+        // First response flush now(latency critical), others corked until frame end.
+        char payload[PayloadSize];
+        LLBC_MemSet(payload, 'C', sizeof(payload));
+        for (int i = 0; i < RspsPerRequest; ++i)
+        {
+            LLBC_Packet *rsp = LLBC_New(LLBC_Packet);
+            rsp->SetHeader(packet.GetSessionId(), RspOpcode, 0);
+            rsp->Write(payload, sizeof(payload));
+            rsp->SetFlushNow(i == 0);
+
+            GetService()->Send(rsp);
+        }
+    }
+
+    void OnRsp(LLBC_Packet &packet)
+    {
+        ++recvedRsps;
+    }
+
+public:
+    volatile int recvedRsps;
+};
+
+}
+
+TestCase_Comm_SendCork::TestCase_Comm_SendCork()
+{
+}
+
+TestCase_Comm_SendCork::~TestCase_Comm_SendCork()
+{
+}
+
+int TestCase_Comm_SendCork::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service send cork test:");
+
+    int ret = LLBC_OK;
+    for (size_t i = 0; i < sizeof(PollerModels) / sizeof(PollerModels[0]) && ret == LLBC_OK; ++i)
+    {
+        if ((ret = RunTest(PollerModels[i], false)) == LLBC_OK)
+            ret = RunTest(PollerModels[i], true);
+    }
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_SendCork::RunTest(const char *pollerModel, bool cork)
+{
+    LLBC_PrintLine("%s send cork %s, requests: %d, responses per request: %d:",
+                   pollerModel, cork ? "on" : "off", RequestCount, RspsPerRequest);
+
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "SendCorkClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "SendCorkServer");
+    clientSvc->SetPollerModel(pollerModel);
+    serverSvc->SetPollerModel(pollerModel);
+    serverSvc->SetSendCork(cork);
+
+    CorkFacade *clientFacade = LLBC_New(CorkFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(RspOpcode, clientFacade, &CorkFacade::OnRsp);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    CorkFacade *serverFacade = LLBC_New(CorkFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(ReqOpcode, serverFacade, &CorkFacade::OnReq);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    int sessionId = 0;
+    if (serverSvc->Listen(ListenIp, ListenPort) != 0)
+        sessionId = clientSvc->Connect(ListenIp, ListenPort);
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Create session failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'R', sizeof(payload));
+
+    const int rspCount = RequestCount * RspsPerRequest;
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < RequestCount; ++i)
+        clientSvc->Send(sessionId, ReqOpcode, payload, sizeof(payload), 0);
+    for (int i = 0; i < 5000 && clientFacade->recvedRsps < rspCount; ++i)
+        LLBC_Sleep(1);
+    const sint64 cost = LLBC_GetMicroSeconds() - begTime;
+
+    LLBC_ServiceStat stat;
+    serverSvc->GetStat(stat);
+
+    LLBC_PrintLine("  recved responses: %d/%d, cost: %lld us, server sent packets: %llu, send calls: %llu",
+                   clientFacade->recvedRsps, rspCount, cost,
+                   stat.total.sentPackets, stat.total.sendCalls);
+
+    const bool succeed = clientFacade->recvedRsps == rspCount;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("%s send cork %s test failed", pollerModel, cork ? "on" : "off");
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
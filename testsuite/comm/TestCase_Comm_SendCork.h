@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_SendCork.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service send cork test case.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_SEND_CORK_H__
+#define __LLBC_TEST_CASE_COMM_SEND_CORK_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_SendCork : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_SendCork();
+    virtual ~TestCase_Comm_SendCork();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunTest(const char *pollerModel, bool cork);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_SEND_CORK_H__
@@ -0,0 +1,228 @@
+/**
+ * @file    TestCase_Comm_SendLanes.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_SendLanes.h"
+
+namespace
+{
+
+const int ReqOpcode = 1;
+const int LowRspOpcode = 2;
+const int HighRspOpcode = 3;
+
+const int RequestCount = 200;
+const int LowRspsPerRequest = 20;
+const int PayloadSize = 64;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7797;
+
+const char *PollerModels[] =
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    "PollPoller",
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+#if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+    "EpollPoller",
+#endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+#if LLBC_CFG_COMM_ENABLE_IO_URING
+    "IoUringPoller",
+#endif // LLBC_CFG_COMM_ENABLE_IO_URING
+};
+
+class LanesFacade : public LLBC_IFacade
+{
+public:
+    LanesFacade()
+    : recvedLowRsps(0)
+    , recvedHighRsps(0)
+    , lowsBeforeHigh(0)
+    , burstLowRsps(0)
+    {
+    }
+
+public:
+    void Request(int sessionId)
+    {
+        char payload[PayloadSize];
+        LLBC_MemSet(payload, 'R', sizeof(payload));
+
+        burstLowRsps = 0;
+        GetService()->Send(sessionId, ReqOpcode, payload, sizeof(payload), 0);
+    }
+
+    void OnReq(LLBC_Packet &packet)
+    {
+        // Bulk low priority responses first, then latency critical high priority response(use opcode priority).
+        char payload[PayloadSize];
+        LLBC_MemSet(payload, 'L', sizeof(payload));
+        for (int i = 0; i < LowRspsPerRequest; ++i)
+        {
+            LLBC_Packet *rsp = LLBC_New(LLBC_Packet);
+            rsp->SetHeader(packet.GetSessionId(), LowRspOpcode, 0);
+            rsp->Write(payload, sizeof(payload));
+            rsp->SetSendPriority(LLBC_SendPriority::Low);
+
+            GetService()->Send(rsp);
+        }
+
+        GetService()->Send(packet.GetSessionId(), HighRspOpcode, payload, sizeof(payload), 0);
+    }
+
+    void OnLowRsp(LLBC_Packet &packet)
+    {
+        ++burstLowRsps;
+        if (++recvedLowRsps % LowRspsPerRequest == 0 && recvedLowRsps == recvedHighRsps * LowRspsPerRequest)
+            Next(packet.GetSessionId());
+    }
+
+    void OnHighRsp(LLBC_Packet &packet)
+    {
+        lowsBeforeHigh += burstLowRsps;
+        if (++recvedHighRsps * LowRspsPerRequest == recvedLowRsps)
+            Next(packet.GetSessionId());
+    }
+
+private:
+    void Next(int sessionId)
+    {
+        // Only one request in flight, next request send after all responses received.
+        if (recvedHighRsps < RequestCount)
+            Request(sessionId);
+    }
+
+public:
+    volatile int recvedLowRsps;
+    volatile int recvedHighRsps;
+    int lowsBeforeHigh;
+    int burstLowRsps;
+};
+
+}
+
+TestCase_Comm_SendLanes::TestCase_Comm_SendLanes()
+{
+}
+
+TestCase_Comm_SendLanes::~TestCase_Comm_SendLanes()
+{
+}
+
+int TestCase_Comm_SendLanes::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service send lanes test:");
+
+    LLBC_SendLanePolicy strictPolicy;
+
+    LLBC_SendLanePolicy weightedPolicy;
+    weightedPolicy.weighted = true;
+    weightedPolicy.weights[LLBC_SendPriority::High] = 4;
+    weightedPolicy.weights[LLBC_SendPriority::Normal] = 2;
+    weightedPolicy.weights[LLBC_SendPriority::Low] = 1;
+    weightedPolicy.lowStaleTimeout = 1000;
+
+    int ret = LLBC_OK;
+    for (size_t i = 0; i < sizeof(PollerModels) / sizeof(PollerModels[0]) && ret == LLBC_OK; ++i)
+    {
+        if ((ret = RunTest(PollerModels[i], NULL)) == LLBC_OK &&
+            (ret = RunTest(PollerModels[i], &strictPolicy)) == LLBC_OK)
+            ret = RunTest(PollerModels[i], &weightedPolicy);
+    }
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_SendLanes::RunTest(const char *pollerModel, const LLBC_SendLanePolicy *policy)
+{
+    const char *policyName = !policy ? "disabled(FIFO)" : (policy->weighted ? "weighted" : "strict");
+    LLBC_PrintLine("%s send lanes %s, requests: %d, low responses per request: %d:",
+                   pollerModel, policyName, RequestCount, LowRspsPerRequest);
+
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "SendLanesClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "SendLanesServer");
+    clientSvc->SetPollerModel(pollerModel);
+    serverSvc->SetPollerModel(pollerModel);
+
+    // Frame's sends flushed at frame end, lanes interleave at flush.
+    serverSvc->SetSendCork(true);
+    if (serverSvc->SetSendLanePolicy(policy) != LLBC_OK ||
+        serverSvc->SetOpcodeSendPriority(HighRspOpcode, LLBC_SendPriority::High) != LLBC_OK)
+    {
+        LLBC_PrintLine("Set send lanes failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    LanesFacade *clientFacade = LLBC_New(LanesFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(LowRspOpcode, clientFacade, &LanesFacade::OnLowRsp);
+    clientSvc->Subscribe(HighRspOpcode, clientFacade, &LanesFacade::OnHighRsp);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    LanesFacade *serverFacade = LLBC_New(LanesFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(ReqOpcode, serverFacade, &LanesFacade::OnReq);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    int sessionId = 0;
+    if (serverSvc->Listen(ListenIp, ListenPort) != 0)
+        sessionId = clientSvc->Connect(ListenIp, ListenPort);
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Create session failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    clientFacade->Request(sessionId);
+    for (int i = 0; i < 10000 && clientFacade->recvedHighRsps < RequestCount; ++i)
+        LLBC_Sleep(1);
+    for (int i = 0; i < 1000 && clientFacade->recvedLowRsps < RequestCount * LowRspsPerRequest; ++i)
+        LLBC_Sleep(1);
+
+    clientSvc->Stop();
+    serverSvc->Stop();
+
+    LLBC_ServiceStat stat;
+    serverSvc->GetStat(stat);
+
+    LLBC_PrintLine("  recved high responses: %d/%d, low responses: %d/%d, avg low responses before high: %.2f, "
+                   "server dropped packets: %llu",
+                   clientFacade->recvedHighRsps, RequestCount,
+                   clientFacade->recvedLowRsps, RequestCount * LowRspsPerRequest,
+                   clientFacade->recvedHighRsps > 0 ?
+                       static_cast<double>(clientFacade->lowsBeforeHigh) / clientFacade->recvedHighRsps : 0.0,
+                   stat.total.sendDroppedPackets);
+
+    const bool succeed = clientFacade->recvedHighRsps == RequestCount &&
+                         clientFacade->recvedLowRsps == RequestCount * LowRspsPerRequest;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("%s send lanes %s test failed", pollerModel, policyName);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_SendLanes.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service send lanes test case.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_SEND_LANES_H__
+#define __LLBC_TEST_CASE_COMM_SEND_LANES_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_SendLanes : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_SendLanes();
+    virtual ~TestCase_Comm_SendLanes();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunTest(const char *pollerModel, const LLBC_SendLanePolicy *policy);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_SEND_LANES_H__
@@ -0,0 +1,178 @@
+/**
+ * @file    TestCase_Comm_SvcStat.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_SvcStat.h"
+
+namespace
+{
+
+const int PingOpcode = 1;
+const int PongOpcode = 2;
+const int PingTimes = 10000;
+
+class TestFacade : public LLBC_IFacade
+{
+public:
+    TestFacade()
+    : _pongTimes(0)
+    {
+    }
+
+public:
+    void OnPing(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(), PongOpcode, packet.GetPayload(), packet.GetPayloadLength(), 0);
+    }
+
+    void OnPong(LLBC_Packet &packet)
+    {
+        ++_pongTimes;
+    }
+
+public:
+    volatile int _pongTimes;
+};
+
+}
+
+TestCase_Comm_SvcStat::TestCase_Comm_SvcStat()
+{
+}
+
+TestCase_Comm_SvcStat::~TestCase_Comm_SvcStat()
+{
+}
+
+int TestCase_Comm_SvcStat::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service traffic statistic test:");
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_IService *svc = LLBC_IService::Create(LLBC_IService::Normal, "SvcStatTest");
+    svc->SuppressCoderNotFoundWarning();
+
+    TestFacade *facade = LLBC_New(TestFacade);
+    svc->RegisterFacade(facade);
+    svc->Subscribe(PingOpcode, facade, &TestFacade::OnPing);
+    svc->Subscribe(PongOpcode, facade, &TestFacade::OnPong);
+
+    svc->Start(2);
+
+    const int port = 7788;
+    if (svc->Listen("127.0.0.1", port) == 0)
+    {
+        LLBC_PrintLine("Listen on 127.0.0.1:%d failed, error: %s", port, LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_FAILED;
+    }
+
+    const int sessionId = svc->Connect("127.0.0.1", port);
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Connect to 127.0.0.1:%d failed, error: %s", port, LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_FAILED;
+    }
+
+    const char data[] = "Hello, service stat!";
+    for (int i = 0; i < PingTimes; ++i)
+        svc->Send(sessionId, PingOpcode, data, sizeof(data), 0);
+
+    // Read stat while pollers & service updating it(updated without lock), counters never go backward.
+    bool goBackward = false;
+    uint64 lastSentPackets = 0, lastHandledPongs = 0;
+    for (int i = 0; i < 5000 && facade->_pongTimes < PingTimes; ++i)
+    {
+        LLBC_ServiceStat stat;
+        svc->GetStat(stat, true);
+
+        const uint64 handledPongs = stat.opcodeStats[PongOpcode].handleCost.times;
+        if (stat.total.sentPackets < lastSentPackets || handledPongs < lastHandledPongs)
+            goBackward = true;
+
+        lastSentPackets = stat.total.sentPackets;
+        lastHandledPongs = handledPongs;
+
+        LLBC_Sleep(1);
+    }
+
+    LLBC_PrintLine("Ping times: %d, pong times: %d", PingTimes, facade->_pongTimes);
+    PrintStat(svc);
+
+    // Wait last pong handle cost recorded(recorded after handler returned).
+    LLBC_Sleep(100);
+
+    LLBC_ServiceStat stat;
+    svc->GetStat(stat);
+    const bool succeed = !goBackward &&
+        stat.opcodeStats[PingOpcode].recvedPackets == static_cast<uint64>(PingTimes) &&
+        stat.opcodeStats[PongOpcode].handleCost.times == static_cast<uint64>(facade->_pongTimes);
+
+    LLBC_Delete(svc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Service stat mismatch(counters go backward: %s), check your code!",
+                       goBackward ? "true" : "false");
+        return LLBC_FAILED;
+    }
+#else // !LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_PrintLine("LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT disabled, skip test");
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return LLBC_OK;
+}
+
+void TestCase_Comm_SvcStat::PrintStat(LLBC_IService *svc)
+{
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_ServiceStat stat;
+    svc->GetStat(stat, true);
+
+    const LLBC_SessionStat &total = stat.total;
+    LLBC_PrintLine("Service %d stat, alive sessions: %lu", stat.svcId, stat.sessionCount);
+    LLBC_PrintLine("  sent: %llu bytes, %llu packets, %llu send() calls, pending: %lld bytes",
+                   total.sentBytes, total.sentPackets, total.sendCalls, total.pendingSendBytes);
+    LLBC_PrintLine("  recved: %llu bytes, %llu packets, %llu recv() calls",
+                   total.recvedBytes, total.recvedPackets, total.recvCalls);
+    LLBC_PrintLine("  queued events, service: %lu, pollers: %lu",
+                   stat.svcQueuedEvents, stat.pollerQueuedEvents);
+
+    for (LLBC_ServiceStat::OpcodeStats::const_iterator it = stat.opcodeStats.begin();
+         it != stat.opcodeStats.end();
+         it++)
+    {
+        const LLBC_OpcodeStat &opStat = it->second;
+        LLBC_PrintLine("  opcode %d: sent %llu packets(%llu bytes), recved %llu packets(%llu bytes), "
+                       "handled %llu times, avg cost: %.2f us, max cost: %lld us",
+                       opStat.opcode,
+                       opStat.sentPackets, opStat.sentBytes,
+                       opStat.recvedPackets, opStat.recvedBytes,
+                       opStat.handleCost.times, opStat.handleCost.GetAverageCost(), opStat.handleCost.maxCost);
+
+        LLBC_String histogram;
+        for (int i = 0; i < LLBC_CostStat::HistogramBucketCount; ++i)
+            histogram.append_format("<%lld:%llu ",
+                LLBC_CostStat::GetHistogramBucketUpperBound(i), opStat.handleCost.histogram[i]);
+        LLBC_PrintLine("    cost histogram(us): %s", histogram.c_str());
+    }
+
+    for (size_t i = 0; i < stat.sessionStats.size(); ++i)
+    {
+        const LLBC_SessionStat &sessionStat = stat.sessionStats[i];
+        LLBC_PrintLine("  session %d: sent %llu bytes, recved %llu bytes",
+                       sessionStat.sessionId, sessionStat.sentBytes, sessionStat.recvedBytes);
+    }
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_SvcStat.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library service traffic statistic test case.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_SVC_STAT_H__
+#define __LLBC_TEST_CASE_COMM_SVC_STAT_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_SvcStat : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_SvcStat();
+    virtual ~TestCase_Comm_SvcStat();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    void PrintStat(LLBC_IService *svc);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_SVC_STAT_H__
@@ -0,0 +1,191 @@
+/**
+ * @file    TestCase_Comm_Udp.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_Udp.h"
+
+namespace
+{
+
+const int EchoReqOpcode = 1;
+const int EchoRspOpcode = 2;
+
+const int ClientCount = 200;
+const int RoundCount = 50;
+const int PayloadSize = 64;
+
+const char *ListenIp = "127.0.0.1";
+const int ListenPort = 7793;
+
+class EchoFacade : public LLBC_IFacade
+{
+public:
+    EchoFacade()
+    : createdSessions(0)
+    , destroyedSessions(0)
+    , recvedRsps(0)
+    {
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        ++createdSessions;
+    }
+
+    virtual void OnSessionDestroy(const LLBC_SessionDestroyInfo &destroyInfo)
+    {
+        ++destroyedSessions;
+    }
+
+public:
+    void OnEchoReq(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(),
+                           EchoRspOpcode,
+                           packet.GetPayload(),
+                           packet.GetPayloadLength(),
+                           0);
+    }
+
+    void OnEchoRsp(LLBC_Packet &packet)
+    {
+        ++recvedRsps;
+    }
+
+public:
+    volatile int createdSessions;
+    volatile int destroyedSessions;
+    volatile int recvedRsps;
+};
+
+}
+
+TestCase_Comm_Udp::TestCase_Comm_Udp()
+{
+}
+
+TestCase_Comm_Udp::~TestCase_Comm_Udp()
+{
+}
+
+int TestCase_Comm_Udp::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service udp datagram session test:");
+
+#if LLBC_CFG_COMM_ENABLE_UDP
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "UdpClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "UdpServer");
+
+    EchoFacade *clientFacade = LLBC_New(EchoFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(EchoRspOpcode, clientFacade, &EchoFacade::OnEchoRsp);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    EchoFacade *serverFacade = LLBC_New(EchoFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(EchoReqOpcode, serverFacade, &EchoFacade::OnEchoReq);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    const int listenSessionId = serverSvc->ListenUdp(ListenIp, ListenPort);
+    if (listenSessionId == 0)
+    {
+        LLBC_PrintLine("Listen udp failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    std::vector<int> sessionIds;
+    for (int i = 0; i < ClientCount; ++i)
+    {
+        const int sessionId = clientSvc->ConnectUdp(ListenIp, ListenPort);
+        if (sessionId == 0)
+        {
+            LLBC_PrintLine("Connect udp failed, error: %s", LLBC_FormatLastError());
+            break;
+        }
+
+        sessionIds.push_back(sessionId);
+    }
+
+    // Every round, all clients send one datagram, the server pseudo-sessions echo back.
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'D', sizeof(payload));
+
+    const int echoCount = ClientCount * RoundCount;
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int round = 0; round < RoundCount && sessionIds.size() == ClientCount; ++round)
+    {
+        for (int i = 0; i < ClientCount; ++i)
+            clientSvc->Send(sessionIds[i], EchoReqOpcode, payload, sizeof(payload), 0);
+
+        const int expectRsps = (round + 1) * ClientCount;
+        for (int i = 0; i < 200 && clientFacade->recvedRsps < expectRsps; ++i)
+            LLBC_Sleep(1);
+    }
+    const sint64 cost = LLBC_GetMicroSeconds() - begTime;
+
+    LLBC_PrintLine("Udp echo, clients: %d, rounds: %d, recved echo responses: %d/%d, cost: %lld us",
+                   ClientCount, RoundCount, clientFacade->recvedRsps, echoCount, cost);
+
+    PrintStat("Client", clientSvc);
+    PrintStat("Server", serverSvc);
+
+    // Remove listen session, all server pseudo-sessions will destroy too.
+    for (size_t i = 0; i < sessionIds.size(); ++i)
+        clientSvc->RemoveSession(sessionIds[i], "Test finished");
+    serverSvc->RemoveSession(listenSessionId, "Test finished");
+    LLBC_Sleep(200);
+
+    LLBC_PrintLine("Session create/destroy, client: %d/%d, server: %d/%d",
+                   clientFacade->createdSessions, clientFacade->destroyedSessions,
+                   serverFacade->createdSessions, serverFacade->destroyedSessions);
+
+    // Datagram is unreliable, but loopback with paced rounds should lost nearly nothing.
+    const bool succeed = clientFacade->recvedRsps >= echoCount * 95 / 100 &&
+                         clientFacade->createdSessions == ClientCount &&
+                         clientFacade->destroyedSessions == ClientCount &&
+                         serverFacade->createdSessions == ClientCount + 1 &&
+                         serverFacade->destroyedSessions == ClientCount + 1;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Udp datagram session test failed");
+        return LLBC_FAILED;
+    }
+#else // !LLBC_CFG_COMM_ENABLE_UDP
+    LLBC_PrintLine("Udp datagram session not enabled, skip test");
+#endif // LLBC_CFG_COMM_ENABLE_UDP
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return LLBC_OK;
+}
+
+void TestCase_Comm_Udp::PrintStat(const char *name, LLBC_IService *svc)
+{
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_ServiceStat stat;
+    svc->GetStat(stat);
+
+    const LLBC_SessionStat &total = stat.total;
+    LLBC_PrintLine("  %s sent %llu packets with %llu sendmmsg() calls, recved %llu packets with %llu recvmmsg() calls",
+                   name, total.sentPackets, total.sendCalls, total.recvedPackets, total.recvCalls);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+}
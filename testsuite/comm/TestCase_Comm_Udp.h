@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Comm_Udp.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library udp datagram session(batch recvmmsg/sendmmsg) test case.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_UDP_H__
+#define __LLBC_TEST_CASE_COMM_UDP_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_Udp : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_Udp();
+    virtual ~TestCase_Comm_Udp();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    void PrintStat(const char *name, LLBC_IService *svc);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_UDP_H__
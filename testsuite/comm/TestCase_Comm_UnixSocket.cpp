@@ -0,0 +1,273 @@
+/**
+ * @file    TestCase_Comm_UnixSocket.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_UnixSocket.h"
+
+namespace
+{
+
+const int EchoReqOpcode = 1;
+const int EchoRspOpcode = 2;
+
+const int EchoCount = 100000;
+const int PayloadSize = 64;
+
+const char *UnixPath = "@llbc_test_unix_socket";
+const char *UnixFilePath = "/tmp/llbc_test_unix_socket.sock";
+const int LoopbackPort = 7792;
+
+struct Transport
+{
+    enum
+    {
+        Loopback,
+        Unix,
+        SocketPair,
+
+        End
+    };
+};
+
+const char *TransportNames[Transport::End] =
+{
+    "Loopback TCP",
+    "Unix domain socket",
+    "Adopted socketpair"
+};
+
+class EchoFacade : public LLBC_IFacade
+{
+public:
+    EchoFacade()
+    : createdSessions(0)
+    , destroyedSessions(0)
+    , unixSessions(0)
+    , recvedRsps(0)
+    {
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        ++createdSessions;
+        if (sessionInfo.GetPeerAddr().GetAddressFamily() == AF_UNIX)
+            ++unixSessions;
+    }
+
+    virtual void OnSessionDestroy(const LLBC_SessionDestroyInfo &destroyInfo)
+    {
+        ++destroyedSessions;
+    }
+
+public:
+    void OnEchoReq(LLBC_Packet &packet)
+    {
+        GetService()->Send(packet.GetSessionId(),
+                           EchoRspOpcode,
+                           packet.GetPayload(),
+                           packet.GetPayloadLength(),
+                           0);
+    }
+
+    void OnEchoRsp(LLBC_Packet &packet)
+    {
+        ++recvedRsps;
+    }
+
+public:
+    volatile int createdSessions;
+    volatile int destroyedSessions;
+    volatile int unixSessions;
+    volatile int recvedRsps;
+};
+
+}
+
+TestCase_Comm_UnixSocket::TestCase_Comm_UnixSocket()
+{
+}
+
+TestCase_Comm_UnixSocket::~TestCase_Comm_UnixSocket()
+{
+}
+
+int TestCase_Comm_UnixSocket::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service unix domain socket test:");
+
+    int ret = LLBC_OK;
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    for (int transport = Transport::Loopback; transport != Transport::End; ++transport)
+    {
+        if ((ret = RunBenchmark(transport)) != LLBC_OK)
+            break;
+    }
+
+    if (ret == LLBC_OK)
+        ret = StaleFileTest();
+#else // !LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    LLBC_PrintLine("Unix domain socket not enabled, skip test");
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_UnixSocket::RunBenchmark(int transport)
+{
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    LLBC_PrintLine("%s echo benchmark, echo count: %d, payload size: %d:",
+                   TransportNames[transport], EchoCount, PayloadSize);
+
+    LLBC_IService *clientSvc = LLBC_IService::Create(LLBC_IService::Normal, "UnixSocketClient");
+    LLBC_IService *serverSvc = LLBC_IService::Create(LLBC_IService::Normal, "UnixSocketServer");
+
+    EchoFacade *clientFacade = LLBC_New(EchoFacade);
+    clientSvc->RegisterFacade(clientFacade);
+    clientSvc->Subscribe(EchoRspOpcode, clientFacade, &EchoFacade::OnEchoRsp);
+    clientSvc->SuppressCoderNotFoundWarning();
+
+    EchoFacade *serverFacade = LLBC_New(EchoFacade);
+    serverSvc->RegisterFacade(serverFacade);
+    serverSvc->Subscribe(EchoReqOpcode, serverFacade, &EchoFacade::OnEchoReq);
+    serverSvc->SuppressCoderNotFoundWarning();
+
+    clientSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    serverSvc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    clientSvc->Start();
+    serverSvc->Start();
+
+    int sessionId = 0;
+    if (transport == Transport::Loopback)
+    {
+        if (serverSvc->Listen("127.0.0.1", LoopbackPort) != 0)
+            sessionId = clientSvc->Connect("127.0.0.1", LoopbackPort);
+    }
+    else if (transport == Transport::Unix)
+    {
+        if (serverSvc->ListenUnix(UnixPath) != 0)
+            sessionId = clientSvc->ConnectUnix(UnixPath);
+    }
+    else
+    {
+        // Simulate the inherited socketpair(eg: fork + exec sidecar), each service adopt one end.
+        LLBC_SocketHandle handles[2];
+        if (LLBC_CreateUnixSocketPair(handles) == LLBC_OK)
+        {
+            if (serverSvc->AdoptSocket(handles[1]) == 0)
+            {
+                LLBC_CloseSocket(handles[0]);
+                LLBC_CloseSocket(handles[1]);
+            }
+            else if ((sessionId = clientSvc->AdoptSocket(handles[0])) == 0)
+            {
+                LLBC_CloseSocket(handles[0]);
+            }
+        }
+    }
+
+    if (sessionId == 0)
+    {
+        LLBC_PrintLine("Create session failed, error: %s", LLBC_FormatLastError());
+        LLBC_Delete(clientSvc);
+        LLBC_Delete(serverSvc);
+
+        return LLBC_FAILED;
+    }
+
+    char payload[PayloadSize];
+    LLBC_MemSet(payload, 'U', sizeof(payload));
+
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < EchoCount; ++i)
+        clientSvc->Send(sessionId, EchoReqOpcode, payload, sizeof(payload), 0);
+
+    for (int i = 0; i < 3000 && clientFacade->recvedRsps < EchoCount; ++i)
+        LLBC_Sleep(5);
+    const sint64 cost = LLBC_GetMicroSeconds() - begTime;
+
+    LLBC_PrintLine("  recved echo responses: %d, cost: %lld us, %.0f echos/s",
+                   clientFacade->recvedRsps, cost, clientFacade->recvedRsps * 1000000.0 / MAX(cost, 1));
+
+    // Remove session, both sides will receive session destroy event(include server listen session).
+    clientSvc->RemoveSession(sessionId, "Test finished");
+    LLBC_Sleep(100);
+
+    LLBC_PrintLine("  session create/destroy, client: %d/%d, server: %d/%d, unix sessions: %d",
+                   clientFacade->createdSessions, clientFacade->destroyedSessions,
+                   serverFacade->createdSessions, serverFacade->destroyedSessions,
+                   clientFacade->unixSessions + serverFacade->unixSessions);
+
+    const int expectUnixSessions = transport == Transport::Loopback ? 0 :
+        (transport == Transport::Unix ? 3 : 2);
+    const bool succeed = clientFacade->recvedRsps == EchoCount &&
+                         clientFacade->createdSessions == 1 && clientFacade->destroyedSessions == 1 &&
+                         serverFacade->destroyedSessions == 1 &&
+                         clientFacade->unixSessions + serverFacade->unixSessions == expectUnixSessions;
+
+    LLBC_Delete(clientSvc);
+    LLBC_Delete(serverSvc);
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Unix domain socket test failed");
+        return LLBC_FAILED;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+    return LLBC_OK;
+}
+
+int TestCase_Comm_UnixSocket::StaleFileTest()
+{
+#if LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+    LLBC_PrintLine("Bind to exist path test:");
+
+    ::unlink(UnixFilePath);
+
+    // Regular file: must not be removed, bind failed.
+    FILE *file = fopen(UnixFilePath, "w");
+    if (file)
+        fclose(file);
+
+    LLBC_SocketHandle handle = LLBC_CreateUnixSocket();
+    const bool regularFileKept = LLBC_BindToUnixPath(handle, UnixFilePath) != LLBC_OK &&
+                                 errno == EADDRINUSE && ::access(UnixFilePath, F_OK) == 0;
+    LLBC_CloseSocket(handle);
+    ::unlink(UnixFilePath);
+
+    // In use socket file: bind failed.
+    LLBC_SocketHandle listener = LLBC_CreateUnixSocket();
+    LLBC_BindToUnixPath(listener, UnixFilePath);
+    LLBC_ListenForConnection(listener, LLBC_CFG_OS_DFT_BACKLOG_SIZE);
+
+    handle = LLBC_CreateUnixSocket();
+    const bool inUseRejected = LLBC_BindToUnixPath(handle, UnixFilePath) != LLBC_OK && errno == EADDRINUSE;
+    LLBC_CloseSocket(handle);
+
+    // Stale socket file(listener closed, file left): removed and bind success.
+    LLBC_CloseSocket(listener);
+    handle = LLBC_CreateUnixSocket();
+    const bool staleRemoved = LLBC_BindToUnixPath(handle, UnixFilePath) == LLBC_OK;
+    LLBC_CloseSocket(handle);
+    ::unlink(UnixFilePath);
+
+    LLBC_PrintLine("  regular file kept: %s, in use socket rejected: %s, stale socket removed: %s",
+                   regularFileKept ? "true" : "false",
+                   inUseRejected ? "true" : "false",
+                   staleRemoved ? "true" : "false");
+
+    if (!regularFileKept || !inUseRejected || !staleRemoved)
+        return LLBC_FAILED;
+#endif // LLBC_CFG_COMM_ENABLE_UNIX_SOCKET
+
+    return LLBC_OK;
+}
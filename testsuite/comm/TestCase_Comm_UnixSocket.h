@@ -0,0 +1,29 @@
+/**
+ * @file    TestCase_Comm_UnixSocket.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The llbc library unix domain socket/socketpair session test case(include benchmark against loopback).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_UNIX_SOCKET_H__
+#define __LLBC_TEST_CASE_COMM_UNIX_SOCKET_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_UnixSocket : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_UnixSocket();
+    virtual ~TestCase_Comm_UnixSocket();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBenchmark(int transport);
+    int StaleFileTest();
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_UNIX_SOCKET_H__
@@ -0,0 +1,315 @@
+/**
+ * @file    TestCase_Com_PoolAllocator.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "common/TestCase_Com_PoolAllocator.h"
+
+namespace
+{
+    const int BenchThreadCount = 4;
+    const int BenchLoopTimes = 2000;
+    const int BenchBatchSize = 256;
+
+    /**
+     * \brief The benchmark thread argument.
+     */
+    struct BenchArg
+    {
+        bool usePool;
+        LLBC_Semaphore finished;
+    };
+
+    /**
+     * The allocate/free benchmark thread proc, each thread allocate a batch of random size
+     * small blocks, then free them.
+     * @param[in] arg - the benchmark argument, see BenchArg.
+     */
+    int BenchThreadProc(void *arg)
+    {
+        BenchArg *benchArg = reinterpret_cast<BenchArg *>(arg);
+        const bool usePool = benchArg->usePool;
+
+        void *blocks[BenchBatchSize];
+        uint32 seed = static_cast<uint32>(reinterpret_cast<size_t>(blocks));
+        for (int loop = 0; loop < BenchLoopTimes; ++loop)
+        {
+            for (int i = 0; i < BenchBatchSize; ++i)
+            {
+                seed = seed * 1103515245 + 12345;
+                const size_t size = 16 + (seed >> 16) % 1008;
+                blocks[i] = usePool ? LLBC_PoolMalloc(size) : malloc(size);
+            }
+
+            for (int i = 0; i < BenchBatchSize; ++i)
+            {
+                if (usePool)
+                    LLBC_PoolFree(blocks[i]);
+                else
+                    free(blocks[i]);
+            }
+        }
+
+        benchArg->finished.Post();
+
+        return 0;
+    }
+
+    /**
+     * Find the tagged stat by tag name.
+     * @param[in] name - the tag name.
+     * @return LLBC_PoolAllocatorTagStat - the tagged stat, if not found, return empty stat.
+     */
+    LLBC_PoolAllocatorTagStat GetTagStat(const char *name)
+    {
+        std::vector<LLBC_PoolAllocatorTagStat> stats;
+        LLBC_GetPoolAllocatorTagStats(stats);
+        for (size_t i = 0; i < stats.size(); ++i)
+        {
+            if (strcmp(stats[i].name, name) == 0)
+                return stats[i];
+        }
+
+        return LLBC_PoolAllocatorTagStat();
+    }
+}
+
+int TestCase_Com_PoolAllocator::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("common/pool allocator test:");
+    LLBC_PrintLine("LLBC_CFG_COM_USE_POOL_ALLOCATOR: %d", LLBC_CFG_COM_USE_POOL_ALLOCATOR);
+
+    if (!BasicTest() || !TagStatTest() || !ArenaTest())
+        return LLBC_FAILED;
+
+    BenchmarkTest();
+    PrintStats();
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return LLBC_OK;
+}
+
+bool TestCase_Com_PoolAllocator::BasicTest()
+{
+    LLBC_PrintLine("Basic test:");
+
+    // Calloc test.
+    unsigned char *mem = reinterpret_cast<unsigned char *>(LLBC_PoolCalloc(100));
+    for (int i = 0; i < 100; ++i)
+    {
+        if (mem[i] != 0)
+        {
+            LLBC_PrintLine("LLBC_PoolCalloc() memory not zero, check your code!");
+            return false;
+        }
+
+        mem[i] = static_cast<unsigned char>(i);
+    }
+
+    // Realloc test(small -> small -> large -> small).
+    const size_t reallocSizes[] = {120, 1000, 100000, 50};
+    for (size_t i = 0; i < sizeof(reallocSizes) / sizeof(reallocSizes[0]); ++i)
+    {
+        mem = reinterpret_cast<unsigned char *>(LLBC_PoolRealloc(mem, reallocSizes[i]));
+        for (int j = 0; j < 50; ++j)
+        {
+            if (mem[j] != static_cast<unsigned char>(j))
+            {
+                LLBC_PrintLine("LLBC_PoolRealloc(%lu) content changed, check your code!", reallocSizes[i]);
+                return false;
+            }
+        }
+    }
+
+    LLBC_PoolFree(mem);
+    LLBC_PoolFree(NULL);
+
+    // Not pool allocated(system allocated) blocks, must pass to system realloc()/free().
+    char *sysMem = reinterpret_cast<char *>(malloc(64));
+    memset(sysMem, 'S', 64);
+    sysMem = reinterpret_cast<char *>(LLBC_PoolRealloc(sysMem, 4096));
+    if (sysMem[0] != 'S' || sysMem[63] != 'S')
+    {
+        LLBC_PrintLine("LLBC_PoolRealloc() system allocated block content changed, check your code!");
+        return false;
+    }
+    LLBC_PoolFree(sysMem);
+
+    LLBC_PrintLine("Basic test success");
+
+    return true;
+}
+
+bool TestCase_Com_PoolAllocator::TagStatTest()
+{
+    LLBC_PrintLine("Tag stat test:");
+
+    const uint32 tag = LLBC_RegisterPoolAllocatorTag("PoolAllocatorTest");
+    if (tag == 0 || LLBC_RegisterPoolAllocatorTag("PoolAllocatorTest") != tag)
+    {
+        LLBC_PrintLine("LLBC_RegisterPoolAllocatorTag() return invalid tag, check your code!");
+        return false;
+    }
+
+    // Tagged allocate/realloc/free, realloc keep tag.
+    void *mem1 = LLBC_PoolTaggedMalloc(100, tag);
+    void *mem2 = LLBC_PoolTaggedMalloc(200, tag);
+    mem1 = LLBC_PoolRealloc(mem1, 1000);
+    LLBC_PoolFree(mem1);
+    LLBC_PoolFree(mem2);
+
+    LLBC_PoolAllocatorTagStat stat = GetTagStat("PoolAllocatorTest");
+    LLBC_PrintLine("    %s: alloc times: %llu, free times: %llu, alloc bytes: %llu",
+                   stat.name, stat.allocTimes, stat.freeTimes, stat.allocBytes);
+    if (stat.allocTimes != 3 || stat.freeTimes != 3 || stat.allocBytes != 1300)
+    {
+        LLBC_PrintLine("Tag stat mismatch, check your code!");
+        return false;
+    }
+
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+    // LLBC_POOL_ALLOCATED_CLASS() classes, LLBC_New/LLBC_Delete tagged by class name.
+    const LLBC_PoolAllocatorTagStat begStat = GetTagStat("LLBC_Packet");
+    LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+    LLBC_Delete(packet);
+
+    stat = GetTagStat("LLBC_Packet");
+    LLBC_PrintLine("    %s: alloc times: %llu, free times: %llu, alloc bytes: %llu",
+                   stat.name, stat.allocTimes, stat.freeTimes, stat.allocBytes);
+    if (stat.allocTimes != begStat.allocTimes + 1 ||
+        stat.freeTimes != begStat.freeTimes + 1 ||
+        stat.allocBytes != begStat.allocBytes + sizeof(LLBC_Packet))
+    {
+        LLBC_PrintLine("LLBC_Packet tag stat mismatch, check your code!");
+        return false;
+    }
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
+    LLBC_PrintLine("Tag stat test success");
+
+    return true;
+}
+
+bool TestCase_Com_PoolAllocator::ArenaTest()
+{
+    LLBC_PrintLine("Arena test:");
+
+    LLBC_PoolArena arena(1024);
+    const uint32 tag = LLBC_RegisterPoolAllocatorTag("PoolArenaTest");
+
+    // Allocate over chunk size, check alignment & content.
+    unsigned char *mems[64];
+    for (int i = 0; i < 64; ++i)
+    {
+        mems[i] = reinterpret_cast<unsigned char *>(arena.Alloc(100, tag));
+        if (!mems[i] || reinterpret_cast<size_t>(mems[i]) % 16 != 0)
+        {
+            LLBC_PrintLine("LLBC_PoolArena::Alloc() return invalid memory, check your code!");
+            return false;
+        }
+
+        LLBC_MemSet(mems[i], i, 100);
+    }
+
+    // Large(over chunk size) allocate.
+    void *largeMem = arena.Alloc(4096);
+    LLBC_MemSet(largeMem, 0xff, 4096);
+
+    for (int i = 0; i < 64; ++i)
+    {
+        if (mems[i][0] != i || mems[i][99] != i)
+        {
+            LLBC_PrintLine("LLBC_PoolArena allocated memory overlapped, check your code!");
+            return false;
+        }
+    }
+
+    // Free arena memory do nothing, realloc arena memory copy to pool.
+    LLBC_PoolFree(mems[0]);
+    unsigned char *reallocMem = reinterpret_cast<unsigned char *>(LLBC_PoolRealloc(mems[1], 200));
+    if (reallocMem[0] != 1 || reallocMem[99] != 1)
+    {
+        LLBC_PrintLine("LLBC_PoolRealloc() arena memory content changed, check your code!");
+        return false;
+    }
+    LLBC_PoolFree(reallocMem);
+
+    const LLBC_PoolAllocatorTagStat stat = GetTagStat("PoolArenaTest");
+    LLBC_PrintLine("    chunks: %lu, used size: %lu, %s: alloc times: %llu, free times: %llu",
+                   arena.GetChunkCount(), arena.GetUsedSize(), stat.name, stat.allocTimes, stat.freeTimes);
+    if (stat.allocTimes != 65 || stat.freeTimes != 3 || arena.GetChunkCount() < 2)
+    {
+        LLBC_PrintLine("Arena stat mismatch, check your code!");
+        return false;
+    }
+
+#if LLBC_CFG_COM_USE_POOL_ALLOCATOR
+    // Placement allocate LLBC_POOL_ALLOCATED_CLASS() class object from arena.
+    LLBC_Packet *packet = new (arena) LLBC_Packet;
+    packet->Write("Hello", 6);
+    LLBC_Delete(packet);
+#endif // LLBC_CFG_COM_USE_POOL_ALLOCATOR
+
+    arena.Reset();
+    if (arena.GetChunkCount() != 1 || arena.GetUsedSize() != 0)
+    {
+        LLBC_PrintLine("LLBC_PoolArena::Reset() not release chunks, check your code!");
+        return false;
+    }
+
+    LLBC_PrintLine("Arena test success");
+
+    return true;
+}
+
+void TestCase_Com_PoolAllocator::BenchmarkTest()
+{
+    LLBC_PrintLine("Benchmark test, threads: %d, loop times: %d, batch size: %d",
+                   BenchThreadCount, BenchLoopTimes, BenchBatchSize);
+
+    for (int usePool = 0; usePool <= 1; ++usePool)
+    {
+        BenchArg arg;
+        arg.usePool = usePool != 0;
+
+        const sint64 begin = LLBC_GetMicroSeconds();
+        LLBC_Handle groupHandle = LLBC_ThreadManagerSingleton->CreateThreads(
+            BenchThreadCount, &BenchThreadProc, &arg);
+        if (groupHandle == LLBC_INVALID_HANDLE)
+        {
+            LLBC_PrintLine("Create benchmark threads failed, reason: %s", LLBC_FormatLastError());
+            return;
+        }
+
+        for (int i = 0; i < BenchThreadCount; ++i)
+            arg.finished.Wait();
+        const sint64 cost = LLBC_GetMicroSeconds() - begin;
+
+        LLBC_ThreadManagerSingleton->WaitGroup(groupHandle);
+
+        LLBC_PrintLine("%s allocate/free cost: %lld us", usePool ? "Pool allocator" : "malloc/free", cost);
+    }
+}
+
+void TestCase_Com_PoolAllocator::PrintStats()
+{
+    std::vector<LLBC_PoolAllocatorStat> stats;
+    LLBC_GetPoolAllocatorStats(stats);
+
+    LLBC_PrintLine("Pool allocator stats:");
+    for (size_t i = 0; i < stats.size(); ++i)
+    {
+        const LLBC_PoolAllocatorStat &stat = stats[i];
+        if (stat.allocTimes == 0)
+            continue;
+
+        LLBC_PrintLine("    block size: %6lu, alloc times: %llu, free times: %llu, alloc bytes: %llu",
+                       stat.blockSize, stat.allocTimes, stat.freeTimes, stat.allocBytes);
+    }
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    TestCase_Com_PoolAllocator.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_TEST_CASE_COM_POOL_ALLOCATOR_H__
+#define __LLBC_TEST_CASE_COM_POOL_ALLOCATOR_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Com_PoolAllocator : public LLBC_BaseTestCase
+{
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    bool BasicTest();
+    bool TagStatTest();
+    bool ArenaTest();
+    void BenchmarkTest();
+    void PrintStats();
+};
+
+#endif // !__LLBC_TEST_CASE_COM_POOL_ALLOCATOR_H__
@@ -69,6 +69,30 @@ int TestCase_Core_Config_Ini::Run(int argc, char *argv[])
         return LLBC_FAILED;
     }
 
+    // Compile ini config to snapshot, and query from snapshot.
+    const LLBC_String snapshotFile = "test_ini.snapshot";
+    LLBC_PrintLine("Compile ini config to snapshot file: %s", snapshotFile.c_str());
+    if (LLBC_ConfigSnapshot::Compile(ini, snapshotFile) != LLBC_OK)
+    {
+        LLBC_PrintLine(
+            "Compile ini config to %s failed, error: %s", snapshotFile.c_str(), LLBC_FormatLastError());
+        return LLBC_FAILED;
+    }
+
+    LLBC_ConfigSnapshot snapshot;
+    if (snapshot.Open(snapshotFile) != LLBC_OK)
+    {
+        LLBC_PrintLine(
+            "Open snapshot file %s failed, error: %s", snapshotFile.c_str(), LLBC_FormatLastError());
+        return LLBC_FAILED;
+    }
+
+    LLBC_PrintLine("Snapshot entry count: %lu", snapshot.GetEntryCount());
+    LLBC_PrintLine("Snapshot [Hello] Cfg1 = %s", snapshot.GetRawValue("Hello", "Cfg1"));
+    LLBC_PrintLine("Snapshot [World] Cfg3 = %s", snapshot.GetValue("World", "Cfg3").AsStr().c_str());
+    LLBC_PrintLine("Snapshot [NewSection] Cfg1 = %d", snapshot.GetValue("NewSection", "Cfg1").AsInt32());
+    LLBC_PrintLine("Snapshot has [World] NotExist key: %s", snapshot.IsHasKey("World", "NotExist") ? "true" : "false");
+
     LLBC_PrintLine("Press any key to continue ...");
     getchar();
 
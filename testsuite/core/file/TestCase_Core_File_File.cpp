@@ -50,6 +50,12 @@ int TestCase_Core_File_File::Run(int argc, char *argv[])
         if (!MoveFileTest())
             break;
 
+        if (!MapFileTest())
+            break;
+
+        if (!BulkIOTest())
+            break;
+
         retCode = LLBC_OK;
     } while (0);
 
@@ -440,6 +446,139 @@ bool TestCase_Core_File_File::MoveFileTest()
     return true;
 }
 
+bool TestCase_Core_File_File::MapFileTest()
+{
+    LLBC_PrintLine("Map file test:");
+
+    LLBC_File file(_testFileName, LLBC_FileMode::BinaryReadWrite);
+    if (!file.IsOpened())
+    {
+        LLBC_PrintLine("Open test file[%s] failed, error: %s", _testFileName.c_str(), LLBC_FormatLastError());
+        return false;
+    }
+
+    LLBC_PrintLine("test file[name: %s, will map] opened, write line string: Hello World!", _testFileName.c_str());
+    file.WriteLine("Hello World");
+
+    LLBC_MappedFile mappedFile;
+    if (file.Map(mappedFile) != LLBC_OK)
+    {
+        LLBC_PrintLine("Map file failed, error: %s", LLBC_FormatLastError());
+        return false;
+    }
+
+    const LLBC_String content(mappedFile.GetData(), mappedFile.GetSize());
+    LLBC_PrintLine("File mapped, size: %lu, content: %s", mappedFile.GetSize(), content.c_str());
+    if (content != file.ReadToEnd(_testFileName))
+    {
+        LLBC_PrintLine("Mapped content not equal to file content, check your code!");
+        return false;
+    }
+
+    LLBC_PrintLine("Map file again(mapped file already opened):");
+    if (file.Map(mappedFile) == LLBC_OK)
+    {
+        LLBC_PrintLine("Map success, failed. check your code!");
+        return false;
+    }
+    else
+    {
+        LLBC_PrintLine("Map failed, error: %s, right!", LLBC_FormatLastError());
+    }
+
+    LLBC_PrintLine("");
+
+    return true;
+}
+
+bool TestCase_Core_File_File::BulkIOTest()
+{
+    LLBC_PrintLine("Bulk io test:");
+
+    LLBC_File file(_testFileName, LLBC_FileMode::BinaryReadWrite);
+    if (!file.IsOpened())
+    {
+        LLBC_PrintLine("Open test file[%s] failed, error: %s", _testFileName.c_str(), LLBC_FormatLastError());
+        return false;
+    }
+
+    // Not block size aligned, make last block is short block.
+    const size_t dataSize = 3 * LLBC_CFG_CORE_FILE_BULK_IO_BLOCK_SIZE * LLBC_CFG_CORE_FILE_BULK_IO_QUEUE_DEPTH + 1234;
+    LLBC_String data;
+    data.resize(dataSize);
+    for (size_t i = 0; i < dataSize; ++i)
+        data[i] = static_cast<char>((i * 131) ^ (i >> 13));
+
+    sint64 begTime = LLBC_GetMicroSeconds();
+    const sint64 wrote = file.BulkWrite(data.data(), data.size(), 0);
+    LLBC_PrintLine("Bulk write %lu bytes, wrote: %lld, cost: %lld us",
+                   dataSize, wrote, LLBC_GetMicroSeconds() - begTime);
+    if (wrote != static_cast<sint64>(dataSize))
+    {
+        LLBC_PrintLine("Bulk write failed, error: %s", LLBC_FormatLastError());
+        return false;
+    }
+
+    LLBC_String readData;
+    readData.resize(dataSize);
+    begTime = LLBC_GetMicroSeconds();
+    const sint64 read = file.BulkRead(const_cast<char *>(readData.data()), readData.size(), 0);
+    LLBC_PrintLine("Bulk read %lu bytes, read: %lld, cost: %lld us",
+                   dataSize, read, LLBC_GetMicroSeconds() - begTime);
+    if (read != static_cast<sint64>(dataSize) || memcmp(readData.data(), data.data(), dataSize) != 0)
+    {
+        LLBC_PrintLine("Bulk read data not equal to written data, check your code!");
+        return false;
+    }
+
+    // Read at unaligned offset and beyond end of file.
+    const sint64 offset = LLBC_CFG_CORE_FILE_BULK_IO_BLOCK_SIZE + 17;
+    const sint64 tailRead = file.BulkRead(const_cast<char *>(readData.data()), readData.size(), offset);
+    LLBC_PrintLine("Bulk read from offset %lld(beyond end of file), read: %lld", offset, tailRead);
+    if (tailRead != static_cast<sint64>(dataSize) - offset ||
+        memcmp(readData.data(), data.data() + offset, static_cast<size_t>(tailRead)) != 0)
+    {
+        LLBC_PrintLine("Bulk read beyond end of file failed, check your code!");
+        return false;
+    }
+
+    // Bulk io not change file position.
+    if (file.GetFilePosition() != 0)
+    {
+        LLBC_PrintLine("Bulk io changed file position, check your code!");
+        return false;
+    }
+
+    file.Close();
+    const LLBC_String content = LLBC_File::ReadToEnd(_testFileName);
+    if (content.size() != dataSize || memcmp(content.data(), data.data(), dataSize) != 0)
+    {
+        LLBC_PrintLine("ReadToEnd content not equal to written data, check your code!");
+        return false;
+    }
+
+    // Append mode bulk write.
+    LLBC_File appendFile(_testFileName, LLBC_FileMode::BinaryAppendWrite);
+    if (appendFile.BulkWrite(data.data(), data.size(), 0) != static_cast<sint64>(dataSize) ||
+        appendFile.GetFileSize() != static_cast<long>(dataSize * 2))
+    {
+        LLBC_PrintLine("Append mode bulk write failed, check your code!");
+        return false;
+    }
+
+    appendFile.Close();
+    const LLBC_String appended = LLBC_File::ReadToEnd(_testFileName);
+    if (appended.size() != dataSize * 2 || memcmp(appended.data() + dataSize, data.data(), dataSize) != 0)
+    {
+        LLBC_PrintLine("Append mode bulk written data error, check your code!");
+        return false;
+    }
+
+    LLBC_PrintLine("");
+
+    return true;
+}
+
 void TestCase_Core_File_File::PrintFileAttributes(const LLBC_FileAttributes &fileAttrs)
 {
     LLBC_PrintLine("    Readable: %s", fileAttrs.readable ? "true" : "false");
@@ -29,6 +29,8 @@ private:
     bool FileAttributeTest();
     bool CopyFileTest();
     bool MoveFileTest();
+    bool MapFileTest();
+    bool BulkIOTest();
 
 private:
     void PrintFileAttributes(const LLBC_FileAttributes &fileAttrs);
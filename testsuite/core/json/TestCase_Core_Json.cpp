@@ -0,0 +1,453 @@
+/**
+ * @file    TestCase_Core_Json.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/json/TestCase_Core_Json.h"
+
+namespace
+{
+    // Strings inserted into escape test strings, cover escaped chars, control chars and UTF-8 sequences.
+    const char *__escapeSpecials[] = {
+        "\"", "\\", "/", "\b", "\f", "\n", "\r", "\t", "\x01", "\x1f",
+        "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80"
+    };
+
+    // Parse document by Reader(structural fast path), Reader(scalar path, forced by a trailing comment) and Document.
+    bool __ParseAll(const std::string &doc, Json::Value &fastRoot, Json::Value &scalarRoot, Json::Document &document)
+    {
+        Json::Reader reader;
+        if (!reader.parse(doc, fastRoot, false))
+        {
+            LLBC_PrintLine("Reader parse failed: %s", reader.getFormatedErrorMessages().c_str());
+            return false;
+        }
+
+        if (!reader.parse(doc + "\n// force scalar parse", scalarRoot, false))
+        {
+            LLBC_PrintLine("Reader(scalar) parse failed: %s", reader.getFormatedErrorMessages().c_str());
+            return false;
+        }
+
+        if (!document.parse(doc))
+        {
+            LLBC_PrintLine("Document parse failed: %s, offset: %u",
+                           document.getErrorMessage().c_str(), document.getErrorOffset());
+            return false;
+        }
+
+        return true;
+    }
+
+    // Build a json document with key/value string raw, padded by pad leading spaces.
+    std::string __BuildEscapeDoc(const std::string &raw, size_t pad)
+    {
+        Json::Value root(Json::objectValue);
+        root[raw] = raw;
+        root["array"].append(raw);
+        root["array"].append(raw + raw);
+
+        return std::string(pad, ' ') + Json::FastWriter().write(root);
+    }
+
+    bool __CheckEscapeDoc(const std::string &raw, size_t pad)
+    {
+        const std::string doc = __BuildEscapeDoc(raw, pad);
+
+        Json::Value fastRoot, scalarRoot;
+        Json::Document document;
+        if (!__ParseAll(doc, fastRoot, scalarRoot, document))
+            return false;
+
+        if (!(fastRoot == scalarRoot) ||
+            fastRoot[raw].asString() != raw ||
+            fastRoot["array"][1u].asString() != raw + raw)
+        {
+            LLBC_PrintLine("Reader result mismatch, doc: %s", doc.c_str());
+            return false;
+        }
+
+        const Json::Document::Node docRoot = document.root();
+        if (docRoot[raw].asString() != raw ||
+            docRoot[raw].stringLength() != raw.size() ||
+            docRoot["array"][1u].asString() != raw + raw)
+        {
+            LLBC_PrintLine("Document result mismatch, doc: %s", doc.c_str());
+            return false;
+        }
+
+        Json::Value converted;
+        Json::Document::toValue(docRoot, converted);
+        if (!(converted == fastRoot))
+        {
+            LLBC_PrintLine("Document::toValue() result mismatch, doc: %s", doc.c_str());
+            return false;
+        }
+
+        // Styled writer output must parse back to same value.
+        Json::Value styledRoot;
+        if (!Json::Reader().parse(Json::StyledWriter().write(fastRoot), styledRoot, false) ||
+            !(styledRoot == fastRoot))
+        {
+            LLBC_PrintLine("Styled round trip mismatch, doc: %s", doc.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    struct __NumberCase
+    {
+        const char *text;
+        Json::ValueType type;
+        Json::Document::NodeType nodeType;
+    };
+}
+
+TestCase_Core_Json::TestCase_Core_Json()
+{
+}
+
+TestCase_Core_Json::~TestCase_Core_Json()
+{
+}
+
+int TestCase_Core_Json::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/json test:");
+
+    int ret = LLBC_FAILED;
+    if (EscapeTest() != LLBC_OK)
+        LLBC_PrintLine("Escape test failed");
+    else if (NumberTest() != LLBC_OK)
+        LLBC_PrintLine("Number test failed");
+    else if (CompatTest() != LLBC_OK)
+        LLBC_PrintLine("Compat test failed");
+    else if (CursorTest() != LLBC_OK)
+        LLBC_PrintLine("Cursor test failed");
+    else if (Benchmark() != LLBC_OK)
+        LLBC_PrintLine("Benchmark failed");
+    else
+        ret = LLBC_OK;
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Core_Json::EscapeTest()
+{
+    LLBC_PrintLine("Escape round trip test:");
+
+    // Insert every special at every position of strings with length [0, 70), padded by [0, 16) spaces,
+    // so special chars cross the 16 bytes(SSE2 lane) and 64 bytes(scan block) boundaries.
+    size_t docCount = 0;
+    for (size_t s = 0; s < sizeof(__escapeSpecials) / sizeof(__escapeSpecials[0]); ++s)
+    {
+        for (size_t len = 0; len < 70; ++len)
+        {
+            for (size_t pos = 0; pos <= len; ++pos)
+            {
+                std::string raw(len, 'a');
+                raw.insert(pos, __escapeSpecials[s]);
+                if (!__CheckEscapeDoc(raw, (len + pos) % 16))
+                    return LLBC_FAILED;
+
+                ++docCount;
+            }
+        }
+    }
+
+    // Backslash runs crossing the 64 bytes block boundary(odd/even backslash carry).
+    for (size_t pad = 0; pad < 80; ++pad)
+    {
+        for (size_t backslashes = 1; backslashes < 8; ++backslashes)
+        {
+            const std::string raw = std::string(backslashes, '\\') + "\"x";
+            if (!__CheckEscapeDoc(raw, pad))
+                return LLBC_FAILED;
+
+            ++docCount;
+        }
+    }
+
+    // \u escapes, include surrogate pair.
+    const char *unicodeDoc = "[\"\\u0041\\u00e9\\u4e2d\\ud83d\\ude00\", \"\\u0000\"]";
+    Json::Value fastRoot, scalarRoot;
+    Json::Document document;
+    if (!__ParseAll(unicodeDoc, fastRoot, scalarRoot, document))
+        return LLBC_FAILED;
+    if (fastRoot[0u].asString() != "A\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80" ||
+        document.root()[0u].asString() != fastRoot[0u].asString() ||
+        document.root()[1u].stringLength() != 1)
+    {
+        LLBC_PrintLine("\\u escape decode mismatch");
+        return LLBC_FAILED;
+    }
+
+    LLBC_PrintLine("Escape round trip test finished, documents: %lu", docCount);
+    LLBC_PrintLine("");
+
+    return LLBC_OK;
+}
+
+int TestCase_Core_Json::NumberTest()
+{
+    LLBC_PrintLine("Number test:");
+
+    const __NumberCase cases[] = {
+        {"0", Json::intValue, Json::Document::int64Node},
+        {"-123", Json::intValue, Json::Document::int64Node},
+        {"2147483647", Json::intValue, Json::Document::int64Node},
+        {"3000000000", Json::uintValue, Json::Document::int64Node},
+        {"4294967295", Json::longValue, Json::Document::int64Node},
+        {"-2147483648", Json::longValue, Json::Document::int64Node},
+        {"9223372036854775807", Json::longValue, Json::Document::int64Node},
+        {"-9223372036854775808", Json::realValue, Json::Document::int64Node},
+        {"10000000000000000000", Json::ulongValue, Json::Document::uint64Node},
+        {"18446744073709551615", Json::realValue, Json::Document::uint64Node},
+        {"18446744073709551616", Json::realValue, Json::Document::doubleNode},
+        {"1.5", Json::realValue, Json::Document::doubleNode},
+        {"-0.25e-3", Json::realValue, Json::Document::doubleNode},
+        {"1E+3", Json::realValue, Json::Document::doubleNode}
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        const __NumberCase &numCase = cases[i];
+        const std::string doc = LLBC_String().format("[%s]", numCase.text);
+
+        Json::Value fastRoot, scalarRoot;
+        Json::Document document;
+        if (!__ParseAll(doc, fastRoot, scalarRoot, document))
+            return LLBC_FAILED;
+
+        const Json::Value &fastValue = fastRoot[0u];
+        const Json::Value &scalarValue = scalarRoot[0u];
+        const Json::Document::Node node = document.root()[0u];
+        LLBC_PrintLine("%s: reader type: %d, scalar reader type: %d, node type: %d, value: %s",
+                       numCase.text, fastValue.type(), scalarValue.type(), node.type(),
+                       LLBC_Trim(fastValue.toStyledString()).c_str());
+
+        if (fastValue.type() != numCase.type ||
+            scalarValue.type() != numCase.type ||
+            node.type() != numCase.nodeType ||
+            !(fastValue == scalarValue) ||
+            node.asDouble() != fastValue.asDouble())
+        {
+            LLBC_PrintLine("Number type/value mismatch: %s", numCase.text);
+            return LLBC_FAILED;
+        }
+    }
+
+    LLBC_PrintLine("");
+
+    return LLBC_OK;
+}
+
+int TestCase_Core_Json::CompatTest()
+{
+    LLBC_PrintLine("Compat test(documents fallback to scalar parse):");
+
+    // Documents rejected by structural parse but accepted by Reader before.
+    const char *lenientDocs[] = {
+        "// comment\n{\"a\": 1}",
+        "{\"a\": /* comment */ 1}",
+        "[\"raw\tcontrol\x01 chars\"]",
+        "[\"invalid utf-8: \xff\xfe\"]",
+        "[01]",
+        "[1] trailing content"
+    };
+
+    for (size_t i = 0; i < sizeof(lenientDocs) / sizeof(lenientDocs[0]); ++i)
+    {
+        const std::string doc = lenientDocs[i];
+
+        Json::Document document;
+        if (document.parse(doc))
+        {
+            LLBC_PrintLine("Document parse should failed: %s", doc.c_str());
+            return LLBC_FAILED;
+        }
+
+        Json::Value root, scalarRoot;
+        Json::Reader reader;
+        if (!reader.parse(doc, root) ||
+            !reader.parse(doc + "\n// force scalar parse", scalarRoot) ||
+            !(root == scalarRoot))
+        {
+            LLBC_PrintLine("Reader parse result changed: %s", doc.c_str());
+            return LLBC_FAILED;
+        }
+
+        LLBC_PrintLine("%s -> Document error: %s, Reader: %s",
+                       doc.c_str(), document.getErrorMessage().c_str(), LLBC_Trim(Json::FastWriter().write(root)).c_str());
+    }
+
+    // Comments still collected.
+    Json::Value commentRoot;
+    if (!Json::Reader().parse("// before\n{\"a\": 1}", commentRoot, true) ||
+        !commentRoot.hasComment(Json::commentBefore))
+    {
+        LLBC_PrintLine("Comment not collected");
+        return LLBC_FAILED;
+    }
+
+    // Reader error messages unchanged.
+    Json::Value root;
+    Json::Reader reader;
+    if (reader.parse("{\"a\" 1}", root) ||
+        reader.getFormatedErrorMessages().find("Missing ':' after object member name") == std::string::npos)
+    {
+        LLBC_PrintLine("Reader error message changed: %s", reader.getFormatedErrorMessages().c_str());
+        return LLBC_FAILED;
+    }
+
+    Json::Reader strictReader(Json::Features::strictMode());
+    if (strictReader.parse("123", root) ||
+        strictReader.getFormatedErrorMessages().find("must be either an array or an object") == std::string::npos)
+    {
+        LLBC_PrintLine("Strict root not checked");
+        return LLBC_FAILED;
+    }
+
+    LLBC_PrintLine("");
+
+    return LLBC_OK;
+}
+
+int TestCase_Core_Json::CursorTest()
+{
+    LLBC_PrintLine("Cursor test:");
+
+    const std::string doc =
+        "{\"server\": {\"name\": \"game\\u0031\", \"port\": 7788, \"ratio\": 0.5, \"debug\": false},"
+        " \"players\": [{\"id\": 1, \"name\": \"alice\"}, {\"id\": 18446744073709551615, \"name\": \"bob\"}],"
+        " \"k\\u0065y\": null, \"dup\": 1, \"dup\": 2}";
+
+    Json::Cursor cursor;
+    if (!cursor.reset(doc))
+    {
+        LLBC_PrintLine("Cursor reset failed: %s", cursor.getErrorMessage().c_str());
+        return LLBC_FAILED;
+    }
+
+    const Json::Cursor::Element root = cursor.root();
+
+    std::string name;
+    Json::LongLong port = 0, dup = 0;
+    Json::ULongLong bigId = 0;
+    double ratio = 0.0;
+    bool debug = true;
+    if (!root["server"]["name"].getString(name) || name != "game1" ||
+        !root["server"]["port"].getInt64(port) || port != 7788 ||
+        !root["server"]["ratio"].getDouble(ratio) || ratio != 0.5 ||
+        !root["server"]["debug"].getBool(debug) || debug ||
+        !root["players"][1u]["id"].getUInt64(bigId) || bigId != Json::Value::maxULong ||
+        root["players"][1u]["id"].type() != Json::Document::uint64Node ||
+        !root["players"][1u]["name"].getString(name) || name != "bob" ||
+        !root["key"].isNull() ||
+        !root["dup"].getInt64(dup) || dup != 1)
+    {
+        LLBC_PrintLine("Cursor lookup result mismatch");
+        return LLBC_FAILED;
+    }
+
+    if (root.size() != 5 || root["players"].size() != 2 ||
+        root["players"][2u].isValid() || root["notExist"].isValid() ||
+        root["server"]["port"].getString(name))
+    {
+        LLBC_PrintLine("Cursor invalid access check failed");
+        return LLBC_FAILED;
+    }
+
+    // Mismatched brackets.
+    if (cursor.reset("{\"a\": [1, 2}"))
+    {
+        LLBC_PrintLine("Cursor reset should failed");
+        return LLBC_FAILED;
+    }
+
+    LLBC_PrintLine("Cursor reset mismatched document, error: %s", cursor.getErrorMessage().c_str());
+    LLBC_PrintLine("");
+
+    return LLBC_OK;
+}
+
+int TestCase_Core_Json::Benchmark()
+{
+    LLBC_PrintLine("Benchmark:");
+
+    // Build ~4MB document.
+    Json::Value root(Json::objectValue);
+    Json::Value &players = root["players"];
+    for (int i = 0; i < 20000; ++i)
+    {
+        Json::Value &player = players.append(Json::Value(Json::objectValue));
+        player["id"] = i;
+        player["name"] = LLBC_String().format("player_%d \"\xe4\xb8\xad\"\n", i);
+        player["score"] = i * 1.25;
+        player["online"] = (i % 2 == 0);
+        player["items"].append(i);
+        player["items"].append(i * 3);
+        player["items"].append("item");
+    }
+
+    const std::string doc = Json::FastWriter().write(root);
+    const double docMB = doc.size() / 1024.0 / 1024.0;
+    const int loops = 10;
+
+    Json::Reader reader;
+    Json::Value readerRoot;
+    sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < loops; ++i)
+        reader.parse(doc, readerRoot, false);
+    sint64 usedTime = MAX(LLBC_GetMicroSeconds() - begTime, 1);
+    LLBC_PrintLine("Reader parse: %.2f MB/s", docMB * loops * 1000000.0 / usedTime);
+
+    Json::Document document;
+    begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < loops; ++i)
+        document.parse(doc);
+    usedTime = MAX(LLBC_GetMicroSeconds() - begTime, 1);
+    LLBC_PrintLine("Document parse: %.2f MB/s", docMB * loops * 1000000.0 / usedTime);
+
+    Json::Cursor cursor;
+    std::string name;
+    begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < loops; ++i)
+    {
+        cursor.reset(doc);
+        cursor.root()["players"][19999u]["name"].getString(name);
+    }
+    usedTime = MAX(LLBC_GetMicroSeconds() - begTime, 1);
+    LLBC_PrintLine("Cursor reset + lookup: %.2f MB/s", docMB * loops * 1000000.0 / usedTime);
+
+    std::string written;
+    begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < loops; ++i)
+        written = Json::FastWriter().write(readerRoot);
+    usedTime = MAX(LLBC_GetMicroSeconds() - begTime, 1);
+    LLBC_PrintLine("FastWriter write: %.2f MB/s", docMB * loops * 1000000.0 / usedTime);
+
+    begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < loops; ++i)
+        written = Json::StyledWriter().write(readerRoot);
+    usedTime = MAX(LLBC_GetMicroSeconds() - begTime, 1);
+    LLBC_PrintLine("StyledWriter write: %.2f MB/s", docMB * loops * 1000000.0 / usedTime);
+
+    if (!(readerRoot == root) || document.root()["players"].size() != 20000)
+    {
+        LLBC_PrintLine("Benchmark parse result mismatch");
+        return LLBC_FAILED;
+    }
+
+    LLBC_PrintLine("");
+
+    return LLBC_OK;
+}
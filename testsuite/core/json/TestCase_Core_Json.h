@@ -0,0 +1,32 @@
+/**
+ * @file    TestCase_Core_Json.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_TEST_CASE_CORE_JSON_H__
+#define __LLBC_TEST_CASE_CORE_JSON_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Json : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Json();
+    virtual ~TestCase_Core_Json();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int EscapeTest();
+    int NumberTest();
+    int CompatTest();
+    int CursorTest();
+    int Benchmark();
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_JSON_H__
@@ -89,6 +89,16 @@ int TestCase_Core_Log::Run(int argc, char *argv[])
     LLBC_FATAL_LOG_SPEC("test", "This is a fatal log message.");
     LLBC_FATAL_LOG_SPEC2("test", "test_tag", "This is a fatal log message.");
 
+    // Binary log test, root logger not enable binary mode, will fallback to normal format output.
+    LLBC_DEBUG_BLOG("This is a debug binary log message, int: %d, str: %s", 1, "hello");
+    LLBC_INFO_BLOG2("test_tag", "This is a info binary log message, sint64: %lld, double: %.3f", (sint64)-64, 2.0);
+
+    // Binary log file test, decode binary log file by tools/blog_decoder.py.
+    LLBC_INFO_BLOG_SPEC("binfiletest", "This is a binary log message, char: %c, uint32: %u, hex: %08x, ptr: %p",
+        'a', (uint32)32, 255, (void *)&argc);
+    LLBC_WARN_BLOG_SPEC2("binfiletest", "test_tag", "Binary log width/precision test: [%*d] [%.*f] [%-8s]",
+        6, 42, 2, 3.14159, "str");
+
     // Log file delete test.
     for (int i = 0; i < 20; i++)
     {
@@ -96,6 +106,18 @@ int TestCase_Core_Log::Run(int argc, char *argv[])
         LLBC_ThreadManager::Sleep(1000);
     }
 
+    // Peform binary log performance test.
+    LLBC_PrintLine("Perform binary log preformance test:");
+    const int binLoopLmt = 500000;
+    LLBC_CPUTime binBegin = LLBC_CPUTime::Current();
+    for (int i = 0; i < binLoopLmt; i++)
+        LLBC_DEBUG_BLOG_SPEC("binperftest", "binary performance test msg, idx: %d, str: %s", i, "perf");
+
+    LLBC_CPUTime binElapsed = LLBC_CPUTime::Current() - binBegin;
+    LLBC_PrintLine("Binary performance test completed, "
+        "log size:%d, elapsed time: %s, dropped: %lld", binLoopLmt, binElapsed.ToString().c_str(),
+        LLBC_LoggerManagerSingleton->GetLogger("binperftest")->GetBinaryDroppedCount());
+
     // Peform performance test.
     LLBC_PrintLine("Perform preformance test:");
     LLBC_CPUTime begin = LLBC_CPUTime::Current();
@@ -0,0 +1,238 @@
+/**
+ * @file    TestCase_Core_Log_NetworkAppender.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/log/TestCase_Core_Log_NetworkAppender.h"
+
+namespace
+{
+    const char *CollectorIp = "127.0.0.1";
+    const uint16 CollectorPort = 17890;
+
+    /**
+     * \brief The log collector stand-in, receive network appender frames and count records.
+     */
+    class LogCollector : public LLBC_BaseTask
+    {
+    public:
+        LogCollector()
+        : _stop(false)
+        , _paused(false)
+        , _listenSock(LLBC_INVALID_SOCKET_HANDLE)
+        , _frames(0)
+        , _records(0)
+        , _reportedDropped(0)
+        {
+        }
+
+        virtual ~LogCollector()
+        {
+        }
+
+    public:
+        int Listen()
+        {
+            _listenSock = LLBC_CreateTcpSocket();
+            if (_listenSock == LLBC_INVALID_SOCKET_HANDLE)
+                return LLBC_FAILED;
+
+            LLBC_EnableAddressReusable(_listenSock);
+            if (LLBC_BindToAddress(_listenSock, CollectorIp, CollectorPort) != LLBC_OK ||
+                LLBC_ListenForConnection(_listenSock, 5) != LLBC_OK ||
+                LLBC_SetNonBlocking(_listenSock) != LLBC_OK)
+            {
+                LLBC_CloseSocket(_listenSock);
+                return LLBC_FAILED;
+            }
+
+            return LLBC_OK;
+        }
+
+        void Stop() { _stop = true; }
+        void SetPaused(bool paused) { _paused = paused; }
+
+        sint64 GetFrames() const { return _frames; }
+        sint64 GetRecords() const { return _records; }
+        sint64 GetReportedDropped() const { return _reportedDropped; }
+
+    public:
+        virtual void Svc()
+        {
+            LLBC_SocketHandle sock = LLBC_INVALID_SOCKET_HANDLE;
+            LLBC_String buf;
+            char recvBuf[65536];
+            while (!_stop)
+            {
+                if (sock == LLBC_INVALID_SOCKET_HANDLE)
+                {
+                    if ((sock = LLBC_AcceptClient(_listenSock)) == LLBC_INVALID_SOCKET_HANDLE)
+                    {
+                        LLBC_Sleep(1);
+                        continue;
+                    }
+
+                    LLBC_SetNonBlocking(sock);
+                }
+
+                // Paused collector simulate slow collector.
+                int recvLen;
+                if (_paused || (recvLen = LLBC_Recv(sock, recvBuf, sizeof(recvBuf), 0)) < 0)
+                {
+                    LLBC_Sleep(1);
+                    continue;
+                }
+                else if (recvLen == 0)
+                {
+                    LLBC_CloseSocket(sock);
+                    sock = LLBC_INVALID_SOCKET_HANDLE;
+                    buf.clear();
+
+                    continue;
+                }
+
+                buf.append(recvBuf, recvLen);
+                ParseFrames(buf);
+            }
+
+            if (sock != LLBC_INVALID_SOCKET_HANDLE)
+                LLBC_CloseSocket(sock);
+            LLBC_CloseSocket(_listenSock);
+        }
+
+        virtual void Cleanup()
+        {
+        }
+
+    private:
+        void ParseFrames(LLBC_String &buf)
+        {
+            size_t pos = 0;
+            while (buf.size() - pos >= sizeof(uint32) * 2)
+            {
+                uint32 frameHead[2];
+                memcpy(frameHead, buf.data() + pos, sizeof(frameHead));
+
+                const uint32 frameLen = LLBC_Net2Host2(frameHead[0]);
+                uint32 records = LLBC_Net2Host2(frameHead[1]);
+                if (buf.size() - pos < frameLen)
+                    break;
+
+                // Dropped records report record, format: "LLBC_LogNetworkAppender: <count> log records dropped".
+                const LLBC_String frame = buf.substr(pos + sizeof(frameHead), frameLen - sizeof(frameHead));
+                const LLBC_String::size_type reportPos = frame.find("log records dropped");
+                if (reportPos != LLBC_String::npos)
+                {
+                    const LLBC_String::size_type countPos = frame.rfind(':', reportPos);
+                    _reportedDropped += LLBC_Str2Int64(frame.c_str() + countPos + 1);
+                    records -= 1;
+                }
+
+                _frames += 1;
+                _records += records;
+
+                pos += frameLen;
+            }
+
+            buf.erase(0, pos);
+        }
+
+    private:
+        volatile bool _stop;
+        volatile bool _paused;
+        LLBC_SocketHandle _listenSock;
+
+        volatile sint64 _frames;
+        volatile sint64 _records;
+        volatile sint64 _reportedDropped;
+    };
+}
+
+TestCase_Core_Log_NetworkAppender::TestCase_Core_Log_NetworkAppender()
+{
+}
+
+TestCase_Core_Log_NetworkAppender::~TestCase_Core_Log_NetworkAppender()
+{
+}
+
+int TestCase_Core_Log_NetworkAppender::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/log/network appender test:");
+
+    // Initialize logger manager before collector startup, network appender will reconnect.
+    if (LLBC_LoggerManagerSingleton->Initialize("Logger_Cfg.cfg") != LLBC_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Initialize logger manager failed, err: %s", LLBC_FormatLastError());
+        LLBC_FilePrintLine(stderr, "Forgot copy Logger_Cfg.cfg test config file to CWD?");
+        return -1;
+    }
+
+    const int beforeCollector = 100;
+    for (int i = 0; i < beforeCollector; ++i)
+        LLBC_INFO_LOG_SPEC("nettest", "Log message before collector startup, idx: " <<i);
+
+    LogCollector *collector = new LogCollector;
+    if (collector->Listen() != LLBC_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Collector listen failed, err: %s", LLBC_FormatLastError());
+        LLBC_LoggerManagerSingleton->Finalize();
+        delete collector;
+
+        return -1;
+    }
+
+    collector->Activate();
+
+    LLBC_ThreadManager::Sleep(2000);
+    LLBC_PrintLine("Reconnect test, logged: %d, collector received: %lld",
+                   beforeCollector, collector->GetRecords());
+
+    // Batch test.
+    const int batchCount = 100000;
+    LLBC_CPUTime begin = LLBC_CPUTime::Current();
+    for (int i = 0; i < batchCount; ++i)
+        LLBC_INFO_LOG_SPEC("nettest", "Batch log message, idx: " <<i);
+    LLBC_CPUTime elapsed = LLBC_CPUTime::Current() - begin;
+
+    LLBC_ThreadManager::Sleep(2000);
+    LLBC_PrintLine("Batch test, logged: %d, elapsed: %s, collector received: %lld(frames: %lld), reported dropped: %lld",
+                   batchCount, elapsed.ToString().c_str(), collector->GetRecords(),
+                   collector->GetFrames(), collector->GetReportedDropped());
+
+    // Slow collector test, logger never block, records dropped and reported to collector after collector resume.
+    collector->SetPaused(true);
+    begin = LLBC_CPUTime::Current();
+    for (int i = 0; i < batchCount; ++i)
+        LLBC_INFO_LOG_SPEC("nettest", "Slow collector log message, idx: " <<i);
+    elapsed = LLBC_CPUTime::Current() - begin;
+
+    LLBC_ThreadManager::Sleep(1000);
+    collector->SetPaused(false);
+    LLBC_ThreadManager::Sleep(1000);
+
+    LLBC_INFO_LOG_SPEC("nettest", "Slow collector test finished");
+    LLBC_ThreadManager::Sleep(1000);
+
+    const sint64 totalLogged = beforeCollector + batchCount * 2 + 1;
+    const sint64 totalAccounted = collector->GetRecords() + collector->GetReportedDropped();
+    LLBC_PrintLine("Slow collector test, elapsed: %s, total logged: %lld, "
+                   "collector received: %lld, reported dropped: %lld, %s",
+                   elapsed.ToString().c_str(), totalLogged, collector->GetRecords(),
+                   collector->GetReportedDropped(), totalAccounted == totalLogged ? "all accounted" : "MISMATCH");
+
+    LLBC_LoggerManagerSingleton->Finalize();
+
+    collector->Stop();
+    collector->Wait();
+    delete collector;
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return totalAccounted == totalLogged ? 0 : -1;
+}
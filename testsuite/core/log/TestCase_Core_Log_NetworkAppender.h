@@ -0,0 +1,25 @@
+/**
+ * @file    TestCase_Core_Log_NetworkAppender.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_TEST_CASE_CORE_LOG_NETWORK_APPENDER_H__
+#define __LLBC_TEST_CASE_CORE_LOG_NETWORK_APPENDER_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Log_NetworkAppender : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Log_NetworkAppender();
+    virtual ~TestCase_Core_Log_NetworkAppender();
+
+public:
+    int Run(int argc, char *argv[]);
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_LOG_NETWORK_APPENDER_H__
@@ -47,6 +47,36 @@ int TestCase_Core_OS_Thread::Run(int argc, char *argv[])
     std::cout <<"OS_Thread test:" <<std::endl;
     std::cout <<"Main thread: " <<LLBC_GetCurrentThread() <<std::endl;
 
+    // CPU/NUMA topology.
+    std::cout <<"CPU count: " <<LLBC_GetCPUCount() <<", NUMA node count: " <<LLBC_GetNUMANodeCount() <<std::endl;
+    for (int node = 0; node < LLBC_GetNUMANodeCount(); ++node)
+    {
+        std::vector<int> cpuNos;
+        if (LLBC_GetNUMANodeCPUs(node, cpuNos) != LLBC_OK)
+            continue;
+
+        std::cout <<"  NUMA node " <<node <<" CPUs:";
+        for (size_t i = 0; i < cpuNos.size(); ++i)
+            std::cout <<" " <<cpuNos[i];
+        std::cout <<std::endl;
+
+        // Bind main thread to node's CPUs, then restore to all CPUs.
+        std::cout <<"  Bind main thread to node " <<node <<": "
+                  <<(LLBC_SetThreadAffinity(LLBC_GetCurrentThread(), cpuNos) == LLBC_OK ? "succeed" : LLBC_FormatLastError())
+                  <<std::endl;
+
+        // Allocate node local memory.
+        const size_t memSize = 1024 * 1024;
+        void *mem = LLBC_NUMAAlloc(memSize, node);
+        std::cout <<"  Alloc " <<memSize <<" bytes on node " <<node <<": " <<(mem ? "succeed" : LLBC_FormatLastError()) <<std::endl;
+        LLBC_NUMAFree(mem, memSize);
+    }
+
+    std::vector<int> allCPUs;
+    for (int cpuNo = 0; cpuNo < LLBC_GetCPUCount(); ++cpuNo)
+        allCPUs.push_back(cpuNo);
+    LLBC_SetThreadAffinity(LLBC_GetCurrentThread(), allCPUs);
+
     //! Non-Win32 specific.
 #if LLBC_TARGET_PLATFORM_NON_WIN32
     std::cout <<"Sched policy SCHED_OTHER value: " <<SCHED_OTHER <<std::endl;
@@ -0,0 +1,134 @@
+/**
+ * @file    TestCase_Core_Sampler_TokenBucket.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/sampler/TestCase_Core_Sampler_TokenBucket.h"
+
+namespace
+{
+
+// The token bucket sampler driven by manual moved clock.
+class FakeClockSampler : public LLBC_TokenBucketSampler
+{
+public:
+    FakeClockSampler()
+    : now(1000000)
+    {
+    }
+
+public:
+    sint64 now;
+
+protected:
+    virtual sint64 GetNowTime() const
+    {
+        return now;
+    }
+};
+
+bool Check(const char *step, sint64 tokens, sint64 expectTokens)
+{
+    LLBC_PrintLine("  %s, tokens: %lld, expect: %lld", step, tokens, expectTokens);
+    return tokens == expectTokens;
+}
+
+}
+
+TestCase_Core_Sampler_TokenBucket::TestCase_Core_Sampler_TokenBucket()
+{
+}
+
+TestCase_Core_Sampler_TokenBucket::~TestCase_Core_Sampler_TokenBucket()
+{
+}
+
+int TestCase_Core_Sampler_TokenBucket::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/sampler/token bucket test:");
+
+    int ret = ClockMovesTest();
+    if (ret == LLBC_OK)
+        ret = RealClockTest();
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Core_Sampler_TokenBucket::ClockMovesTest()
+{
+    LLBC_PrintLine("Clock moves test, rate: 10/s, burst: 20:");
+
+    FakeClockSampler sampler;
+    sampler.SetRate(10, 20);
+
+    bool succeed = Check("Initial", sampler.GetTokens(), 20);
+
+    // Drain bucket.
+    for (int i = 0; i < 20; ++i)
+        sampler.Sampling(1);
+    succeed = succeed &&
+              sampler.Sampling(1) != LLBC_OK &&
+              sampler.GetLimitedTimes() == 1 &&
+              Check("Drained", sampler.GetTokens(), 0);
+
+    // Forward 100 ms, refill 1 token.
+    sampler.now += 100;
+    succeed = succeed &&
+              Check("Forward 100ms", sampler.GetTokens(), 1) &&
+              sampler.Sampling(1) == LLBC_OK &&
+              sampler.Sampling(1) != LLBC_OK;
+
+    // Backward 1 hour, no refill, and refill must not stall until clock caught up.
+    sampler.now -= 3600 * 1000;
+    succeed = succeed && Check("Backward 1 hour", sampler.GetTokens(), 0);
+    sampler.now += 300;
+    succeed = succeed && Check("Backward 1 hour then forward 300ms", sampler.GetTokens(), 3);
+
+    // Forward 1 day, refill clamped to burst(not overflow).
+    sampler.now += 86400 * 1000;
+    succeed = succeed && Check("Forward 1 day", sampler.GetTokens(), 20);
+
+    // Reset refill to full.
+    sampler.Sampling(15);
+    succeed = succeed && Check("Consume 15", sampler.GetTokens(), 5);
+    sampler.Reset();
+    succeed = succeed &&
+              Check("Reset", sampler.GetTokens(), 20) &&
+              sampler.GetLimitedTimes() == 0;
+
+    if (!succeed)
+    {
+        LLBC_PrintLine("Clock moves test failed");
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+int TestCase_Core_Sampler_TokenBucket::RealClockTest()
+{
+    LLBC_PrintLine("Real clock test, rate: 1000/s, burst: 1000:");
+
+    LLBC_TokenBucketSampler sampler;
+    sampler.SetRate(1000);
+    sampler.Sampling(1000);
+
+    // Coarse clock resolution is kernel tick, allow some deviation.
+    LLBC_Sleep(100);
+    const sint64 tokens = sampler.GetTokens();
+    LLBC_PrintLine("  After sleep 100ms, tokens: %lld, expect: [80, 200]", tokens);
+    if (tokens < 80 || tokens > 200)
+    {
+        LLBC_PrintLine("Real clock test failed");
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
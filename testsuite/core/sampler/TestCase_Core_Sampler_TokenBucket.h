@@ -0,0 +1,29 @@
+/**
+ * @file    TestCase_Core_Sampler_TokenBucket.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief   The token bucket sampler test case(refill & clock moves).
+ */
+#ifndef __LLBC_TEST_CASE_CORE_SAMPLER_TOKEN_BUCKET_H__
+#define __LLBC_TEST_CASE_CORE_SAMPLER_TOKEN_BUCKET_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Sampler_TokenBucket : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Sampler_TokenBucket();
+    virtual ~TestCase_Core_Sampler_TokenBucket();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int ClockMovesTest();
+    int RealClockTest();
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_SAMPLER_TOKEN_BUCKET_H__
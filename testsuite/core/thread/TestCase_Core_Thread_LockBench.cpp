@@ -0,0 +1,195 @@
+/**
+ * @file    TestCase_Core_Thread_LockBench.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/thread/TestCase_Core_Thread_LockBench.h"
+
+namespace
+{
+
+const int LockTimesPerThread = 200000;
+const int PingPongTimes = 100000;
+
+struct BenchArg
+{
+    LLBC_ILock *lock;
+    volatile sint64 counter;
+};
+
+/**
+ * Virtual guard, lock/unlock through LLBC_ILock interface.
+ */
+template <typename LockType>
+int VirtualGuardThreadProc(void *arg)
+{
+    BenchArg *benchArg = reinterpret_cast<BenchArg *>(arg);
+    for (int i = 0; i < LockTimesPerThread; ++i)
+    {
+        LLBC_Guard guard(*benchArg->lock);
+        ++benchArg->counter;
+    }
+
+    return 0;
+}
+
+/**
+ * Non-virtual guard, lock/unlock through LLBC_LockGuard<LockType>.
+ */
+template <typename LockType>
+int LockGuardThreadProc(void *arg)
+{
+    BenchArg *benchArg = reinterpret_cast<BenchArg *>(arg);
+    LockType &lock = *static_cast<LockType *>(benchArg->lock);
+    for (int i = 0; i < LockTimesPerThread; ++i)
+    {
+        LLBC_LockGuard<LockType> guard(lock);
+        ++benchArg->counter;
+    }
+
+    return 0;
+}
+
+template <typename LockType>
+bool RunBench(const char *name, LLBC_ThreadProc proc, int threadNum)
+{
+    LockType lock;
+    BenchArg arg;
+    arg.lock = &lock;
+    arg.counter = 0;
+
+    std::vector<LLBC_NativeThreadHandle> handles(threadNum, LLBC_INVALID_NATIVE_THREAD_HANDLE);
+
+    const clock_t begClock = clock();
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < threadNum; ++i)
+        LLBC_CreateThread(&handles[i], proc, &arg);
+    for (int i = 0; i < threadNum; ++i)
+        LLBC_JoinThread(handles[i]);
+
+    const sint64 wallCost = LLBC_GetMicroSeconds() - begTime;
+    const sint64 cpuCost = static_cast<sint64>(clock() - begClock) * 1000000 / CLOCKS_PER_SEC;
+
+    const sint64 expect = static_cast<sint64>(threadNum) * LockTimesPerThread;
+    LLBC_PrintLine("  %-28s wall: %8lld us, cpu: %8lld us, %6.1f ns/op, counter %s",
+                   name,
+                   wallCost,
+                   cpuCost,
+                   wallCost * 1000.0 / expect,
+                   arg.counter == expect ? "ok" : "mismatch");
+
+    return arg.counter == expect;
+}
+
+class PingPong
+{
+public:
+    PingPong()
+    : turn(0)
+    {
+    }
+
+public:
+    void Play(int self)
+    {
+        for (int i = 0; i < PingPongTimes; ++i)
+        {
+            lock.Lock();
+            while (turn != self)
+                cond.Wait(lock);
+
+            turn = 1 - self;
+            lock.Unlock();
+
+            cond.Notify();
+        }
+    }
+
+public:
+    LLBC_AdaptiveLock lock;
+    LLBC_ConditionVariable cond;
+    volatile int turn;
+};
+
+int PingPongThreadProc(void *arg)
+{
+    reinterpret_cast<PingPong *>(arg)->Play(1);
+    return 0;
+}
+
+}
+
+TestCase_Core_Thread_LockBench::TestCase_Core_Thread_LockBench()
+{
+}
+
+TestCase_Core_Thread_LockBench::~TestCase_Core_Thread_LockBench()
+{
+}
+
+int TestCase_Core_Thread_LockBench::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/thread/LockBench test:");
+
+    const int cpuCount = LLBC_GetCPUCount();
+    LLBC_PrintLine("CPU count: %d", cpuCount);
+
+    int ret = LLBC_OK;
+    if (ContentionBench(cpuCount) != LLBC_OK ||
+        ContentionBench(cpuCount * 4) != LLBC_OK ||
+        CVPingPongBench() != LLBC_OK)
+        ret = LLBC_FAILED;
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Core_Thread_LockBench::ContentionBench(int threadNum)
+{
+    LLBC_PrintLine("Contention bench, threads: %d, lock times per thread: %d", threadNum, LockTimesPerThread);
+
+    bool ok = true;
+    ok &= RunBench<LLBC_SpinLock>("SpinLock(Guard)", &VirtualGuardThreadProc<LLBC_SpinLock>, threadNum);
+    ok &= RunBench<LLBC_FastLock>("FastLock(Guard)", &VirtualGuardThreadProc<LLBC_FastLock>, threadNum);
+    ok &= RunBench<LLBC_SimpleLock>("SimpleLock(Guard)", &VirtualGuardThreadProc<LLBC_SimpleLock>, threadNum);
+    ok &= RunBench<LLBC_AdaptiveLock>("AdaptiveLock(Guard)", &VirtualGuardThreadProc<LLBC_AdaptiveLock>, threadNum);
+    ok &= RunBench<LLBC_SpinLock>("SpinLock(LockGuard)", &LockGuardThreadProc<LLBC_SpinLock>, threadNum);
+    ok &= RunBench<LLBC_SimpleLock>("SimpleLock(LockGuard)", &LockGuardThreadProc<LLBC_SimpleLock>, threadNum);
+    ok &= RunBench<LLBC_AdaptiveLock>("AdaptiveLock(LockGuard)", &LockGuardThreadProc<LLBC_AdaptiveLock>, threadNum);
+
+    return ok ? LLBC_OK : LLBC_FAILED;
+}
+
+int TestCase_Core_Thread_LockBench::CVPingPongBench()
+{
+    LLBC_PrintLine("Condition variable ping-pong bench, rounds: %d", PingPongTimes);
+
+    PingPong pingPong;
+    LLBC_NativeThreadHandle handle = LLBC_INVALID_NATIVE_THREAD_HANDLE;
+
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    LLBC_CreateThread(&handle, &PingPongThreadProc, &pingPong);
+    pingPong.Play(0);
+    LLBC_JoinThread(handle);
+
+    const sint64 cost = LLBC_GetMicroSeconds() - begTime;
+    LLBC_PrintLine("  AdaptiveLock + ConditionVariable: %lld us, %.1f ns/round", cost, cost * 1000.0 / PingPongTimes);
+
+    // Timed wait timeout test.
+    pingPong.lock.Lock();
+    const sint64 waitBegTime = LLBC_GetMilliSeconds();
+    const int waitRet = pingPong.cond.TimedWait(pingPong.lock, 50);
+    const sint64 waitCost = LLBC_GetMilliSeconds() - waitBegTime;
+    pingPong.lock.Unlock();
+
+    const bool timedOut = waitRet != LLBC_OK && LLBC_GetLastError() == LLBC_ERROR_TIMEOUT;
+    LLBC_PrintLine("  timed wait 50 ms, timed out: %s, cost: %lld ms", timedOut ? "true" : "false", waitCost);
+
+    return timedOut ? LLBC_OK : LLBC_FAILED;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file    TestCase_Core_Thread_LockBench.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_TEST_CASE_CORE_THREAD_LOCK_BENCH_H__
+#define __LLBC_TEST_CASE_CORE_THREAD_LOCK_BENCH_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Thread_LockBench : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Thread_LockBench();
+    virtual ~TestCase_Core_Thread_LockBench();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int ContentionBench(int threadNum);
+    int CVPingPongBench();
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_THREAD_LOCK_BENCH_H__
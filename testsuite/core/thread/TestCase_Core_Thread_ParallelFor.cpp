@@ -0,0 +1,310 @@
+/**
+ * @file    TestCase_Core_Thread_ParallelFor.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/thread/TestCase_Core_Thread_ParallelFor.h"
+
+namespace
+{
+
+const int EntityCount = 50000;
+const int UpdateLoops = 200;
+
+struct Entity
+{
+    double x;
+    double y;
+    double speed;
+    int updateTimes;
+};
+
+void UpdateEntity(Entity &entity)
+{
+    for (int i = 0; i < UpdateLoops; ++i)
+    {
+        entity.x += entity.speed * 0.001;
+        entity.y += entity.x * 0.0001;
+    }
+
+    ++entity.updateTimes;
+}
+
+class EntityUpdater
+{
+public:
+    explicit EntityUpdater(std::vector<Entity> &entities)
+    : entities(entities)
+    {
+    }
+
+public:
+    void Update(int idx)
+    {
+        UpdateEntity(entities[idx]);
+    }
+
+public:
+    std::vector<Entity> &entities;
+};
+
+struct EntityUpdateFunc
+{
+    void operator ()(Entity &entity)
+    {
+        UpdateEntity(entity);
+    }
+};
+
+struct ReciprocalMapFunc
+{
+    double operator ()(int idx)
+    {
+        return 1.0 / (static_cast<double>(idx) + 1.0);
+    }
+};
+
+struct SumReduceFunc
+{
+    double operator ()(const double &left, const double &right)
+    {
+        return left + right;
+    }
+};
+
+struct CountMapFunc
+{
+    sint64 operator ()(int idx)
+    {
+        return idx;
+    }
+};
+
+struct CountReduceFunc
+{
+    sint64 operator ()(const sint64 &left, const sint64 &right)
+    {
+        return left + right;
+    }
+};
+
+class NestedJob
+{
+public:
+    explicit NestedJob(LLBC_ThreadPool *pool)
+    : pool(pool)
+    , entities(EntityCount / 10)
+    {
+    }
+
+public:
+    void Run()
+    {
+        // Parallel for in worker thread, worker participate and join.
+        EntityUpdater updater(entities);
+        LLBC_ParallelFor(*pool, 0, static_cast<int>(entities.size()), &updater, &EntityUpdater::Update);
+    }
+
+public:
+    LLBC_ThreadPool *pool;
+    std::vector<Entity> entities;
+};
+
+void InitEntities(std::vector<Entity> &entities)
+{
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        Entity &entity = entities[i];
+        entity.x = static_cast<double>(i);
+        entity.y = 0.0;
+        entity.speed = static_cast<double>(i % 100);
+        entity.updateTimes = 0;
+    }
+}
+
+bool SameEntities(const std::vector<Entity> &left, const std::vector<Entity> &right)
+{
+    if (left.size() != right.size())
+        return false;
+
+    for (size_t i = 0; i < left.size(); ++i)
+    {
+        if (left[i].x != right[i].x ||
+            left[i].y != right[i].y ||
+            left[i].updateTimes != right[i].updateTimes)
+            return false;
+    }
+
+    return true;
+}
+
+}
+
+TestCase_Core_Thread_ParallelFor::TestCase_Core_Thread_ParallelFor()
+{
+}
+
+TestCase_Core_Thread_ParallelFor::~TestCase_Core_Thread_ParallelFor()
+{
+}
+
+int TestCase_Core_Thread_ParallelFor::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/thread/ParallelFor test:");
+
+    LLBC_ThreadPool pool;
+    if (pool.Start() != LLBC_OK)
+    {
+        LLBC_PrintLine("Start thread pool failed, error: %s", LLBC_FormatLastError());
+        return LLBC_FAILED;
+    }
+
+    LLBC_PrintLine("Thread pool started, workers: %d", pool.GetThreadCount());
+
+    int ret = LLBC_OK;
+    if (ForTest(pool) != LLBC_OK ||
+        ForEachTest(pool) != LLBC_OK ||
+        ReduceTest(pool) != LLBC_OK ||
+        NestedTest(pool) != LLBC_OK)
+        ret = LLBC_FAILED;
+
+    pool.Stop();
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Core_Thread_ParallelFor::ForTest(LLBC_ThreadPool &pool)
+{
+    LLBC_PrintLine("Parallel for %d entities test:", EntityCount);
+
+    std::vector<Entity> serialEntities(EntityCount);
+    InitEntities(serialEntities);
+
+    sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < EntityCount; ++i)
+        UpdateEntity(serialEntities[i]);
+    const sint64 serialCost = LLBC_GetMicroSeconds() - begTime;
+
+    std::vector<Entity> entities(EntityCount);
+    InitEntities(entities);
+
+    EntityUpdater updater(entities);
+    begTime = LLBC_GetMicroSeconds();
+    LLBC_ParallelFor(pool, 0, EntityCount, &updater, &EntityUpdater::Update);
+    const sint64 parallelCost = LLBC_GetMicroSeconds() - begTime;
+
+    const bool same = SameEntities(serialEntities, entities);
+    LLBC_PrintLine("  serial cost: %lld us, parallel cost: %lld us, result same: %s",
+                   serialCost, parallelCost, same ? "true" : "false");
+
+    // Grain size control: grain size 1 & grain size greater than range.
+    InitEntities(entities);
+    LLBC_ParallelFor(pool, 0, EntityCount, &updater, &EntityUpdater::Update, 1);
+    const bool sameGrain1 = SameEntities(serialEntities, entities);
+
+    InitEntities(entities);
+    LLBC_ParallelFor(pool, 0, EntityCount, &updater, &EntityUpdater::Update, EntityCount * 2);
+    const bool sameGrainAll = SameEntities(serialEntities, entities);
+
+    LLBC_PrintLine("  grain size 1 result same: %s, grain size %d result same: %s",
+                   sameGrain1 ? "true" : "false", EntityCount * 2, sameGrainAll ? "true" : "false");
+
+    return same && sameGrain1 && sameGrainAll ? LLBC_OK : LLBC_FAILED;
+}
+
+int TestCase_Core_Thread_ParallelFor::ForEachTest(LLBC_ThreadPool &pool)
+{
+    LLBC_PrintLine("Parallel for each test:");
+
+    std::vector<Entity> serialEntities(EntityCount);
+    InitEntities(serialEntities);
+    for (int i = 0; i < EntityCount; ++i)
+        UpdateEntity(serialEntities[i]);
+
+    std::vector<Entity> entities(EntityCount);
+    InitEntities(entities);
+
+    EntityUpdateFunc func;
+    LLBC_ParallelForEach(pool, entities.begin(), entities.end(), func, 512);
+
+    const bool same = SameEntities(serialEntities, entities);
+    LLBC_PrintLine("  result same: %s", same ? "true" : "false");
+
+    return same ? LLBC_OK : LLBC_FAILED;
+}
+
+int TestCase_Core_Thread_ParallelFor::ReduceTest(LLBC_ThreadPool &pool)
+{
+    LLBC_PrintLine("Parallel reduce test:");
+
+    const int n = 1000000;
+
+    CountMapFunc countMap;
+    CountReduceFunc countReduce;
+    const sint64 count = LLBC_ParallelReduce(pool, 0, n, static_cast<sint64>(0), countMap, countReduce);
+    const sint64 expect = static_cast<sint64>(n) * (n - 1) / 2;
+    LLBC_PrintLine("  integer sum: %lld, expect: %lld", count, expect);
+    if (count != expect)
+        return LLBC_FAILED;
+
+    // Floating point sum, same grain size must get same result in every run.
+    ReciprocalMapFunc mapFunc;
+    SumReduceFunc reduceFunc;
+    const double first = LLBC_ParallelReduce(pool, 0, n, 0.0, mapFunc, reduceFunc, 1024);
+    for (int i = 0; i < 20; ++i)
+    {
+        const double result = LLBC_ParallelReduce(pool, 0, n, 0.0, mapFunc, reduceFunc, 1024);
+        if (result != first)
+        {
+            LLBC_PrintLine("  floating sum not deterministic, first: %.17g, now: %.17g", first, result);
+            return LLBC_FAILED;
+        }
+    }
+
+    LLBC_PrintLine("  floating sum: %.17g, deterministic in 20 runs", first);
+
+    return LLBC_OK;
+}
+
+int TestCase_Core_Thread_ParallelFor::NestedTest(LLBC_ThreadPool &pool)
+{
+    LLBC_PrintLine("Nested parallel for test:");
+
+    std::vector<NestedJob> jobs(pool.GetThreadCount() * 2, NestedJob(&pool));
+    std::vector<LLBC_Future> futures(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        InitEntities(jobs[i].entities);
+        futures[i] = pool.Submit(&jobs[i], &NestedJob::Run);
+    }
+
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        if (futures[i].Wait(10000) != LLBC_OK)
+        {
+            LLBC_PrintLine("  nested job %lu timeout", i);
+            return LLBC_FAILED;
+        }
+
+        const std::vector<Entity> &entities = jobs[i].entities;
+        for (size_t j = 0; j < entities.size(); ++j)
+        {
+            if (entities[j].updateTimes != 1)
+            {
+                LLBC_PrintLine("  nested job %lu entity %lu update times: %d", i, j, entities[j].updateTimes);
+                return LLBC_FAILED;
+            }
+        }
+    }
+
+    LLBC_PrintLine("  all %lu nested jobs done", jobs.size());
+
+    return LLBC_OK;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file    TestCase_Core_Thread_ParallelFor.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_TEST_CASE_CORE_THREAD_PARALLEL_FOR_H__
+#define __LLBC_TEST_CASE_CORE_THREAD_PARALLEL_FOR_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Thread_ParallelFor : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Thread_ParallelFor();
+    virtual ~TestCase_Core_Thread_ParallelFor();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int ForTest(LLBC_ThreadPool &pool);
+    int ForEachTest(LLBC_ThreadPool &pool);
+    int ReduceTest(LLBC_ThreadPool &pool);
+    int NestedTest(LLBC_ThreadPool &pool);
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_THREAD_PARALLEL_FOR_H__
@@ -0,0 +1,285 @@
+/**
+ * @file    TestCase_Core_Thread_ThreadPool.cpp
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/thread/TestCase_Core_Thread_ThreadPool.h"
+
+namespace
+{
+
+const int JobCount = 1000;
+const int JobRange = 10000;
+
+class SumJob
+{
+public:
+    SumJob()
+    : from(0)
+    , to(0)
+    , sum(0)
+    {
+    }
+
+public:
+    void Run()
+    {
+        for (sint64 i = from; i < to; ++i)
+            sum += i;
+    }
+
+public:
+    sint64 from;
+    sint64 to;
+    sint64 sum;
+};
+
+class NestedJob
+{
+public:
+    explicit NestedJob(LLBC_ThreadPool *pool)
+    : pool(pool)
+    , sum(0)
+    {
+    }
+
+public:
+    void Run()
+    {
+        // Fan out children in worker thread, wait children will help run pool tasks.
+        SumJob children[8];
+        LLBC_Future futures[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            children[i].from = i * JobRange;
+            children[i].to = (i + 1) * JobRange;
+            futures[i] = pool->Submit(&children[i], &SumJob::Run);
+        }
+
+        for (int i = 0; i < 8; ++i)
+        {
+            futures[i].Wait();
+            sum += children[i].sum;
+        }
+    }
+
+public:
+    LLBC_ThreadPool *pool;
+    sint64 sum;
+};
+
+class SubmitWhenStopJob
+{
+public:
+    explicit SubmitWhenStopJob(LLBC_ThreadPool *pool)
+    : pool(pool)
+    , rejected(false)
+    {
+    }
+
+public:
+    void Run()
+    {
+        // Wait pool stopping, then submit child, child must be rejected.
+        for (int i = 0; i < 100 && pool->GetPendingTaskCount() > 0; ++i)
+            LLBC_Sleep(10);
+        LLBC_Sleep(50);
+
+        SumJob child;
+        rejected = !pool->Submit(&child, &SumJob::Run).IsValid();
+    }
+
+public:
+    LLBC_ThreadPool *pool;
+    volatile bool rejected;
+};
+
+class TestFacade : public LLBC_IFacade
+{
+public:
+    TestFacade()
+    : svcThread(LLBC_INVALID_NATIVE_THREAD_HANDLE)
+    , doneThread(LLBC_INVALID_NATIVE_THREAD_HANDLE)
+    , done(false)
+    {
+    }
+
+public:
+    virtual void OnUpdate()
+    {
+        svcThread = LLBC_GetCurrentThread();
+    }
+
+    void OnJobDone()
+    {
+        doneThread = LLBC_GetCurrentThread();
+        done = true;
+    }
+
+public:
+    volatile LLBC_NativeThreadHandle svcThread;
+    volatile LLBC_NativeThreadHandle doneThread;
+    volatile bool done;
+};
+
+}
+
+TestCase_Core_Thread_ThreadPool::TestCase_Core_Thread_ThreadPool()
+{
+}
+
+TestCase_Core_Thread_ThreadPool::~TestCase_Core_Thread_ThreadPool()
+{
+}
+
+int TestCase_Core_Thread_ThreadPool::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/thread/ThreadPool test:");
+
+    LLBC_ThreadPool pool;
+    if (pool.Start() != LLBC_OK)
+    {
+        LLBC_PrintLine("Start thread pool failed, error: %s", LLBC_FormatLastError());
+        return LLBC_FAILED;
+    }
+
+    LLBC_PrintLine("Thread pool started, workers: %d", pool.GetThreadCount());
+
+    int ret = LLBC_OK;
+    if (FanOutTest(pool) != LLBC_OK ||
+        NestedTest(pool) != LLBC_OK ||
+        ServiceContinuationTest(pool) != LLBC_OK)
+        ret = LLBC_FAILED;
+
+    pool.Stop();
+
+    if (StopTest() != LLBC_OK)
+        ret = LLBC_FAILED;
+
+    LLBC_PrintLine("Press any key to continue ...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Core_Thread_ThreadPool::FanOutTest(LLBC_ThreadPool &pool)
+{
+    LLBC_PrintLine("Fan out %d jobs test:", JobCount);
+
+    std::vector<SumJob> jobs(JobCount);
+    std::vector<LLBC_Future> futures(JobCount);
+
+    const sint64 begTime = LLBC_GetMicroSeconds();
+    for (int i = 0; i < JobCount; ++i)
+    {
+        jobs[i].from = static_cast<sint64>(i) * JobRange;
+        jobs[i].to = static_cast<sint64>(i + 1) * JobRange;
+        futures[i] = pool.Submit(&jobs[i], &SumJob::Run);
+    }
+
+    sint64 sum = 0;
+    for (int i = 0; i < JobCount; ++i)
+    {
+        futures[i].Wait();
+        sum += jobs[i].sum;
+    }
+
+    const sint64 n = static_cast<sint64>(JobCount) * JobRange;
+    const sint64 expect = n * (n - 1) / 2;
+    LLBC_PrintLine("  sum: %lld, expect: %lld, cost: %lld us", sum, expect, LLBC_GetMicroSeconds() - begTime);
+
+    return sum == expect ? LLBC_OK : LLBC_FAILED;
+}
+
+int TestCase_Core_Thread_ThreadPool::NestedTest(LLBC_ThreadPool &pool)
+{
+    LLBC_PrintLine("Nested submit & wait test:");
+
+    std::vector<NestedJob> jobs(pool.GetThreadCount() * 2, NestedJob(&pool));
+    std::vector<LLBC_Future> futures(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i)
+        futures[i] = pool.Submit(&jobs[i], &NestedJob::Run);
+
+    const sint64 n = 8 * JobRange;
+    const sint64 expect = n * (n - 1) / 2;
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        if (futures[i].Wait(10000) != LLBC_OK || jobs[i].sum != expect)
+        {
+            LLBC_PrintLine("  nested job %lu failed, sum: %lld, expect: %lld", i, jobs[i].sum, expect);
+            return LLBC_FAILED;
+        }
+    }
+
+    LLBC_PrintLine("  all %lu nested jobs done", jobs.size());
+
+    return LLBC_OK;
+}
+
+int TestCase_Core_Thread_ThreadPool::ServiceContinuationTest(LLBC_ThreadPool &pool)
+{
+    LLBC_PrintLine("Continuation post back to service test:");
+
+    LLBC_IService *svc = LLBC_IService::Create(LLBC_IService::Normal, "ThreadPoolTest");
+    TestFacade *facade = LLBC_New(TestFacade);
+    svc->RegisterFacade(facade);
+    svc->Start();
+
+    SumJob job;
+    job.to = JobRange;
+
+    LLBC_Future future = pool.Submit(&job, &SumJob::Run);
+    future.Then(facade, &TestFacade::OnJobDone, svc->GetExecutor());
+
+    for (int i = 0; i < 100 && !facade->done; ++i)
+        LLBC_Sleep(10);
+
+    const bool inSvcThread = facade->done && facade->doneThread == facade->svcThread;
+    LLBC_PrintLine("  continuation done: %s, run in service thread: %s",
+                   facade->done ? "true" : "false", inSvcThread ? "true" : "false");
+
+    LLBC_Delete(svc);
+
+    return inSvcThread ? LLBC_OK : LLBC_FAILED;
+}
+
+int TestCase_Core_Thread_ThreadPool::StopTest()
+{
+    LLBC_PrintLine("Stop with queued tasks test:");
+
+    LLBC_ThreadPool pool;
+    if (pool.Start(2) != LLBC_OK)
+    {
+        LLBC_PrintLine("  start thread pool failed, error: %s", LLBC_FormatLastError());
+        return LLBC_FAILED;
+    }
+
+    SubmitWhenStopJob stopJob(&pool);
+    LLBC_Future stopFuture = pool.Submit(&stopJob, &SubmitWhenStopJob::Run);
+
+    std::vector<SumJob> jobs(JobCount);
+    std::vector<LLBC_Future> futures(JobCount);
+    for (int i = 0; i < JobCount; ++i)
+    {
+        jobs[i].to = JobRange;
+        futures[i] = pool.Submit(&jobs[i], &SumJob::Run);
+    }
+
+    pool.Stop();
+
+    int doneCount = stopFuture.IsDone() ? 1 : 0;
+    for (int i = 0; i < JobCount; ++i)
+        doneCount += futures[i].IsDone() ? 1 : 0;
+
+    SumJob afterStopJob;
+    const bool afterStopRejected = !pool.Submit(&afterStopJob, &SumJob::Run).IsValid();
+
+    LLBC_PrintLine("  done futures: %d/%d, submit when stopping rejected: %s, submit after stopped rejected: %s",
+                   doneCount, JobCount + 1, stopJob.rejected ? "true" : "false", afterStopRejected ? "true" : "false");
+
+    return doneCount == JobCount + 1 && stopJob.rejected && afterStopRejected ? LLBC_OK : LLBC_FAILED;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file    TestCase_Core_Thread_ThreadPool.h
+ * @author  Longwei Lai<lailongwei@126.com>
+ * @date    2026/10/19
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_TEST_CASE_CORE_THREAD_THREAD_POOL_H__
+#define __LLBC_TEST_CASE_CORE_THREAD_THREAD_POOL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Thread_ThreadPool : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Thread_ThreadPool();
+    virtual ~TestCase_Core_Thread_ThreadPool();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int FanOutTest(LLBC_ThreadPool &pool);
+    int NestedTest(LLBC_ThreadPool &pool);
+    int ServiceContinuationTest(LLBC_ThreadPool &pool);
+    int StopTest();
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_THREAD_THREAD_POOL_H__
@@ -9,6 +9,35 @@
 
 #include "core/time/TestCase_Core_Time_Time.h"
 
+namespace
+{
+
+// The simulated cached time refresh tick period(service frame interval), in milli-seconds.
+const int TickPeriod = 10;
+
+const int RefresherCount = 4;
+const int RefreshTimes = 100000;
+
+volatile bool cachedTimeGoBack = false;
+
+int CachedTimeRefresher(void *arg)
+{
+    sint64 prev = LLBC_GetCachedMilliSeconds();
+    for (int i = 0; i < RefreshTimes; ++i)
+    {
+        LLBC_UpdateCachedMilliSeconds();
+        const sint64 cached = LLBC_GetCachedMilliSeconds();
+        if (cached < prev)
+            cachedTimeGoBack = true;
+
+        prev = cached;
+    }
+
+    return 0;
+}
+
+}
+
 TestCase_Core_Time_Time::TestCase_Core_Time_Time()
 {
 }
@@ -21,7 +50,7 @@ int TestCase_Core_Time_Time::Run(int argc, char *argv[])
 {
     std::cout <<"core/time/time test: " <<std::endl;
 
-    OSTimeTest();
+    int ret = OSTimeTest();
     std::cout <<std::endl;
 
     TimeClassTest();
@@ -30,10 +59,10 @@ int TestCase_Core_Time_Time::Run(int argc, char *argv[])
     std::cout <<"Press any key to continue ... ..." <<std::endl;
     getchar();
 
-    return 0;
+    return ret;
 }
 
-void TestCase_Core_Time_Time::OSTimeTest()
+int TestCase_Core_Time_Time::OSTimeTest()
 {
     std::cout <<"OS_Time part test: " <<std::endl;
 
@@ -42,6 +71,13 @@ void TestCase_Core_Time_Time::OSTimeTest()
     std::cout <<"LLBC_GetMilliSeconds(): "<<nowTimeInMs <<std::endl;
     sint64 nowTimeInUs = LLBC_GetMicroSeconds();
     std::cout <<"LLBC_GetMicroSeconds(): " <<nowTimeInUs <<std::endl;
+    std::cout <<"LLBC_GetCoarseMilliSeconds(): " <<LLBC_GetCoarseMilliSeconds() <<std::endl;
+    std::cout <<"LLBC_GetMonotonicMicroSeconds(): " <<LLBC_GetMonotonicMicroSeconds() <<std::endl;
+    std::cout <<"LLBC_GetCoarseMonotonicMilliSeconds(): " <<LLBC_GetCoarseMonotonicMilliSeconds() <<std::endl;
+    std::cout <<"LLBC_UpdateCachedMilliSeconds(): " <<LLBC_UpdateCachedMilliSeconds() <<std::endl;
+    LLBC_Sleep(10);
+    std::cout <<"After sleep 10 ms, LLBC_GetCachedMilliSeconds()(must not changed): " 
+        <<LLBC_GetCachedMilliSeconds() <<std::endl;
 
     struct timeval tv;
     LLBC_GetTimeOfDay(&tv, NULL);
@@ -50,6 +86,48 @@ void TestCase_Core_Time_Time::OSTimeTest()
     gettimeofday(&tv, NULL);
     std::cout <<"WIN32 spec: gettimeofday(), tv_sec: " <<tv.tv_sec <<", tv_usec: " <<tv.tv_usec <<std::endl;
 #endif
+
+    return CachedTimeTest();
+}
+
+int TestCase_Core_Time_Time::CachedTimeTest()
+{
+    std::cout <<"Cached time test, tick period: " <<TickPeriod <<" ms" <<std::endl;
+
+    // Single refresher: cached time monotonic, and within one tick period of real clock between two refreshes.
+    bool monotonic = true;
+    bool inTickPeriod = true;
+    sint64 prev = LLBC_UpdateCachedMilliSeconds();
+    for (int i = 0; i < 20; ++i)
+    {
+        LLBC_Sleep(TickPeriod / 2);
+
+        const sint64 cached = LLBC_GetCachedMilliSeconds();
+        const sint64 diff = LLBC_GetMilliSeconds() - cached;
+        if (diff < 0 || diff > TickPeriod)
+        {
+            std::cout <<"  cached time not in tick period, cached: " <<cached <<", diff: " <<diff <<std::endl;
+            inTickPeriod = false;
+        }
+
+        const sint64 refreshed = LLBC_UpdateCachedMilliSeconds();
+        if (refreshed < prev)
+            monotonic = false;
+
+        prev = refreshed;
+    }
+
+    // Multi refreshers: cached time never go back.
+    cachedTimeGoBack = false;
+    LLBC_Handle group = LLBC_ThreadManagerSingleton->CreateThreads(RefresherCount, &CachedTimeRefresher, NULL);
+    if (group != LLBC_INVALID_HANDLE)
+        LLBC_ThreadManagerSingleton->WaitGroup(group);
+
+    std::cout <<"  in tick period: " <<(inTickPeriod ? "true" : "false")
+        <<", monotonic: " <<(monotonic ? "true" : "false")
+        <<", multi refreshers monotonic: " <<(!cachedTimeGoBack ? "true" : "false") <<std::endl;
+
+    return inTickPeriod && monotonic && !cachedTimeGoBack && group != LLBC_INVALID_HANDLE ? 0 : -1;
 }
 
 void TestCase_Core_Time_Time::TimeClassTest()
@@ -22,7 +22,8 @@ public:
     virtual int Run(int argc, char *argv[]);
 
 private:
-    void OSTimeTest();
+    int OSTimeTest();
+    int CachedTimeTest();
 
     void TimeClassTest();
 
@@ -0,0 +1,189 @@
+# -*- coding: utf-8 -*-
+"""
+llbc binary log file decoder, decode binary log file(logger config: binaryMode=true, binaryLogFile=xxx)
+to text log.
+Usage: python blog_decoder.py <binary log file> [output file]
+"""
+
+import re
+import sys
+import struct
+import time
+
+# Binary log file magic and version.
+FILE_MAGIC = b'LLBCBLOG'
+FILE_VERSION = 1
+
+# Argument types, see LLBC_LogArgType.
+ARG_INT32 = 1
+ARG_INT64 = 2
+ARG_DOUBLE = 3
+ARG_LONG_DOUBLE = 4
+ARG_STRING = 5
+ARG_POINTER = 6
+
+# Log levels, see LLBC_LogLevel.
+LEVEL_NAMES = ['DEBUG', 'INFO', 'WARN', 'ERROR', 'FATAL']
+
+# LLBC_LogBinaryRecord: fmtId(sint32), argsLen(uint32), logTime(sint64), threadHandle(uint64).
+RECORD_FMT = '=iIqQ'
+RECORD_SIZE = struct.calcsize(RECORD_FMT)
+
+# Conversion spec: %[flags][width][.precision][length]conversion.
+SPEC_RE = re.compile(r"%([-+ #0']*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|L|q|j|z|t|I64|I32|I)?([diouxXceEfFgGaAsp%])")
+
+
+class BinaryLogReader(object):
+    def __init__(self, data):
+        self._data = data
+        self._pos = 0
+
+    def eof(self):
+        return self._pos >= len(self._data)
+
+    def read(self, size):
+        if self._pos + size > len(self._data):
+            raise EOFError('binary log file truncated')
+        buf = self._data[self._pos:self._pos + size]
+        self._pos += size
+        return buf
+
+    def unpack(self, fmt):
+        return struct.unpack(fmt, self.read(struct.calcsize(fmt)))
+
+    def read_str(self):
+        (length,) = self.unpack('=I')
+        return self.read(length).decode('utf-8', 'replace')
+
+
+class FormatInfo(object):
+    def __init__(self, fmt_id, level, line, tag, file_name, fmt, arg_types):
+        self.fmt_id = fmt_id
+        self.level = level
+        self.line = line
+        self.tag = tag
+        self.file_name = file_name
+        self.fmt = fmt
+        self.arg_types = arg_types
+
+    def format(self, args_data):
+        reader = BinaryLogReader(args_data)
+        values = []
+        for arg_type in self.arg_types:
+            if arg_type == ARG_INT32:
+                values.append(reader.unpack('=i')[0])
+            elif arg_type == ARG_INT64:
+                values.append(reader.unpack('=q')[0])
+            elif arg_type in (ARG_DOUBLE, ARG_LONG_DOUBLE):
+                values.append(reader.unpack('=d')[0])
+            elif arg_type == ARG_STRING:
+                values.append(reader.read_str())
+            else:
+                values.append(reader.unpack('=Q')[0])
+
+        values.reverse()
+        arg_types = list(reversed(self.arg_types))
+
+        def _replace(m):
+            flags, width, precision, length, conv = m.groups()
+            if conv == '%':
+                return '%'
+
+            flags = flags.replace("'", '')
+            if width == '*':
+                arg_types.pop()
+                width = str(values.pop())
+            if precision == '*':
+                arg_types.pop()
+                precision = str(values.pop())
+
+            arg_type = arg_types.pop()
+            value = values.pop()
+            spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+
+            bits = 64 if arg_type == ARG_INT64 else 32
+            if length == 'h':
+                bits = 16
+            elif length == 'hh':
+                bits = 8
+
+            if conv in 'di':
+                value &= (1 << bits) - 1
+                if value >= 1 << (bits - 1):
+                    value -= 1 << bits
+                return (spec + 'd') % value
+            elif conv in 'ouxX':
+                value &= (1 << bits) - 1
+                return (spec + ('d' if conv == 'u' else conv)) % value
+            elif conv == 'c':
+                return (spec + 'c') % chr(value & 0xff)
+            elif conv in 'aA':
+                return value.hex() if conv == 'a' else value.hex().upper()
+            elif conv == 'p':
+                return (spec + 's') % ('0x%x' % value if value else '(nil)')
+            elif conv == 's':
+                return (spec + 's') % value
+
+            return (spec + conv) % value
+
+        return SPEC_RE.sub(_replace, self.fmt)
+
+
+def decode(data, out):
+    reader = BinaryLogReader(data)
+    if reader.read(len(FILE_MAGIC)) != FILE_MAGIC:
+        raise ValueError('not a llbc binary log file')
+
+    (version,) = reader.unpack('=I')
+    if version != FILE_VERSION:
+        raise ValueError('unsupported binary log file version: %d' % version)
+
+    logger_name = reader.read_str()
+
+    fmts = {}
+    while not reader.eof():
+        entry_type = reader.read(1)
+        if entry_type == b'F':
+            fmt_id, level, line = reader.unpack('=iii')
+            tag = reader.read_str()
+            file_name = reader.read_str()
+            fmt = reader.read_str()
+            (arg_count,) = reader.unpack('=I')
+            arg_types = list(struct.unpack('=%dB' % arg_count, reader.read(arg_count)))
+            fmts[fmt_id] = FormatInfo(fmt_id, level, line, tag, file_name, fmt, arg_types)
+        elif entry_type == b'R':
+            fmt_id, args_len, log_time, thread_handle = reader.unpack(RECORD_FMT)
+            args_data = reader.read(args_len)
+
+            info = fmts.get(fmt_id)
+            if info is None:
+                raise ValueError('format %d not found' % fmt_id)
+
+            time_str = time.strftime('%Y-%m-%d %H:%M:%S', time.localtime(log_time // 1000))
+            level_name = LEVEL_NAMES[info.level] if 0 <= info.level < len(LEVEL_NAMES) else str(info.level)
+            out.write('%s.%03d %s:%d@[%s][%s][%s][%d] - %s\n' % (
+                time_str, log_time % 1000, info.file_name, info.line,
+                logger_name, level_name, info.tag, thread_handle, info.format(args_data)))
+        else:
+            raise ValueError('unknown entry type: %r' % entry_type)
+
+
+def main():
+    if len(sys.argv) < 2:
+        print('Usage: python %s <binary log file> [output file]' % sys.argv[0])
+        return 1
+
+    with open(sys.argv[1], 'rb') as f:
+        data = f.read()
+
+    if len(sys.argv) > 2:
+        with open(sys.argv[2], 'w') as out:
+            decode(data, out)
+    else:
+        decode(data, sys.stdout)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -179,7 +179,8 @@ int csllbc_Service_Multicast(csllbc_Service *svc,
     for (int idx = 0; idx < sessionIdCount; idx++)
         sessionIdList.push_back(sessionIds[idx]);
 
-    LLBC_XFree(sessionIds);
+    // Session Ids allocated by managed code(Marshal.AllocHGlobal()), not by LLBC_Malloc().
+    free(sessionIds);
     
     return svc->Multicast(sessionIdList, opcode, data, static_cast<size_t>(dataLen), status);
 }
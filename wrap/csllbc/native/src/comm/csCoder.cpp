@@ -49,7 +49,7 @@ bool csllbc_Coder::Encode(LLBC_Packet &packet)
         if (data)
         {
             packet.SetCodecError(LLBC_String(reinterpret_cast<char *>(data), errMsgLen));
-            LLBC_Free(data);
+            free(data); // Allocated by managed code(Marshal.AllocHGlobal()), not by LLBC_Malloc().
         }
 
         return false;
@@ -59,7 +59,7 @@ bool csllbc_Coder::Encode(LLBC_Packet &packet)
     if (data)
     {
         packet.Write(data, encodedLen);
-        LLBC_Free(data);
+        free(data);
     }
 
     return true;
@@ -79,7 +79,7 @@ bool csllbc_Coder::Decode(LLBC_Packet &packet)
         return true;
 
     packet.SetCodecError(LLBC_String(reinterpret_cast<char *>(decodeRet), errMsgLen));
-    LLBC_Free(decodeRet);
+    free(decodeRet); // Allocated by managed code(Marshal.AllocHGlobal()), not by LLBC_Malloc().
 
     return false;
 }
@@ -38,7 +38,8 @@ char *csllbc_PInvokeUtil::BuildCSharpStr(const char *nativeStr, size_t nativeStr
     if (UNLIKELY(nativeStr == NULL || nativeStrLen == 0))
         return NULL;
 
-    char *csStr = LLBC_Malloc(char, nativeStrLen);
+    // C# string will be freed by managed code(Marshal.FreeHGlobal()), must allocate by malloc().
+    char *csStr = reinterpret_cast<char *>(malloc(nativeStrLen));
     LLBC_MemCpy(csStr, nativeStr, nativeStrLen);
 
     return csStr;
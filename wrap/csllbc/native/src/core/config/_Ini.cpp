@@ -104,13 +104,14 @@ void csllbc_Ini_FreeNativeSections(csllbc_Ini_IniSection *sections, int sectionC
     for (int sectionIdx = 0; sectionIdx < sectionCount; sectionIdx++)
     {
         csllbc_Ini_IniSection &section = sections[sectionIdx];
-        LLBC_Free(section.sectionName);
+        // Section name, keys & values built by csllbc_PInvokeUtil::BuildCSharpStr(), allocated by malloc().
+        free(section.sectionName);
 
         int valueCount = section.count;
         for (int valueIdx = 0; valueIdx < valueCount; valueIdx++)
         {
-            LLBC_Free(section.keys[valueIdx]);
-            LLBC_XFree(section.values[valueIdx]);
+            free(section.keys[valueIdx]);
+            free(section.values[valueIdx]);
         }
 
         if (valueCount > 0)